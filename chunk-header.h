@@ -0,0 +1,342 @@
+/* *
+ * chunk-header.h - self-describing header at the front of every chunk file.
+ *
+ * Each of the k+m files starts with hdr_size bytes of header: the fixed
+ * fields below, then an offset table of one entry per sub-chunk giving the
+ * position of sub-chunk j inside one read-in (relative to
+ * hdr_size + (n-1)*M*blocksize), then, if CHUNK_CRC32C is set, the CRC32C
+ * of every sub-chunk in the file, read-in by read-in.
+ * Objects streamed in with an unknown length (CHUNK_TRAILER) are written
+ * strictly sequentially instead: the header carries no size, read-in count
+ * or CRCs, and they follow the last read-in as a trailer, the CRC table
+ * then a chunk_trailer at the very end of the file.  The last read-in of
+ * a stream is only as long as the data it holds: its sub-chunks are
+ * lastbs bytes instead of blocksize, in the same order, and lastbs is in
+ * the trailer.
+ * hdr_size is a multiple of CHUNK_IO_ALIGN so that O_DIRECT sub-chunk I/O
+ * stays aligned.  A decoder only needs to read the header of any one
+ * surviving chunk to know the whole layout; there is no _meta.txt.
+ *
+ * Fields are stored in host byte order.
+ */
+
+#ifndef _CHUNK_HEADER_H
+#define _CHUNK_HEADER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <glob.h>
+#include "chunk-io.h"
+
+#define CHUNK_MAGIC "JMCHUNK"		/* 8 bytes including the '\0' */
+#define CHUNK_VERSION 1
+
+#define CHUNK_CRC32C 1			/* flags: a CRC32C table follows the offsets */
+#define CHUNK_TRAILER 2			/* flags: size, readins and CRCs are in the trailer */
+
+#define CHUNK_TRAILER_MAGIC "JMTRAIL"
+
+enum Chunk_Family {Chunk_Mul = 1, Chunk_Clay = 2};
+
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t hdr_size;		/* bytes in front of the first sub-chunk */
+	uint32_t family;		/* enum Chunk_Family */
+	uint32_t k, m, d, w;		/* d = helpers contacted by a repair */
+	uint32_t subchunks;		/* sub-chunks per read-in in this file */
+	uint32_t tech;			/* enum Coding_Technique */
+	uint32_t packetsize;
+	uint32_t index;			/* 0..k-1 data, k..k+m-1 coding */
+	uint32_t readins;
+	uint32_t flags;
+	uint64_t blocksize;		/* sub-chunk size */
+	uint64_t buffersize;
+	uint64_t size;			/* object size before padding */
+	uint64_t lastbs;		/* sub-chunk size of the last read-in; not stored */
+} chunk_header;
+
+/* Bytes of a chunk_header in the file: lastbs only comes from the trailer */
+#define CHUNK_HEADER_STORED offsetof(chunk_header, lastbs)
+
+typedef struct {
+	uint64_t size;			/* object size before padding */
+	uint32_t readins;
+	uint32_t lastbs;		/* sub-chunk size of the last read-in, 0 if blocksize */
+	char magic[8];
+} chunk_trailer;
+
+/* Header size for subchunks sub-chunks per read-in, rounded up to
+   CHUNK_IO_ALIGN */
+static inline int chunk_header_size(int subchunks, int readins)
+{
+	long len;
+
+	len = CHUNK_HEADER_STORED + subchunks*sizeof(uint64_t) + (long) readins*subchunks*sizeof(uint32_t);
+	return ((len+CHUNK_IO_ALIGN-1)/CHUNK_IO_ALIGN)*CHUNK_IO_ALIGN;
+}
+
+/* Fills in everything but index.  The offset table is the plain layer
+   order, offset[j] = j*blocksize. */
+static inline void chunk_header_init(chunk_header *h, uint64_t *offset, int family, int k, int m, int w,
+	int subchunks, int tech, int packetsize, long size, long buffersize, long blocksize, int readins)
+{
+	int j;
+
+	memset(h, 0, sizeof(chunk_header));
+	strcpy(h->magic, CHUNK_MAGIC);
+	h->version = CHUNK_VERSION;
+	h->hdr_size = chunk_header_size(subchunks, readins);
+	h->flags = CHUNK_CRC32C;
+	h->family = family;
+	h->k = k;
+	h->m = m;
+	h->d = k+m-1;
+	h->w = w;
+	h->subchunks = subchunks;
+	h->tech = tech;
+	h->packetsize = packetsize;
+	h->readins = readins;
+	h->blocksize = blocksize;
+	h->lastbs = blocksize;
+	h->buffersize = buffersize;
+	h->size = size;
+	for (j = 0; j < subchunks; j++) offset[j] = (uint64_t) j*blocksize;
+}
+
+/* Lays out the header of chunk index in buf (hdr_size bytes, aligned).
+   crc holds readins*subchunks CRCs of this chunk, or is NULL while they
+   are not known yet. */
+static inline void chunk_header_pack(chunk_header *h, uint64_t *offset, uint32_t *crc, int index, char *buf)
+{
+	h->index = index;
+	memset(buf, 0, h->hdr_size);
+	memcpy(buf, h, CHUNK_HEADER_STORED);
+	memcpy(buf+CHUNK_HEADER_STORED, offset, h->subchunks*sizeof(uint64_t));
+	if (crc != NULL && !(h->flags & CHUNK_TRAILER)) {
+		memcpy(buf+CHUNK_HEADER_STORED+h->subchunks*sizeof(uint64_t), crc,
+		       (size_t) h->readins*h->subchunks*sizeof(uint32_t));
+	}
+}
+
+/* Bytes in the trailer of a CHUNK_TRAILER chunk */
+static inline long chunk_trailer_size(chunk_header *h, int readins)
+{
+	long len;
+
+	len = (long) readins*h->subchunks*sizeof(uint32_t) + sizeof(chunk_trailer);
+	return len;
+}
+
+/* Lays out the trailer of one chunk in buf: its readins*subchunks CRCs,
+   then the chunk_trailer with size and h->lastbs.  Returns the length. */
+static inline long chunk_trailer_pack(chunk_header *h, uint32_t *crc, long size, int readins, char *buf)
+{
+	chunk_trailer t;
+	long len;
+
+	len = (long) readins*h->subchunks*sizeof(uint32_t);
+	memcpy(buf, crc, len);
+	memset(&t, 0, sizeof(chunk_trailer));
+	t.size = size;
+	t.readins = readins;
+	if (h->lastbs != h->blocksize) t.lastbs = h->lastbs;
+	strcpy(t.magic, CHUNK_TRAILER_MAGIC);
+	memcpy(buf+len, &t, sizeof(chunk_trailer));
+	return len+sizeof(chunk_trailer);
+}
+
+/* The encoders collect CRCs read-in by read-in, (n*nodes+index)*subchunks+j
+   for read-in n; this copies out the table of chunk index */
+static inline void chunk_crc_gather(uint32_t *crc, int nodes, int subchunks, int readins, int index, uint32_t *out)
+{
+	int n;
+
+	for (n = 0; n < readins; n++) {
+		memcpy(out+(long)n*subchunks, crc+((long)n*nodes+index)*subchunks, subchunks*sizeof(uint32_t));
+	}
+}
+
+/* Reads and checks the header at the front of fp.  Returns 0 and a
+   malloc'd offset table on success, -1 if fp has no chunk header.  If crc
+   is not NULL it gets the malloc'd CRC table, or NULL for chunks written
+   without one. */
+static inline int chunk_header_read(FILE *fp, chunk_header *h, uint64_t **offset, uint32_t **crc)
+{
+	size_t ncrc;
+	chunk_trailer t;
+
+	rewind(fp);
+	memset(h, 0, sizeof(chunk_header));
+	if (fread(h, CHUNK_HEADER_STORED, 1, fp) != 1) return -1;
+	if (memcmp(h->magic, CHUNK_MAGIC, sizeof(CHUNK_MAGIC)) != 0 || h->version != CHUNK_VERSION) return -1;
+	ncrc = (h->flags & CHUNK_CRC32C) ? (size_t) h->readins*h->subchunks : 0;
+	if (h->subchunks == 0 || h->hdr_size < CHUNK_HEADER_STORED + h->subchunks*sizeof(uint64_t) + ncrc*sizeof(uint32_t)) return -1;
+	*offset = (uint64_t *)malloc(sizeof(uint64_t)*h->subchunks);
+	if (fread(*offset, sizeof(uint64_t), h->subchunks, fp) != h->subchunks) {
+		free(*offset);
+		return -1;
+	}
+	if (h->flags & CHUNK_TRAILER) {
+		/* Streamed chunk: size, readins and the CRCs are at the end */
+		if (fseek(fp, -(long) sizeof(chunk_trailer), SEEK_END) != 0 ||
+		    fread(&t, sizeof(chunk_trailer), 1, fp) != 1 ||
+		    memcmp(t.magic, CHUNK_TRAILER_MAGIC, sizeof(CHUNK_TRAILER_MAGIC)) != 0) {
+			free(*offset);
+			return -1;
+		}
+		h->size = t.size;
+		h->readins = t.readins;
+		if (t.lastbs != 0) h->lastbs = t.lastbs;
+		ncrc = (h->flags & CHUNK_CRC32C) ? (size_t) h->readins*h->subchunks : 0;
+		fseek(fp, -chunk_trailer_size(h, h->readins), SEEK_END);
+	}
+	if (h->lastbs == 0) h->lastbs = h->blocksize;
+	if (crc == NULL) return 0;
+	*crc = NULL;
+	if (ncrc == 0) return 0;
+	*crc = (uint32_t *)malloc(sizeof(uint32_t)*ncrc);
+	if (fread(*crc, sizeof(uint32_t), ncrc, fp) != ncrc) {
+		free(*offset);
+		free(*crc);
+		return -1;
+	}
+	return 0;
+}
+
+/* 0 if h, the header of chunk index, describes the same object and
+   layout as ref, -1 if not.  A chunk whose header does not match is not
+   to be trusted, not even its offset table and CRCs. */
+static inline int chunk_header_match(chunk_header *h, chunk_header *ref, int index)
+{
+	if (h->family != ref->family || h->k != ref->k || h->m != ref->m || h->w != ref->w) return -1;
+	if (h->subchunks != ref->subchunks || h->tech != ref->tech || h->packetsize != ref->packetsize) return -1;
+	if (h->hdr_size != ref->hdr_size || h->flags != ref->flags || h->readins != ref->readins) return -1;
+	if (h->blocksize != ref->blocksize || h->lastbs != ref->lastbs || h->size != ref->size) return -1;
+	if (h->index != (uint32_t) index) return -1;
+	return 0;
+}
+
+/* chunk_header_read() on the file at path */
+static inline int chunk_header_load(const char *path, chunk_header *h, uint64_t **offset, uint32_t **crc)
+{
+	FILE *fp;
+	int ret;
+
+	fp = fopen(path, "rb");
+	if (fp == NULL) return -1;
+	ret = chunk_header_read(fp, h, offset, crc);
+	fclose(fp);
+	return ret;
+}
+
+/* Position of sub-chunk j inside a read-in.  offset is NULL for chunks
+   written before headers existed, which are always in layer order. */
+static inline uint64_t chunk_offset(uint64_t *offset, int j, long blocksize)
+{
+	if (offset == NULL) return (uint64_t) j*blocksize;
+	return offset[j];
+}
+
+/* Position of sub-chunk j of read-in n (from 1), relative to the first
+   sub-chunk of the file, when the sub-chunks of that read-in are bs
+   bytes: the offset table is in units of blocksize, and every read-in
+   before it is whole */
+static inline uint64_t chunk_subchunk_pos(uint64_t *offset, int subchunks, int n, int j, long blocksize, long bs)
+{
+	return (uint64_t) (n-1)*subchunks*blocksize + chunk_offset(offset, j, blocksize)/blocksize*bs;
+}
+
+/* Bytes of sub-chunks in a chunk of readins read-ins, the last of them
+   lastbs bytes a sub-chunk */
+static inline uint64_t chunk_data_size(chunk_header *h, int readins)
+{
+	if (readins == 0) return 0;
+	return (uint64_t) (readins-1)*h->subchunks*h->blocksize + (uint64_t) h->subchunks*h->lastbs;
+}
+
+/* Repair-friendly sub-chunk order for Clay chunks.  Repairing a node of
+   pair p reads, from every helper, the layers whose bit p matches the
+   node; in layer order those are 2^(bits-1-p) runs of 2^p sub-chunks.
+   Chunk index instead stores at position pos the layer whose bits are the
+   Gray code of pos rotated left by the pair of the chunk.  Bit q of a Gray
+   code flips every 2^(q+1) positions, so the runs are twice as long, and
+   since every helper rotates by its own pair each failed node sees the
+   same mix of run lengths. */
+static inline int chunk_permuted_layer(int index, int bits, int pos)
+{
+	int g, s;
+
+	g = pos ^ (pos >> 1);
+	s = (index/2) % bits;
+	if (s == 0) return g;
+	return ((g << s) | (g >> (bits-s))) & ((1 << bits)-1);
+}
+
+/* Offset table (and, if layer is not NULL, the layer at every position)
+   of chunk index in the order above */
+static inline void chunk_permute(uint64_t *offset, int *layer, int index, int subchunks, long blocksize)
+{
+	int bits, pos, z;
+
+	for (bits = 0; (1 << bits) < subchunks; bits++) ;
+	for (pos = 0; pos < subchunks; pos++) {
+		z = (bits == 0) ? pos : chunk_permuted_layer(index, bits, pos);
+		offset[z] = (uint64_t) pos*blocksize;
+		if (layer != NULL) layer[pos] = z;
+	}
+}
+
+/* Number of separate reads a helper with this offset table serves to
+   repair a node of pair p at position b of its pair */
+static inline int chunk_repair_runs(uint64_t *offset, int subchunks, int p, int b, long blocksize)
+{
+	char *want;
+	int j, runs;
+
+	want = (char *)calloc(subchunks+1, sizeof(char));
+	for (j = 0; j < subchunks; j++) {
+		if (((j >> p) & 1) == b) want[chunk_offset(offset, j, blocksize)/blocksize] = 1;
+	}
+	runs = 0;
+	for (j = 0; j < subchunks; j++) {
+		if (want[j] && !want[j+1]) runs++;
+	}
+	free(want);
+	return runs;
+}
+
+/* Looks for dir/name_k#ext or dir/name_m#ext files and returns the header
+   of the first one that has one.  Returns -1 if none of them does. */
+static inline int chunk_header_find(const char *dir, const char *name, const char *ext,
+	chunk_header *h, uint64_t **offset)
+{
+	char *pattern;
+	char *p;
+	glob_t gl;
+	size_t i;
+	int found;
+
+	pattern = (char *)malloc(strlen(dir)+strlen(name)+strlen(ext)+10);
+	sprintf(pattern, "%s/%s_[km]*%s", dir, name, ext);
+	found = -1;
+	if (glob(pattern, 0, NULL, &gl) == 0) {
+		for (i = 0; i < gl.gl_pathc && found != 0; i++) {
+			/* Only name_, k or m, digits, ext: not the chunks of name_k1 */
+			p = gl.gl_pathv[i] + strlen(dir) + 1 + strlen(name) + 2;
+			if (!isdigit((unsigned char) *p)) continue;
+			while (isdigit((unsigned char) *p)) p++;
+			if (strcmp(p, ext) != 0) continue;
+			found = chunk_header_load(gl.gl_pathv[i], h, offset, NULL);
+		}
+		globfree(&gl);
+	}
+	free(pattern);
+	return found;
+}
+
+#endif
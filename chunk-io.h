@@ -0,0 +1,403 @@
+/* *
+ * chunk-io.h - batched chunk file I/O for the encoders and decoders.
+ *
+ * Reads and writes of sub-chunks are queued with chunk_io_pread() /
+ * chunk_io_pwrite(), pushed to the kernel in one batch by
+ * chunk_io_submit() and reaped by chunk_io_wait().  When io_uring is
+ * available (and asked for), a batch is a set of SQEs on one ring, using
+ * the registered-buffer opcodes for buffers handed to chunk_io_register().
+ * Otherwise every request is done on the spot with pread/pwrite, so the
+ * callers do not need a second code path.
+ *
+ * A read or write that fails or comes up short is not fatal here.
+ * chunk_io_wait() returns how many did since the last call, and when the
+ * caller has set tagged, tagged[tag] is set for each of them, tag being
+ * what io->tag was when the request was queued.  A decoder tags the
+ * requests with the chunk they read and turns the chunks that failed into
+ * erasures; an encoder gives up.
+ *
+ * Only raw system calls are used, so there is no dependency on liburing.
+ */
+
+#ifndef _CHUNK_IO_H
+#define _CHUNK_IO_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <errno.h>
+
+/* glibc only exposes O_DIRECT under _GNU_SOURCE */
+#if !defined(O_DIRECT) && defined(__O_DIRECT)
+#define O_DIRECT __O_DIRECT
+#endif
+
+/* Offset, length and address alignment required by O_DIRECT */
+#define CHUNK_IO_ALIGN 4096
+
+#if defined(__NR_io_uring_setup) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define CHUNK_IO_URING
+#endif
+#endif
+
+typedef struct {
+	int ring_fd;			/* -1 means blocking pread/pwrite */
+	int fixed;			/* buffers registered with the ring */
+	int queued;			/* SQEs filled in but not submitted */
+	int inflight;			/* submitted but not reaped */
+	unsigned entries;
+	int tag;			/* tag of the requests queued next */
+	char *tagged;			/* tagged[tag] set when one of them fails, if not NULL */
+	int failed;			/* failed or short since the last chunk_io_wait() */
+	int err;			/* errno of the last of them, 0 if it was short */
+#ifdef CHUNK_IO_URING
+	char *sq_ring, *cq_ring;
+	size_t sq_ring_size, cq_ring_size;
+	struct io_uring_sqe *sqes;
+	struct io_uring_cqe *cqes;
+	unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+	unsigned *cq_head, *cq_tail, *cq_mask;
+#endif
+} chunk_io;
+
+/* Sub-chunk memory; aligned so it can be used with O_DIRECT */
+static inline char *chunk_io_alloc(size_t len)
+{
+	void *p;
+
+	if (posix_memalign(&p, CHUNK_IO_ALIGN, len) != 0) {
+		perror("posix_memalign");
+		exit(1);
+	}
+	return (char *) p;
+}
+
+/* Smallest multiple of unit that is also a multiple of CHUNK_IO_ALIGN */
+static inline long chunk_io_align_unit(long unit)
+{
+	long a, b, t;
+
+	a = unit;
+	b = CHUNK_IO_ALIGN;
+	while (b != 0) {
+		t = a%b;
+		a = b;
+		b = t;
+	}
+	return unit/a*CHUNK_IO_ALIGN;
+}
+
+/* open(2) with O_DIRECT if direct is set.  File systems that refuse 
+   O_DIRECT (tmpfs, for one) get a warning and buffered I/O. */
+static inline int chunk_io_open(const char *path, int flags, int direct)
+{
+	int fd;
+
+#ifdef O_DIRECT
+	if (direct) {
+		fd = open(path, flags | O_DIRECT, 0644);
+		if (fd >= 0 || errno != EINVAL) return fd;
+		fprintf(stderr, "%s: O_DIRECT not supported, using buffered I/O\n", path);
+	}
+#endif
+	fd = open(path, flags, 0644);
+	return fd;
+}
+
+/* Drops O_DIRECT again, for chunk files whose sub-chunks are not aligned */
+static inline void chunk_io_undirect(int fd)
+{
+#ifdef O_DIRECT
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_DIRECT);
+#endif
+}
+
+/* Blocking fallback: loops until the whole region is transferred.
+   Returns the bytes done, fewer than len at the end of the file, or -1
+   with errno set. */
+static inline long chunk_io_blocking(int fd, char *buf, int len, off_t off, int wr)
+{
+	ssize_t ret;
+	long done;
+
+	done = 0;
+	while (done < len) {
+		ret = wr ? pwrite(fd, buf+done, len-done, off+done) : pread(fd, buf+done, len-done, off+done);
+		if (ret < 0 && errno == EINTR) continue;
+		if (ret < 0) return -1;
+		if (ret == 0) break;
+		done += ret;
+	}
+	return done;
+}
+
+/* Blocking vectored transfer of niov buffers at off, or at the file
+   position if off < 0, until all of them are done.  iov is used up.
+   Returns the bytes done, short at the end of the file, or -1 with
+   errno set. */
+static inline long chunk_io_vec(int fd, struct iovec *iov, int niov, off_t off, int wr)
+{
+	ssize_t ret;
+	long done;
+
+	done = 0;
+	while (niov > 0) {
+		if (wr) ret = (off < 0) ? writev(fd, iov, niov) : pwritev(fd, iov, niov, off);
+		else ret = (off < 0) ? readv(fd, iov, niov) : preadv(fd, iov, niov, off);
+		if (ret < 0 && errno == EINTR) continue;
+		if (ret < 0) return -1;
+		if (ret == 0) break;
+		done += ret;
+		if (off >= 0) off += ret;
+		while (niov > 0 && (size_t) ret >= iov->iov_len) {
+			ret -= iov->iov_len;
+			iov++;
+			niov--;
+		}
+		if (niov > 0) {
+			iov->iov_base = (char *) iov->iov_base + ret;
+			iov->iov_len -= ret;
+		}
+	}
+	return done;
+}
+
+/* Notes a request of tag that failed with err, or came up short (0) */
+static inline void chunk_io_fail(chunk_io *io, int tag, int err)
+{
+	io->failed++;
+	io->err = err;
+	if (io->tagged != NULL && tag >= 0) io->tagged[tag] = 1;
+}
+
+/* Sets up the ring.  Returns 1 if io_uring is in use, 0 for blocking I/O. */
+static inline int chunk_io_init(chunk_io *io, unsigned entries, int use_uring)
+{
+	memset(io, 0, sizeof(chunk_io));
+	io->ring_fd = -1;
+	io->entries = entries;
+	io->tag = -1;
+#ifdef CHUNK_IO_URING
+	struct io_uring_params p;
+	int fd;
+
+	if (!use_uring) return 0;
+	memset(&p, 0, sizeof(p));
+	fd = syscall(__NR_io_uring_setup, entries, &p);
+	if (fd < 0) {
+		fprintf(stderr, "io_uring unavailable, using blocking I/O\n");
+		return 0;
+	}
+	io->entries = p.sq_entries;
+	io->sq_ring_size = p.sq_off.array + p.sq_entries*sizeof(unsigned);
+	io->cq_ring_size = p.cq_off.cqes + p.cq_entries*sizeof(struct io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		if (io->cq_ring_size > io->sq_ring_size) io->sq_ring_size = io->cq_ring_size;
+		io->cq_ring_size = io->sq_ring_size;
+	}
+	io->sq_ring = mmap(NULL, io->sq_ring_size, PROT_READ | PROT_WRITE,
+	                   MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		io->cq_ring = io->sq_ring;
+	}
+	else {
+		io->cq_ring = mmap(NULL, io->cq_ring_size, PROT_READ | PROT_WRITE,
+		                   MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+	}
+	io->sqes = mmap(NULL, p.sq_entries*sizeof(struct io_uring_sqe), PROT_READ | PROT_WRITE,
+	                MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+	if (io->sq_ring == MAP_FAILED || io->cq_ring == MAP_FAILED || io->sqes == MAP_FAILED) {
+		fprintf(stderr, "io_uring mmap failed, using blocking I/O\n");
+		close(fd);
+		return 0;
+	}
+	io->sq_head = (unsigned *)(io->sq_ring + p.sq_off.head);
+	io->sq_tail = (unsigned *)(io->sq_ring + p.sq_off.tail);
+	io->sq_mask = (unsigned *)(io->sq_ring + p.sq_off.ring_mask);
+	io->sq_array = (unsigned *)(io->sq_ring + p.sq_off.array);
+	io->cq_head = (unsigned *)(io->cq_ring + p.cq_off.head);
+	io->cq_tail = (unsigned *)(io->cq_ring + p.cq_off.tail);
+	io->cq_mask = (unsigned *)(io->cq_ring + p.cq_off.ring_mask);
+	io->cqes = (struct io_uring_cqe *)(io->cq_ring + p.cq_off.cqes);
+	io->ring_fd = fd;
+	return 1;
+#else
+	if (use_uring) fprintf(stderr, "io_uring not compiled in, using blocking I/O\n");
+	return 0;
+#endif
+}
+
+/* Registers niov buffers; afterwards the buf_index argument of
+   chunk_io_pread/pwrite refers to iov[buf_index].  Failure (for example
+   RLIMIT_MEMLOCK) is not fatal, the plain opcodes are used instead. */
+static inline void chunk_io_register(chunk_io *io, struct iovec *iov, int niov)
+{
+#ifdef CHUNK_IO_URING
+	if (io->ring_fd < 0) return;
+	if (syscall(__NR_io_uring_register, io->ring_fd, IORING_REGISTER_BUFFERS, iov, niov) == 0) {
+		io->fixed = 1;
+	}
+#endif
+}
+
+static inline void chunk_io_submit(chunk_io *io);
+
+#ifdef CHUNK_IO_URING
+/* Reaps completions until at least min of them have been seen (or nothing
+   is in flight).  The length of a request is in the low half of its
+   user_data, its tag plus one in the high half. */
+static inline void chunk_io_reap(chunk_io *io, int min)
+{
+	unsigned head;
+	int got;
+	struct io_uring_cqe *cqe;
+
+	got = 0;
+	while (1) {
+		head = *io->cq_head;
+		while (head != __atomic_load_n(io->cq_tail, __ATOMIC_ACQUIRE)) {
+			cqe = &io->cqes[head & *io->cq_mask];
+			if (cqe->res != (int) (cqe->user_data & 0xffffffff)) {
+				chunk_io_fail(io, (int) (cqe->user_data >> 32)-1, (cqe->res < 0) ? -cqe->res : 0);
+			}
+			head++;
+			got++;
+			io->inflight--;
+		}
+		__atomic_store_n(io->cq_head, head, __ATOMIC_RELEASE);
+		if (got >= min || io->inflight == 0) return;
+		if (syscall(__NR_io_uring_enter, io->ring_fd, 0, min-got, IORING_ENTER_GETEVENTS, NULL, 0) < 0) {
+			perror("io_uring_enter");
+			exit(1);
+		}
+	}
+}
+
+static inline void chunk_io_push(chunk_io *io, int fd, char *buf, int len, off_t off, int buf_index, int wr)
+{
+	unsigned tail, idx;
+	struct io_uring_sqe *sqe;
+
+	/* Ring full: hand what we have to the kernel and make room */
+	if ((unsigned)(io->queued + io->inflight) >= io->entries) {
+		chunk_io_submit(io);
+		chunk_io_reap(io, 1);
+	}
+
+	tail = *io->sq_tail;
+	idx = tail & *io->sq_mask;
+	sqe = &io->sqes[idx];
+	memset(sqe, 0, sizeof(*sqe));
+	if (io->fixed && buf_index >= 0) {
+		sqe->opcode = wr ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+		sqe->buf_index = buf_index;
+	}
+	else {
+		sqe->opcode = wr ? IORING_OP_WRITE : IORING_OP_READ;
+	}
+	sqe->fd = fd;
+	sqe->addr = (unsigned long) buf;
+	sqe->len = len;
+	sqe->off = off;
+	sqe->user_data = ((uint64_t) (io->tag+1) << 32) | (uint32_t) len;
+	io->sq_array[idx] = idx;
+	__atomic_store_n(io->sq_tail, tail+1, __ATOMIC_RELEASE);
+	io->queued++;
+}
+#endif
+
+static inline void chunk_io_pwrite(chunk_io *io, int fd, char *buf, int len, off_t off, int buf_index)
+{
+	long ret;
+
+#ifdef CHUNK_IO_URING
+	if (io->ring_fd >= 0) {
+		chunk_io_push(io, fd, buf, len, off, buf_index, 1);
+		return;
+	}
+#endif
+	ret = chunk_io_blocking(fd, buf, len, off, 1);
+	if (ret != len) chunk_io_fail(io, io->tag, (ret < 0) ? errno : 0);
+}
+
+static inline void chunk_io_pread(chunk_io *io, int fd, char *buf, int len, off_t off, int buf_index)
+{
+	long ret;
+
+#ifdef CHUNK_IO_URING
+	if (io->ring_fd >= 0) {
+		chunk_io_push(io, fd, buf, len, off, buf_index, 0);
+		return;
+	}
+#endif
+	ret = chunk_io_blocking(fd, buf, len, off, 0);
+	if (ret != len) chunk_io_fail(io, io->tag, (ret < 0) ? errno : 0);
+}
+
+/* Submits everything queued so far without waiting for it */
+static inline void chunk_io_submit(chunk_io *io)
+{
+#ifdef CHUNK_IO_URING
+	int ret;
+
+	if (io->ring_fd < 0) return;
+	while (io->queued > 0) {
+		ret = syscall(__NR_io_uring_enter, io->ring_fd, io->queued, 0, 0, NULL, 0);
+		if (ret <= 0) {
+			perror("io_uring_enter");
+			exit(1);
+		}
+		io->inflight += ret;
+		io->queued -= ret;
+	}
+#endif
+}
+
+/* Submits anything still queued and waits until every request is done.
+   Returns the number that failed or came up short since the last call. */
+static inline int chunk_io_wait(chunk_io *io)
+{
+	int failed;
+
+#ifdef CHUNK_IO_URING
+	if (io->ring_fd >= 0) {
+		chunk_io_submit(io);
+		chunk_io_reap(io, io->inflight);
+	}
+#endif
+	failed = io->failed;
+	io->failed = 0;
+	return failed;
+}
+
+/* chunk_io_wait() for writers: any request that failed is fatal */
+static inline void chunk_io_done(chunk_io *io, const char *what)
+{
+	if (chunk_io_wait(io) != 0) {
+		fprintf(stderr, "%s: %s\n", what, io->err ? strerror(io->err) : "short transfer");
+		exit(1);
+	}
+}
+
+static inline void chunk_io_exit(chunk_io *io)
+{
+#ifdef CHUNK_IO_URING
+	if (io->ring_fd < 0) return;
+	chunk_io_wait(io);
+	munmap(io->sqes, io->entries*sizeof(struct io_uring_sqe));
+	if (io->cq_ring != io->sq_ring) munmap(io->cq_ring, io->cq_ring_size);
+	munmap(io->sq_ring, io->sq_ring_size);
+	close(io->ring_fd);
+	io->ring_fd = -1;
+#endif
+}
+
+#endif
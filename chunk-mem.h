@@ -0,0 +1,154 @@
+/* *
+ * chunk-mem.h - what the buffers of an encode take.
+ *
+ * A tool keeps a chunk_mem and makes its buffers with chunk_mem_alloc(),
+ * or hands ones it made some other way (aligned, realloc'ed) to
+ * chunk_mem_add(), each with the class it belongs to.  Every class keeps
+ * the number of allocations and the bytes in them; chunk_mem_free() takes
+ * bytes off again, so the live total and its peak are known too.
+ * chunk_mem_mark() is called when the read-in loop starts and
+ * chunk_mem_mark_end() when it is over: the allocations made in between
+ * are per read-in, and should be none.
+ *
+ * chunk_mem_report() prints a table of the classes with the peak of what
+ * was accounted, the peak resident set of the process (VmHWM, which also
+ * has the libraries, the stack and mapped input) and the allocations per
+ * read-in, then the same as one line of JSON starting with {"memory":.
+ * Divided by the bytes of one read-in it says how much memory a stripe in
+ * flight costs, which is what sizes the number of them a node can run.
+ */
+
+#ifndef _CHUNK_MEM_H
+#define _CHUNK_MEM_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/resource.h>
+
+enum Chunk_Mem {Mem_Input, Mem_Coding, Mem_Layers, Mem_Uncoupled, Mem_Io, Mem_Meta, Mem_Scratch, Chunk_Mems};
+
+/* input: block and tail; coding: the m coding blocks of one layer; layers:
+   fdata and fcoding; uncoupled: ffdata and ccoding; io: registered uring
+   buffers; meta: headers, offsets and CRCs; scratch: anything else */
+static const char *chunk_mem_names[] = {"input", "coding", "layers", "uncoupled", "io", "meta", "scratch"};
+
+typedef struct {
+	uint64_t bytes[Chunk_Mems];
+	long count[Chunk_Mems];
+	uint64_t live, peak;
+	long allocs;
+	long loop_allocs;		/* allocs when the read-in loop started, -1 before */
+	long loop_end;			/* and when it ended, -1 before */
+} chunk_mem;
+
+static inline void chunk_mem_init(chunk_mem *cm)
+{
+	memset(cm, 0, sizeof(chunk_mem));
+	cm->loop_allocs = -1;
+	cm->loop_end = -1;
+}
+
+static inline void chunk_mem_add(chunk_mem *cm, int cls, uint64_t bytes)
+{
+	cm->bytes[cls] += bytes;
+	cm->count[cls]++;
+	cm->allocs++;
+	cm->live += bytes;
+	if (cm->live > cm->peak) cm->peak = cm->live;
+}
+
+static inline void *chunk_mem_alloc(chunk_mem *cm, int cls, size_t bytes)
+{
+	void *p;
+
+	p = malloc(bytes);
+	if (p == NULL) {
+		perror("malloc");
+		exit(1);
+	}
+	chunk_mem_add(cm, cls, bytes);
+	return p;
+}
+
+static inline void chunk_mem_free(chunk_mem *cm, void *p, uint64_t bytes)
+{
+	free(p);
+	cm->live -= (bytes < cm->live) ? bytes : cm->live;
+}
+
+static inline void chunk_mem_mark(chunk_mem *cm)
+{
+	cm->loop_allocs = cm->allocs;
+}
+
+static inline void chunk_mem_mark_end(chunk_mem *cm)
+{
+	cm->loop_end = cm->allocs;
+}
+
+/* Field of /proc/self/status in bytes; the peak from getrusage() when
+   there is no /proc */
+static inline uint64_t chunk_mem_status(const char *field)
+{
+	struct rusage ru;
+	char line[256];
+	long kb;
+	FILE *fp;
+
+	fp = fopen("/proc/self/status", "r");
+	if (fp != NULL) {
+		while (fgets(line, sizeof(line), fp) != NULL) {
+			if (strncmp(line, field, strlen(field)) == 0 && sscanf(line+strlen(field), ": %ld", &kb) == 1) {
+				fclose(fp);
+				return (uint64_t) kb*1024;
+			}
+		}
+		fclose(fp);
+	}
+	getrusage(RUSAGE_SELF, &ru);
+	return (uint64_t) ru.ru_maxrss*1024;
+}
+
+/* The table on fp, then the JSON line.  stripe is the bytes of one
+   read-in, readins how many there were. */
+static inline void chunk_mem_report(chunk_mem *cm, FILE *fp, const char *tool, uint64_t stripe, long readins)
+{
+	uint64_t total, hwm;
+	double per;
+	int i;
+
+	total = 0;
+	for (i = 0; i < Chunk_Mems; i++) total += cm->bytes[i];
+	if (total == 0) total = 1;
+	hwm = chunk_mem_status("VmHWM");
+	per = 0;
+	if (cm->loop_allocs >= 0 && readins > 0) {
+		per = (double) (((cm->loop_end >= 0) ? cm->loop_end : cm->allocs)-cm->loop_allocs)/readins;
+	}
+
+	fprintf(fp, "%-10s %8s %14s %12s %7s\n", "buffers", "allocs", "bytes", "MB", "%");
+	for (i = 0; i < Chunk_Mems; i++) {
+		fprintf(fp, "%-10s %8ld %14llu %12.3f %6.2f%%\n", chunk_mem_names[i], cm->count[i],
+			(unsigned long long) cm->bytes[i], cm->bytes[i]/1024.0/1024.0, 100.0*cm->bytes[i]/total);
+	}
+	fprintf(fp, "%-10s %8s %14llu %12.3f  (%.2f read-ins of %llu bytes)\n", "peak", "",
+		(unsigned long long) cm->peak, cm->peak/1024.0/1024.0, stripe ? (double) cm->peak/stripe : 0.0,
+		(unsigned long long) stripe);
+	fprintf(fp, "%-10s %8s %14llu %12.3f\n", "VmHWM", "", (unsigned long long) hwm, hwm/1024.0/1024.0);
+	fprintf(fp, "%-10s %8.2f  (%ld allocations before the read-ins)\n", "per read-in", per,
+		(cm->loop_allocs >= 0) ? cm->loop_allocs : cm->allocs);
+
+	fprintf(fp, "{\"memory\": {\"tool\": \"%s\", \"peak\": %llu, \"vm_hwm\": %llu, \"stripe\": %llu, \"readins\": %ld, "
+		"\"setup_allocs\": %ld, \"allocs_per_readin\": %.2f",
+		tool, (unsigned long long) cm->peak, (unsigned long long) hwm, (unsigned long long) stripe, readins,
+		(cm->loop_allocs >= 0) ? cm->loop_allocs : cm->allocs, per);
+	for (i = 0; i < Chunk_Mems; i++) {
+		fprintf(fp, ", \"%s\": {\"allocs\": %ld, \"bytes\": %llu}", chunk_mem_names[i], cm->count[i],
+			(unsigned long long) cm->bytes[i]);
+	}
+	fprintf(fp, "}}\n");
+}
+
+#endif
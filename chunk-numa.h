@@ -0,0 +1,160 @@
+/* *
+ * chunk-numa.h - worker placement on multi-socket machines.
+ *
+ * chunk_numa_init() reads the NUMA topology from sysfs (one node holding
+ * every allowed CPU when there is none).  Only nodes with a CPU we may run
+ * on count, numbered 0..nodes-1; id[] keeps the sysfs number of each,
+ * which is what mbind wants, since node numbers can have gaps and a cpuset
+ * may leave out node 0.  Worker i of a pool runs on node i % nodes, so
+ * consecutive workers alternate between sockets, and is pinned to one CPU
+ * of that node by chunk_numa_pin().  Stripe buffers come from
+ * chunk_numa_alloc(chunk_numa_id()), called by the pinned worker: the
+ * pages are bound to its node where mbind is allowed and touched right
+ * away, so first-touch puts them there anyway where it is not.  A stripe is only
+ * ever handled by one worker, so its layers stay on one node.
+ *
+ * Only raw system calls are used, so there is no dependency on libnuma.
+ */
+
+#ifndef _CHUNK_NUMA_H
+#define _CHUNK_NUMA_H
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include "chunk-io.h"
+
+#define CHUNK_NUMA_MAXNODES 64
+
+#define CHUNK_NUMA_MPOL_BIND 2		/* from linux/mempolicy.h */
+
+typedef struct {
+	int nodes;
+	int id[CHUNK_NUMA_MAXNODES];	/* sysfs number of each node, -1 if unknown */
+	int ncpus[CHUNK_NUMA_MAXNODES];
+	int *cpus[CHUNK_NUMA_MAXNODES];	/* allowed CPUs of each node */
+} chunk_numa;
+
+/* Adds the CPUs of a sysfs cpulist ("0-3,8,10-11") that we may run on */
+static inline void chunk_numa_cpulist(chunk_numa *nm, int node, const char *list, cpu_set_t *allowed)
+{
+	const char *s;
+	char *e;
+	long a, b, c;
+
+	s = list;
+	while (*s != '\0' && *s != '\n') {
+		a = strtol(s, &e, 10);
+		if (e == s) break;
+		b = a;
+		if (*e == '-') {
+			s = e+1;
+			b = strtol(s, &e, 10);
+		}
+		for (c = a; c <= b; c++) {
+			if (c < CPU_SETSIZE && CPU_ISSET(c, allowed)) {
+				nm->cpus[node] = (int *)realloc(nm->cpus[node], sizeof(int)*(nm->ncpus[node]+1));
+				nm->cpus[node][nm->ncpus[node]++] = c;
+			}
+		}
+		s = (*e == ',') ? e+1 : e;
+	}
+}
+
+static inline void chunk_numa_init(chunk_numa *nm)
+{
+	cpu_set_t allowed;
+	char path[64], list[4096];
+	FILE *fp;
+	int i, node;
+
+	memset(nm, 0, sizeof(chunk_numa));
+	CPU_ZERO(&allowed);
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &allowed) != 0) {
+		for (i = 0; i < sysconf(_SC_NPROCESSORS_ONLN) && i < CPU_SETSIZE; i++) CPU_SET(i, &allowed);
+	}
+	for (node = 0; node < CHUNK_NUMA_MAXNODES; node++) {
+		sprintf(path, "/sys/devices/system/node/node%d/cpulist", node);
+		fp = fopen(path, "r");
+		if (fp == NULL) continue;
+		if (fgets(list, sizeof(list), fp) != NULL) {
+			chunk_numa_cpulist(nm, nm->nodes, list, &allowed);
+			nm->id[nm->nodes] = node;
+			if (nm->ncpus[nm->nodes] > 0) nm->nodes++;
+		}
+		fclose(fp);
+	}
+	if (nm->nodes == 0) {
+		nm->nodes = 1;
+		nm->id[0] = -1;
+		for (i = 0; i < CPU_SETSIZE; i++) {
+			if (!CPU_ISSET(i, &allowed)) continue;
+			nm->cpus[0] = (int *)realloc(nm->cpus[0], sizeof(int)*(nm->ncpus[0]+1));
+			nm->cpus[0][nm->ncpus[0]++] = i;
+		}
+	}
+}
+
+static inline int chunk_numa_node(chunk_numa *nm, int worker)
+{
+	return worker % nm->nodes;
+}
+
+/* sysfs number of the node of worker, for chunk_numa_alloc() */
+static inline int chunk_numa_id(chunk_numa *nm, int worker)
+{
+	return nm->id[chunk_numa_node(nm, worker)];
+}
+
+static inline int chunk_numa_cpu(chunk_numa *nm, int worker)
+{
+	int node;
+
+	node = chunk_numa_node(nm, worker);
+	return nm->cpus[node][(worker / nm->nodes) % nm->ncpus[node]];
+}
+
+/* Pins the calling thread to the CPU of worker */
+static inline void chunk_numa_pin(chunk_numa *nm, int worker)
+{
+	cpu_set_t set;
+
+	CPU_ZERO(&set);
+	CPU_SET(chunk_numa_cpu(nm, worker), &set);
+	if (sched_setaffinity(0, sizeof(cpu_set_t), &set) != 0) perror("sched_setaffinity");
+}
+
+/* len bytes on node (a sysfs node number, -1 for no binding), touched so
+   that every page is in place before use */
+static inline char *chunk_numa_alloc(int node, size_t len)
+{
+	char *buf;
+	unsigned long mask[CHUNK_NUMA_MAXNODES/(8*sizeof(unsigned long))];
+
+	buf = chunk_io_alloc(len);
+#ifdef __NR_mbind
+	if (node >= 0) {
+		memset(mask, 0, sizeof(mask));
+		mask[node/(8*sizeof(unsigned long))] = 1UL << (node%(8*sizeof(unsigned long)));
+		syscall(__NR_mbind, buf, len, CHUNK_NUMA_MPOL_BIND, mask, CHUNK_NUMA_MAXNODES+1, 0);
+	}
+#endif
+	memset(buf, 0, len);
+	return buf;
+}
+
+static inline void chunk_numa_exit(chunk_numa *nm)
+{
+	int i;
+
+	for (i = 0; i < nm->nodes; i++) free(nm->cpus[i]);
+}
+
+#endif
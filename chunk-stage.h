@@ -0,0 +1,240 @@
+/* *
+ * chunk-stage.h - where the time of an encode or decode goes.
+ *
+ * A tool keeps a chunk_stage and calls chunk_stage_end() as each step of
+ * a read-in finishes: the nanoseconds since the previous mark, from
+ * CLOCK_MONOTONIC, are charged to that stage together with the bytes it
+ * handled, and the clock restarts for the next one.  chunk_stage_mark()
+ * restarts it without charging anything, so bookkeeping between steps
+ * shows up as "other".  Threads keep one each; chunk_stage_add() sums
+ * them, and the stages then add up to more than the wall time.
+ *
+ * chunk_stage_perf() adds hardware counters: cycles, instructions and
+ * last-level cache misses of the calling thread, opened as one
+ * perf_event_open() group so that they are scheduled together, and read
+ * at every mark and end like the clock.  Where the kernel or the CPU
+ * does not have them (a VM, perf_event_paranoid) it says so once and the
+ * tool goes on with the timings alone; a counter the CPU lacks is left
+ * out of the group.  Kernel time is counted if allowed, so the I/O
+ * stages include the system calls; otherwise user space only.
+ *
+ * chunk_stage_report() prints a table of the stages and the same numbers
+ * as one line of JSON, starting with {"stages":.  With counters, the
+ * table also has IPC, bytes handled per cache miss and the DRAM traffic
+ * the misses make, a cache line each, of each stage.
+ */
+
+#ifndef _CHUNK_STAGE_H
+#define _CHUNK_STAGE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/syscall.h>
+
+#if defined(__NR_perf_event_open) && defined(__has_include)
+#if __has_include(<linux/perf_event.h>)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#define CHUNK_STAGE_PERF
+#endif
+#endif
+
+enum Chunk_Stage {Stage_Setup, Stage_Read, Stage_Crc, Stage_Copy, Stage_Mds, Stage_Couple, Stage_Write, Chunk_Stages};
+
+static const char *chunk_stage_names[] = {"setup", "read", "crc", "copy", "mds", "couple", "write"};
+
+#define CHUNK_STAGE_LINE 64
+
+enum Chunk_Counter {Counter_Cycles, Counter_Instructions, Counter_Misses, Chunk_Counters};
+
+static const char *chunk_counter_names[] = {"cycles", "instructions", "llc_misses"};
+
+typedef struct {
+	uint64_t ns[Chunk_Stages];
+	uint64_t bytes[Chunk_Stages];
+	uint64_t start;			/* of the run */
+	uint64_t mark;			/* of the step under way */
+	long readins;
+	int threads;
+	int perf_fd;			/* counter group leader, -1 without */
+	int perf_on[Chunk_Counters];	/* counters in the group, in order */
+	uint64_t count[Chunk_Stages][Chunk_Counters];
+	uint64_t count_mark[Chunk_Counters];
+} chunk_stage;
+
+static inline uint64_t chunk_stage_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec*1000000000ULL + ts.tv_nsec;
+}
+
+static inline void chunk_stage_init(chunk_stage *st)
+{
+	memset(st, 0, sizeof(chunk_stage));
+	st->start = chunk_stage_now();
+	st->mark = st->start;
+	st->threads = 1;
+	st->perf_fd = -1;
+}
+
+/* Reads the group into c, the counters that are not in it as 0; -1 if
+   there is no group */
+static inline int chunk_stage_read(chunk_stage *st, uint64_t *c)
+{
+	uint64_t buf[1+Chunk_Counters];
+	int i, j;
+
+	if (st->perf_fd < 0) return -1;
+	if (read(st->perf_fd, buf, sizeof(buf)) <= 0) return -1;
+	for (i = 0, j = 1; i < Chunk_Counters; i++) c[i] = st->perf_on[i] ? buf[j++] : 0;
+	return 0;
+}
+
+/* Opens the counters for the calling thread; 0 if at least the cycles
+   are counted.  A thread that runs stages calls this itself. */
+static inline int chunk_stage_perf(chunk_stage *st)
+{
+#ifdef CHUNK_STAGE_PERF
+	static const uint64_t config[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES};
+	struct perf_event_attr pe;
+	int i, fd, user;
+
+	for (user = 0; user <= 1 && st->perf_fd < 0; user++) {
+		for (i = 0; i < Chunk_Counters; i++) {
+			memset(&pe, 0, sizeof(pe));
+			pe.type = PERF_TYPE_HARDWARE;
+			pe.size = sizeof(pe);
+			pe.config = config[i];
+			pe.read_format = PERF_FORMAT_GROUP;
+			pe.disabled = (i == 0);
+			pe.exclude_kernel = user;
+			pe.exclude_hv = 1;
+			fd = syscall(__NR_perf_event_open, &pe, 0, -1, (i == 0) ? -1 : st->perf_fd, 0);
+			if (fd < 0) {
+				if (i == 0) break;
+				continue;
+			}
+			if (i == 0) st->perf_fd = fd;
+			st->perf_on[i] = 1;
+		}
+	}
+	if (st->perf_fd < 0) {
+		fprintf(stderr, "perf: no hardware counters here (%s), timing only\n", strerror(errno));
+		return -1;
+	}
+	ioctl(st->perf_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	chunk_stage_read(st, st->count_mark);
+	return 0;
+#else
+	fprintf(stderr, "perf: not built with perf_event_open, timing only\n");
+	return -1;
+#endif
+}
+
+static inline void chunk_stage_perf_close(chunk_stage *st)
+{
+	if (st->perf_fd >= 0) close(st->perf_fd);
+	st->perf_fd = -1;
+}
+
+static inline void chunk_stage_mark(chunk_stage *st)
+{
+	st->mark = chunk_stage_now();
+	chunk_stage_read(st, st->count_mark);
+}
+
+/* Charges the time since the last mark to stage */
+static inline void chunk_stage_end(chunk_stage *st, int stage, uint64_t bytes)
+{
+	uint64_t now, c[Chunk_Counters];
+	int i;
+
+	now = chunk_stage_now();
+	st->ns[stage] += now-st->mark;
+	st->bytes[stage] += bytes;
+	st->mark = now;
+	if (chunk_stage_read(st, c) == 0) {
+		for (i = 0; i < Chunk_Counters; i++) {
+			st->count[stage][i] += c[i]-st->count_mark[i];
+			st->count_mark[i] = c[i];
+		}
+	}
+}
+
+/* Adds the stages of a worker into st */
+static inline void chunk_stage_add(chunk_stage *st, chunk_stage *w)
+{
+	int i, j;
+
+	for (i = 0; i < Chunk_Stages; i++) {
+		st->ns[i] += w->ns[i];
+		st->bytes[i] += w->bytes[i];
+		for (j = 0; j < Chunk_Counters; j++) st->count[i][j] += w->count[i][j];
+	}
+	for (j = 0; j < Chunk_Counters; j++) st->perf_on[j] |= w->perf_on[j];
+	st->readins += w->readins;
+}
+
+/* The table on fp, then the JSON line.  size is the object size, for the
+   throughput of the whole run. */
+static inline void chunk_stage_report(chunk_stage *st, FILE *fp, const char *tool, long size)
+{
+	uint64_t wall, sum, other, total, *c;
+	int i, j;
+
+	wall = chunk_stage_now()-st->start;
+	sum = 0;
+	for (i = 0; i < Chunk_Stages; i++) sum += st->ns[i];
+	other = (wall > sum) ? wall-sum : 0;
+	total = sum+other;
+	if (total == 0) total = 1;
+
+	fprintf(fp, "%-8s %14s %7s %14s %12s", "stage", "sec", "%", "bytes", "MB/sec");
+	if (st->perf_on[Counter_Cycles]) fprintf(fp, " %7s %10s %12s", "IPC", "bytes/miss", "DRAM MB/sec");
+	fprintf(fp, "\n");
+	for (i = 0; i < Chunk_Stages; i++) {
+		c = st->count[i];
+		fprintf(fp, "%-8s %14.9f %6.2f%% %14llu ", chunk_stage_names[i], st->ns[i]/1e9, 100.0*st->ns[i]/total,
+			(unsigned long long) st->bytes[i]);
+		if (st->ns[i] > 0 && st->bytes[i] > 0) fprintf(fp, "%12.3f", st->bytes[i]/1024.0/1024.0/(st->ns[i]/1e9));
+		else fprintf(fp, "%12s", "-");
+		if (st->perf_on[Counter_Cycles]) {
+			if (st->perf_on[Counter_Instructions] && c[Counter_Cycles] > 0) {
+				fprintf(fp, " %7.3f", (double) c[Counter_Instructions]/c[Counter_Cycles]);
+			}
+			else fprintf(fp, " %7s", "-");
+			if (st->perf_on[Counter_Misses] && c[Counter_Misses] > 0 && st->bytes[i] > 0) {
+				fprintf(fp, " %10.1f", (double) st->bytes[i]/c[Counter_Misses]);
+			}
+			else fprintf(fp, " %10s", "-");
+			if (st->perf_on[Counter_Misses] && st->ns[i] > 0) {
+				fprintf(fp, " %12.3f", (double) c[Counter_Misses]*CHUNK_STAGE_LINE/1024.0/1024.0/(st->ns[i]/1e9));
+			}
+			else fprintf(fp, " %12s", "-");
+		}
+		fprintf(fp, "\n");
+	}
+	fprintf(fp, "%-8s %14.9f %6.2f%%\n", "other", other/1e9, 100.0*other/total);
+	fprintf(fp, "%-8s %14.9f  (%d thread%s, %ld read-ins, %0.3f MB/sec)\n", "wall", wall/1e9, st->threads,
+		(st->threads == 1) ? "" : "s", st->readins, (wall > 0) ? size/1024.0/1024.0/(wall/1e9) : 0.0);
+
+	fprintf(fp, "{\"stages\": {\"tool\": \"%s\", \"size\": %ld, \"readins\": %ld, \"threads\": %d, \"wall_ns\": %llu, \"other_ns\": %llu",
+		tool, size, st->readins, st->threads, (unsigned long long) wall, (unsigned long long) other);
+	for (i = 0; i < Chunk_Stages; i++) {
+		fprintf(fp, ", \"%s\": {\"ns\": %llu, \"bytes\": %llu", chunk_stage_names[i],
+			(unsigned long long) st->ns[i], (unsigned long long) st->bytes[i]);
+		for (j = 0; j < Chunk_Counters; j++) {
+			if (st->perf_on[j]) fprintf(fp, ", \"%s\": %llu", chunk_counter_names[j], (unsigned long long) st->count[i][j]);
+		}
+		fprintf(fp, "}");
+	}
+	fprintf(fp, "}}\n");
+}
+
+#endif
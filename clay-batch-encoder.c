@@ -0,0 +1,586 @@
+/* *
+ * clay-batch-encoder.c - Clay encoding of many objects in one process.
+ *
+ * usage: manifest k m coding_technique w packetsize buffersize threads [numa]
+ *
+ * The manifest lists one input file per line (blank lines and lines
+ * starting with '#' are skipped).  Every object ends up exactly as
+ * clay-encoder writes it, Coding/<name>_k#/_m# with a chunk header each, so
+ * clay-decoder reads it back unchanged.
+ *
+ * The coding matrix, bitmatrix and schedule are built once and shared by
+ * every thread.  Each thread owns one arena of stripe buffers, sized for
+ * the largest read-in of the batch and reused by all of its tasks.
+ *
+ * An object is cut into tasks of one read-in (buffersize bytes, or
+ * BATCH_TASKSIZE for buffersize 0).  The tasks of an object are dealt to
+ * the deque of one thread, objects round robin.  A thread pops from the
+ * bottom of its own deque and, once that is empty, steals from the top of
+ * the others, so the read-ins of one huge object are spread over all
+ * threads instead of stalling the batch.  A task reads its range with
+ * pread, encodes and couples its M layers and writes the sub-chunks of
+ * every chunk file with one pwritev.  The thread that finishes the last
+ * task of an object writes the headers, with the CRCs, and trims the
+ * files.
+ *
+ * With numa, thread i is pinned to a CPU of node i % nodes and allocates
+ * its arena there (chunk-numa.h).  Objects are dealt to nodes round robin
+ * and to the threads of a node in turn, and an idle thread steals from the
+ * threads of its own node before it goes to another one.  A task is always
+ * done start to end by one thread, so no layer of a stripe is touched from
+ * the other socket.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include "jerasure.h"
+#include "galois.h"
+#include "reed_sol.h"
+#include "cauchy.h"
+#include "liberation.h"
+#include "chunk-io.h"
+#include "chunk-header.h"
+#include "crc32c.h"
+#include "chunk-numa.h"
+#include "coupling.h"
+
+#define M 128
+#define r 2
+
+/* Read-in size of a task when buffersize is 0 */
+#define BATCH_TASKSIZE (4L*1024*1024)
+
+enum Coding_Technique {Reed_Sol_Van, Reed_Sol_R6_Op, Cauchy_Orig, Cauchy_Good, Liberation, Blaum_Roth, Liber8tion, RDP, EVENODD, No_Coding};
+
+typedef struct {
+	char *path;
+	char *name, *ext;		/* chunk files are Coding/name_k#ext */
+	long size;
+	long buffersize;		/* as recorded in the header */
+	long blocksize;
+	int readins;
+	uint32_t *crc;			/* (k+m)*readins*M, file by file */
+	int remaining;			/* tasks not finished yet */
+} batch_object;
+
+typedef struct {
+	batch_object *obj;
+	int n;				/* read-in, from 0 */
+} batch_task;
+
+typedef struct {
+	pthread_mutex_t lock;
+	batch_task *t;
+	int head, tail;			/* tasks are t[head..tail-1] */
+} batch_deque;
+
+typedef struct {
+	int id;
+	int node, cpu;			/* with numa: sysfs node number and CPU */
+	pthread_t tid;
+	char *udata, *ucod;		/* uncoupled layers, k and m sub-chunks each */
+	char *cdata, *ccod;		/* coupled layers */
+	char **data, **coding;
+	struct iovec *iov;
+	long tasks, stolen;
+	long remote;			/* stolen from a thread on another node */
+	double busy;			/* seconds spent in tasks */
+} batch_worker;
+
+/* Shared by all threads, read-only once they run */
+int k, m, w, cw, packetsize;
+enum Coding_Technique tech;
+int *matrix, *bitmatrix, **schedule;
+long arena;				/* largest blocksize of the batch */
+int md;
+char *curdir;
+int nthreads;
+batch_deque *deques;
+batch_worker *workers;
+int use_numa;
+chunk_numa numa;
+int nodes;				/* 1 without numa */
+
+/* Wall clock; timing.h measures the CPU time of the whole process, which
+   grows with the number of threads */
+static double batch_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec/1e9;
+}
+
+/* One layer through the MDS code */
+static void batch_mds(char **data, char **coding, long blocksize)
+{
+	switch (tech) {
+		case Reed_Sol_Van:
+			jerasure_matrix_encode(k, m, w, matrix, data, coding, blocksize);
+			break;
+		default:
+			jerasure_schedule_encode(k, m, w, schedule, data, coding, blocksize, packetsize);
+	}
+}
+
+static void chunk_name(char *fname, batch_object *o, int node)
+{
+	if (node < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, o->name, md, node+1, o->ext);
+	else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, o->name, md, node-k+1, o->ext);
+}
+
+/* Last task of o is done: headers with the CRCs go in front, and anything
+   left over from an older, longer encoding is cut off */
+static void batch_finish(batch_object *o)
+{
+	chunk_header chdr;
+	uint64_t *choff;
+	char *hbuf;
+	char *fname;
+	int i, fd;
+
+	choff = (uint64_t *)malloc(sizeof(uint64_t)*M);
+	chunk_header_init(&chdr, choff, Chunk_Clay, k, m, w, M, tech, packetsize, o->size, o->buffersize, o->blocksize, o->readins);
+	hbuf = chunk_io_alloc(chdr.hdr_size);
+	fname = (char *)malloc(sizeof(char)*(strlen(curdir)+strlen(o->name)+strlen(o->ext)+32));
+	for (i = 0; i < k+m; i++) {
+		chunk_header_pack(&chdr, choff, o->crc+(long)i*o->readins*M, i, hbuf);
+		chunk_name(fname, o, i);
+		fd = open(fname, O_WRONLY);
+		if (fd < 0) { perror(fname); exit(1); }
+		if (chunk_io_blocking(fd, hbuf, chdr.hdr_size, 0, 1) != chdr.hdr_size) { perror(fname); exit(1); }
+		if (ftruncate(fd, chdr.hdr_size+(off_t)o->readins*M*o->blocksize) != 0) { perror(fname); exit(1); }
+		close(fd);
+	}
+	free(fname);
+	free(hbuf);
+	free(choff);
+	free(o->crc);
+}
+
+/* Read-in t->n of t->obj: read, encode, couple, checksum and write */
+static void batch_encode(batch_worker *wk, batch_task *t)
+{
+	batch_object *o;
+	long bs, off, len, got, ret;
+	int fd, i, z, node, p;
+	char *u, *c, *partner;
+	char *fname;
+
+	o = t->obj;
+	bs = o->blocksize;
+
+	/* Uncoupled data: the object bytes, zero-padded past its end */
+	off = (long) t->n*k*M*bs;
+	len = o->size-off;
+	if (len > k*M*bs) len = k*M*bs;
+	got = 0;
+	if (len > 0) {
+		fd = open(o->path, O_RDONLY);
+		if (fd < 0) { perror(o->path); exit(1); }
+		while (got < len) {
+			ret = pread(fd, wk->udata+got, len-got, off+got);
+			if (ret <= 0) { perror(o->path); exit(1); }
+			got += ret;
+		}
+		close(fd);
+	}
+	memset(wk->udata+got, 0, k*M*bs-got);
+
+	/* Uncoupled parity, layer by layer */
+	for (z = 0; z < M; z++) {
+		for (i = 0; i < k; i++) wk->data[i] = wk->udata+((long)z*k+i)*bs;
+		for (i = 0; i < m; i++) wk->coding[i] = wk->ucod+((long)z*m+i)*bs;
+		batch_mds(wk->data, wk->coding, bs);
+	}
+
+	/* Couple: node t of pair p = t/2 is stored as is in layer z when bit p
+	   of z is t%2, and as U + r*U' of its partner in layer z^(1<<p)
+	   otherwise */
+	for (node = 0; node < k+m; node++) {
+		p = node/2;
+		for (z = 0; z < M; z++) {
+			if (node < k) {
+				u = wk->udata+((long)z*k+node)*bs;
+				c = wk->cdata+((long)z*k+node)*bs;
+			}
+			else {
+				u = wk->ucod+((long)z*m+node-k)*bs;
+				c = wk->ccod+((long)z*m+node-k)*bs;
+			}
+			memcpy(c, u, bs);
+			if (((z >> p) & 1) != node%2) {
+				i = (z ^ (1 << p));
+				if ((node^1) < k) partner = wk->udata+((long)i*k+(node^1))*bs;
+				else partner = wk->ucod+((long)i*m+(node^1)-k)*bs;
+				coupling_region_multiply(partner, r, bs, c, 1, cw);
+			}
+			o->crc[((long)node*o->readins+t->n)*M+z] = crc32c(0, c, bs);
+			wk->iov[z].iov_base = c;
+			wk->iov[z].iov_len = bs;
+		}
+
+		/* Layer order on disk, one pwritev for the whole read-in */
+		fname = (char *)malloc(sizeof(char)*(strlen(curdir)+strlen(o->name)+strlen(o->ext)+32));
+		chunk_name(fname, o, node);
+		fd = open(fname, O_WRONLY | O_CREAT, 0644);
+		if (fd < 0) { perror(fname); exit(1); }
+		if (chunk_io_vec(fd, wk->iov, M, chunk_header_size(M, o->readins)+(off_t)t->n*M*bs, 1) != (long)M*bs) {
+			perror(fname);
+			exit(1);
+		}
+		close(fd);
+		free(fname);
+	}
+
+	if (__sync_sub_and_fetch(&o->remaining, 1) == 0) batch_finish(o);
+}
+
+/* Own deque from the bottom, then the others from the top: first those
+   on the same node, then the rest */
+static int batch_next(batch_worker *wk, batch_task *t)
+{
+	batch_deque *d;
+	int i, pass, v;
+
+	d = &deques[wk->id];
+	pthread_mutex_lock(&d->lock);
+	if (d->tail > d->head) {
+		*t = d->t[--d->tail];
+		pthread_mutex_unlock(&d->lock);
+		return 1;
+	}
+	pthread_mutex_unlock(&d->lock);
+	for (pass = 0; pass < 2; pass++) {
+		for (i = 1; i < nthreads; i++) {
+			v = (wk->id+i)%nthreads;
+			if ((v%nodes == wk->id%nodes) != (pass == 0)) continue;
+			d = &deques[v];
+			pthread_mutex_lock(&d->lock);
+			if (d->tail > d->head) {
+				*t = d->t[d->head++];
+				pthread_mutex_unlock(&d->lock);
+				wk->stolen++;
+				if (pass == 1) wk->remote++;
+				return 1;
+			}
+			pthread_mutex_unlock(&d->lock);
+		}
+	}
+	return 0;
+}
+
+static void *batch_worker_main(void *arg)
+{
+	batch_worker *wk;
+	batch_task t;
+	double t1;
+
+	wk = (batch_worker *) arg;
+
+	/* The arena is touched first by the thread that uses it */
+	if (use_numa) {
+		chunk_numa_pin(&numa, wk->id);
+		wk->udata = chunk_numa_alloc(wk->node, sizeof(char)*k*M*arena);
+		wk->ucod = chunk_numa_alloc(wk->node, sizeof(char)*m*M*arena);
+		wk->cdata = chunk_numa_alloc(wk->node, sizeof(char)*k*M*arena);
+		wk->ccod = chunk_numa_alloc(wk->node, sizeof(char)*m*M*arena);
+	}
+	else {
+		wk->udata = chunk_io_alloc(sizeof(char)*k*M*arena);
+		wk->ucod = chunk_io_alloc(sizeof(char)*m*M*arena);
+		wk->cdata = chunk_io_alloc(sizeof(char)*k*M*arena);
+		wk->ccod = chunk_io_alloc(sizeof(char)*m*M*arena);
+	}
+	wk->data = (char **)malloc(sizeof(char*)*k);
+	wk->coding = (char **)malloc(sizeof(char*)*m);
+	wk->iov = (struct iovec *)malloc(sizeof(struct iovec)*M);
+
+	while (batch_next(wk, &t)) {
+		t1 = batch_now();
+		batch_encode(wk, &t);
+		wk->busy += batch_now()-t1;
+		wk->tasks++;
+	}
+
+	free(wk->udata);
+	free(wk->ucod);
+	free(wk->cdata);
+	free(wk->ccod);
+	free(wk->data);
+	free(wk->coding);
+	free(wk->iov);
+	return NULL;
+}
+
+int main(int argc, char **argv)
+{
+	FILE *fp;
+	char line[4096];
+	char *s;
+	batch_object *objs;
+	int nobjs, cap;
+	int ntasks;
+	long buffersize, unit_size, newsize, total, up, down;
+	int i, j, n, v;
+	struct stat status;
+	double t1;
+	double tsec;
+	char **pdata, **pcoding;
+	char *zero;
+
+	if (argc != 9 && argc != 10) {
+		fprintf(stderr, "usage: manifest k m coding_technique w packetsize buffersize threads [numa]\n");
+		fprintf(stderr, "\nmanifest lists one inputfile per line; each is encoded as clay-encoder would.");
+		fprintf(stderr, "\nChoose one of: reed_sol_van, cauchy_orig, cauchy_good, liberation, blaum_roth.");
+		fprintf(stderr, "\nBuffersize is the size of one task; 0 means %ld bytes.", BATCH_TASKSIZE);
+		fprintf(stderr, "\nnuma pins the threads and keeps each object on one NUMA node.\n\n");
+		exit(0);
+	}
+	if (sscanf(argv[2], "%d", &k) != 1 || k <= 0 || sscanf(argv[3], "%d", &m) != 1 || m <= 0) {
+		fprintf(stderr, "Invalid value for k or m\n");
+		exit(0);
+	}
+	if ((1 << ((k+m)/2)) != M || (k+m)%2 != 0) {
+		fprintf(stderr, "The Clay code here has %d layers: k+m must be 14\n", M);
+		exit(0);
+	}
+	if (sscanf(argv[5], "%d", &w) != 1 || w <= 0) {
+		fprintf(stderr, "Invalid value for w.\n");
+		exit(0);
+	}
+	if (sscanf(argv[6], "%d", &packetsize) != 1 || packetsize < 0) {
+		fprintf(stderr, "Invalid value for packetsize.\n");
+		exit(0);
+	}
+	if (sscanf(argv[7], "%ld", &buffersize) != 1 || buffersize < 0) {
+		fprintf(stderr, "Invalid value for buffersize\n");
+		exit(0);
+	}
+	if (sscanf(argv[8], "%d", &nthreads) != 1 || nthreads <= 0) {
+		fprintf(stderr, "Invalid value for threads\n");
+		exit(0);
+	}
+	use_numa = 0;
+	if (argc == 10) {
+		if (strcmp(argv[9], "numa") != 0) {
+			fprintf(stderr, "Unknown option %s\n", argv[9]);
+			exit(0);
+		}
+		use_numa = 1;
+	}
+	nodes = 1;
+	if (use_numa) {
+		chunk_numa_init(&numa);
+		nodes = (numa.nodes < nthreads) ? numa.nodes : nthreads;
+	}
+
+	/* Coding technique; the matrix, bitmatrix and schedule are shared */
+	matrix = NULL;
+	bitmatrix = NULL;
+	schedule = NULL;
+	if (strcmp(argv[4], "reed_sol_van") == 0) {
+		tech = Reed_Sol_Van;
+		if (w != 8 && w != 16 && w != 32) {
+			fprintf(stderr, "w must be one of {8, 16, 32}\n");
+			exit(0);
+		}
+		matrix = reed_sol_vandermonde_coding_matrix(k, m, w);
+		packetsize = 0;
+	}
+	else if (strcmp(argv[4], "cauchy_orig") == 0 || strcmp(argv[4], "cauchy_good") == 0) {
+		tech = (argv[4][7] == 'o') ? Cauchy_Orig : Cauchy_Good;
+		if (packetsize == 0) {
+			fprintf(stderr, "Must include packetsize.\n");
+			exit(0);
+		}
+		matrix = (tech == Cauchy_Orig) ? cauchy_original_coding_matrix(k, m, w) : cauchy_good_general_coding_matrix(k, m, w);
+		bitmatrix = jerasure_matrix_to_bitmatrix(k, m, w, matrix);
+	}
+	else if (strcmp(argv[4], "liberation") == 0) {
+		tech = Liberation;
+		if (packetsize == 0 || k > w) {
+			fprintf(stderr, "Must include packetsize, and k must be less than or equal to w\n");
+			exit(0);
+		}
+		bitmatrix = liberation_coding_bitmatrix(k, w);
+	}
+	else if (strcmp(argv[4], "blaum_roth") == 0) {
+		tech = Blaum_Roth;
+		if (packetsize == 0 || k > w) {
+			fprintf(stderr, "Must include packetsize, and k must be less than or equal to w\n");
+			exit(0);
+		}
+		bitmatrix = blaum_roth_coding_bitmatrix(k, w);
+	}
+	else {
+		fprintf(stderr, "Not a valid coding technique.\n");
+		exit(0);
+	}
+	if (bitmatrix != NULL) {
+		schedule = jerasure_smart_bitmatrix_to_schedule(k, m, w, bitmatrix);
+	}
+	cw = coupling_w(w);
+
+	/* A read-in is M layers of k sub-chunks, each a whole number of words
+	   (or packets) */
+	if (packetsize != 0) unit_size = sizeof(long)*w*k*packetsize*M;
+	else unit_size = sizeof(long)*w*k*M;
+	if (buffersize == 0) buffersize = BATCH_TASKSIZE;
+
+	/* Closest valid buffersize, the way clay-encoder picks it, so the same
+	   arguments give the same chunk files */
+	if (buffersize%unit_size != 0) {
+		up = (buffersize/unit_size+1)*unit_size;
+		down = (buffersize/unit_size)*unit_size;
+		if (down == 0 || up-buffersize <= buffersize-down) buffersize = up;
+		else buffersize = down;
+	}
+
+	curdir = (char *)malloc(sizeof(char)*1000);
+	if (getcwd(curdir, 1000) == NULL) { perror("getcwd"); exit(1); }
+	i = mkdir("Coding", S_IRWXU);
+	if (i == -1 && errno != EEXIST) {
+		fprintf(stderr, "Unable to create Coding directory.\n");
+		exit(0);
+	}
+	sprintf(line, "%d", k);
+	md = strlen(line);
+
+	/* Objects and their read-ins */
+	fp = fopen(argv[1], "r");
+	if (fp == NULL) { perror(argv[1]); exit(1); }
+	nobjs = 0;
+	cap = 64;
+	objs = (batch_object *)malloc(sizeof(batch_object)*cap);
+	ntasks = 0;
+	arena = 0;
+	total = 0;
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		line[strcspn(line, "\r\n")] = '\0';
+		if (line[0] == '\0' || line[0] == '#') continue;
+		if (stat(line, &status) != 0) { perror(line); exit(1); }
+		if (nobjs == cap) {
+			cap *= 2;
+			objs = (batch_object *)realloc(objs, sizeof(batch_object)*cap);
+		}
+		objs[nobjs].path = strdup(line);
+		s = strrchr(line, '/');
+		objs[nobjs].name = strdup(s != NULL ? s+1 : line);
+		s = strchr(objs[nobjs].name, '.');
+		if (s != NULL) {
+			objs[nobjs].ext = strdup(s);
+			*s = '\0';
+		}
+		else {
+			objs[nobjs].ext = strdup("");
+		}
+		objs[nobjs].size = status.st_size;
+		newsize = ((status.st_size+unit_size-1)/unit_size)*unit_size;
+		if (newsize == 0) newsize = unit_size;
+		if (status.st_size > buffersize) {
+			objs[nobjs].readins = (newsize+buffersize-1)/buffersize;
+			objs[nobjs].buffersize = buffersize;
+			objs[nobjs].blocksize = buffersize/k/M;
+		}
+		else {
+			objs[nobjs].readins = 1;
+			objs[nobjs].buffersize = status.st_size;
+			objs[nobjs].blocksize = newsize/k/M;
+		}
+		objs[nobjs].remaining = objs[nobjs].readins;
+		objs[nobjs].crc = (uint32_t *)malloc(sizeof(uint32_t)*(k+m)*objs[nobjs].readins*M);
+		if (objs[nobjs].crc == NULL) { perror("malloc"); exit(1); }
+		if (objs[nobjs].blocksize > arena) arena = objs[nobjs].blocksize;
+		ntasks += objs[nobjs].readins;
+		total += status.st_size;
+		nobjs++;
+	}
+	fclose(fp);
+
+	/* Lazily built GF tables are not thread-safe: build them all here
+	   with one throwaway layer */
+	zero = chunk_io_alloc(sizeof(char)*(k+m)*(unit_size/k/M));
+	memset(zero, 0, (k+m)*(unit_size/k/M));
+	pdata = (char **)malloc(sizeof(char*)*k);
+	pcoding = (char **)malloc(sizeof(char*)*m);
+	for (i = 0; i < k; i++) pdata[i] = zero+i*(unit_size/k/M);
+	for (i = 0; i < m; i++) pcoding[i] = zero+(k+i)*(unit_size/k/M);
+	batch_mds(pdata, pcoding, unit_size/k/M);
+	coupling_region_multiply(pdata[0], r, unit_size/k/M, pdata[1], 1, cw);
+	crc32c(0, zero, 1);
+	free(zero);
+	free(pdata);
+	free(pcoding);
+
+	/* Deal the tasks out, all read-ins of an object to the same deque.
+	   Object i goes to node i % nodes and there to its threads in turn;
+	   thread j is on node j % nodes. */
+	deques = (batch_deque *)malloc(sizeof(batch_deque)*nthreads);
+	workers = (batch_worker *)malloc(sizeof(batch_worker)*nthreads);
+	for (i = 0; i < nthreads; i++) {
+		pthread_mutex_init(&deques[i].lock, NULL);
+		deques[i].t = (batch_task *)malloc(sizeof(batch_task)*(ntasks+1));
+		deques[i].head = 0;
+		deques[i].tail = 0;
+	}
+	for (i = 0; i < nobjs; i++) {
+		v = i%nodes;
+		v += nodes*((i/nodes)%((nthreads-v+nodes-1)/nodes));
+		/* Pushed last-first, so the owner pops read-in 0 first */
+		for (n = objs[i].readins-1; n >= 0; n--) {
+			j = deques[v].tail++;
+			deques[v].t[j].obj = &objs[i];
+			deques[v].t[j].n = n;
+		}
+	}
+
+	t1 = batch_now();
+	for (i = 0; i < nthreads; i++) {
+		memset(&workers[i], 0, sizeof(batch_worker));
+		workers[i].id = i;
+		if (use_numa) {
+			workers[i].node = chunk_numa_id(&numa, i);
+			workers[i].cpu = chunk_numa_cpu(&numa, i);
+		}
+		if (pthread_create(&workers[i].tid, NULL, batch_worker_main, &workers[i]) != 0) {
+			perror("pthread_create");
+			exit(1);
+		}
+	}
+	for (i = 0; i < nthreads; i++) pthread_join(workers[i].tid, NULL);
+	tsec = batch_now()-t1;
+
+	for (i = 0; i < nthreads; i++) {
+		if (use_numa) printf("thread %d (node %d, cpu %d): %ld tasks, %ld stolen, %ld remote, %0.6f sec busy\n", i, workers[i].node, workers[i].cpu, workers[i].tasks, workers[i].stolen, workers[i].remote, workers[i].busy);
+		else printf("thread %d: %ld tasks, %ld stolen, %0.6f sec busy\n", i, workers[i].tasks, workers[i].stolen, workers[i].busy);
+	}
+	printf("objects: %d\n", nobjs);
+	printf("tasks: %d\n", ntasks);
+	printf("time(sec): %0.10f\n", tsec);
+	printf("Encoding (MB/sec): %0.10f\n", (((double) total)/1024.0/1024.0)/tsec);
+
+	for (i = 0; i < nthreads; i++) free(deques[i].t);
+	for (i = 0; i < nobjs; i++) {
+		free(objs[i].path);
+		free(objs[i].name);
+		free(objs[i].ext);
+	}
+	free(objs);
+	free(deques);
+	free(workers);
+	free(curdir);
+	if (use_numa) chunk_numa_exit(&numa);
+	return 0;
+}
@@ -0,0 +1,921 @@
+/* *
+ * clay-bench.c - one benchmark for RS, the mul code and Clay.
+ *
+ * usage: k m coding_technique w packetsize blocksize threads stripes csv|json
+ *        [codes] [dir path] [latency]
+ *
+ * k, m, coding_technique, w, blocksize and threads may each be a comma
+ * separated list, and every combination is run for each of the codes
+ * (default "rs,mul,clay").  blocksize is the size of one chunk; it is
+ * rounded down so that each of its sub-chunks is a whole number of coding
+ * units, and the size actually used is reported.
+ *
+ * All three are run as the same kind of code: M layers of an MDS code
+ * (the Jerasure technique given), whose nodes are then coupled in pairs.
+ * Pair p (nodes 2p and 2p+1) is coupled across the two layers that differ
+ * in bit bit[p] of the layer index, with
+ *
+ *      C[lo][2p+1] = U[lo][2p+1] + a * U[hi][2p]
+ *      C[hi][2p]   = U[hi][2p]   + b * U[lo][2p+1]
+ *
+ * and U = C elsewhere.  rs has one layer and no pairs; mul is the code of
+ * mul-encoder (k=10, m=4, 8 layers, a=1, b=e[]); clay is clay-encoder's
+ * (bit[p] = p, 2^((k+m)/2) layers, a=b=2).  So every code goes through the
+ * same buffers, the same layer encode and decode, and the same reads.
+ *
+ * Each thread works on its own stripes; per stripe it does
+ *
+ *   encode     the object into k+m chunks, which are stored
+ *   decode     a degraded read: the object back with chunk 0 lost
+ *   repair     every chunk in turn rebuilt alone: the Clay way, from the
+ *              layers with bit[p] = t%2 of k+m-1 helpers, when no other
+ *              pair shares bit[p], and from k whole chunks otherwise
+ *   multi      chunks 0..m-1 rebuilt together from the other k
+ *
+ * Chunks are stored in memory, or in dir/bench_<thread>_<node> with "dir",
+ * and every read goes through the same fetch, which counts the bytes.
+ * Each operation is run once to check its result and then timed over
+ * "stripes" stripes in every thread, by the wall clock.  encode, decode
+ * and multi are in MB of object per second, repair in MB rebuilt per
+ * second; repair_read and multi_read are the bytes read by one of them.
+ *
+ * With "latency", blocksize is the size of one object instead, and each
+ * encode, decode and repair (of one chunk, a different one each time) is
+ * timed on its own, "stripes" of them per thread.  The matrices and
+ * buffers are set up once per row and reused by every object, as a
+ * long-running service would; setup_us is what building the matrices
+ * costs, which the tools pay on every invocation.  An object only pads
+ * its sub-chunks to what Jerasure needs, whole longs or whole packets,
+ * not to the w*sizeof(long) units the encoders use, so a 4 KiB object is
+ * a stripe of 10 KiB rather than 80 KiB with k=10, m=4 and w=8.  Each row
+ * has the mean, the 50th, 99th and 99.9th percentiles and the maximum of
+ * one operation, in microseconds.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <pthread.h>
+#include "jerasure.h"
+#include "galois.h"
+#include "reed_sol.h"
+#include "cauchy.h"
+#include "liberation.h"
+#include "chunk-io.h"
+#include "coupling.h"
+
+#define MAXN 32			/* nodes */
+#define MAXM 1024		/* layers */
+#define r 2
+
+enum Coding_Technique {Reed_Sol_Van, Reed_Sol_R6_Op, Cauchy_Orig, Cauchy_Good, Liberation, Blaum_Roth, Liber8tion, RDP, EVENODD, No_Coding};
+
+char *Methods[] = {"reed_sol_van", "reed_sol_r6_op", "cauchy_orig", "cauchy_good", "liberation", "blaum_roth", "liber8tion", NULL};
+
+enum Bench_Op {Op_Encode, Op_Decode, Op_Repair, Op_Multi};
+
+char *Ops[] = {"encode", "decode", "repair", "multi"};
+
+typedef struct {
+	const char *name;
+	int k, m, n, w, cw, tech, packetsize;
+	int M;				/* layers */
+	int bit[MAXN/2];		/* layer bit of pair p, -1 if not coupled */
+	int a[MAXN/2], b[MAXN/2];
+	int inv[MAXN/2];		/* 1/(1+ab) */
+	int *matrix, *bitmatrix;
+	int **schedule;
+	long sub, chunk;		/* bytes in a sub-chunk and a chunk */
+	double setup;			/* seconds to build the matrices */
+	char *dir;			/* file store, NULL in memory */
+} bench_code;
+
+typedef struct {
+	bench_code *c;
+	int id;
+	int fd[MAXN];
+	char *store[MAXN];		/* chunks, in memory */
+	char *in;			/* object: layer z, node t at (z*k+t)*sub */
+	char *C[MAXN], *U[MAXN];	/* chunk t, sub-chunk z at z*sub */
+	int erased[MAXN];
+	int done[MAXM];
+	long read;			/* bytes fetched */
+	int op, stripes;
+	int only;			/* repair: the one chunk to rebuild, -1 all */
+	double *lat;			/* seconds of each op, latency mode */
+	int err;
+	pthread_t tid;
+} bench_thread;
+
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec/1e9;
+}
+
+static int is_prime(int w)
+{
+	int i;
+
+	if (w < 2) return 0;
+	for (i = 2; i*i <= w; i++) if (w % i == 0) return 0;
+	return 1;
+}
+
+/* Splits a comma separated list of ints; returns how many */
+static int int_list(char *s, int *v, int max, const char *what)
+{
+	int n;
+	char *e;
+
+	for (n = 0; n < max; n++) {
+		v[n] = strtol(s, &e, 10);
+		if (e == s || (*e != ',' && *e != '\0')) {
+			fprintf(stderr, "Invalid value for %s\n", what);
+			exit(0);
+		}
+		if (*e == '\0') return n+1;
+		s = e+1;
+	}
+	fprintf(stderr, "Too many values for %s\n", what);
+	exit(0);
+}
+
+/* Pair p is coupled in layer z at node t */
+static int coupled(bench_code *c, int z, int t)
+{
+	int p;
+
+	p = t/2;
+	if (t >= 2*(c->n/2) || c->bit[p] < 0) return 0;
+	return ((z >> c->bit[p]) & 1) != t%2;
+}
+
+/* Coefficient of the partner's U in C[z][t] */
+static int coef(bench_code *c, int t)
+{
+	return (t%2) ? c->a[t/2] : c->b[t/2];
+}
+
+static int partner_layer(bench_code *c, int z, int t)
+{
+	return z ^ (1 << c->bit[t/2]);
+}
+
+/* Matrices and coupling of one code, or -1 (said why) if it does not
+   apply to these parameters.  object > 0 sizes the sub-chunks to hold an
+   object of that many bytes instead of blocksize. */
+static int code_setup(bench_code *c, const char *name, int k, int m, int w, int tech, int packetsize, long blocksize, long object)
+{
+	static int e[7] = {20, 18, 17, 16, 15, 13, 167};	/* mul-encoder.c */
+	long unit;
+	double t1;
+	int p, ab;
+
+	memset(c, 0, sizeof(bench_code));
+	c->name = name;
+	c->k = k;
+	c->m = m;
+	c->n = k+m;
+	c->w = w;
+	c->cw = coupling_w(w);
+	c->tech = tech;
+	c->packetsize = packetsize;
+	for (p = 0; p < MAXN/2; p++) c->bit[p] = -1;
+	if (c->n > MAXN) {
+		fprintf(stderr, "%s: k+m is at most %d\n", name, MAXN);
+		return -1;
+	}
+
+	if (strcmp(name, "rs") == 0) {
+		c->M = 1;
+	}
+	else if (strcmp(name, "mul") == 0) {
+		if (k != 10 || m != 4) {
+			fprintf(stderr, "mul: only k=10 m=4\n");
+			return -1;
+		}
+		c->M = 8;
+		c->bit[0] = 0;
+		c->bit[1] = c->bit[2] = c->bit[3] = 1;
+		c->bit[4] = c->bit[5] = c->bit[6] = 2;
+		for (p = 0; p < 7; p++) {
+			c->a[p] = 1;
+			c->b[p] = e[p < 5 ? p : p-5];
+		}
+	}
+	else if (strcmp(name, "clay") == 0) {
+		if (c->n % 2 != 0 || (1L << (c->n/2)) > MAXM) {
+			fprintf(stderr, "clay: k+m must be even, and 2^((k+m)/2) at most %d layers\n", MAXM);
+			return -1;
+		}
+		c->M = 1 << (c->n/2);
+		for (p = 0; p < c->n/2; p++) {
+			c->bit[p] = p;
+			c->a[p] = r;
+			c->b[p] = r;
+		}
+	}
+	else {
+		fprintf(stderr, "Unknown code %s\n", name);
+		return -1;
+	}
+	for (p = 0; p < c->n/2; p++) {
+		if (c->bit[p] < 0) continue;
+		ab = galois_single_multiply(c->a[p], c->b[p], c->cw);
+		c->inv[p] = galois_single_divide(1, 1 ^ ab, c->cw);
+	}
+
+	t1 = bench_now();
+	switch (tech) {
+		case Reed_Sol_Van:
+			if (w != 8 && w != 16 && w != 32) goto bad_w;
+			c->matrix = reed_sol_vandermonde_coding_matrix(k, m, w);
+			break;
+		case Reed_Sol_R6_Op:
+			if (m != 2 || (w != 8 && w != 16 && w != 32)) goto bad_w;
+			c->matrix = reed_sol_r6_coding_matrix(k, w);
+			break;
+		case Cauchy_Orig:
+		case Cauchy_Good:
+			if (w < 1 || w > 32 || (1L << w) < c->n) goto bad_w;
+			c->matrix = (tech == Cauchy_Orig) ? cauchy_original_coding_matrix(k, m, w) : cauchy_good_general_coding_matrix(k, m, w);
+			c->bitmatrix = jerasure_matrix_to_bitmatrix(k, m, w, c->matrix);
+			break;
+		case Liberation:
+			if (m != 2 || w < k || !is_prime(w)) goto bad_w;
+			c->bitmatrix = liberation_coding_bitmatrix(k, w);
+			break;
+		case Blaum_Roth:
+			if (m != 2 || w < k || !is_prime(w+1)) goto bad_w;
+			c->bitmatrix = blaum_roth_coding_bitmatrix(k, w);
+			break;
+		case Liber8tion:
+			if (m != 2 || w != 8 || k > 8) goto bad_w;
+			c->bitmatrix = liber8tion_coding_bitmatrix(k);
+			break;
+	}
+	if (c->bitmatrix != NULL) {
+		if (packetsize <= 0) {
+			fprintf(stderr, "%s %s needs a packetsize\n", name, Methods[tech]);
+			return -1;
+		}
+		c->schedule = jerasure_smart_bitmatrix_to_schedule(k, m, w, c->bitmatrix);
+		unit = (long)w*packetsize*sizeof(long);
+	}
+	else {
+		unit = (long)w*sizeof(long);
+	}
+	c->setup = bench_now()-t1;
+	if (object > 0) {
+		/* Only what Jerasure needs: whole longs, or whole packets */
+		unit = (c->bitmatrix != NULL) ? (long)w*packetsize : (long)sizeof(long);
+		c->sub = (object+(long)k*c->M-1)/((long)k*c->M);
+		c->sub = (c->sub+unit-1)/unit*unit;
+	}
+	else c->sub = blocksize/c->M/unit*unit;
+	c->chunk = c->sub*c->M;
+	if (c->sub == 0) {
+		fprintf(stderr, "%s: blocksize %ld is less than %d sub-chunks of %ld bytes\n", name, blocksize, c->M, unit);
+		return -1;
+	}
+	return 0;
+
+bad_w:
+	fprintf(stderr, "%s: %s does not work with k=%d m=%d w=%d\n", name, Methods[tech], k, m, w);
+	return -1;
+}
+
+static void code_free(bench_code *c)
+{
+	free(c->matrix);
+	free(c->bitmatrix);
+	if (c->schedule != NULL) jerasure_free_schedule(c->schedule);
+}
+
+static void layer_encode(bench_code *c, char **data, char **coding)
+{
+	if (c->tech == Reed_Sol_R6_Op) reed_sol_r6_encode(c->k, c->w, data, coding, c->sub);
+	else if (c->bitmatrix == NULL) jerasure_matrix_encode(c->k, c->m, c->w, c->matrix, data, coding, c->sub);
+	else jerasure_schedule_encode(c->k, c->m, c->w, c->schedule, data, coding, c->sub, c->packetsize);
+}
+
+/* MDS-decodes one layer in place; erasures ends in -1 */
+static int layer_decode(bench_code *c, int *erasures, char **data, char **coding)
+{
+	if (erasures[0] == -1) return 0;
+	if (c->bitmatrix == NULL) {
+		return jerasure_matrix_decode(c->k, c->m, c->w, c->matrix, 1, erasures, data, coding, c->sub);
+	}
+	return jerasure_schedule_decode_lazy(c->k, c->m, c->w, c->bitmatrix, erasures, data, coding, c->sub, c->packetsize, 1);
+}
+
+/* Stores C of chunk t: sub-chunk z from C where coupled, U elsewhere */
+static void bench_put(bench_thread *th, int t)
+{
+	bench_code *c;
+	struct iovec iov[MAXM];
+	int z;
+
+	c = th->c;
+	for (z = 0; z < c->M; z++) {
+		iov[z].iov_base = (coupled(c, z, t) ? th->C[t] : th->U[t]) + z*c->sub;
+		iov[z].iov_len = c->sub;
+		if (th->fd[t] < 0) memcpy(th->store[t]+z*c->sub, iov[z].iov_base, c->sub);
+	}
+	if (th->fd[t] >= 0 && chunk_io_vec(th->fd[t], iov, c->M, 0, 1) != c->chunk) {
+		perror("pwritev");
+		exit(1);
+	}
+}
+
+/* Reads sub-chunks z0 .. z0+nz-1 of chunk t into C[t] */
+static void bench_fetch(bench_thread *th, int t, int z0, int nz)
+{
+	bench_code *c;
+
+	c = th->c;
+	if (th->fd[t] >= 0) {
+		if (chunk_io_blocking(th->fd[t], th->C[t]+z0*c->sub, nz*c->sub, z0*c->sub, 0) != nz*c->sub) {
+			perror("pread");
+			exit(1);
+		}
+	}
+	else memcpy(th->C[t]+z0*c->sub, th->store[t]+z0*c->sub, nz*c->sub);
+	th->read += nz*c->sub;
+}
+
+static char *sub_c(bench_thread *th, int z, int t)
+{
+	return th->C[t]+z*th->c->sub;
+}
+
+/* Where U of sub-chunk z of t is: in C when it was read uncoupled */
+static char *sub_u(bench_thread *th, int z, int t)
+{
+	if (!th->erased[t] && !coupled(th->c, z, t)) return sub_c(th, z, t);
+	return th->U[t]+z*th->c->sub;
+}
+
+/* C[z][t] of a rebuilt chunk from U */
+static void bench_couple(bench_thread *th, int z, int t)
+{
+	bench_code *c;
+	int zq;
+
+	c = th->c;
+	if (!coupled(c, z, t)) {
+		memcpy(sub_c(th, z, t), th->U[t]+z*c->sub, c->sub);
+		return;
+	}
+	zq = partner_layer(c, z, t);
+	memcpy(sub_c(th, z, t), th->U[t]+z*c->sub, c->sub);
+	coupling_region_multiply(sub_u(th, zq, t^1), coef(c, t), c->sub, sub_c(th, z, t), 1, c->cw);
+}
+
+static void code_encode(bench_thread *th)
+{
+	bench_code *c;
+	char *data[MAXN], *coding[MAXN];
+	int z, t;
+
+	c = th->c;
+	for (t = 0; t < c->n; t++) th->erased[t] = 1;
+	for (z = 0; z < c->M; z++) {
+		for (t = 0; t < c->k; t++) {
+			data[t] = th->U[t]+z*c->sub;
+			memcpy(data[t], th->in+((long)z*c->k+t)*c->sub, c->sub);
+		}
+		for (t = 0; t < c->m; t++) coding[t] = th->U[c->k+t]+z*c->sub;
+		layer_encode(c, data, coding);
+	}
+	for (t = 0; t < c->n; t++) {
+		for (z = 0; z < c->M; z++) {
+			if (coupled(c, z, t)) bench_couple(th, z, t);
+		}
+		bench_put(th, t);
+	}
+}
+
+/* Fills the lost set up to m: the partner of the first, then from the end */
+static int pad_erasures(bench_code *c, int *lost, int nlost, int *e)
+{
+	int i, t, ne;
+
+	for (t = 0; t < c->n; t++) e[t] = 0;
+	for (i = 0; i < nlost; i++) e[lost[i]] = 1;
+	ne = nlost;
+	if (ne < c->m && lost[0] < 2*(c->n/2) && c->bit[lost[0]/2] >= 0 && !e[lost[0]^1]) {
+		e[lost[0]^1] = 1;
+		ne++;
+	}
+	for (t = c->n-1; t >= 0 && ne < c->m; t--) {
+		if (!e[t]) {
+			e[t] = 1;
+			ne++;
+		}
+	}
+	return ne;
+}
+
+/* U of every node in every layer from the k chunks not erased.  A layer
+   can be done once the partner layers of its coupled survivors whose
+   partner is lost are; for Clay that is the order of intersection score.
+   Returns -1 if the layers depend on each other in a circle. */
+static int code_decode(bench_thread *th)
+{
+	bench_code *c;
+	char *data[MAXN], *coding[MAXN];
+	int erasures[MAXN+1];
+	int z, zq, t, ne, left, ready, progress;
+
+	c = th->c;
+	ne = 0;
+	for (t = 0; t < c->n; t++) {
+		if (th->erased[t]) erasures[ne++] = t;
+		else bench_fetch(th, t, 0, c->M);
+	}
+	erasures[ne] = -1;
+	for (z = 0; z < c->M; z++) th->done[z] = 0;
+
+	left = c->M;
+	while (left > 0) {
+		progress = 0;
+		for (z = 0; z < c->M; z++) {
+			if (th->done[z]) continue;
+			ready = 1;
+			for (t = 0; t < c->n && ready; t++) {
+				if (th->erased[t] || !coupled(c, z, t) || !th->erased[t^1]) continue;
+				if (!th->done[partner_layer(c, z, t)]) ready = 0;
+			}
+			if (!ready) continue;
+
+			for (t = 0; t < c->n; t++) {
+				if (th->erased[t] || !coupled(c, z, t)) continue;
+				zq = partner_layer(c, z, t);
+				memcpy(sub_u(th, z, t), sub_c(th, z, t), c->sub);
+				if (th->erased[t^1]) {
+					coupling_region_multiply(sub_u(th, zq, t^1), coef(c, t), c->sub, sub_u(th, z, t), 1, c->cw);
+				}
+				else {
+					coupling_region_multiply(sub_c(th, zq, t^1), coef(c, t), c->sub, sub_u(th, z, t), 1, c->cw);
+					coupling_region_multiply(sub_u(th, z, t), c->inv[t/2], c->sub, sub_u(th, z, t), 0, c->cw);
+				}
+			}
+			for (t = 0; t < c->k; t++) data[t] = sub_u(th, z, t);
+			for (t = 0; t < c->m; t++) coding[t] = sub_u(th, z, c->k+t);
+			if (layer_decode(c, erasures, data, coding) != 0) return -1;
+			th->done[z] = 1;
+			left--;
+			progress = 1;
+		}
+		if (!progress) return -1;
+	}
+	return 0;
+}
+
+/* Rebuilds chunk t alone into C[t]; the Clay way if no other pair is
+   coupled on the same layer bit */
+static int code_repair(bench_thread *th, int t)
+{
+	bench_code *c;
+	char *data[MAXN], *coding[MAXN];
+	int erasures[3];
+	int u, z, zq, b, p, q, a, tp;
+
+	c = th->c;
+	p = t/2;
+	b = (t < 2*(c->n/2)) ? c->bit[p] : -1;
+	for (q = 0; q < c->n/2 && b >= 0; q++) {
+		if (q != p && c->bit[q] == b) b = -1;
+	}
+	if (b < 0) {
+		pad_erasures(c, &t, 1, th->erased);
+		if (code_decode(th) != 0) return -1;
+		for (z = 0; z < c->M; z++) bench_couple(th, z, t);
+		return 0;
+	}
+
+	/* Layers with bit b equal to t%2 come in runs of 2^b */
+	for (u = 0; u < c->n; u++) th->erased[u] = (u == t);
+	for (u = 0; u < c->n; u++) {
+		if (u == t) continue;
+		for (z = 0; z < c->M; z += 2 << b) bench_fetch(th, u, z + ((t%2) << b), 1 << b);
+	}
+	tp = t^1;
+	th->erased[tp] = 1;
+	erasures[0] = (t < tp) ? t : tp;
+	erasures[1] = (t < tp) ? tp : t;
+	erasures[2] = -1;
+	a = galois_single_divide(1, coef(c, tp), c->cw);
+	for (z = 0; z < c->M; z++) {
+		if (((z >> b) & 1) != t%2) continue;
+		for (u = 0; u < c->n; u++) {
+			if (th->erased[u] || !coupled(c, z, u)) continue;
+			zq = partner_layer(c, z, u);
+			memcpy(sub_u(th, z, u), sub_c(th, z, u), c->sub);
+			coupling_region_multiply(sub_c(th, zq, u^1), coef(c, u), c->sub, sub_u(th, z, u), 1, c->cw);
+			coupling_region_multiply(sub_u(th, z, u), c->inv[u/2], c->sub, sub_u(th, z, u), 0, c->cw);
+		}
+		for (u = 0; u < c->k; u++) data[u] = sub_u(th, z, u);
+		for (u = 0; u < c->m; u++) coding[u] = sub_u(th, z, c->k+u);
+		if (layer_decode(c, erasures, data, coding) != 0) return -1;
+
+		/* C[z][t] = U[z][t]; U[z'][t] = (C[z][tp] - U[z][tp]) / coef */
+		zq = z ^ (1 << b);
+		memcpy(sub_c(th, z, t), sub_u(th, z, t), c->sub);
+		memcpy(sub_u(th, zq, t), sub_c(th, z, tp), c->sub);
+		galois_region_xor(sub_u(th, z, tp), sub_u(th, zq, t), c->sub);
+		coupling_region_multiply(sub_u(th, zq, t), a, c->sub, sub_u(th, zq, t), 0, c->cw);
+		memcpy(sub_c(th, zq, t), sub_u(th, zq, t), c->sub);
+		coupling_region_multiply(sub_u(th, z, tp), coef(c, t), c->sub, sub_c(th, zq, t), 1, c->cw);
+	}
+	return 0;
+}
+
+static int chunk_check(bench_thread *th, int t)
+{
+	bench_code *c;
+	char *buf;
+	int ret;
+
+	c = th->c;
+	if (th->fd[t] < 0) return memcmp(th->C[t], th->store[t], c->chunk) != 0;
+	buf = chunk_io_alloc(c->chunk);
+	ret = 1;
+	if (chunk_io_blocking(th->fd[t], buf, c->chunk, 0, 0) == c->chunk) ret = memcmp(th->C[t], buf, c->chunk) != 0;
+	free(buf);
+	return ret;
+}
+
+/* One operation on one stripe; check compares the result */
+static int bench_op(bench_thread *th, int check)
+{
+	bench_code *c;
+	int lost[MAXN];
+	int t, z;
+
+	c = th->c;
+	switch (th->op) {
+		case Op_Encode:
+			code_encode(th);
+			return 0;
+		case Op_Decode:
+			lost[0] = 0;
+			pad_erasures(c, lost, 1, th->erased);
+			if (code_decode(th) != 0) return -1;
+			for (z = 0; z < c->M && check; z++) {
+				for (t = 0; t < c->k; t++) {
+					if (memcmp(sub_u(th, z, t), th->in+((long)z*c->k+t)*c->sub, c->sub) != 0) return -1;
+				}
+			}
+			return 0;
+		case Op_Repair:
+			for (t = 0; t < c->n; t++) {
+				if (th->only >= 0 && t != th->only) continue;
+				if (code_repair(th, t) != 0) return -1;
+				if (check && chunk_check(th, t) != 0) return -1;
+			}
+			return 0;
+		case Op_Multi:
+			for (t = 0; t < c->m; t++) lost[t] = t;
+			pad_erasures(c, lost, c->m, th->erased);
+			if (code_decode(th) != 0) return -1;
+			for (t = 0; t < c->m; t++) {
+				for (z = 0; z < c->M; z++) bench_couple(th, z, t);
+				if (check && chunk_check(th, t) != 0) return -1;
+			}
+			return 0;
+	}
+	return -1;
+}
+
+static void *bench_thread_main(void *arg)
+{
+	bench_thread *th;
+	double t1;
+	int i;
+
+	th = (bench_thread *) arg;
+	for (i = 0; i < th->stripes && !th->err; i++) {
+		if (th->lat == NULL) {
+			if (bench_op(th, 0) != 0) th->err = 1;
+			continue;
+		}
+		th->only = i % th->c->n;
+		t1 = bench_now();
+		if (bench_op(th, 0) != 0) th->err = 1;
+		th->lat[i] = bench_now()-t1;
+	}
+	th->only = -1;
+	return NULL;
+}
+
+static void bench_thread_init(bench_thread *th, bench_code *c, int id)
+{
+	char *fname;
+	long i;
+	int t;
+
+	memset(th, 0, sizeof(bench_thread));
+	th->c = c;
+	th->id = id;
+	th->only = -1;
+	th->in = chunk_io_alloc(c->chunk*c->k);
+	srand48(id+1);
+	for (i = 0; i < c->chunk*c->k/4; i++) ((uint32_t *)th->in)[i] = mrand48();
+	fname = (c->dir != NULL) ? (char *)malloc(strlen(c->dir)+64) : NULL;
+	for (t = 0; t < c->n; t++) {
+		th->C[t] = chunk_io_alloc(c->chunk);
+		th->U[t] = chunk_io_alloc(c->chunk);
+		memset(th->C[t], 0, c->chunk);
+		memset(th->U[t], 0, c->chunk);
+		th->fd[t] = -1;
+		if (c->dir == NULL) {
+			th->store[t] = chunk_io_alloc(c->chunk);
+			continue;
+		}
+		sprintf(fname, "%s/bench_%d_%d", c->dir, id, t);
+		th->fd[t] = open(fname, O_RDWR | O_CREAT | O_TRUNC, 0644);
+		if (th->fd[t] < 0) {
+			perror(fname);
+			exit(1);
+		}
+	}
+	free(fname);
+}
+
+static void bench_thread_free(bench_thread *th)
+{
+	char *fname;
+	int t;
+
+	fname = (th->c->dir != NULL) ? (char *)malloc(strlen(th->c->dir)+64) : NULL;
+	for (t = 0; t < th->c->n; t++) {
+		free(th->C[t]);
+		free(th->U[t]);
+		free(th->store[t]);
+		if (th->fd[t] < 0) continue;
+		close(th->fd[t]);
+		sprintf(fname, "%s/bench_%d_%d", th->c->dir, th->id, t);
+		unlink(fname);
+	}
+	free(th->in);
+	free(fname);
+}
+
+/* Runs op in every thread: once checked, then stripes times.  Returns
+   the wall time, and the bytes one operation read in *read. */
+static double bench_phase(bench_thread *th, int threads, int op, int stripes, long *read)
+{
+	double t1;
+	int i, err;
+
+	err = 0;
+	for (i = 0; i < threads; i++) {
+		th[i].op = op;
+		th[i].stripes = stripes;
+		th[i].read = 0;
+		if (bench_op(&th[i], 1) != 0) err = 1;
+	}
+	*read = th[0].read;
+	if (op == Op_Repair) *read /= th[0].c->n;
+	if (err) return -1;
+
+	t1 = bench_now();
+	for (i = 0; i < threads; i++) {
+		if (pthread_create(&th[i].tid, NULL, bench_thread_main, &th[i]) != 0) {
+			perror("pthread_create");
+			exit(1);
+		}
+	}
+	for (i = 0; i < threads; i++) {
+		pthread_join(th[i].tid, NULL);
+		if (th[i].err) err = 1;
+	}
+	return err ? -1 : bench_now()-t1;
+}
+
+static int lat_cmp(const void *a, const void *b)
+{
+	double x, y;
+
+	x = *(const double *)a;
+	y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+/* Latency mode: op once checked in every thread, then stripes times,
+   each timed alone.  The times of all threads go into lat, sorted;
+   returns -1 if op failed. */
+static int bench_latency(bench_thread *th, int threads, int op, int stripes, double *lat)
+{
+	int i, err;
+
+	err = 0;
+	for (i = 0; i < threads; i++) {
+		th[i].op = op;
+		th[i].stripes = stripes;
+		if (bench_op(&th[i], 1) != 0) err = 1;
+		th[i].lat = lat+(long)i*stripes;
+	}
+	for (i = 0; i < threads && !err; i++) {
+		if (pthread_create(&th[i].tid, NULL, bench_thread_main, &th[i]) != 0) {
+			perror("pthread_create");
+			exit(1);
+		}
+	}
+	for (i = 0; i < threads && !err; i++) pthread_join(th[i].tid, NULL);
+	for (i = 0; i < threads; i++) {
+		if (th[i].err) err = 1;
+		th[i].lat = NULL;
+	}
+	if (err) return -1;
+	qsort(lat, (long)threads*stripes, sizeof(double), lat_cmp);
+	return 0;
+}
+
+/* Quantile permille of n sorted times, by nearest rank, in us */
+static double lat_q(double *lat, long n, int permille)
+{
+	long i;
+
+	i = ((long)permille*n+999)/1000-1;
+	if (i < 0) i = 0;
+	return lat[i]*1e6;
+}
+
+static double mbs(double bytes, double sec)
+{
+	return (sec > 0) ? bytes/1024.0/1024.0/sec : 0;
+}
+
+int main(int argc, char **argv)
+{
+	int ks[16], ms[16], ws[16], techs[16], threads[16];
+	long blocksizes[16];
+	int nk, nm, nw, ntech, nthreads, nbs, ncodes;
+	int ik, im, iw, it, ib, ith, ic, i, packetsize, stripes, json, rows, latency;
+	char *codes[3], *s, *dir;
+	int bsv[16];
+	bench_code c;
+	bench_thread *th;
+	double sec[4], *lat, sum;
+	long read[4], obj, nlat, j;
+
+	if (argc < 10) {
+		fprintf(stderr, "usage: k m coding_technique w packetsize blocksize threads stripes csv|json [codes] [dir path] [latency]\n");
+		fprintf(stderr, "\nk, m, coding_technique, w, blocksize and threads may be comma separated lists.");
+		fprintf(stderr, "\ncodes is a list of rs, mul and clay (default all three).");
+		fprintf(stderr, "\nlatency times each object alone; blocksize is then the object size.");
+		fprintf(stderr, "\nChoose one of the following coding techniques: \nreed_sol_van, \nreed_sol_r6_op, \ncauchy_orig, \ncauchy_good, \nliberation, \nblaum_roth, \nliber8tion\n\n");
+		exit(0);
+	}
+	nk = int_list(argv[1], ks, 16, "k");
+	nm = int_list(argv[2], ms, 16, "m");
+	ntech = 0;
+	for (s = strtok(argv[3], ","); s != NULL; s = strtok(NULL, ",")) {
+		for (i = 0; Methods[i] != NULL && strcmp(s, Methods[i]) != 0; i++) ;
+		if (Methods[i] == NULL || ntech == 16) {
+			fprintf(stderr, "Not a valid coding technique: %s\n", s);
+			exit(0);
+		}
+		techs[ntech++] = i;
+	}
+	nw = int_list(argv[4], ws, 16, "w");
+	if (sscanf(argv[5], "%d", &packetsize) != 1 || packetsize < 0) {
+		fprintf(stderr, "Invalid value for packetsize\n");
+		exit(0);
+	}
+	nbs = int_list(argv[6], bsv, 16, "blocksize");
+	for (i = 0; i < nbs; i++) blocksizes[i] = bsv[i];
+	nthreads = int_list(argv[7], threads, 16, "threads");
+	for (i = 0; i < nthreads; i++) {
+		if (threads[i] <= 0) {
+			fprintf(stderr, "Invalid value for threads\n");
+			exit(0);
+		}
+	}
+	if (sscanf(argv[8], "%d", &stripes) != 1 || stripes <= 0) {
+		fprintf(stderr, "Invalid value for stripes\n");
+		exit(0);
+	}
+	if (strcmp(argv[9], "csv") != 0 && strcmp(argv[9], "json") != 0) {
+		fprintf(stderr, "Output is csv or json\n");
+		exit(0);
+	}
+	json = (strcmp(argv[9], "json") == 0);
+	codes[0] = "rs";
+	codes[1] = "mul";
+	codes[2] = "clay";
+	ncodes = 3;
+	dir = NULL;
+	latency = 0;
+	for (i = 10; i < argc; i++) {
+		if (strcmp(argv[i], "dir") == 0 && i+1 < argc) {
+			dir = argv[++i];
+		}
+		else if (strcmp(argv[i], "latency") == 0) {
+			latency = 1;
+		}
+		else {
+			ncodes = 0;
+			for (s = strtok(argv[i], ","); s != NULL && ncodes < 3; s = strtok(NULL, ",")) codes[ncodes++] = s;
+		}
+	}
+
+	if (json) printf("[\n");
+	else if (latency) printf("code,k,m,technique,w,packetsize,object,stripe,subchunk,threads,setup_us,op,count,mean_us,p50_us,p99_us,p999_us,max_us\n");
+	else printf("code,k,m,technique,w,packetsize,chunk,subchunk,threads,encode_MBs,decode_MBs,repair_MBs,multi_MBs,repair_read,multi_read\n");
+	rows = 0;
+	for (ik = 0; ik < nk; ik++)
+	for (im = 0; im < nm; im++)
+	for (it = 0; it < ntech; it++)
+	for (iw = 0; iw < nw; iw++)
+	for (ib = 0; ib < nbs; ib++)
+	for (ic = 0; ic < ncodes; ic++) {
+		/* GF tables and matrices are built here, before any thread runs */
+		galois_single_multiply(1, 1, ws[iw]);
+		galois_single_multiply(1, 1, coupling_w(ws[iw]));
+		galois_single_multiply(1, 1, 32);	/* galois_region_xor() */
+		if (code_setup(&c, codes[ic], ks[ik], ms[im], ws[iw], techs[it], packetsize, blocksizes[ib], latency ? blocksizes[ib] : 0) != 0) {
+			code_free(&c);
+			continue;
+		}
+		c.dir = dir;
+		for (ith = 0; ith < nthreads; ith++) {
+			th = (bench_thread *)malloc(sizeof(bench_thread)*threads[ith]);
+			for (i = 0; i < threads[ith]; i++) bench_thread_init(&th[i], &c, i);
+			if (latency) {
+				nlat = (long)threads[ith]*stripes;
+				lat = (double *)malloc(sizeof(double)*nlat);
+				if (lat == NULL) {
+					perror("malloc");
+					exit(1);
+				}
+				for (i = Op_Encode; i <= Op_Repair; i++) {
+					if (bench_latency(th, threads[ith], i, stripes, lat) != 0) {
+						fprintf(stderr, "%s k=%d m=%d %s w=%d: %s failed\n", c.name, c.k, c.m, Methods[c.tech], c.w, Ops[i]);
+						continue;
+					}
+					for (sum = 0, j = 0; j < nlat; j++) sum += lat[j];
+					if (json) {
+						printf("%s  {\"code\": \"%s\", \"k\": %d, \"m\": %d, \"technique\": \"%s\", \"w\": %d, \"packetsize\": %d, "
+							"\"object\": %ld, \"stripe\": %ld, \"subchunk\": %ld, \"threads\": %d, \"setup_us\": %.1f, "
+							"\"op\": \"%s\", \"count\": %ld, \"mean_us\": %.1f, \"p50_us\": %.1f, \"p99_us\": %.1f, "
+							"\"p999_us\": %.1f, \"max_us\": %.1f}",
+							rows ? ",\n" : "", c.name, c.k, c.m, Methods[c.tech], c.w, c.packetsize, blocksizes[ib],
+							c.chunk*c.k, c.sub, threads[ith], c.setup*1e6, Ops[i], nlat, sum/nlat*1e6,
+							lat_q(lat, nlat, 500), lat_q(lat, nlat, 990), lat_q(lat, nlat, 999), lat[nlat-1]*1e6);
+					}
+					else {
+						printf("%s,%d,%d,%s,%d,%d,%ld,%ld,%ld,%d,%.1f,%s,%ld,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+							c.name, c.k, c.m, Methods[c.tech], c.w, c.packetsize, blocksizes[ib],
+							c.chunk*c.k, c.sub, threads[ith], c.setup*1e6, Ops[i], nlat, sum/nlat*1e6,
+							lat_q(lat, nlat, 500), lat_q(lat, nlat, 990), lat_q(lat, nlat, 999), lat[nlat-1]*1e6);
+					}
+					rows++;
+				}
+				fflush(stdout);
+				free(lat);
+				for (i = 0; i < threads[ith]; i++) bench_thread_free(&th[i]);
+				free(th);
+				continue;
+			}
+			for (i = Op_Encode; i <= Op_Multi; i++) {
+				sec[i] = bench_phase(th, threads[ith], i, stripes, &read[i]);
+				if (sec[i] < 0) fprintf(stderr, "%s k=%d m=%d %s w=%d: %s failed\n", c.name, c.k, c.m, Methods[c.tech], c.w, Ops[i]);
+			}
+			obj = c.chunk*c.k*(long)stripes*threads[ith];
+			if (json) {
+				printf("%s  {\"code\": \"%s\", \"k\": %d, \"m\": %d, \"technique\": \"%s\", \"w\": %d, \"packetsize\": %d, "
+					"\"chunk\": %ld, \"subchunk\": %ld, \"threads\": %d, \"encode_MBs\": %.2f, \"decode_MBs\": %.2f, "
+					"\"repair_MBs\": %.2f, \"multi_MBs\": %.2f, \"repair_read\": %ld, \"multi_read\": %ld}",
+					rows ? ",\n" : "", c.name, c.k, c.m, Methods[c.tech], c.w, c.packetsize, c.chunk, c.sub, threads[ith],
+					mbs(obj, sec[0]), mbs(obj, sec[1]), mbs((double)c.chunk*c.n*stripes*threads[ith], sec[2]),
+					mbs(obj, sec[3]), read[2], read[3]);
+			}
+			else {
+				printf("%s,%d,%d,%s,%d,%d,%ld,%ld,%d,%.2f,%.2f,%.2f,%.2f,%ld,%ld\n",
+					c.name, c.k, c.m, Methods[c.tech], c.w, c.packetsize, c.chunk, c.sub, threads[ith],
+					mbs(obj, sec[0]), mbs(obj, sec[1]), mbs((double)c.chunk*c.n*stripes*threads[ith], sec[2]),
+					mbs(obj, sec[3]), read[2], read[3]);
+			}
+			rows++;
+			fflush(stdout);
+			for (i = 0; i < threads[ith]; i++) bench_thread_free(&th[i]);
+			free(th);
+		}
+		code_free(&c);
+	}
+	if (json) printf("\n]\n");
+	return 0;
+}
@@ -0,0 +1,838 @@
+/* *
+ * clay-check.c - clay-encoder and clay-decoder checked against each other
+ * over every erasure pattern, and timed against stored baselines.
+ *
+ * usage: bindir coding_technique[,...] w packetsize buffersize check_size
+ *        bench_size [baseline path] [tolerance pct] [reps n] [update]
+ *
+ * bindir holds the built clay-encoder, clay-decoder and clay-batch-
+ * encoder.  Everything runs in a fresh directory clay-check.XXXXXX under
+ * the current one, which is removed again unless something failed.
+ *
+ * Round trip: for each technique, a random object of check_size bytes is
+ * encoded (k=10, m=4, the profile the coupling loops are written for) in
+ * each of the layouts
+ *
+ *   plain      clay-encoder
+ *   permute    clay-encoder permute
+ *   stdin      clay-encoder stdin, the object piped in (chunk trailers)
+ *   stream     the same with buffersize 0: one read-in, shorter than the
+ *              stream buffer, and no chunk may be larger than the object
+ *   batch      clay-batch-encoder, two threads
+ *   mmap       clay-encoder mmap, the object mapped instead of read
+ *   uring      clay-encoder uring, the chunks written through io_uring
+ *   direct     clay-encoder direct, the chunks written with O_DIRECT
+ *   mmap-direct  clay-encoder mmap direct, both at once
+ *
+ * and then decoded with every set of at most m chunks missing, 1471 of
+ * them, each compared byte for byte with the object.  The decodes take
+ * turns at plain, "parallel 2", "stdout", "uring" and "direct", so
+ * every way of reading and writing sees every size of erasure.  A
+ * buffersize that gives several read-ins and a check_size that is not a
+ * multiple of anything exercise the padding as well.
+ *
+ * Truncated chunks: the plain encoding again, with k03 and m02 cut to
+ * half their size.  Every decoder mode has to treat them as erased and
+ * give back the object; with m+1 chunks cut it has to fail with an exit
+ * status, not a signal.
+ *
+ * Corrupted chunks: the plain encoding again, with a byte flipped in the
+ * middle of k02 and of m01.  Every decoder mode has to report the CRC32C
+ * failure and still give back the object.
+ *
+ * Damaged headers: the permute encoding again, with a byte flipped in
+ * the magic of k02 and in the object size in the header of m01.  Every
+ * decoder mode has to erase both chunks and give back the object.
+ *
+ * Odd k: the object encoded with k=9 m=5, k=11 m=3 and k=7 m=7, where
+ * data node k-1 is coupled with coding node k, and decoded with m01
+ * missing, with k_k and m01, with the m nodes from k_k on and with every
+ * coding node, taking turns at the decoder modes.
+ *
+ * Unsupported profiles: clay-encoder with k=12 m=4 (2^8 layers) and
+ * k=11 m=4 (k+m odd) has to refuse them and write no chunks, rather than
+ * run the coupling loops off the end of its 2^7 layers.
+ *
+ * If bindir also has mul-encoder, it encodes the object with "direct" and
+ * with "mmap direct", and the chunks of the two have to be the same.
+ *
+ * Throughput: an object of bench_size bytes is encoded and decoded whole,
+ * with chunk k01 missing and with the first m chunks missing, reps times
+ * each (default 3); the best of each is in MB of object per second, the
+ * process timed from start to exit.  The numbers are compared with those
+ * in the baseline file, one "name MB/s" per line, and anything more than
+ * tolerance percent (default 10) slower is a regression.  The file is
+ * written when it does not exist yet or with "update".
+ *
+ * The exit status is 1 if any round trip failed or regressed, 0 if not.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <dirent.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "chunk-header.h"
+
+#define K 10
+#define Mc 4
+#define MAXBASE 256
+
+enum Check_Layout {Plain, Permute, Stdin, Stream, Batch, Mmap, Uring, Direct, MmapDirect, Layouts};
+
+char *Layouts_[] = {"plain", "permute", "stdin", "stream", "batch", "mmap", "uring", "direct", "mmap-direct"};
+
+enum Check_Mode {Dec_Plain, Dec_Parallel, Dec_Stdout, Dec_Uring, Dec_Direct, Modes};
+
+char *Modes_[] = {"plain", "parallel 2", "stdout", "uring", "direct"};
+
+char *Methods[] = {"reed_sol_van", "reed_sol_r6_op", "cauchy_orig", "cauchy_good", "liberation", "blaum_roth", "liber8tion", NULL};
+
+char bindir[PATH_MAX];
+char *w, *packetsize, *buffersize;
+
+typedef struct {
+	char name[128];
+	double mbs;
+} check_base;
+
+static double check_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec/1e9;
+}
+
+/* Runs bindir/tool with args (NULL ended).  stdin from in, stdout to out
+   if given, everything else to the file log.  Returns the exit status,
+   -1 if it did not exit, and the wall time in *sec. */
+static int check_run(const char *tool, char **args, const char *in, const char *out, double *sec)
+{
+	char path[PATH_MAX+64];
+	char *argv[32];
+	pid_t pid;
+	int i, fd, status;
+	double t;
+
+	snprintf(path, sizeof(path), "%s/%s", bindir, tool);
+	argv[0] = path;
+	for (i = 0; args[i] != NULL && i < 30; i++) argv[i+1] = args[i];
+	argv[i+1] = NULL;
+
+	t = check_now();
+	pid = fork();
+	if (pid < 0) {
+		perror("fork");
+		exit(1);
+	}
+	if (pid == 0) {
+		fd = open("log", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd >= 0) {
+			dup2(fd, 1);
+			dup2(fd, 2);
+			close(fd);
+		}
+		if (in != NULL) {
+			fd = open(in, O_RDONLY);
+			if (fd < 0) { perror(in); _exit(127); }
+			dup2(fd, 0);
+			close(fd);
+		}
+		if (out != NULL) {
+			fd = open(out, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+			if (fd < 0) { perror(out); _exit(127); }
+			dup2(fd, 1);
+			close(fd);
+		}
+		execv(path, argv);
+		perror(path);
+		_exit(127);
+	}
+	while (waitpid(pid, &status, 0) < 0 && errno == EINTR) ;
+	if (sec != NULL) *sec = check_now()-t;
+	return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+/* 1 if the two files have the same bytes */
+static int check_same(const char *a, const char *b)
+{
+	char x[65536], y[65536];
+	int fa, fb, ret;
+	long la, lb;
+
+	fa = open(a, O_RDONLY);
+	fb = open(b, O_RDONLY);
+	ret = (fa >= 0 && fb >= 0);
+	while (ret) {
+		la = read(fa, x, sizeof(x));
+		lb = read(fb, y, sizeof(y));
+		if (la != lb || (la > 0 && memcmp(x, y, la) != 0)) ret = 0;
+		if (la <= 0) break;
+	}
+	if (fa >= 0) close(fa);
+	if (fb >= 0) close(fb);
+	return ret;
+}
+
+static void check_object(const char *fname, long size, long seed)
+{
+	FILE *fp;
+	long i;
+	uint32_t v;
+
+	fp = fopen(fname, "wb");
+	if (fp == NULL) { perror(fname); exit(1); }
+	srand48(seed);
+	for (i = 0; i < size; i += 4) {
+		v = mrand48();
+		fwrite(&v, 1, (size-i < 4) ? size-i : 4, fp);
+	}
+	fclose(fp);
+}
+
+/* Chunk t of name.bin in dir */
+static void chunk_name(char *fname, const char *dir, const char *name, int t)
+{
+	if (t < K) sprintf(fname, "%s/%s_k%02d.bin", dir, name, t+1);
+	else sprintf(fname, "%s/%s_m%02d.bin", dir, name, t-K+1);
+}
+
+/* Removes the files of dir, and dir */
+static void check_rmdir(const char *dir)
+{
+	DIR *d;
+	struct dirent *de;
+	char fname[PATH_MAX];
+
+	d = opendir(dir);
+	if (d == NULL) return;
+	while ((de = readdir(d)) != NULL) {
+		if (de->d_name[0] == '.') continue;
+		snprintf(fname, sizeof(fname), "%s/%s", dir, de->d_name);
+		unlink(fname);
+	}
+	closedir(d);
+	rmdir(dir);
+}
+
+/* Encodes name.bin in layout; 0 if all k+m chunks came out */
+static int check_encode(const char *name, const char *tech, int layout, double *sec)
+{
+	char in[64], fname[128];
+	char *args[16];
+	struct stat st, ist;
+	FILE *fp;
+	int i, ret;
+
+	check_rmdir("Coding");
+	sprintf(in, "%s.bin", name);
+	i = 0;
+	if (layout == Batch) {
+		fp = fopen("manifest", "w");
+		if (fp == NULL) { perror("manifest"); exit(1); }
+		fprintf(fp, "%s\n", in);
+		fclose(fp);
+		args[i++] = "manifest";
+	}
+	else args[i++] = in;
+	args[i++] = "10";
+	args[i++] = "4";
+	args[i++] = (char *) tech;
+	args[i++] = w;
+	args[i++] = packetsize;
+	args[i++] = (layout == Stream) ? "0" : buffersize;
+	if (layout == Batch) args[i++] = "2";
+	if (layout == Permute) args[i++] = "permute";
+	if (layout == Stdin || layout == Stream) args[i++] = "stdin";
+	if (layout == Mmap || layout == MmapDirect) args[i++] = "mmap";
+	if (layout == Uring) args[i++] = "uring";
+	if (layout == Direct || layout == MmapDirect) args[i++] = "direct";
+	args[i] = NULL;
+	ret = check_run((layout == Batch) ? "clay-batch-encoder" : "clay-encoder", args, (layout == Stdin || layout == Stream) ? in : NULL, NULL, sec);
+	for (i = 0; i < K+Mc && ret == 0; i++) {
+		chunk_name(fname, "Coding", name, i);
+		if (stat(fname, &st) != 0) ret = -1;
+		else if (layout == Stream && stat(in, &ist) == 0 && st.st_size > ist.st_size) {
+			printf("  %s is %ld bytes, the object only %ld\n", fname, (long) st.st_size, (long) ist.st_size);
+			ret = -1;
+		}
+	}
+	return ret;
+}
+
+/* Decodes name.bin with the chunks in lost (a bit each) moved aside, the
+   way mode says; 0 if the object comes back */
+static int check_decode(const char *name, int lost, int mode, double *sec)
+{
+	char in[64], out[128], fname[128], aside[128];
+	char *args[8];
+	int t, ret;
+
+	for (t = 0; t < K+Mc; t++) {
+		if (!(lost & (1 << t))) continue;
+		chunk_name(fname, "Coding", name, t);
+		chunk_name(aside, "lost", name, t);
+		if (rename(fname, aside) != 0) { perror(fname); exit(1); }
+	}
+	sprintf(in, "%s.bin", name);
+	sprintf(out, "Coding/%s_decoded.bin", name);
+	unlink(out);
+	args[0] = in;
+	args[1] = NULL;
+	if (mode == Dec_Parallel) {
+		args[1] = "parallel";
+		args[2] = "2";
+		args[3] = NULL;
+	}
+	if (mode == Dec_Stdout) {
+		args[1] = "stdout";
+		args[2] = NULL;
+	}
+	if (mode == Dec_Uring) {
+		args[1] = "uring";
+		args[2] = NULL;
+	}
+	if (mode == Dec_Direct) {
+		args[1] = "direct";
+		args[2] = NULL;
+	}
+	ret = check_run("clay-decoder", args, NULL, (mode == Dec_Stdout) ? out : NULL, sec);
+	if (ret == 0 && !check_same(in, out)) ret = -1;
+	unlink(out);
+	for (t = 0; t < K+Mc; t++) {
+		if (!(lost & (1 << t))) continue;
+		chunk_name(fname, "Coding", name, t);
+		chunk_name(aside, "lost", name, t);
+		if (rename(aside, fname) != 0) { perror(aside); exit(1); }
+	}
+	return ret;
+}
+
+/* Cuts chunk t of name.bin to half its size */
+static void check_truncate(const char *name, int t)
+{
+	char fname[128];
+	struct stat st;
+
+	chunk_name(fname, "Coding", name, t);
+	if (stat(fname, &st) != 0 || truncate(fname, st.st_size/2) != 0) {
+		perror(fname);
+		exit(1);
+	}
+}
+
+/* Decodes a plain encoding with k03 and m02 truncated, in every mode, and
+   then with m+1 chunks truncated, which has to fail cleanly.  Returns the
+   number of decodes that went wrong. */
+static int check_truncated(const char *tech)
+{
+	char name[128];
+	int mode, ret, nfail;
+
+	if (check_encode("check", tech, Plain, NULL) != 0) return 1;
+	check_truncate("check", 2);
+	check_truncate("check", K+1);
+	nfail = 0;
+	for (mode = Dec_Plain; mode < Modes; mode++) {
+		if (check_decode("check", 0, mode, NULL) != 0) {
+			sprintf(name, "fail-truncated-%s-%d.log", tech, mode);
+			rename("log", name);
+			printf("  FAIL truncated %s k03 m02 (decoder %s), see %s\n", tech, Modes_[mode], name);
+			nfail++;
+		}
+	}
+	check_truncate("check", 0);
+	check_truncate("check", 4);
+	check_truncate("check", K+3);
+	ret = check_decode("check", 0, 0, NULL);
+	if (ret <= 0) {
+		sprintf(name, "fail-truncated-%s-many.log", tech);
+		rename("log", name);
+		printf("  FAIL truncated %s, %d chunks: decoder %s, see %s\n", tech, Mc+1,
+			(ret == 0) ? "succeeded" : "did not exit", name);
+		nfail++;
+	}
+	printf("truncated %s w=%s: %d decodes, %d failed\n", tech, w, Modes+1, nfail);
+	fflush(stdout);
+	return nfail;
+}
+
+/* 1 if the log of the last run has s in it */
+static int check_log(const char *s)
+{
+	char line[1024];
+	FILE *fp;
+	int ret;
+
+	fp = fopen("log", "r");
+	if (fp == NULL) return 0;
+	ret = 0;
+	while (!ret && fgets(line, sizeof(line), fp) != NULL) ret = (strstr(line, s) != NULL);
+	fclose(fp);
+	return ret;
+}
+
+/* Decodes a plain encoding with a byte flipped in the middle of k02 and
+   of m01, in every mode: the CRC32C check has to catch both and the
+   object come back anyway.  Returns the number of decodes that went
+   wrong. */
+static int check_corrupt(const char *tech)
+{
+	char fname[128], name[128];
+	struct stat st;
+	unsigned char c;
+	int mode, t, fd, nfail;
+
+	if (check_encode("check", tech, Plain, NULL) != 0) return 1;
+	for (t = 1; t < K+Mc; t += K) {
+		chunk_name(fname, "Coding", "check", t);
+		fd = open(fname, O_RDWR);
+		if (fd < 0 || fstat(fd, &st) != 0 || pread(fd, &c, 1, st.st_size/2) != 1) {
+			perror(fname);
+			exit(1);
+		}
+		c ^= 0x5a;
+		if (pwrite(fd, &c, 1, st.st_size/2) != 1) {
+			perror(fname);
+			exit(1);
+		}
+		close(fd);
+	}
+	nfail = 0;
+	for (mode = Dec_Plain; mode < Modes; mode++) {
+		if (check_decode("check", 0, mode, NULL) != 0 || !check_log("CRC32C")) {
+			sprintf(name, "fail-corrupt-%s-%d.log", tech, mode);
+			rename("log", name);
+			printf("  FAIL corrupt %s k02 m01 (decoder %s), see %s\n", tech, Modes_[mode], name);
+			nfail++;
+		}
+	}
+	printf("corrupt %s w=%s: %d decodes, %d failed\n", tech, w, Modes, nfail);
+	fflush(stdout);
+	return nfail;
+}
+
+/* Decodes a permuted encoding with a byte of the magic of k02 flipped,
+   and one of the object size in the header of m01, in every mode: both
+   headers have to be refused and the chunks erased, since their offset
+   tables and CRCs cannot be trusted.  Returns the number of decodes that
+   went wrong. */
+static int check_header(const char *tech)
+{
+	char fname[128], name[128];
+	unsigned char c;
+	int mode, t, fd, nfail;
+	off_t pos;
+
+	if (check_encode("check", tech, Permute, NULL) != 0) return 1;
+	for (t = 1; t < K+Mc; t += K) {
+		chunk_name(fname, "Coding", "check", t);
+		pos = (t < K) ? 0 : offsetof(chunk_header, size);
+		fd = open(fname, O_RDWR);
+		if (fd < 0 || pread(fd, &c, 1, pos) != 1) {
+			perror(fname);
+			exit(1);
+		}
+		c ^= 0x5a;
+		if (pwrite(fd, &c, 1, pos) != 1) {
+			perror(fname);
+			exit(1);
+		}
+		close(fd);
+	}
+	nfail = 0;
+	for (mode = Dec_Plain; mode < Modes; mode++) {
+		if (check_decode("check", 0, mode, NULL) != 0 || !check_log("chunk header")) {
+			sprintf(name, "fail-header-%s-%d.log", tech, mode);
+			rename("log", name);
+			printf("  FAIL header %s k02 m01 (decoder %s), see %s\n", tech, Modes_[mode], name);
+			nfail++;
+		}
+	}
+	printf("header %s w=%s: %d decodes, %d failed\n", tech, w, Modes, nfail);
+	fflush(stdout);
+	return nfail;
+}
+
+/* Encodes with profiles other than the 2^7 layers the tools are built
+   for, which has to be refused before anything is written.  Returns the
+   number of profiles that were not. */
+static int check_profiles(const char *tech)
+{
+	char *profiles[][2] = {{"12", "4"}, {"11", "4"}};
+	char *args[8];
+	char fname[128], name[128];
+	struct stat st;
+	int i, ret, nfail;
+
+	nfail = 0;
+	for (i = 0; i < 2; i++) {
+		check_rmdir("Coding");
+		args[0] = "check.bin";
+		args[1] = profiles[i][0];
+		args[2] = profiles[i][1];
+		args[3] = (char *) tech;
+		args[4] = w;
+		args[5] = packetsize;
+		args[6] = buffersize;
+		args[7] = NULL;
+		ret = check_run("clay-encoder", args, NULL, NULL, NULL);
+		chunk_name(fname, "Coding", "check", 0);
+		if (ret < 0 || stat(fname, &st) == 0 || !check_log("k+m must be")) {
+			sprintf(name, "fail-profile-%s-%s-%s.log", tech, profiles[i][0], profiles[i][1]);
+			rename("log", name);
+			printf("  FAIL profile %s k=%s m=%s: encoder %s, see %s\n", tech, profiles[i][0], profiles[i][1],
+				(ret < 0) ? "did not exit" : "did not refuse it", name);
+			nfail++;
+		}
+	}
+	printf("profiles %s w=%s: 2 unsupported, %d not refused\n", tech, w, nfail);
+	fflush(stdout);
+	return nfail;
+}
+
+/* Encodes with the profiles of odd k, where data node k-1 is paired with
+   coding node k, and decodes with m01 missing, with it and k_k, with the m
+   nodes from k-1 on, and with every coding node: the decoder has to work
+   out the bad sub-chunks of m01 before it uncouples k_k.  Chunk names have
+   as many digits as k.  Returns the number of decodes that went wrong. */
+static int check_odd(const char *tech)
+{
+	char *profiles[][2] = {{"9", "5"}, {"11", "3"}, {"7", "7"}};
+	char *args[8];
+	char fname[128], aside[128], name[128];
+	int i, k, m, md, t, lost[4], il, mode, nfail, ndec;
+
+	nfail = 0;
+	ndec = 0;
+	for (i = 0; i < 3; i++) {
+		k = atoi(profiles[i][0]);
+		m = atoi(profiles[i][1]);
+		md = strlen(profiles[i][0]);
+		check_rmdir("Coding");
+		args[0] = "check.bin";
+		args[1] = profiles[i][0];
+		args[2] = profiles[i][1];
+		args[3] = (char *) tech;
+		args[4] = w;
+		args[5] = packetsize;
+		args[6] = buffersize;
+		args[7] = NULL;
+		if (check_run("clay-encoder", args, NULL, NULL, NULL) != 0) {
+			sprintf(name, "fail-odd-%s-%d-%d.log", tech, k, m);
+			rename("log", name);
+			printf("  FAIL odd %s k=%d m=%d: the encoder failed, see %s\n", tech, k, m, name);
+			nfail++;
+			continue;
+		}
+		lost[0] = 1 << k;
+		lost[1] = (1 << (k-1)) | (1 << k);
+		lost[2] = ((1 << m)-1) << (k-1);
+		lost[3] = ((1 << m)-1) << k;
+		for (il = 0; il < 4; il++) {
+			for (t = 0; t < k+m; t++) {
+				if (!(lost[il] & (1 << t))) continue;
+				if (t < k) sprintf(fname, "Coding/check_k%0*d.bin", md, t+1);
+				else sprintf(fname, "Coding/check_m%0*d.bin", md, t-k+1);
+				sprintf(aside, "lost/%s", fname+7);
+				if (rename(fname, aside) != 0) { perror(fname); exit(1); }
+			}
+			mode = ndec%Modes;
+			if (check_decode("check", 0, mode, NULL) != 0) {
+				sprintf(name, "fail-odd-%s-%d-%d-%d.log", tech, k, m, il);
+				rename("log", name);
+				printf("  FAIL odd %s k=%d m=%d lost %#x (decoder %s), see %s\n", tech, k, m, lost[il], Modes_[mode], name);
+				nfail++;
+			}
+			ndec++;
+			for (t = 0; t < k+m; t++) {
+				if (!(lost[il] & (1 << t))) continue;
+				if (t < k) sprintf(fname, "Coding/check_k%0*d.bin", md, t+1);
+				else sprintf(fname, "Coding/check_m%0*d.bin", md, t-k+1);
+				sprintf(aside, "lost/%s", fname+7);
+				if (rename(aside, fname) != 0) { perror(aside); exit(1); }
+			}
+		}
+	}
+	check_rmdir("Coding");
+	printf("odd k %s w=%s: %d decodes, %d failed\n", tech, w, ndec, nfail);
+	fflush(stdout);
+	return nfail;
+}
+
+/* mul-encoder with "direct" and with "mmap direct": the mapped input has
+   to give the same k+m chunks as the read one.  Returns the number of
+   chunks that differ, -1 if an encode failed. */
+static int check_mul(const char *tech)
+{
+	char fname[128], ref[128];
+	char *args[16];
+	int t, ndiff;
+
+	args[0] = "check.bin";
+	args[1] = "10";
+	args[2] = "4";
+	args[3] = (char *) tech;
+	args[4] = w;
+	args[5] = packetsize;
+	args[6] = buffersize;
+	args[7] = "direct";
+	args[8] = NULL;
+	args[9] = NULL;
+	check_rmdir("Coding");
+	check_rmdir("mul");
+	mkdir("mul", S_IRWXU);
+	if (check_run("mul-encoder", args, NULL, NULL, NULL) != 0) return -1;
+	for (t = 0; t < K+Mc; t++) {
+		chunk_name(fname, "Coding", "check", t);
+		chunk_name(ref, "mul", "check", t);
+		if (rename(fname, ref) != 0) return -1;
+	}
+	args[7] = "mmap";
+	args[8] = "direct";
+	check_rmdir("Coding");
+	if (check_run("mul-encoder", args, NULL, NULL, NULL) != 0) return -1;
+	ndiff = 0;
+	for (t = 0; t < K+Mc; t++) {
+		chunk_name(fname, "Coding", "check", t);
+		chunk_name(ref, "mul", "check", t);
+		if (!check_same(fname, ref)) ndiff++;
+	}
+	check_rmdir("mul");
+	return ndiff;
+}
+
+static void pattern_string(int lost, char *s)
+{
+	int t;
+
+	s[0] = '\0';
+	for (t = 0; t < K+Mc; t++) {
+		if (lost & (1 << t)) s += sprintf(s, (t < K) ? "k%02d " : "m%02d ", (t < K) ? t+1 : t-K+1);
+	}
+	if (lost == 0) strcpy(s, "none ");
+}
+
+/* Every pattern of at most m lost chunks, for one encoding; returns the
+   number that failed */
+static int check_patterns(const char *tech, int layout)
+{
+	char pat[128], log[256];
+	int lost, t, n, npat, nfail;
+
+	npat = 0;
+	nfail = 0;
+	for (lost = 0; lost < (1 << (K+Mc)); lost++) {
+		for (n = 0, t = 0; t < K+Mc; t++) n += (lost >> t) & 1;
+		if (n > Mc) continue;
+		if (check_decode("check", lost, npat%Modes, NULL) != 0) {
+			pattern_string(lost, pat);
+			if (nfail < 5) {
+				sprintf(log, "fail-%s-%s-%d.log", Layouts_[layout], tech, lost);
+				rename("log", log);
+				printf("  FAIL %s %s lost %s(decoder %s), see %s\n", Layouts_[layout], tech, pat, Modes_[npat%Modes], log);
+			}
+			nfail++;
+		}
+		npat++;
+	}
+	printf("%s %s w=%s: %d patterns, %d failed\n", Layouts_[layout], tech, w, npat, nfail);
+	fflush(stdout);
+	return nfail;
+}
+
+static int base_load(const char *path, check_base *b)
+{
+	FILE *fp;
+	int n;
+
+	fp = fopen(path, "r");
+	if (fp == NULL) return -1;
+	n = 0;
+	while (n < MAXBASE && fscanf(fp, "%127s %lf", b[n].name, &b[n].mbs) == 2) n++;
+	fclose(fp);
+	return n;
+}
+
+/* Best of reps, in MB/s of an object of size bytes */
+static double check_bench(const char *tech, int what, long size, int reps)
+{
+	double sec, best;
+	int i, lost;
+
+	best = -1;
+	lost = (what == 2) ? 1 : (what == 3) ? (1 << Mc)-1 : 0;
+	for (i = 0; i < reps; i++) {
+		if (what == 0) {
+			if (check_encode("bench", tech, Plain, &sec) != 0) return -1;
+		}
+		else if (check_decode("bench", lost, 0, &sec) != 0) return -1;
+		if (best < 0 || sec < best) best = sec;
+	}
+	return (best > 0) ? size/1024.0/1024.0/best : 0;
+}
+
+int main(int argc, char **argv)
+{
+	static char *Whats[] = {"encode", "decode", "degraded", "decode_m"};
+	char *techs[16], *s, *basepath, dir[64], name[128], mul[PATH_MAX+16];
+	check_base base[MAXBASE], now[MAXBASE];
+	long check_size, bench_size;
+	double tol, mbs;
+	int ntech, nbase, nnow, reps, update, fail, it, layout, what, i, j;
+	FILE *fp;
+
+	if (argc < 8) {
+		fprintf(stderr, "usage: bindir coding_technique[,...] w packetsize buffersize check_size bench_size\n");
+		fprintf(stderr, "       [baseline path] [tolerance pct] [reps n] [update]\n");
+		fprintf(stderr, "\nbindir has clay-encoder, clay-decoder and clay-batch-encoder.  Every erasure pattern up to m is");
+		fprintf(stderr, "\ndecoded and compared for each layout; the throughput is compared with the baseline file.\n\n");
+		exit(0);
+	}
+	if (realpath(argv[1], bindir) == NULL) {
+		perror(argv[1]);
+		exit(1);
+	}
+	ntech = 0;
+	for (s = strtok(argv[2], ","); s != NULL; s = strtok(NULL, ",")) {
+		for (i = 0; Methods[i] != NULL && strcmp(s, Methods[i]) != 0; i++) ;
+		if (Methods[i] == NULL || ntech == 16) {
+			fprintf(stderr, "Not a valid coding technique: %s\n", s);
+			exit(0);
+		}
+		techs[ntech++] = s;
+	}
+	w = argv[3];
+	packetsize = argv[4];
+	buffersize = argv[5];
+	if (sscanf(argv[6], "%ld", &check_size) != 1 || check_size <= 0) {
+		fprintf(stderr, "Invalid value for check_size\n");
+		exit(0);
+	}
+	if (sscanf(argv[7], "%ld", &bench_size) != 1 || bench_size <= 0) {
+		fprintf(stderr, "Invalid value for bench_size\n");
+		exit(0);
+	}
+	basepath = NULL;
+	tol = 10;
+	reps = 3;
+	update = 0;
+	for (i = 8; i < argc; i++) {
+		if (strcmp(argv[i], "baseline") == 0 && i+1 < argc) basepath = argv[++i];
+		else if (strcmp(argv[i], "tolerance") == 0 && i+1 < argc && sscanf(argv[i+1], "%lf", &tol) == 1 && tol >= 0) i++;
+		else if (strcmp(argv[i], "reps") == 0 && i+1 < argc && sscanf(argv[i+1], "%d", &reps) == 1 && reps > 0) i++;
+		else if (strcmp(argv[i], "update") == 0) update = 1;
+		else {
+			fprintf(stderr, "Unknown option %s\n", argv[i]);
+			exit(0);
+		}
+	}
+	/* The baseline is read before moving into the work directory */
+	nbase = (basepath != NULL) ? base_load(basepath, base) : -1;
+	if (basepath != NULL && basepath[0] != '/') {
+		s = (char *)malloc(PATH_MAX+strlen(basepath)+2);
+		if (getcwd(s, PATH_MAX) == NULL) { perror("getcwd"); exit(1); }
+		strcat(s, "/");
+		strcat(s, basepath);
+		basepath = s;
+	}
+
+	strcpy(dir, "clay-check.XXXXXX");
+	if (mkdtemp(dir) == NULL || chdir(dir) != 0) {
+		perror("mkdtemp");
+		exit(1);
+	}
+	mkdir("lost", S_IRWXU);
+
+	fail = 0;
+	check_object("check.bin", check_size, 1);
+	for (it = 0; it < ntech; it++) {
+		for (layout = Plain; layout < Layouts; layout++) {
+			if (check_encode("check", techs[it], layout, NULL) != 0) {
+				sprintf(name, "fail-encode-%s-%s.log", Layouts_[layout], techs[it]);
+				rename("log", name);
+				printf("%s %s w=%s: the encoder failed, see %s/%s\n", Layouts_[layout], techs[it], w, dir, name);
+				fail++;
+				continue;
+			}
+			fail += check_patterns(techs[it], layout);
+		}
+		fail += check_truncated(techs[it]);
+		fail += check_corrupt(techs[it]);
+		fail += check_header(techs[it]);
+		fail += check_profiles(techs[it]);
+		fail += check_odd(techs[it]);
+		sprintf(mul, "%s/mul-encoder", bindir);
+		if (access(mul, X_OK) == 0) {
+			i = check_mul(techs[it]);
+			if (i < 0) {
+				sprintf(name, "fail-mul-%s.log", techs[it]);
+				rename("log", name);
+				printf("mul-encoder mmap direct %s w=%s: the encoder failed, see %s/%s\n", techs[it], w, dir, name);
+				fail++;
+			}
+			else {
+				printf("mul-encoder mmap direct %s w=%s: %d of %d chunks differ from direct\n", techs[it], w, i, K+Mc);
+				fail += i;
+			}
+			fflush(stdout);
+		}
+	}
+
+	nnow = 0;
+	check_object("bench.bin", bench_size, 2);
+	for (it = 0; it < ntech; it++) {
+		for (what = 0; what < 4; what++) {
+			if (what == 1 && check_encode("bench", techs[it], Plain, NULL) != 0) break;
+			mbs = check_bench(techs[it], what, bench_size, reps);
+			sprintf(name, "%s/w%s/%s", techs[it], w, Whats[what]);
+			if (mbs < 0) {
+				printf("%s: failed\n", name);
+				fail++;
+				continue;
+			}
+			strcpy(now[nnow].name, name);
+			now[nnow++].mbs = mbs;
+			printf("%s: %.2f MB/sec", name, mbs);
+			for (j = 0; j < nbase && strcmp(base[j].name, name) != 0; j++) ;
+			if (nbase > 0 && j < nbase) {
+				printf(" (baseline %.2f, %+.1f%%)", base[j].mbs, 100.0*(mbs-base[j].mbs)/base[j].mbs);
+				if (!update && mbs < base[j].mbs*(1-tol/100)) {
+					printf(" REGRESSION");
+					fail++;
+				}
+			}
+			printf("\n");
+			fflush(stdout);
+		}
+	}
+
+	if (basepath != NULL && (update || nbase < 0)) {
+		fp = fopen(basepath, "w");
+		if (fp == NULL) { perror(basepath); exit(1); }
+		for (i = 0; i < nnow; i++) fprintf(fp, "%s %.2f\n", now[i].name, now[i].mbs);
+		fclose(fp);
+		printf("baseline written to %s\n", basepath);
+	}
+
+	if (chdir("..") != 0) { perror(".."); exit(1); }
+	if (fail == 0) {
+		sprintf(name, "%s/Coding", dir);
+		check_rmdir(name);
+		sprintf(name, "%s/lost", dir);
+		check_rmdir(name);
+		check_rmdir(dir);
+	}
+	else printf("kept %s\n", dir);
+	return (fail > 0);
+}
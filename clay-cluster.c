@@ -0,0 +1,1451 @@
+/* *
+ * clay-cluster.c - a cluster of storage nodes on one machine, for repair
+ * experiments.
+ *
+ * usage: cluster_dir nodes MB/s latency_ms command [args]
+ *
+ *   init                  creates cluster_dir/node00 .. node<nodes-1>
+ *   put inputfile         sends Coding/<name>_k#/_m# (from clay-encoder)
+ *                         to their nodes
+ *   fail node             loses every chunk on a node; it comes back empty
+ *   get inputfile         degraded read: fetches the surviving chunks of an
+ *                         object into Coding/, ready for clay-decoder
+ *   repair inputfile [full]
+ *                         rebuilds the missing chunks of an object on their
+ *                         (replacement) nodes
+ *   daemon workers cap_MB/s interval_s [scrub] [once]
+ *                         keeps every object whole: each pass finds the
+ *                         Clay objects with chunks missing (or, with scrub,
+ *                         failing their CRCs) and repairs them
+ *   bench inputfile [full]
+ *                         loses each chunk of a whole object in turn and
+ *                         repairs it, one CSV row per chunk, then the
+ *                         average and the worst case
+ *
+ * Chunk i of an object lives on node (hash(name)+i) % nodes, so nodes must
+ * be at least k+m.  A node is a directory, and every byte that goes to or
+ * comes from a node passes its link: a token bucket of MB/s each way (0
+ * means unlimited) and latency_ms once per request.  cluster_dir/limits
+ * may override both for single nodes, one "node MB/s latency_ms" per line.
+ * The helpers of a repair send in parallel, each through its own uplink,
+ * and all of it then goes through the downlink of the node being rebuilt.
+ *
+ * A single lost chunk of a Clay object is rebuilt the Clay way: each of
+ * the k+m-1 helpers sends only the M/2 layers whose bit p (p being the pair
+ * of the lost node) matches the node, and those layers are enough to
+ * regain all M sub-chunks.  With "full", or more than one chunk lost, k
+ * whole chunks are read and every lost one is worked out from them, which
+ * is what repair costs without the Clay repair property.  Each command
+ * reports its time and the bytes that crossed node links.
+ *
+ * bench gives, for every chunk lost on its own, the repair time and MB of
+ * chunk rebuilt per second, the bytes read from all helpers and from the
+ * least and most loaded one, and the peak resident memory the repair
+ * added.  Each rebuilt chunk is checked against the original.  Clay
+ * repair reads the same from every helper but decodes a different set
+ * of layers for each pair, so its cost can depend on which chunk is lost.
+ *
+ * The daemon queues the objects of a pass by how few chunks they have
+ * left, so those closest to data loss are repaired first, and works the
+ * queue with a pool of workers.  All of its traffic, scrub reads included,
+ * also goes through one cap_MB/s bucket (0 unlimited), which leaves the
+ * rest of the links to foreground reads.  Every repair is logged with its
+ * bytes and its time to repair counted from the start of the pass.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <ctype.h>
+#include <dirent.h>
+#include <time.h>
+#include <pthread.h>
+#include <malloc.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/resource.h>
+#include "jerasure.h"
+#include "galois.h"
+#include "reed_sol.h"
+#include "cauchy.h"
+#include "liberation.h"
+#include "chunk-io.h"
+#include "chunk-header.h"
+#include "crc32c.h"
+#include "coupling.h"
+
+#define M 128
+#define r 2
+
+/* Unit of the token buckets, and the most a link may send in one burst */
+#define CLUSTER_PIECE (64*1024)
+
+enum Coding_Technique {Reed_Sol_Van, Reed_Sol_R6_Op, Cauchy_Orig, Cauchy_Good, Liberation, Blaum_Roth, Liber8tion, RDP, EVENODD, No_Coding};
+
+typedef struct {
+	pthread_mutex_t lock;
+	double rate;			/* bytes per second, 0 unlimited */
+	double burst;
+	double tokens;			/* negative: owed by those sleeping */
+	double last;
+} cluster_bucket;
+
+typedef struct {
+	char *dir;
+	double latency;			/* seconds per request */
+	cluster_bucket up, down;
+} cluster_node;
+
+/* One object and where its chunks are */
+typedef struct {
+	char *name, *ext;
+	int md;
+	chunk_header hdr;		/* as read from a surviving chunk */
+	int k, m, w, cw;
+	int *matrix, *bitmatrix;
+	int home[64];			/* node of chunk i */
+	uint64_t *offs[64];		/* offset table of chunk i, NULL if lost */
+	uint32_t *crcs[64];
+	long moved;			/* bytes of this object over node links */
+	long sent[64];			/* of those, sent by chunk i as a helper */
+} cluster_object;
+
+/* What one helper sends: sub-chunks of one read-in, read in runs */
+typedef struct {
+	cluster_object *o;
+	int index;			/* chunk */
+	int n;				/* read-in, from 0 */
+	int nz;
+	int *z;				/* layers wanted */
+	char **buf;			/* buf[z] gets layer z */
+	cluster_bucket *to;		/* downlink it goes through */
+	int ok;				/* sub-chunks passed their CRC */
+	pthread_t tid;
+} cluster_fetch;
+
+int nnodes;
+cluster_node *nodes;
+cluster_bucket cap;			/* all of the daemon's traffic */
+long moved;				/* bytes over node links */
+
+
+static double cluster_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec/1e9;
+}
+
+static void cluster_sleep(double sec)
+{
+	struct timespec ts;
+
+	if (sec <= 0) return;
+	ts.tv_sec = (time_t) sec;
+	ts.tv_nsec = (long) ((sec-ts.tv_sec)*1e9);
+	while (nanosleep(&ts, &ts) != 0 && errno == EINTR) ;
+}
+
+static void bucket_init(cluster_bucket *b, double rate)
+{
+	pthread_mutex_init(&b->lock, NULL);
+	b->rate = rate;
+	b->burst = (rate*0.01 > CLUSTER_PIECE) ? rate*0.01 : CLUSTER_PIECE;
+	b->tokens = b->burst;
+	b->last = cluster_now();
+}
+
+/* Takes len bytes worth of tokens, sleeping off whatever is owed */
+static void bucket_take(cluster_bucket *b, long len)
+{
+	double now, wait;
+
+	if (b == NULL || b->rate <= 0) return;
+	pthread_mutex_lock(&b->lock);
+	now = cluster_now();
+	b->tokens += (now-b->last)*b->rate;
+	if (b->tokens > b->burst) b->tokens = b->burst;
+	b->last = now;
+	b->tokens -= len;
+	wait = (b->tokens < 0) ? -b->tokens/b->rate : 0;
+	pthread_mutex_unlock(&b->lock);
+	cluster_sleep(wait);
+}
+
+/* len bytes over a link, in pieces so parallel senders interleave */
+static void cluster_send(cluster_bucket *from, cluster_bucket *to, long len)
+{
+	long piece;
+
+	__sync_fetch_and_add(&moved, len);
+	while (len > 0) {
+		piece = (len < CLUSTER_PIECE) ? len : CLUSTER_PIECE;
+		bucket_take(from, piece);
+		bucket_take(to, piece);
+		bucket_take(&cap, piece);
+		len -= piece;
+	}
+}
+
+static void cluster_setup(char *dir, double mbps, double latency)
+{
+	FILE *fp;
+	char *path;
+	int i, node;
+	double rate, lat;
+
+	nodes = (cluster_node *)malloc(sizeof(cluster_node)*nnodes);
+	path = (char *)malloc(strlen(dir)+32);
+	bucket_init(&cap, 0);
+	for (i = 0; i < nnodes; i++) {
+		nodes[i].dir = (char *)malloc(strlen(dir)+16);
+		sprintf(nodes[i].dir, "%s/node%02d", dir, i);
+		nodes[i].latency = latency;
+		bucket_init(&nodes[i].up, mbps*1024*1024);
+		bucket_init(&nodes[i].down, mbps*1024*1024);
+	}
+	sprintf(path, "%s/limits", dir);
+	fp = fopen(path, "r");
+	if (fp != NULL) {
+		while (fscanf(fp, "%d %lf %lf", &node, &rate, &lat) == 3) {
+			if (node < 0 || node >= nnodes) continue;
+			nodes[node].latency = lat/1000.0;
+			bucket_init(&nodes[node].up, rate*1024*1024);
+			bucket_init(&nodes[node].down, rate*1024*1024);
+		}
+		fclose(fp);
+	}
+	free(path);
+}
+
+static void chunk_path(cluster_object *o, char *fname, const char *dir, int index)
+{
+	if (index < o->k) sprintf(fname, "%s/%s_k%0*d%s", dir, o->name, o->md, index+1, o->ext);
+	else sprintf(fname, "%s/%s_m%0*d%s", dir, o->name, o->md, index-o->k+1, o->ext);
+}
+
+/* Splits inputfile into the name and extension its chunks carry */
+static void object_name(cluster_object *o, char *inputfile)
+{
+	char *s;
+
+	s = strrchr(inputfile, '/');
+	o->name = strdup(s != NULL ? s+1 : inputfile);
+	s = strchr(o->name, '.');
+	if (s != NULL) {
+		o->ext = strdup(s);
+		*s = '\0';
+	}
+	else {
+		o->ext = strdup("");
+	}
+}
+
+static void object_place(cluster_object *o)
+{
+	unsigned h;
+	char *s;
+	int i;
+
+	h = 5381;
+	for (s = o->name; *s != '\0'; s++) h = h*33 + (unsigned char) *s;
+	for (i = 0; i < o->k+o->m; i++) o->home[i] = (h+i) % nnodes;
+}
+
+static void object_params(cluster_object *o, chunk_header *h)
+{
+	char temp[16];
+
+	o->hdr = *h;
+	o->k = h->k;
+	o->m = h->m;
+	o->w = h->w;
+	o->cw = coupling_w(o->w);
+	sprintf(temp, "%d", o->k);
+	o->md = strlen(temp);
+	if (o->k+o->m > nnodes || o->k+o->m > 64) {
+		fprintf(stderr, "%d chunks need at least as many nodes, there are %d\n", o->k+o->m, nnodes);
+		exit(0);
+	}
+	object_place(o);
+}
+
+/* Sub-chunk size of read-in n (from 0): the last read-in of a stream is
+   only as long as its data */
+static long object_bs(cluster_object *o, int n)
+{
+	return (n == (int) o->hdr.readins-1) ? (long) o->hdr.lastbs : (long) o->hdr.blocksize;
+}
+
+/* Looks up every chunk of the object on its node */
+static int object_find(cluster_object *o)
+{
+	chunk_header h;
+	char *fname;
+	int i, found;
+
+	fname = (char *)malloc(strlen(nodes[0].dir)+strlen(o->name)+strlen(o->ext)+32);
+	found = 0;
+	for (i = 0; i < 64; i++) {
+		o->offs[i] = NULL;
+		o->crcs[i] = NULL;
+	}
+	/* k and m come from whichever chunk turns up first */
+	for (i = 0; i < nnodes && found == 0; i++) {
+		if (chunk_header_find(nodes[i].dir, o->name, o->ext, &h, &o->offs[0]) == 0) {
+			free(o->offs[0]);
+			o->offs[0] = NULL;
+			object_params(o, &h);
+			found = 1;
+		}
+	}
+	if (!found) {
+		fprintf(stderr, "No chunk of %s%s on any node\n", o->name, o->ext);
+		exit(0);
+	}
+	found = 0;
+	for (i = 0; i < o->k+o->m; i++) {
+		chunk_path(o, fname, nodes[o->home[i]].dir, i);
+		if (chunk_header_load(fname, &h, &o->offs[i], &o->crcs[i]) == 0) {
+			o->hdr = h;
+			found++;
+		}
+	}
+	free(fname);
+	return found;
+}
+
+static void object_matrix(cluster_object *o)
+{
+	o->matrix = NULL;
+	o->bitmatrix = NULL;
+	switch (o->hdr.tech) {
+		case Reed_Sol_Van:
+			o->matrix = reed_sol_vandermonde_coding_matrix(o->k, o->m, o->w);
+			break;
+		case Reed_Sol_R6_Op:
+			o->matrix = reed_sol_r6_coding_matrix(o->k, o->w);
+			break;
+		case Cauchy_Orig:
+			o->matrix = cauchy_original_coding_matrix(o->k, o->m, o->w);
+			o->bitmatrix = jerasure_matrix_to_bitmatrix(o->k, o->m, o->w, o->matrix);
+			break;
+		case Cauchy_Good:
+			o->matrix = cauchy_good_general_coding_matrix(o->k, o->m, o->w);
+			o->bitmatrix = jerasure_matrix_to_bitmatrix(o->k, o->m, o->w, o->matrix);
+			break;
+		case Liberation:
+			o->bitmatrix = liberation_coding_bitmatrix(o->k, o->w);
+			break;
+		case Blaum_Roth:
+			o->bitmatrix = blaum_roth_coding_bitmatrix(o->k, o->w);
+			break;
+		case Liber8tion:
+			o->bitmatrix = liber8tion_coding_bitmatrix(o->k);
+			break;
+		default:
+			fprintf(stderr, "Not a valid coding technique.\n");
+			exit(0);
+	}
+}
+
+/* MDS-decodes one layer of U in place; erasures ends in -1 */
+static int layer_decode(cluster_object *o, int *erasures, char **data, char **coding, long bs)
+{
+	if (erasures[0] == -1) return 0;
+	if (o->matrix != NULL && o->bitmatrix == NULL) {
+		return jerasure_matrix_decode(o->k, o->m, o->w, o->matrix, 1, erasures, data, coding, bs);
+	}
+	return jerasure_schedule_decode_lazy(o->k, o->m, o->w, o->bitmatrix, erasures, data, coding, bs, o->hdr.packetsize, 1);
+}
+
+/* Copies a whole file to or from a node, through its link */
+static void cluster_copy(const char *from, const char *to, cluster_node *nd, int up)
+{
+	char *buf;
+	int ifd, ofd;
+	long len;
+
+	buf = chunk_io_alloc(CLUSTER_PIECE);
+	ifd = open(from, O_RDONLY);
+	if (ifd < 0) { perror(from); exit(1); }
+	ofd = open(to, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (ofd < 0) { perror(to); exit(1); }
+	cluster_sleep(nd->latency);
+	while ((len = read(ifd, buf, CLUSTER_PIECE)) > 0) {
+		cluster_send(up ? &nd->up : NULL, up ? NULL : &nd->down, len);
+		if (write(ofd, buf, len) != len) { perror(to); exit(1); }
+	}
+	close(ifd);
+	close(ofd);
+	free(buf);
+}
+
+/* Helper side of a repair: one request per run of adjacent sub-chunks */
+static void *cluster_fetch_main(void *arg)
+{
+	cluster_fetch *f;
+	cluster_object *o;
+	cluster_node *nd;
+	struct iovec *iov;
+	uint64_t *pos;
+	char *fname;
+	long bs, hsize;
+	int fd, i, j, a, b, z;
+
+	f = (cluster_fetch *) arg;
+	o = f->o;
+	nd = &nodes[o->home[f->index]];
+	bs = object_bs(o, f->n);
+	hsize = o->hdr.hdr_size;
+	fname = (char *)malloc(strlen(nd->dir)+strlen(o->name)+strlen(o->ext)+32);
+	chunk_path(o, fname, nd->dir, f->index);
+	f->ok = 0;
+	fd = open(fname, O_RDONLY);
+	if (fd < 0) {
+		perror(fname);
+		free(fname);
+		return NULL;
+	}
+
+	/* Wanted layers in file order */
+	pos = (uint64_t *)malloc(sizeof(uint64_t)*f->nz);
+	iov = (struct iovec *)malloc(sizeof(struct iovec)*f->nz);
+	for (i = 0; i < f->nz; i++) pos[i] = chunk_subchunk_pos(o->offs[f->index], M, f->n+1, f->z[i], o->hdr.blocksize, bs);
+	for (i = 1; i < f->nz; i++) {
+		for (j = i; j > 0 && pos[j-1] > pos[j]; j--) {
+			z = f->z[j]; f->z[j] = f->z[j-1]; f->z[j-1] = z;
+			pos[j] ^= pos[j-1]; pos[j-1] ^= pos[j]; pos[j] ^= pos[j-1];
+		}
+	}
+	for (a = 0; a < f->nz; a = b) {
+		for (b = a+1; b < f->nz && pos[b] == pos[b-1]+bs; b++) ;
+		for (i = a; i < b; i++) {
+			iov[i].iov_base = f->buf[f->z[i]];
+			iov[i].iov_len = bs;
+		}
+		cluster_sleep(nd->latency);
+		cluster_send(&nd->up, f->to, (b-a)*bs);
+		__sync_fetch_and_add(&o->moved, (b-a)*bs);
+		__sync_fetch_and_add(&o->sent[f->index], (b-a)*bs);
+		if (chunk_io_vec(fd, iov+a, b-a, hsize+pos[a], 0) != (b-a)*bs) {
+			fprintf(stderr, "%s: read-in %d cannot be read in full\n", fname, f->n+1);
+			break;
+		}
+	}
+	close(fd);
+
+	f->ok = (a >= f->nz);
+	for (i = 0; i < f->nz && o->crcs[f->index] != NULL; i++) {
+		z = f->z[i];
+		if (crc32c(0, f->buf[z], bs) != o->crcs[f->index][(long)f->n*M+z]) f->ok = 0;
+	}
+	free(pos);
+	free(iov);
+	free(fname);
+	return NULL;
+}
+
+/* Runs the helpers of one read-in in parallel.  Returns -1 if one of
+   them could not deliver. */
+static int cluster_fetch_all(cluster_fetch *f, int nf)
+{
+	int i, ret;
+
+	for (i = 0; i < nf; i++) {
+		if (pthread_create(&f[i].tid, NULL, cluster_fetch_main, &f[i]) != 0) {
+			perror("pthread_create");
+			exit(1);
+		}
+	}
+	ret = 0;
+	for (i = 0; i < nf; i++) {
+		pthread_join(f[i].tid, NULL);
+		if (!f[i].ok) {
+			fprintf(stderr, "%s%s: chunk %d on node %d is short or fails its CRC; repair it with full\n", f[i].o->name, f[i].o->ext, f[i].index, f[i].o->home[f[i].index]);
+			ret = -1;
+		}
+	}
+	return ret;
+}
+
+/* The new chunk index from its M sub-chunks per read-in, c[n*M+z], in
+   the same sub-chunk order and header format as the others.  Returns -1
+   if it cannot be written. */
+static int chunk_store(cluster_object *o, int index, char **c)
+{
+	chunk_header h;
+	uint64_t *off;
+	uint32_t *crc;
+	char *hbuf, *tbuf, *fname;
+	struct iovec *iov;
+	long bs, tlen;
+	int permuted, fd, n, z, i, readins, ret;
+
+	bs = o->hdr.blocksize;
+	readins = o->hdr.readins;
+	off = (uint64_t *)malloc(sizeof(uint64_t)*M);
+	crc = (uint32_t *)malloc(sizeof(uint32_t)*readins*M);
+	iov = (struct iovec *)malloc(sizeof(struct iovec)*M);
+
+	/* Plain layer order unless the object was encoded with permute */
+	permuted = 0;
+	for (i = 0; i < o->k+o->m; i++) {
+		for (z = 0; z < M && o->offs[i] != NULL; z++) {
+			if (o->offs[i][z] != (uint64_t) z*bs) permuted = 1;
+		}
+	}
+	for (z = 0; z < M; z++) off[z] = (uint64_t) z*bs;
+	if (permuted) chunk_permute(off, NULL, index, M, bs);
+	for (n = 0; n < readins; n++) {
+		for (z = 0; z < M; z++) crc[(long)n*M+z] = crc32c(0, c[(long)n*M+z], object_bs(o, n));
+	}
+
+	fname = (char *)malloc(strlen(nodes[o->home[index]].dir)+strlen(o->name)+strlen(o->ext)+32);
+	chunk_path(o, fname, nodes[o->home[index]].dir, index);
+	fd = open(fname, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) {
+		perror(fname);
+		free(fname);
+		free(off);
+		free(crc);
+		free(iov);
+		return -1;
+	}
+	h = o->hdr;
+	if (h.flags & CHUNK_TRAILER) {
+		h.size = 0;
+		h.readins = 0;
+	}
+	hbuf = chunk_io_alloc(h.hdr_size);
+	chunk_header_pack(&h, off, crc, index, hbuf);
+	ret = 0;
+	if (chunk_io_blocking(fd, hbuf, h.hdr_size, 0, 1) != h.hdr_size) ret = -1;
+	for (n = 0; n < readins && ret == 0; n++) {
+		for (z = 0; z < M; z++) {
+			iov[off[z]/bs].iov_base = c[(long)n*M+z];
+			iov[off[z]/bs].iov_len = object_bs(o, n);
+		}
+		if (chunk_io_vec(fd, iov, M, h.hdr_size+(off_t)n*M*bs, 1) != M*object_bs(o, n)) ret = -1;
+	}
+	if ((h.flags & CHUNK_TRAILER) && ret == 0) {
+		tbuf = (char *)malloc(chunk_trailer_size(&h, readins));
+		tlen = chunk_trailer_pack(&h, crc, o->hdr.size, readins, tbuf);
+		if (chunk_io_blocking(fd, tbuf, tlen, h.hdr_size+chunk_data_size(&h, readins), 1) != tlen) ret = -1;
+		free(tbuf);
+	}
+	if (ret != 0) perror(fname);
+	close(fd);
+	free(hbuf);
+	free(fname);
+	free(off);
+	free(crc);
+	free(iov);
+	return ret;
+}
+
+/* Clay repair of chunk t: in every layer z with bit p = t/2 equal to
+   b = t%2, the pairs other than p are all present in both of their
+   layers, so their U are known.  That leaves t and t^1 erased in layer
+   z, which MDS decoding recovers; C[z][t] = U[z][t] there.  The stored
+   C[z][t^1] = U[z][t^1] + r*U[z'][t] then gives U of t in the other layer
+   z' = z^(1<<p), and with it C[z'][t] = U[z'][t] + r*U[z][t^1]. */
+static int repair_clay(cluster_object *o, int t)
+{
+	cluster_fetch *f;
+	char **cbuf, **ubuf, **out;
+	char **data, **coding;
+	char *tmp;
+	int erasures[3];
+	int p, b, n, z, zq, zp, i, j, q, nf, nz, inv, rinv, ret;
+	long bs;
+
+	bs = o->hdr.blocksize;
+	p = t/2;
+	b = t%2;
+	inv = galois_single_divide(1, 1 ^ galois_single_multiply(r, r, o->cw), o->cw);
+	rinv = galois_single_divide(1, r, o->cw);
+
+	cbuf = (char **)malloc(sizeof(char*)*(o->k+o->m)*M);
+	ubuf = (char **)malloc(sizeof(char*)*(o->k+o->m)*M);
+	out = (char **)malloc(sizeof(char*)*o->hdr.readins*M);
+	data = (char **)malloc(sizeof(char*)*o->k);
+	coding = (char **)malloc(sizeof(char*)*o->m);
+	f = (cluster_fetch *)malloc(sizeof(cluster_fetch)*(o->k+o->m));
+	for (i = 0; i < (o->k+o->m)*M; i++) {
+		cbuf[i] = chunk_io_alloc(bs);
+		ubuf[i] = chunk_io_alloc(bs);
+	}
+	tmp = chunk_io_alloc(bs);
+	nz = 0;
+	for (i = 0; i < o->k+o->m; i++) {
+		f[i].z = (int *)malloc(sizeof(int)*M);
+		f[i].buf = (char **)malloc(sizeof(char*)*M);
+	}
+	for (i = 0; i < (long)o->hdr.readins*M; i++) out[i] = NULL;
+
+	ret = 0;
+	for (n = 0; n < (int) o->hdr.readins && ret == 0; n++) {
+		bs = object_bs(o, n);
+		nf = 0;
+		for (i = 0; i < o->k+o->m; i++) {
+			if (i == t) continue;
+			f[nf].o = o;
+			f[nf].index = i;
+			f[nf].n = n;
+			f[nf].to = &nodes[o->home[t]].down;
+			nz = 0;
+			for (z = 0; z < M; z++) {
+				if (((z >> p) & 1) != b) continue;
+				f[nf].z[nz++] = z;
+				f[nf].buf[z] = cbuf[i*M+z];
+			}
+			f[nf].nz = nz;
+			nf++;
+		}
+		if (cluster_fetch_all(f, nf) != 0) {
+			ret = -1;
+			break;
+		}
+
+		for (z = 0; z < M && ret == 0; z++) {
+			if (((z >> p) & 1) != b) continue;
+			/* U of every pair but p */
+			for (i = 0; i < o->k+o->m; i++) {
+				q = i/2;
+				if (q == p) continue;
+				if (((z >> q) & 1) == i%2) {
+					memcpy(ubuf[i*M+z], cbuf[i*M+z], bs);
+				}
+				else {
+					zq = z ^ (1 << q);
+					memcpy(ubuf[i*M+z], cbuf[i*M+z], bs);
+					coupling_region_multiply(cbuf[(i^1)*M+zq], r, bs, ubuf[i*M+z], 1, o->cw);
+					coupling_region_multiply(ubuf[i*M+z], inv, bs, ubuf[i*M+z], 0, o->cw);
+				}
+			}
+			for (i = 0; i < o->k; i++) data[i] = ubuf[i*M+z];
+			for (i = 0; i < o->m; i++) coding[i] = ubuf[(o->k+i)*M+z];
+			erasures[0] = (t < (t^1)) ? t : t^1;
+			erasures[1] = (t < (t^1)) ? t^1 : t;
+			erasures[2] = -1;
+			if (layer_decode(o, erasures, data, coding, bs) != 0) {
+				fprintf(stderr, "%s%s: layer %d does not decode\n", o->name, o->ext, z);
+				ret = -1;
+				break;
+			}
+
+			/* C[z][t] = U[z][t]; U[z'][t] = (C[z][t^1] - U[z][t^1])/r */
+			zp = z ^ (1 << p);
+			j = t^1;
+			out[(long)n*M+z] = (char *)malloc(bs);
+			out[(long)n*M+zp] = (char *)malloc(bs);
+			memcpy(out[(long)n*M+z], ubuf[t*M+z], bs);
+			memcpy(tmp, cbuf[j*M+z], bs);
+			galois_region_xor(ubuf[j*M+z], tmp, bs);
+			coupling_region_multiply(tmp, rinv, bs, out[(long)n*M+zp], 0, o->cw);
+			coupling_region_multiply(ubuf[j*M+z], r, bs, out[(long)n*M+zp], 1, o->cw);
+		}
+	}
+	if (ret == 0) ret = chunk_store(o, t, out);
+
+	for (i = 0; i < (o->k+o->m)*M; i++) {
+		free(cbuf[i]);
+		free(ubuf[i]);
+	}
+	for (i = 0; i < (long)o->hdr.readins*M; i++) free(out[i]);
+	for (i = 0; i < o->k+o->m; i++) {
+		free(f[i].z);
+		free(f[i].buf);
+	}
+	free(tmp);
+	free(cbuf);
+	free(ubuf);
+	free(out);
+	free(data);
+	free(coding);
+	free(f);
+	return ret;
+}
+
+/* Repair from k whole chunks.  Every chunk not read is an erasure.
+   Layers are decoded in order of how many erased nodes are uncoupled in
+   them: a present node coupled to an erased partner needs that partner's
+   U in the other layer, which holds one such node fewer and so is done
+   by then. */
+static int repair_full(cluster_object *o, int *lost, int nlost)
+{
+	cluster_fetch *f;
+	char **cbuf, **ubuf, **out;
+	char **data, **coding;
+	int *erasures, *read, *score;
+	int n, z, zq, i, q, nf, ne, s, maxs, inv, dst, ret;
+	long bs;
+	char *c;
+
+	bs = o->hdr.blocksize;
+	inv = galois_single_divide(1, 1 ^ galois_single_multiply(r, r, o->cw), o->cw);
+	cbuf = (char **)malloc(sizeof(char*)*(o->k+o->m)*M);
+	ubuf = (char **)malloc(sizeof(char*)*(o->k+o->m)*M);
+	out = (char **)malloc(sizeof(char*)*nlost*o->hdr.readins*M);
+	data = (char **)malloc(sizeof(char*)*o->k);
+	coding = (char **)malloc(sizeof(char*)*o->m);
+	erasures = (int *)malloc(sizeof(int)*(o->k+o->m+1));
+	read = (int *)malloc(sizeof(int)*(o->k+o->m));
+	score = (int *)malloc(sizeof(int)*M);
+	f = (cluster_fetch *)malloc(sizeof(cluster_fetch)*o->k);
+	for (i = 0; i < (o->k+o->m)*M; i++) {
+		cbuf[i] = chunk_io_alloc(bs);
+		ubuf[i] = chunk_io_alloc(bs);
+	}
+	for (i = 0; i < (long)nlost*o->hdr.readins*M; i++) out[i] = NULL;
+
+	/* The first k chunks still there are read; the rest are erasures */
+	nf = 0;
+	ne = 0;
+	for (i = 0; i < o->k+o->m; i++) {
+		read[i] = (o->offs[i] != NULL && nf < o->k);
+		if (read[i]) {
+			f[nf].o = o;
+			f[nf].index = i;
+			f[nf].z = (int *)malloc(sizeof(int)*M);
+			f[nf].buf = (char **)malloc(sizeof(char*)*M);
+			f[nf].nz = M;
+			for (z = 0; z < M; z++) {
+				f[nf].z[z] = z;
+				f[nf].buf[z] = cbuf[i*M+z];
+			}
+			nf++;
+		}
+		else {
+			erasures[ne++] = i;
+		}
+	}
+	erasures[ne] = -1;
+	ret = 0;
+	if (nf < o->k) {
+		fprintf(stderr, "%s%s: only %d chunks are left, %d are needed\n", o->name, o->ext, nf, o->k);
+		ret = -1;
+	}
+	/* Lost chunks go to their own nodes; one downlink takes it all */
+	dst = o->home[lost[0]];
+
+	maxs = 0;
+	for (z = 0; z < M; z++) {
+		score[z] = 0;
+		for (i = 0; i < ne; i++) {
+			if (((z >> (erasures[i]/2)) & 1) == erasures[i]%2) score[z]++;
+		}
+		if (score[z] > maxs) maxs = score[z];
+	}
+
+	for (n = 0; n < (int) o->hdr.readins && ret == 0; n++) {
+		bs = object_bs(o, n);
+		for (i = 0; i < nf; i++) {
+			f[i].n = n;
+			f[i].to = &nodes[dst].down;
+		}
+		if (cluster_fetch_all(f, nf) != 0) {
+			ret = -1;
+			break;
+		}
+
+		for (s = 0; s <= maxs && ret == 0; s++) {
+			for (z = 0; z < M && ret == 0; z++) {
+				if (score[z] != s) continue;
+				for (i = 0; i < o->k+o->m; i++) {
+					if (!read[i]) continue;
+					q = i/2;
+					zq = z ^ (1 << q);
+					memcpy(ubuf[i*M+z], cbuf[i*M+z], bs);
+					if (((z >> q) & 1) == i%2) continue;
+					if (read[i^1]) {
+						coupling_region_multiply(cbuf[(i^1)*M+zq], r, bs, ubuf[i*M+z], 1, o->cw);
+						coupling_region_multiply(ubuf[i*M+z], inv, bs, ubuf[i*M+z], 0, o->cw);
+					}
+					else {
+						coupling_region_multiply(ubuf[(i^1)*M+zq], r, bs, ubuf[i*M+z], 1, o->cw);
+					}
+				}
+				for (i = 0; i < o->k; i++) data[i] = ubuf[i*M+z];
+				for (i = 0; i < o->m; i++) coding[i] = ubuf[(o->k+i)*M+z];
+				if (layer_decode(o, erasures, data, coding, bs) != 0) {
+					fprintf(stderr, "%s%s: layer %d does not decode\n", o->name, o->ext, z);
+					ret = -1;
+				}
+			}
+		}
+
+		/* C of the lost chunks from U; out[(i*readins+n)*M+z] */
+		for (i = 0; i < nlost && ret == 0; i++) {
+			q = lost[i]/2;
+			for (z = 0; z < M; z++) {
+				c = (char *)malloc(bs);
+				memcpy(c, ubuf[lost[i]*M+z], bs);
+				if (((z >> q) & 1) != lost[i]%2) {
+					coupling_region_multiply(ubuf[(lost[i]^1)*M+(z ^ (1 << q))], r, bs, c, 1, o->cw);
+				}
+				out[((long)i*o->hdr.readins+n)*M+z] = c;
+			}
+		}
+	}
+	for (i = 0; i < nlost && ret == 0; i++) ret = chunk_store(o, lost[i], out+(long)i*o->hdr.readins*M);
+
+	for (i = 0; i < (o->k+o->m)*M; i++) {
+		free(cbuf[i]);
+		free(ubuf[i]);
+	}
+	for (i = 0; i < (long)nlost*o->hdr.readins*M; i++) free(out[i]);
+	for (i = 0; i < nf; i++) {
+		free(f[i].z);
+		free(f[i].buf);
+	}
+	free(out);
+	free(cbuf);
+	free(ubuf);
+	free(data);
+	free(coding);
+	free(erasures);
+	free(read);
+	free(score);
+	free(f);
+	return ret;
+}
+
+/* A Clay object the daemon looks after in one pass */
+typedef struct {
+	cluster_object o;
+	int found;			/* chunks in place */
+	int nlost;
+	int lost[64];
+} cluster_job;
+
+typedef struct {
+	cluster_job **jobs;
+	int njobs, next;
+	int scrub;
+	double start;			/* of the scan, for the time to repair */
+	pthread_mutex_t lock;
+	int repaired, failed, lost;
+	long bytes;
+	double ttr_sum, ttr_max;
+} cluster_queue;
+
+/* "name_k01.ext" gives "name.ext", anything else NULL */
+static char *chunk_object(const char *fname)
+{
+	const char *s, *e;
+	char *key;
+	long len;
+
+	e = strchr(fname, '.');
+	if (e == NULL) e = fname+strlen(fname);
+	for (s = e; s > fname && isdigit((unsigned char) s[-1]); s--) ;
+	if (s == e || s-fname < 3 || (s[-1] != 'k' && s[-1] != 'm') || s[-2] != '_') return NULL;
+	len = s-2-fname;
+	key = (char *)malloc(len+strlen(e)+1);
+	memcpy(key, fname, len);
+	strcpy(key+len, e);
+	return key;
+}
+
+static int key_compare(const void *a, const void *b)
+{
+	return strcmp(*(char **)a, *(char **)b);
+}
+
+/* The objects with a chunk on some node, each once */
+static int cluster_scan(char ***keys)
+{
+	DIR *d;
+	struct dirent *de;
+	char *key;
+	int i, j, n, size;
+
+	n = 0;
+	size = 64;
+	*keys = (char **)malloc(sizeof(char *)*size);
+	for (i = 0; i < nnodes; i++) {
+		d = opendir(nodes[i].dir);
+		if (d == NULL) continue;
+		while ((de = readdir(d)) != NULL) {
+			if (de->d_name[0] == '.') continue;
+			key = chunk_object(de->d_name);
+			if (key == NULL) continue;
+			if (n == size) {
+				size *= 2;
+				*keys = (char **)realloc(*keys, sizeof(char *)*size);
+			}
+			(*keys)[n++] = key;
+		}
+		closedir(d);
+	}
+	qsort(*keys, n, sizeof(char *), key_compare);
+	for (i = j = 0; i < n; i++) {
+		if (j > 0 && strcmp((*keys)[j-1], (*keys)[i]) == 0) free((*keys)[i]);
+		else (*keys)[j++] = (*keys)[i];
+	}
+	return j;
+}
+
+static void object_free(cluster_object *o)
+{
+	int i;
+
+	for (i = 0; i < 64; i++) {
+		free(o->offs[i]);
+		free(o->crcs[i]);
+	}
+	free(o->matrix);
+	free(o->bitmatrix);
+	free(o->name);
+	free(o->ext);
+}
+
+static void job_count(cluster_job *j)
+{
+	int i;
+
+	j->found = 0;
+	j->nlost = 0;
+	for (i = 0; i < j->o.k+j->o.m; i++) {
+		if (j->o.offs[i] == NULL) j->lost[j->nlost++] = i;
+		else j->found++;
+	}
+}
+
+/* Fewest chunks left first, then the most to rebuild */
+static int job_compare(const void *a, const void *b)
+{
+	cluster_job *x, *y;
+
+	x = *(cluster_job **)a;
+	y = *(cluster_job **)b;
+	if (x->found != y->found) return x->found - y->found;
+	return y->nlost - x->nlost;
+}
+
+/* Reads every sub-chunk of the chunks in place and checks its CRC.  A
+   chunk that is short or fails is moved aside, to .<file>.corrupt on its
+   node, and counts as lost from then on. */
+static void object_scrub(cluster_object *o)
+{
+	cluster_fetch f;
+	struct stat status;
+	char *fname, *to;
+	long bs;
+	int i, n, z;
+
+	bs = o->hdr.blocksize;
+	fname = (char *)malloc(strlen(nodes[0].dir)+strlen(o->name)+strlen(o->ext)+32);
+	to = (char *)malloc(strlen(nodes[0].dir)+strlen(o->name)+strlen(o->ext)+48);
+	f.o = o;
+	f.nz = M;
+	f.to = NULL;
+	f.z = (int *)malloc(sizeof(int)*M);
+	f.buf = (char **)malloc(sizeof(char *)*M);
+	for (z = 0; z < M; z++) {
+		f.z[z] = z;
+		f.buf[z] = chunk_io_alloc(bs);
+	}
+	for (i = 0; i < o->k+o->m; i++) {
+		if (o->offs[i] == NULL) continue;
+		chunk_path(o, fname, nodes[o->home[i]].dir, i);
+		f.index = i;
+		f.ok = (stat(fname, &status) == 0 && status.st_size >= o->hdr.hdr_size+(long)chunk_data_size(&o->hdr, o->hdr.readins));
+		for (n = 0; n < (int) o->hdr.readins && f.ok; n++) {
+			f.n = n;
+			cluster_fetch_main(&f);
+		}
+		if (f.ok) continue;
+		sprintf(to, "%s/.%s.corrupt", nodes[o->home[i]].dir, strrchr(fname, '/')+1);
+		if (rename(fname, to) != 0) perror(fname);
+		printf("%s%s: chunk %d on node %d is corrupt, moved to %s\n", o->name, o->ext, i, o->home[i], to);
+		free(o->offs[i]);
+		free(o->crcs[i]);
+		o->offs[i] = NULL;
+		o->crcs[i] = NULL;
+	}
+	for (z = 0; z < M; z++) free(f.buf[z]);
+	free(f.buf);
+	free(f.z);
+	free(fname);
+	free(to);
+}
+
+/* Scrubs an object if asked, and rebuilds whatever it has lost: the Clay
+   way for one chunk, from k whole chunks otherwise or if that fails */
+static void job_run(cluster_queue *q, cluster_job *j)
+{
+	cluster_object *o;
+	double t, now;
+	long scrubbed;
+	int i, ret;
+
+	o = &j->o;
+	if (q->scrub) {
+		object_scrub(o);
+		job_count(j);
+	}
+	if (j->nlost == 0) return;
+	if (j->found < o->k) {
+		printf("%s%s: only %d chunks are left, %d are needed; the object is lost\n", o->name, o->ext, j->found, o->k);
+		pthread_mutex_lock(&q->lock);
+		q->lost++;
+		pthread_mutex_unlock(&q->lock);
+		return;
+	}
+	t = cluster_now();
+	scrubbed = o->moved;
+	ret = -1;
+	if (j->nlost == 1) ret = repair_clay(o, j->lost[0]);
+	if (ret != 0) ret = repair_full(o, j->lost, j->nlost);
+	now = cluster_now();
+
+	pthread_mutex_lock(&q->lock);
+	if (ret == 0) {
+		printf("%s%s: rebuilt chunk", o->name, o->ext);
+		for (i = 0; i < j->nlost; i++) printf(" %d (node %d)", j->lost[i], o->home[j->lost[i]]);
+		printf(" from %d survivors, %ld bytes in %.3f sec, %.3f sec after the scan\n",
+			j->found, o->moved-scrubbed, now-t, now-q->start);
+		q->repaired++;
+		q->ttr_sum += now-q->start;
+		if (now-q->start > q->ttr_max) q->ttr_max = now-q->start;
+	}
+	else {
+		printf("%s%s: repair failed, next pass tries again\n", o->name, o->ext);
+		q->failed++;
+	}
+	pthread_mutex_unlock(&q->lock);
+}
+
+static void *cluster_daemon_main(void *arg)
+{
+	cluster_queue *q;
+	cluster_job *j;
+
+	q = (cluster_queue *) arg;
+	while (1) {
+		pthread_mutex_lock(&q->lock);
+		j = (q->next < q->njobs) ? q->jobs[q->next++] : NULL;
+		pthread_mutex_unlock(&q->lock);
+		if (j == NULL) break;
+		job_run(q, j);
+		pthread_mutex_lock(&q->lock);
+		q->bytes += j->o.moved;
+		pthread_mutex_unlock(&q->lock);
+	}
+	return NULL;
+}
+
+/* One pass: finds every object, queues the Clay ones that need looking
+   at, most endangered first, and works the queue with a pool of repair
+   threads.  Coding matrices and GF tables are set up before the threads
+   start, as neither is safe to build from several at once. */
+static void cluster_daemon_pass(int pass, int workers, int scrub)
+{
+	cluster_queue q;
+	cluster_job *j;
+	pthread_t *tid;
+	char **keys;
+	int i, nkeys;
+
+	memset(&q, 0, sizeof(cluster_queue));
+	pthread_mutex_init(&q.lock, NULL);
+	q.scrub = scrub;
+	q.start = cluster_now();
+	nkeys = cluster_scan(&keys);
+	q.jobs = (cluster_job **)malloc(sizeof(cluster_job *)*(nkeys+1));
+	for (i = 0; i < nkeys; i++) {
+		j = (cluster_job *)malloc(sizeof(cluster_job));
+		memset(j, 0, sizeof(cluster_job));
+		object_name(&j->o, keys[i]);
+		object_find(&j->o);
+		job_count(j);
+		if (j->o.hdr.family != Chunk_Clay || j->o.hdr.subchunks != M || (1 << ((j->o.k+j->o.m)/2)) != M) {
+			printf("%s: not a Clay object with %d layers, skipped\n", keys[i], M);
+		}
+		else if (j->found < j->o.k) {
+			printf("%s: only %d chunks are left, %d are needed; the object is lost\n", keys[i], j->found, j->o.k);
+			q.lost++;
+		}
+		else if (j->nlost > 0 || scrub) {
+			object_matrix(&j->o);
+			galois_single_multiply(1, 1, j->o.cw);
+			galois_single_multiply(1, 1, 32);	/* galois_region_xor() */
+			q.jobs[q.njobs++] = j;
+			continue;
+		}
+		object_free(&j->o);
+		free(j);
+	}
+	qsort(q.jobs, q.njobs, sizeof(cluster_job *), job_compare);
+
+	tid = (pthread_t *)malloc(sizeof(pthread_t)*workers);
+	for (i = 0; i < workers; i++) {
+		if (pthread_create(&tid[i], NULL, cluster_daemon_main, &q) != 0) {
+			perror("pthread_create");
+			exit(1);
+		}
+	}
+	for (i = 0; i < workers; i++) pthread_join(tid[i], NULL);
+
+	printf("pass %d: %d objects, %d repaired, %d failed, %d lost, %ld bytes over links in %.3f sec",
+		pass, nkeys, q.repaired, q.failed, q.lost, q.bytes, cluster_now()-q.start);
+	if (q.repaired > 0) printf(", time to repair mean %.3f max %.3f sec", q.ttr_sum/q.repaired, q.ttr_max);
+	printf("\n");
+	fflush(stdout);
+
+	for (i = 0; i < q.njobs; i++) {
+		object_free(&q.jobs[i]->o);
+		free(q.jobs[i]);
+	}
+	for (i = 0; i < nkeys; i++) free(keys[i]);
+	free(keys);
+	free(q.jobs);
+	free(tid);
+	pthread_mutex_destroy(&q.lock);
+}
+
+/* Peak resident memory since the last reset, in bytes.  Writing 5 to
+   clear_refs sets the peak back to what is resident now (Linux 4.0 on);
+   without it this is the peak of the whole run. */
+static void cluster_peak_reset(void)
+{
+	int fd;
+
+	malloc_trim(0);
+	fd = open("/proc/self/clear_refs", O_WRONLY);
+	if (fd < 0) return;
+	write(fd, "5", 1);
+	close(fd);
+}
+
+static long cluster_peak(const char *field)
+{
+	FILE *fp;
+	char line[256];
+	long kb;
+	struct rusage ru;
+
+	kb = -1;
+	fp = fopen("/proc/self/status", "r");
+	if (fp != NULL) {
+		while (fgets(line, sizeof(line), fp) != NULL) {
+			if (strncmp(line, field, strlen(field)) == 0) sscanf(line+strlen(field), "%ld", &kb);
+		}
+		fclose(fp);
+	}
+	if (kb < 0) {
+		getrusage(RUSAGE_SELF, &ru);
+		kb = (strcmp(field, "VmHWM:") == 0) ? ru.ru_maxrss : 0;
+	}
+	return kb*1024;
+}
+
+/* 1 if the two files have the same bytes */
+static int cluster_same(const char *a, const char *b)
+{
+	char *x, *y;
+	int fa, fb, ret;
+	long la, lb;
+
+	x = (char *)malloc(CLUSTER_PIECE);
+	y = (char *)malloc(CLUSTER_PIECE);
+	fa = open(a, O_RDONLY);
+	fb = open(b, O_RDONLY);
+	ret = (fa >= 0 && fb >= 0);
+	while (ret) {
+		la = read(fa, x, CLUSTER_PIECE);
+		lb = read(fb, y, CLUSTER_PIECE);
+		if (la != lb || (la > 0 && memcmp(x, y, la) != 0)) ret = 0;
+		if (la <= 0) break;
+	}
+	if (fa >= 0) close(fa);
+	if (fb >= 0) close(fb);
+	free(x);
+	free(y);
+	return ret;
+}
+
+/* Loses each chunk of a whole object in turn and repairs it, the Clay way
+   or with full from k whole chunks.  The rebuilt chunk is compared with
+   the one set aside, which then goes back in its place. */
+static void cluster_bench(cluster_object *o, int full)
+{
+	char *fname, *aside;
+	double t, sec, mbs, sum_sec, sum_mbs, max_sec, min_mbs;
+	long chunk, base, peak, hmin, hmax, sum_read, max_read, sum_peak, max_peak;
+	int t0, i, helpers, ret, same, nok, nfail;
+
+	fname = (char *)malloc(strlen(nodes[0].dir)+strlen(o->name)+strlen(o->ext)+32);
+	aside = (char *)malloc(strlen(nodes[0].dir)+strlen(o->name)+strlen(o->ext)+48);
+	chunk = chunk_data_size(&o->hdr, o->hdr.readins);
+	galois_single_multiply(1, 1, o->cw);
+	nok = nfail = 0;
+	sum_sec = sum_mbs = max_sec = 0;
+	min_mbs = -1;
+	sum_read = max_read = sum_peak = max_peak = 0;
+
+	printf("%s%s: k=%d m=%d w=%d, %s repair of every chunk, %ld bytes each\n", o->name, o->ext, o->k, o->m, o->w,
+		full ? "full" : "clay", chunk);
+	printf("chunk,node,helpers,read_bytes,helper_min,helper_max,sec,MBs,peak_MB,ok\n");
+	for (t0 = 0; t0 < o->k+o->m; t0++) {
+		chunk_path(o, fname, nodes[o->home[t0]].dir, t0);
+		sprintf(aside, "%s/.%s.bench", nodes[o->home[t0]].dir, strrchr(fname, '/')+1);
+		if (rename(fname, aside) != 0) { perror(fname); exit(1); }
+		free(o->offs[t0]);
+		free(o->crcs[t0]);
+		o->offs[t0] = NULL;
+		o->crcs[t0] = NULL;
+
+		o->moved = 0;
+		memset(o->sent, 0, sizeof(o->sent));
+		cluster_peak_reset();
+		base = cluster_peak("VmRSS:");
+		t = cluster_now();
+		ret = full ? repair_full(o, &t0, 1) : repair_clay(o, t0);
+		sec = cluster_now()-t;
+		peak = cluster_peak("VmHWM:")-base;
+		if (peak < 0) peak = 0;
+		same = (ret == 0 && cluster_same(fname, aside));
+
+		/* The original goes back, whatever became of the repair */
+		if (rename(aside, fname) != 0) { perror(aside); exit(1); }
+		if (chunk_header_load(fname, &o->hdr, &o->offs[t0], &o->crcs[t0]) != 0) {
+			fprintf(stderr, "%s: cannot read it back\n", fname);
+			exit(1);
+		}
+
+		helpers = 0;
+		hmin = -1;
+		hmax = 0;
+		for (i = 0; i < o->k+o->m; i++) {
+			if (o->sent[i] == 0) continue;
+			helpers++;
+			if (hmin < 0 || o->sent[i] < hmin) hmin = o->sent[i];
+			if (o->sent[i] > hmax) hmax = o->sent[i];
+		}
+		mbs = (sec > 0) ? chunk/1024.0/1024.0/sec : 0;
+		printf("%d,%d,%d,%ld,%ld,%ld,%.6f,%.2f,%.2f,%s\n", t0, o->home[t0], helpers, o->moved, (hmin < 0) ? 0 : hmin, hmax,
+			sec, mbs, peak/1024.0/1024.0, same ? "yes" : "no");
+		fflush(stdout);
+		if (!same) {
+			nfail++;
+			continue;
+		}
+		nok++;
+		sum_sec += sec;
+		sum_mbs += mbs;
+		sum_read += o->moved;
+		sum_peak += peak;
+		if (sec > max_sec) max_sec = sec;
+		if (min_mbs < 0 || mbs < min_mbs) min_mbs = mbs;
+		if (o->moved > max_read) max_read = o->moved;
+		if (peak > max_peak) max_peak = peak;
+	}
+	if (nok > 0) {
+		printf("average: %.6f sec, %.2f MB/sec, %ld bytes read, %.2f MB peak\n", sum_sec/nok, sum_mbs/nok,
+			sum_read/nok, sum_peak/1024.0/1024.0/nok);
+		printf("worst: %.6f sec, %.2f MB/sec, %ld bytes read, %.2f MB peak\n", max_sec, min_mbs,
+			max_read, max_peak/1024.0/1024.0);
+	}
+	if (nfail > 0) printf("%d of %d repairs failed or did not give the chunk back\n", nfail, o->k+o->m);
+	free(fname);
+	free(aside);
+}
+
+int main(int argc, char **argv)
+{
+	double t1, mbps, latency, tsec;
+	char *cmd, *fname, *to;
+	struct stat status;
+	int i, node, found, workers, scrub, once, pass;
+	int lost[64], nlost;
+	chunk_header h;
+	uint64_t *hoff;
+	long size;
+	cluster_object obj, *o;
+
+	if (argc < 6) {
+		fprintf(stderr, "usage: cluster_dir nodes MB/s latency_ms command [args]\n");
+		fprintf(stderr, "\ncommands: init, put inputfile, fail node, get inputfile, repair inputfile [full],");
+		fprintf(stderr, "\n          daemon workers cap_MB/s interval_s [scrub] [once], bench inputfile [full]");
+		fprintf(stderr, "\nMB/s of 0 means unlimited; cluster_dir/limits may set \"node MB/s latency_ms\" per node.\n\n");
+		exit(0);
+	}
+	if (sscanf(argv[2], "%d", &nnodes) != 1 || nnodes <= 0) {
+		fprintf(stderr, "Invalid value for nodes\n");
+		exit(0);
+	}
+	if (sscanf(argv[3], "%lf", &mbps) != 1 || mbps < 0) {
+		fprintf(stderr, "Invalid value for MB/s\n");
+		exit(0);
+	}
+	if (sscanf(argv[4], "%lf", &latency) != 1 || latency < 0) {
+		fprintf(stderr, "Invalid value for latency\n");
+		exit(0);
+	}
+	cluster_setup(argv[1], mbps, latency/1000.0);
+	/* The CRC32C tables are built on first use; build them before any
+	   helper or daemon thread can race for them */
+	crc32c_init();
+	o = &obj;
+	memset(o, 0, sizeof(cluster_object));
+	cmd = argv[5];
+	moved = 0;
+	/* Wall clock: most of a throttled run is spent asleep */
+	t1 = cluster_now();
+
+	if (strcmp(cmd, "init") == 0) {
+		mkdir(argv[1], S_IRWXU);
+		for (i = 0; i < nnodes; i++) {
+			if (mkdir(nodes[i].dir, S_IRWXU) != 0 && errno != EEXIST) { perror(nodes[i].dir); exit(1); }
+		}
+		printf("%d nodes in %s\n", nnodes, argv[1]);
+		return 0;
+	}
+	if (strcmp(cmd, "fail") == 0) {
+		if (argc != 7 || sscanf(argv[6], "%d", &node) != 1 || node < 0 || node >= nnodes) {
+			fprintf(stderr, "fail needs a node between 0 and %d\n", nnodes-1);
+			exit(0);
+		}
+		to = (char *)malloc(strlen(nodes[node].dir)+32);
+		for (i = 0; ; i++) {
+			sprintf(to, "%s.failed%d", nodes[node].dir, i);
+			if (stat(to, &status) != 0) break;
+		}
+		if (rename(nodes[node].dir, to) != 0) { perror(nodes[node].dir); exit(1); }
+		if (mkdir(nodes[node].dir, S_IRWXU) != 0) { perror(nodes[node].dir); exit(1); }
+		printf("node %d failed, its chunks are in %s\n", node, to);
+		free(to);
+		return 0;
+	}
+	if (strcmp(cmd, "daemon") == 0) {
+		if (argc < 9 || sscanf(argv[6], "%d", &workers) != 1 || workers <= 0 ||
+		    sscanf(argv[7], "%lf", &mbps) != 1 || mbps < 0 || sscanf(argv[8], "%lf", &tsec) != 1 || tsec < 0) {
+			fprintf(stderr, "daemon needs workers > 0, cap_MB/s >= 0 and interval_s >= 0\n");
+			exit(0);
+		}
+		scrub = 0;
+		once = 0;
+		for (i = 9; i < argc; i++) {
+			if (strcmp(argv[i], "scrub") == 0) scrub = 1;
+			else if (strcmp(argv[i], "once") == 0) once = 1;
+			else {
+				fprintf(stderr, "Unknown daemon option %s\n", argv[i]);
+				exit(0);
+			}
+		}
+		bucket_init(&cap, mbps*1024*1024);
+		for (pass = 1; ; pass++) {
+			cluster_daemon_pass(pass, workers, scrub);
+			if (once) break;
+			cluster_sleep(tsec);
+		}
+		return 0;
+	}
+	if (argc < 7) {
+		fprintf(stderr, "%s needs an inputfile\n", cmd);
+		exit(0);
+	}
+	object_name(o, argv[6]);
+
+	if (strcmp(cmd, "put") == 0) {
+		fname = (char *)malloc(strlen(o->name)+strlen(o->ext)+1000);
+		to = (char *)malloc(strlen(argv[1])+strlen(o->name)+strlen(o->ext)+64);
+		if (chunk_header_find("Coding", o->name, o->ext, &h, &hoff) != 0) {
+			fprintf(stderr, "No chunks of %s in Coding/\n", argv[6]);
+			exit(0);
+		}
+		free(hoff);
+		object_params(o, &h);
+		for (i = 0; i < o->k+o->m; i++) {
+			chunk_path(o, fname, "Coding", i);
+			chunk_path(o, to, nodes[o->home[i]].dir, i);
+			cluster_copy(fname, to, &nodes[o->home[i]], 0);
+		}
+	}
+	else if (strcmp(cmd, "get") == 0) {
+		found = object_find(o);
+		fname = (char *)malloc(strlen(o->name)+strlen(o->ext)+1000);
+		to = (char *)malloc(strlen(argv[1])+strlen(o->name)+strlen(o->ext)+64);
+		mkdir("Coding", S_IRWXU);
+		for (i = 0; i < o->k+o->m; i++) {
+			chunk_path(o, to, "Coding", i);
+			unlink(to);
+			if (o->offs[i] == NULL) {
+				printf("chunk %d is lost (node %d)\n", i, o->home[i]);
+				continue;
+			}
+			chunk_path(o, fname, nodes[o->home[i]].dir, i);
+			cluster_copy(fname, to, &nodes[o->home[i]], 1);
+		}
+		if (found < o->k) {
+			fprintf(stderr, "Only %d chunks are left, %d are needed\n", found, o->k);
+			exit(0);
+		}
+	}
+	else if (strcmp(cmd, "repair") == 0) {
+		found = object_find(o);
+		fname = NULL;
+		to = NULL;
+		if (o->hdr.family != Chunk_Clay || o->hdr.subchunks != M || (1 << ((o->k+o->m)/2)) != M) {
+			fprintf(stderr, "%s is not a Clay object with %d layers\n", argv[6], M);
+			exit(0);
+		}
+		nlost = 0;
+		for (i = 0; i < o->k+o->m; i++) {
+			if (o->offs[i] == NULL) lost[nlost++] = i;
+		}
+		if (nlost == 0) {
+			printf("nothing to repair\n");
+			return 0;
+		}
+		object_matrix(o);
+		if (nlost == 1 && !(argc > 7 && strcmp(argv[7], "full") == 0)) {
+			printf("clay repair of chunk %d on node %d from %d helpers\n", lost[0], o->home[lost[0]], found);
+			if (repair_clay(o, lost[0]) != 0) exit(0);
+		}
+		else {
+			printf("full repair of %d chunks from %d helpers\n", nlost, o->k);
+			if (repair_full(o, lost, nlost) != 0) exit(0);
+		}
+	}
+	else if (strcmp(cmd, "bench") == 0) {
+		found = object_find(o);
+		fname = NULL;
+		to = NULL;
+		if (o->hdr.family != Chunk_Clay || o->hdr.subchunks != M || (1 << ((o->k+o->m)/2)) != M) {
+			fprintf(stderr, "%s is not a Clay object with %d layers\n", argv[6], M);
+			exit(0);
+		}
+		if (found != o->k+o->m) {
+			fprintf(stderr, "%s has %d of its %d chunks; bench needs them all\n", argv[6], found, o->k+o->m);
+			exit(0);
+		}
+		object_matrix(o);
+		cluster_bench(o, argc > 7 && strcmp(argv[7], "full") == 0);
+	}
+	else {
+		fprintf(stderr, "Not a valid command.\n");
+		exit(0);
+	}
+
+	tsec = cluster_now()-t1;
+	size = o->hdr.size;
+	printf("object size: %ld\n", size);
+	printf("bytes over links: %ld\n", moved);
+	printf("time(sec): %0.10f\n", tsec);
+	printf("Throughput (MB/sec): %0.10f\n", (((double) moved)/1024.0/1024.0)/tsec);
+	free(fname);
+	free(to);
+	return 0;
+}
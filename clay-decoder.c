@@ -67,16 +67,24 @@ same arguments, and encoder.c does error check.
 #include <sys/time.h>
 #include <sys/stat.h>
 #include <signal.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <pthread.h>
+#include <sys/uio.h>
 #include "jerasure.h"
 #include "reed_sol.h"
 #include "galois.h"
 #include "cauchy.h"
 #include "liberation.h"
-#include "timing.h"
+#include "chunk-io.h"
+#include "chunk-header.h"
+#include "crc32c.h"
+#include "chunk-stage.h"
+#include "coupling.h"
 
 #define N 10
 #define M 128
+#define r 2
 
 enum Coding_Technique {Reed_Sol_Van, Reed_Sol_R6_Op, Cauchy_Orig, Cauchy_Good, Liberation, Blaum_Roth, Liber8tion, RDP, EVENODD, No_Coding};
 
@@ -86,302 +94,368 @@ char *Methods[N] = {"reed_sol_van", "reed_sol_r6_op", "cauchy_orig", "cauchy_goo
 enum Coding_Technique method;
 int readins, n;
 
+/* Layout and coding parameters of the object, shared by the workers */
+int k, m, w, cw, packetsize, tech;
+long blocksize;
+long lastbs;				// sub-chunk size of the last read-in, short for a stream
+long origsize;
+int hdr_size;
+int *matrix, *bitmatrix;
+uint64_t **offs;			// offset table of every file; they may differ
+uint32_t **crcs;			// CRC32C table of each chunk, NULL if it has none
+char *hdrbad;				// hdrbad[i]: file i is there but its header is not usable
+char *curdir, *cs1, *extension;
+int md;
+int use_uring;				// read the k+m files through io_uring
+int use_direct;				// read the k+m files with O_DIRECT
+int use_perf;				// hardware counters for each stage
+
+/* Decoded object.  Workers pwrite their read-in at its offset when ofd can
+   seek; a pipe gets the read-ins strictly in order, out_next at a time. */
+int ofd;
+int out_seekable;
+off_t out_base;
+int out_next;
+pthread_mutex_t out_lock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t out_turn = PTHREAD_COND_INITIALIZER;
+int next_readin;			// next read-in to hand to a worker
+chunk_stage stages;			// setup, and the workers' stages summed
+
 /* Function prototype */
 void ctrl_bs_handler(int dummy);
 
-int main (int argc, char **argv) {
-	FILE *fp;				// File pointer
+/* Wall-clock seconds.  The workers of parallel mode run at the same time,
+   so CPU time of the process would count them all at once. */
+static double clay_now(void)
+{
+	struct timespec ts;
 
-	/* Jerasure arguments */
-	char **data;
-	char **coding;
-        char **pdata;
-        char **pcoding;
-        
-        char **fdata;           
-        char **fcoding;         
-        char **ffdata;           //backup
-        char **ccoding;         //backup
-        char *e;
-        char *e1;
-
-	int *erasures;
-	int *erased;
-	int *matrix;
-	int *bitmatrix;
-	
-	/* Parameters */
-	int k, m, w, packetsize, buffersize;
-	int tech;
-	char *c_tech;
-	
-	int i, j,i1,j1;				// loop control variable, s
-	int blocksize = 0;			// size of individual files
-	int origsize;			// size of file before padding
-	int total;				// used to write data, not padding to file
-	struct stat status;		// used to find size of individual files
-	int numerased;			// number of erased files
-        int Bsize;
-        Bsize=512000;
-		
-	/* Used to recreate file names */
-	char *temp;
-	char *cs1, *cs2, *extension;
-	char *fname;
-	int md;
-	char *curdir;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec/1e9;
+}
 
-	/* Used to time decoding */
-	struct timing t1, t2, t3, t4, t5, t6;
-	double tsec;
-	double totalsec;
-        double transec;
+#define CLAY_SCHEDULE_UNCOUPLE
+#include "clay-schedule.h"
 
-	
-	signal(SIGQUIT, ctrl_bs_handler);
+/* Uncouples a read-in in place once every sub-chunk is there, pair by
+   pair.  Of a coupled pair, the odd node of the lower layer z is worked
+   out first, U = ((C[z][t] + C[z'][t-1])/(1+r) + C[z'][t-1])/(1+r), and
+   the even node of z' then takes r times it off its C.  The profiles
+   clay-gen wrote a schedule for run it; the rest take the loops here,
+   which do the same in the same order. */
+void clay_uncouple(char **fdata, char **fcoding, int k, int m, long blocksize, int cw)
+{
+  int p, h, i, j, inv;
+  char *c, *cp;
 
-	matrix = NULL;
-	bitmatrix = NULL;
-	totalsec = 0.0;
-	
-	/* Start timing */
-	timing_set(&t1);
+  inv = galois_single_divide(1, 1^r, cw);
+  if (clay_uncouple_schedule(k, m, M, fdata, fcoding, blocksize, inv, cw) == 0) return;
+  for (p = 0; p < (k+m)/2; p++) {
+    h = 1 << p;
+    for (i = 0; i < M; i++) {
+      for (j = 2*p; j < 2*p+2; j++) {
+        if (((i & h) != 0) == (j%2 != 0)) continue;
+        c = (j < k) ? fdata[i]+j*blocksize : fcoding[i]+(j-k)*blocksize;
+        cp = ((j^1) < k) ? fdata[i^h]+(j^1)*blocksize : fcoding[i^h]+((j^1)-k)*blocksize;
+        if (j%2 != 0) {
+          galois_region_xor(cp, c, blocksize);
+          coupling_region_multiply(c, inv, blocksize, c, 0, cw);
+          galois_region_xor(cp, c, blocksize);
+          coupling_region_multiply(c, inv, blocksize, c, 0, cw);
+        }
+        else {
+          coupling_region_multiply(cp, r, blocksize, c, 1, cw);
+        }
+      }
+    }
+  }
+}
 
-	/* Error checking parameters */
-	if (argc != 2) {
-		fprintf(stderr, "usage: inputfile\n");
-		exit(0);
-	}
-	curdir = (char *)malloc(sizeof(char)*1000);
-	assert(curdir == getcwd(curdir, 1000));
-	
-	/* Begin recreation of file names */
-	cs1 = (char*)malloc(sizeof(char)*strlen(argv[1]));
-	cs2 = strrchr(argv[1], '/');
-	if (cs2 != NULL) {
-		cs2++;
-		strcpy(cs1, cs2);
-	}
-	else {
-		strcpy(cs1, argv[1]);
-	}
-	cs2 = strchr(cs1, '.');
-	if (cs2 != NULL) {
-                extension = strdup(cs2);
-		*cs2 = '\0';
-	} else {
-           extension = strdup("");
-        }	
-	fname = (char *)malloc(sizeof(char*)*(100+strlen(argv[1])+20));
+/* Sub-chunk repair.  Chunks that are missing and sub-chunks that fail
+   their CRC are marked in bad[] (bad[t*M+z] is layer z of node t), and
+   clay_repair_run() rebuilds the stored, coupled contents of the bad data
+   sub-chunks in place.  Only the layers holding one are MDS-decoded, plus
+   whatever layers their pair partners need, so a bit flip in one sector
+   costs one layer rather than a whole chunk.
 
-	/* Read in parameters from metadata file */
-	sprintf(fname, "%s/Coding/%s_meta.txt", curdir, cs1);
+   Node t belongs to pair t/2, which couples across layer bit t/2.  In 
+   layer z, t is uncoupled (C = U) when that bit of z equals t%2; otherwise
+   C[z][t] = U[z][t] + r*U[z'][t^1], z' being z with the bit flipped. */
+typedef struct {
+  int k, m, w, cw, tech, packetsize, blocksize;
+  int *matrix, *bitmatrix;
+  char **fdata, **fcoding;
+  char *bad;
+  char **u;		/* u[t*M+z]: U of a coupled sub-chunk, once worked out */
+  char *layer;		/* 0 untouched, 1 being decoded, 2 decoded, 3 failed */
+} clay_repair;
 
-	fp = fopen(fname, "rb");
-        if (fp == NULL) {
-          fprintf(stderr, "Error: no metadata file %s\n", fname);
-          exit(1);
-        }
-	temp = (char *)malloc(sizeof(char)*(strlen(argv[1])+20));
-	if (fscanf(fp, "%s", temp) != 1) {
-		fprintf(stderr, "Metadata file - bad format\n");
-		exit(0);
-	}
-	
-	if (fscanf(fp, "%d", &origsize) != 1) {
-		fprintf(stderr, "Original size is not valid\n");
-		exit(0);
-	}
-	if (fscanf(fp, "%d %d %d %d %d", &k, &m, &w, &packetsize, &buffersize) != 5) {
-		fprintf(stderr, "Parameters are not correct\n");
-		exit(0);
-	}
-	c_tech = (char *)malloc(sizeof(char)*(strlen(argv[1])+20));
-	if (fscanf(fp, "%s", c_tech) != 1) {
-		fprintf(stderr, "Metadata file - bad format\n");
-		exit(0);
-	}
-	if (fscanf(fp, "%d", &tech) != 1) {
-		fprintf(stderr, "Metadata file - bad format\n");
-		exit(0);
-	}
-	method = tech;
-	if (fscanf(fp, "%d", &readins) != 1) {
-		fprintf(stderr, "Metadata file - bad format\n");
-		exit(0);
-	}
-	fclose(fp);	
- 
-        printf("origsize:%d\n",origsize);
-        //printf("packetsize:%d\n",packetsize);
-        printf("buffersize:%d\n",buffersize);
-         
-	/* Allocate memory */
-	erased = (int *)malloc(sizeof(int)*(k+m));
-	for (i = 0; i < k+m; i++)
-		erased[i] = 0;
-	erasures = (int *)malloc(sizeof(int)*(k+m));
+static char *repair_c(clay_repair *R, int z, int t)
+{
+  if (t < R->k) return R->fdata[z]+t*R->blocksize;
+  return R->fcoding[z]+(t-R->k)*R->blocksize;
+}
 
-	data = (char **)malloc(sizeof(char *)*M);
-	coding = (char **)malloc(sizeof(char *)*M);
+static int repair_decode_layer(clay_repair *R, int z);
 
-        pdata = (char **)malloc(sizeof(char*)*k);
-            for(j=0;j<k;j++){
-               pdata[j] = (char *)malloc(sizeof(char)*Bsize);}
+/* U of sub-chunk (z, t), or NULL if it cannot be worked out from what has
+   been decoded so far */
+static char *repair_u(clay_repair *R, int z, int t)
+{
+  int p, zp, tp, bs;
+  char *u, *up;
 
-        pcoding = (char **)malloc(sizeof(char*)*m);
-            for (i = 0; i < m; i++) {
-		pcoding[i] = (char *)malloc(sizeof(char)*Bsize);
-                if (pcoding[i] == NULL) { perror("malloc"); exit(1); }
-	     }
+  bs = R->blocksize;
+  if (R->u[t*M+z] != NULL) return R->u[t*M+z];
+  if (R->bad[t*M+z]) {
+    repair_decode_layer(R, z);
+    return R->u[t*M+z];
+  }
+  p = t/2;
+  if (((z >> p) & 1) == (t & 1)) return repair_c(R, z, t);
+  zp = z ^ (1 << p);
+  tp = t ^ 1;
+  if (R->bad[tp*M+zp]) {
+    /* Partner lost: C[z][t] - r*U[z'][t'] */
+    up = repair_u(R, zp, tp);
+    if (up == NULL) return NULL;
+    u = (char *)malloc(sizeof(char)*bs);
+    if (u == NULL) { perror("malloc"); exit(1); }
+    memcpy(u, repair_c(R, z, t), bs);
+    coupling_region_multiply(up, r, bs, u, 1, R->cw);
+  }
+  else {
+    /* Both halves stored: C[z][t] + r*C[z'][t'] = (1+r^2)U[z][t] */
+    u = (char *)malloc(sizeof(char)*bs);
+    if (u == NULL) { perror("malloc"); exit(1); }
+    memcpy(u, repair_c(R, z, t), bs);
+    coupling_region_multiply(repair_c(R, zp, tp), r, bs, u, 1, R->cw);
+    coupling_region_multiply(u, galois_single_divide(1, 1 ^ galois_single_multiply(r, r, R->cw), R->cw), bs, u, 0, R->cw);
+  }
+  R->u[t*M+z] = u;
+  return u;
+}
 
-        fdata = (char **)malloc(sizeof(char*)*M);
-            for(j=0;j<M;j++){
-               fdata[j] = (char *)malloc(sizeof(char)*k*Bsize);}
+/* MDS-decodes layer z.  Nodes whose U cannot be had yet are erasures too;
+   returns 0 if there are more than m of them. */
+static int repair_decode_layer(clay_repair *R, int z)
+{
+  int i, t, ne, ret;
+  int *erasures;
+  char **pdata, **pcoding;
+  char *u;
 
-        fcoding = (char **)malloc(sizeof(char*)*M);
-            for (i = 0; i < M; i++) {
-		fcoding[i] = (char *)malloc(sizeof(char)*m*Bsize);
-                if (fcoding[i] == NULL) { perror("malloc"); exit(1); }
-	     }
-        ffdata = (char **)malloc(sizeof(char*)*M);
-            for(j=0;j<M;j++){
-               ffdata[j] = (char *)malloc(sizeof(char)*k*Bsize);}
+  if (R->layer[z] != 0) return (R->layer[z] == 2);
+  R->layer[z] = 1;
+  erasures = (int *)malloc(sizeof(int)*(R->k+R->m+1));
+  pdata = (char **)malloc(sizeof(char*)*R->k);
+  pcoding = (char **)malloc(sizeof(char*)*R->m);
+  ne = 0;
+  for (t = 0; t < R->k+R->m; t++) {
+    u = R->bad[t*M+z] ? NULL : repair_u(R, z, t);
+    if (u == NULL) {
+      erasures[ne++] = t;
+      u = (char *)malloc(sizeof(char)*R->blocksize);
+      if (u == NULL) { perror("malloc"); exit(1); }
+    }
+    if (t < R->k) pdata[t] = u;
+    else pcoding[t-R->k] = u;
+  }
+  erasures[ne] = -1;
 
-        ccoding = (char **)malloc(sizeof(char*)*M);
-            for (i = 0; i < M; i++) {
-		ccoding[i] = (char *)malloc(sizeof(char)*m*Bsize);
-                if (ccoding[i] == NULL) { perror("malloc"); exit(1); }
-	     }
+  ret = -1;
+  if (ne <= R->m) {
+    switch (R->tech) {
+      case Reed_Sol_Van:
+      case Reed_Sol_R6_Op:
+        ret = jerasure_matrix_decode(R->k, R->m, R->w, R->matrix, 1, erasures, pdata, pcoding, R->blocksize);
+        break;
+      case Cauchy_Orig:
+      case Cauchy_Good:
+      case Liberation:
+      case Blaum_Roth:
+      case Liber8tion:
+        ret = jerasure_schedule_decode_lazy(R->k, R->m, R->w, R->bitmatrix, erasures, pdata, pcoding, R->blocksize, R->packetsize, 1);
+        break;
+      default:
+        break;
+    }
+  }
+  for (i = 0; i < ne; i++) {
+    t = erasures[i];
+    u = (t < R->k) ? pdata[t] : pcoding[t-R->k];
+    if (ret == 0) R->u[t*M+z] = u;
+    else free(u);
+  }
+  free(erasures);
+  free(pdata);
+  free(pcoding);
+  R->layer[z] = (ret == 0) ? 2 : 3;
+  return (ret == 0);
+}
 
-	if (buffersize != origsize) {
-		for (i = 0; i < M; i++) {
-			data[i] = (char *)malloc(sizeof(char)*(buffersize/k/M));
-		}
-		for (i = 0; i < m; i++) {
-			coding[i] = (char *)malloc(sizeof(char)*(buffersize/M/m));
-		}
-		blocksize = buffersize/k/M;
-	}
-        e=(char *)malloc(sizeof(char)*7);
-        e1=(char *)malloc(sizeof(char)*7);
+/* Rebuilds every bad sub-chunk the uncoupling of the data nodes reads:
+   those of the data nodes, and with k odd those of coding node k, which
+   is paired with data node k-1.  The other bad coding sub-chunks are left
+   as they are, nothing that follows looks at them.  Returns -1 if some
+   needed layer has too many erasures. */
+static int clay_repair_run(clay_repair *R)
+{
+  int z, t, p, ret;
+  char *u, *up, *c;
 
-        printf("buffersize2:%d\n ",buffersize);
-        printf("blocksize:%d\n",blocksize);
-        printf("readins:%d\n", readins);
-	sprintf(temp, "%d", k);
+  ret = 0;
+  for (t = 0; t < R->k+R->m && ret == 0; t++) {
+    if (t >= R->k && (t^1) >= R->k) continue;
+    for (z = 0; z < M && ret == 0; z++) {
+      if (!R->bad[t*M+z]) continue;
+      u = repair_u(R, z, t);
+      if (u == NULL) { ret = -1; break; }
+      c = repair_c(R, z, t);
+      p = t/2;
+      if (((z >> p) & 1) == (t & 1)) {
+        memcpy(c, u, R->blocksize);
+      }
+      else {
+        up = repair_u(R, z ^ (1 << p), t ^ 1);
+        if (up == NULL) { ret = -1; break; }
+        memcpy(c, u, R->blocksize);
+        coupling_region_multiply(up, r, R->blocksize, c, 1, R->cw);
+      }
+    }
+  }
+  for (t = 0; t < (R->k+R->m)*M; t++) {
+    free(R->u[t]);
+    R->u[t] = NULL;
+  }
+  memset(R->layer, 0, M);
+  return ret;
+}
 
-	md = strlen(temp);
-	timing_set(&t3);
-	/* Create coding matrix or bitmatrix */
-	switch(tech) {
-		case No_Coding:
-			break;
-		case Reed_Sol_Van:
-			matrix = reed_sol_vandermonde_coding_matrix(k, m, w);
-			break;
-		case Reed_Sol_R6_Op:
-			matrix = reed_sol_r6_coding_matrix(k, w);
-			break;
-		case Cauchy_Orig:
-			matrix = cauchy_original_coding_matrix(k, m, w);
-			bitmatrix = jerasure_matrix_to_bitmatrix(k, m, w, matrix);
-			break;
-		case Cauchy_Good:
-			matrix = cauchy_good_general_coding_matrix(k, m, w);
-			bitmatrix = jerasure_matrix_to_bitmatrix(k, m, w, matrix);
-			break;
-		case Liberation:
-			bitmatrix = liberation_coding_bitmatrix(k, w);
-			break;
-		case Blaum_Roth:
-			bitmatrix = blaum_roth_coding_bitmatrix(k, w);
-			break;
-		case Liber8tion:
-			bitmatrix = liber8tion_coding_bitmatrix(k);
-	}
-	timing_set(&t4);
-	totalsec += timing_delta(&t3, &t4);
-	
-        
-	/* Begin decoding process */
-	total = 0;
-	n = 1;	
-	while (n <= readins) {
+/* One decode worker: the buffers of one read-in and its own I/O queue */
+typedef struct {
+	char **fdata, **fcoding;	// the read-in, straight from the k+m files; uncoupled in place
+	char **pdata, **pcoding;	// pointers into one layer
+	int *erased, *erasures;
+	char *e, *e1;
+	int *cfd;			// descriptors of the k+m files
+	char *ioerr;			// ioerr[i]: a read of file i failed or came up short
+	struct iovec *riov;		// sub-chunks of one file, in file order
+	struct iovec *wiov;		// layers of the decoded object
+	char *fname;
+	chunk_io cio;
+	clay_repair rep;		// sub-chunk erasures and their repair
+	double dsec, tsec;		// decoding and coupling inversion time
+	chunk_stage st;			// time and bytes of each stage
+	pthread_t tid;
+} clay_worker;
+
+/* Reads, checks, repairs and decodes read-in n (from 1) into d->fdata */
+static void clay_decode_readin(clay_worker *d, int n)
+{
+	char **pdata = d->pdata, **pcoding = d->pcoding;
+	char **fdata = d->fdata, **fcoding = d->fcoding;
+	char *e = d->e, *e1 = d->e1;
+	char *fname = d->fname;
+	int *erased = d->erased, *erasures = d->erasures;
+	int i, j, i1, numerased, nbad, nchecked, fd;
+	char *sub;
+	long bs;				// sub-chunk size of this read-in
+	double t3, t4, t5, t6;
+
+		chunk_stage_mark(&d->st);
+		bs = (n == readins) ? lastbs : blocksize;
 		numerased = 0;
-		/* Open files, check for erasures, read in data/coding */	
-		for (i = 1; i <= k; i++) {
+		memset(d->ioerr, 0, k+m);
+		if (use_uring || use_direct) {
+			/* Queue every sub-chunk read of this read-in as one batch, 
+			   straight into its place in fdata/fcoding */
+			for (i = 0; i < k+m; i++) {
+				if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i+1, extension);
+				else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i-k+1, extension);
+				d->cfd[i] = hdrbad[i] ? -1 : chunk_io_open(fname, O_RDONLY, use_direct);
+				if (d->cfd[i] < 0) {
+					erased[i] = 1;
+					erasures[numerased] = i;
+					numerased++;
+					printf("%s failed\n", fname);
+					continue;
+				}
+				if (use_direct && blocksize%CHUNK_IO_ALIGN != 0) {
+					/* Not encoded with direct: sub-chunks are not aligned */
+					chunk_io_undirect(d->cfd[i]);
+				}
+				d->cio.tag = i;
+				for (j = 0; j < M; j++) {
+					if (i < k) chunk_io_pread(&d->cio, d->cfd[i], fdata[j]+i*bs, bs, hdr_size+chunk_subchunk_pos(offs[i], M, n, j, blocksize, bs), -1);
+					else chunk_io_pread(&d->cio, d->cfd[i], fcoding[j]+(i-k)*bs, bs, hdr_size+chunk_subchunk_pos(offs[i], M, n, j, blocksize, bs), -1);
+				}
+			}
+			chunk_io_wait(&d->cio);
+			for (i = 0; i < k+m; i++) {
+				if (d->cfd[i] >= 0) close(d->cfd[i]);
+			}
+		}
+		/* Open files, check for erasures, read in data/coding.  The M 
+		   sub-chunks of a file are one run on disk: a single preadv 
+		   scatters them to their places in fdata/fcoding. */
+		for (i = 1; i <= k && !use_uring && !use_direct; i++) {
 			sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i, extension);
-			fp = fopen(fname, "rb");
-			if (fp == NULL) {
+			fd = hdrbad[i-1] ? -1 : open(fname, O_RDONLY);
+			if (fd < 0) {
 				erased[i-1] = 1;
 				erasures[numerased] = i-1;
 				numerased++;
 				printf("%s failed\n", fname);
 			}
 			else {
-                               /*fread(fdata[i],sizeof(char),blocksize,fp);
-                               printf("data_readtest\n");
-                               for(j=0;j<blocksize;j++)
-                               {printf("%d ",fdata[3][j]);}*/
-				if (buffersize == origsize) {
-					stat(fname, &status);
-					blocksize = status.st_size/M;
-                                        //printf("%d ",blocksize);
-
-                                        for(j=0;j<M;j++){
-                                           data[j] = (char *)malloc(sizeof(char)*blocksize);
-					   assert(blocksize == fread(data[j], sizeof(char), blocksize, fp));
-                                        }
-				}
-				else {
-					fseek(fp, blocksize*(n-1), SEEK_SET); 
-                                        for(j=0;j<M;j++){
-					assert(blocksize == fread(data[j], sizeof(char), blocksize, fp));}
+				for (j = 0; j < M; j++) {
+					d->riov[chunk_offset(offs[i-1], j, blocksize)/blocksize].iov_base = fdata[j]+(i-1)*bs;
+					d->riov[chunk_offset(offs[i-1], j, blocksize)/blocksize].iov_len = bs;
 				}
-				fclose(fp);
-
-                               for(j=0;j<M;j++){
-                                 for(j1=0;j1<blocksize;j1++){
-                                    fdata[j][(i-1)*blocksize+j1]=data[j][j1];
-                                 }
-                              }
+				if (chunk_io_vec(fd, d->riov, M, hdr_size+(off_t)(n-1)*M*blocksize, 0) != M*bs) d->ioerr[i-1] = 1;
+				close(fd);
 	              }
                        
 		}
                 
-		for (i = 1; i <= m; i++) {
+		for (i = 1; i <= m && !use_uring && !use_direct; i++) {
 			sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i, extension);
-				fp = fopen(fname, "rb");
-			if (fp == NULL) {
+			fd = hdrbad[k+i-1] ? -1 : open(fname, O_RDONLY);
+			if (fd < 0) {
 				erased[k+(i-1)] = 1;
 				erasures[numerased] = k+i-1;
 				numerased++;
 				printf("%s failed\n", fname);
 			}
 			else {
-				if (buffersize == origsize) {
-					stat(fname, &status);
-					blocksize = status.st_size/M;
-                                        //printf("%d ",blocksize);
-                                        for(j=0;j<M;j++){
-					coding[j] = (char *)malloc(sizeof(char)*blocksize);
-					assert(blocksize == fread(coding[j], sizeof(char), blocksize, fp));}
+				for (j = 0; j < M; j++) {
+					d->riov[chunk_offset(offs[k+i-1], j, blocksize)/blocksize].iov_base = fcoding[j]+(i-1)*bs;
+					d->riov[chunk_offset(offs[k+i-1], j, blocksize)/blocksize].iov_len = bs;
 				}
-				else {
-					fseek(fp, blocksize*(n-1), SEEK_SET);
-                                        for(j=0;j<M;j++){
-					assert(blocksize == fread(coding[j], sizeof(char), blocksize, fp));}
-				}	
-				fclose(fp);
-                              for(j=0;j<M;j++){
-                                 for(j1=0;j1<blocksize;j1++){
-                                    fcoding[j][(i-1)*blocksize+j1]=coding[j][j1];
-                                 }
-                              }
+				if (chunk_io_vec(fd, d->riov, M, hdr_size+(off_t)(n-1)*M*blocksize, 0) != M*bs) d->ioerr[k+i-1] = 1;
+				close(fd);
 			}
 		}
                           
+		/* A file that is there but cannot be read in full (truncated, 
+		   or an I/O error) is erased like a missing one, as long as k
+		   files are left */
+		for (i = 0; i < k+m; i++) {
+			if (!d->ioerr[i] || erased[i]) continue;
+			if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i+1, extension);
+			else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i-k+1, extension);
+			fprintf(stderr, "%s: read-in %d cannot be read in full, treating it as erased\n", fname, n);
+			erased[i] = 1;
+			erasures[numerased] = i;
+			numerased++;
+		}
+		if (numerased > m) {
+			fprintf(stderr, "Read-in %d: %d of the %d chunks are missing or unreadable, at most %d may be\n", n, numerased, k+m, m);
+			exit(1);
+		}
+		chunk_stage_end(&d->st, Stage_Read, (uint64_t) (k+m-numerased)*M*bs);
+
 		/* Finish allocating data/coding if needed */
 		/*if (n == 1) {
 			for (i = 0; i < numerased; i++) {
@@ -395,9 +469,57 @@ int main (int argc, char **argv) {
 				}
 			}
 		}*/
+		/* Missing chunks are erased as a whole, a sub-chunk that fails 
+		   the CRC in its chunk header only by itself */
+		nbad = 0;
+		nchecked = 0;
+		for (i = 0; i < k+m; i++) {
+			if (!erased[i] && crcs[i] != NULL) nchecked += M;
+			for (j = 0; j < M; j++) {
+				sub = (i < k) ? fdata[j]+i*bs : fcoding[j]+(i-k)*bs;
+				if (erased[i]) {
+					d->rep.bad[i*M+j] = 1;
+				}
+				else if (crcs[i] != NULL && crc32c(0, sub, bs) != crcs[i][(long)(n-1)*M+j]) {
+					if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i+1, extension);
+					else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i-k+1, extension);
+					fprintf(stderr, "%s: sub-chunk %d of read-in %d fails the CRC32C check, treating it as erased\n", fname, j, n);
+					d->rep.bad[i*M+j] = 1;
+				}
+				if (d->rep.bad[i*M+j] && (i < k || (i^1) < k)) nbad++;
+			}
+		}
+		chunk_stage_end(&d->st, Stage_Crc, (uint64_t) nchecked*bs);
+
+		/* Rebuild the bad data sub-chunks, and those of a coding node
+		   paired with a data node, layer by layer, so that what follows
+		   sees a complete set */
+		if (nbad > 0) {
+			d->rep.k = k;
+			d->rep.m = m;
+			d->rep.w = w;
+			d->rep.cw = cw;
+			d->rep.tech = tech;
+			d->rep.packetsize = packetsize;
+			d->rep.blocksize = bs;
+			d->rep.matrix = matrix;
+			d->rep.bitmatrix = bitmatrix;
+			d->rep.fdata = fdata;
+			d->rep.fcoding = fcoding;
+			if (clay_repair_run(&d->rep) != 0) {
+				fprintf(stderr, "Unsuccessful!\n");
+				exit(0);
+			}
+		}
+		if (nbad > 0 || numerased > 0) {
+			for (i = 0; i < k+m; i++) erased[i] = 0;
+			numerased = 0;
+		}
+		memset(d->rep.bad, 0, (k+m)*M);
 		erasures[numerased] = -1;
+		chunk_stage_end(&d->st, Stage_Mds, (uint64_t) nbad*bs);
 
-      timing_set(&t5);  
+      t5 = clay_now();  
       /* invert transformation*/
       for(i=0;i<7;i++){
                e[0]=20; e[1]=18;e[2]=21;e[3]=16;e[4]=25;e[5]=13;e[6]=54;}   
@@ -405,16 +527,6 @@ int main (int argc, char **argv) {
                e1[0]=1; e1[1]=1;e1[2]=1;e1[3]=1;e1[4]=1;e1[5]=1;e1[6]=1;}
       galois_region_xor(e,e1,7);
       
-       for(i=0;i<M;i++){
-            for(j=0;j<k*blocksize;j++){
-              ffdata[i][j]=fdata[i][j];
-            }
-        }
-        for(i=0;i<M;i++){
-            for(j=0;j<m*blocksize;j++){
-              ccoding[i][j]=fcoding[i][j];
-            }
-        }
 
      /*
         //k=0,1
@@ -423,10 +535,10 @@ int main (int argc, char **argv) {
              if(erased[j]==0){
                if(j%2!=0 &&  i%2==0) {                                                                 //C1_2+C2_1 xor C1_2e1+c2_1 to C1_2(1+e1)
 		   galois_region_xor(fdata[i+1]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,e1[j/2],w),blocksize,fdata[i]+j*blocksize,0); 
+                   coupling_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,e1[j/2],w),blocksize,fdata[i]+j*blocksize, 0, cw); 
 	       }
                if(j%2==0 && i%2!=0){ 
-                   galois_w08_region_multiply((fdata[i-1]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-1]+(j+1)*blocksize), 0);
+                   coupling_region_multiply((fdata[i-1]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-1]+(j+1)*blocksize), 0, cw);
 		   galois_region_xor(ffdata[i-1]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
                }
              }
@@ -438,10 +550,10 @@ int main (int argc, char **argv) {
            for(j=2;j<8;j++){
                if(j%2!=0 && (i/2==0 || i/2==2) && erased[j]==0 && erased[j-1]==0) {                                                                 
 		   galois_region_xor(fdata[i+2]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,e1[j/2],w),blocksize,fdata[i]+j*blocksize,0); 
+                   coupling_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,e1[j/2],w),blocksize,fdata[i]+j*blocksize, 0, cw); 
 	       }
                if(j%2==0 && (i/2==1 || i/2==3) && erased[j]==0 && erased[j+1]==0){ 
-                   galois_w08_region_multiply((fdata[i-2]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-2]+(j+1)*blocksize), 0);
+                   coupling_region_multiply((fdata[i-2]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-2]+(j+1)*blocksize), 0, cw);
 		   galois_region_xor(ffdata[i-2]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
                }
            }
@@ -452,10 +564,10 @@ int main (int argc, char **argv) {
            for(j=8;j<10;j++){
               if(j%2!=0 && i/4==0 && erased[j]==0 && erased[j-1]==0){ 
                  galois_region_xor(fdata[i+4]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);
-                 galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,e1[j/2],w),blocksize,fdata[i]+j*blocksize,0); 
+                 coupling_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,e1[j/2],w),blocksize,fdata[i]+j*blocksize, 0, cw); 
 	        }
               if(j%2==0 && i/4==1 && erased[j]==0 && erased[j+1]==0){ 
-                   galois_w08_region_multiply((fdata[i-4]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-4]+(j+1)*blocksize), 0);
+                   coupling_region_multiply((fdata[i-4]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-4]+(j+1)*blocksize), 0, cw);
 		   galois_region_xor(ffdata[i-4]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
 		 }
            }
@@ -466,221 +578,525 @@ int main (int argc, char **argv) {
            for(j=0;j<4;j++){
               if(j%2!=0 && i/4==0 && erased[k+j]==0 && erased[k+j-1]==0){ 
                  galois_region_xor(fcoding[i+4]+(j-1)*blocksize,fcoding[i]+j*blocksize,blocksize);
-                 galois_w08_region_multiply(fcoding[i]+j*blocksize,galois_single_divide(1,e1[4+j/2],w),blocksize,fcoding[i]+j*blocksize,0); 
+                 coupling_region_multiply(fcoding[i]+j*blocksize,galois_single_divide(1,e1[4+j/2],w),blocksize,fcoding[i]+j*blocksize, 0, cw); 
 	      }
               if(j%2==0 && i/4==1 && erased[k+j]==0 && erased[k+j-1]==0){ 
-                  galois_w08_region_multiply((fcoding[i-4]+(j+1)*blocksize),e[4+j/2],blocksize,(ccoding[i-4]+(j+1)*blocksize), 0);
+                  coupling_region_multiply((fcoding[i-4]+(j+1)*blocksize),e[4+j/2],blocksize,(ccoding[i-4]+(j+1)*blocksize), 0, cw);
 		  galois_region_xor(ccoding[i-4]+(j+1)*blocksize,fcoding[i]+j*blocksize, blocksize);
                }
            }
         }  
       */
 
-       //k=0,1
-        for(i=0;i<M;i++){
-           for(j=0;j<2;j++){
-             if(erased[j]==0){
-               if(j%2!=0 && i%2==0) {                                                                 //C1_2+2*C2_1 xor C1_2*2+c2_1 to C1_2(1+2)+c2_1(1+2)
-		   galois_region_xor(fdata[i+1]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);      
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fdata[i]+j*blocksize,0); 
-                   galois_region_xor(fdata[i+1]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize); 
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fdata[i]+j*blocksize,0); 
-	       }
-               if(j%2==0 && i%2!=0){ 
-                   galois_w08_region_multiply((fdata[i-1]+(j+1)*blocksize),2,blocksize,(ffdata[i-1]+(j+1)*blocksize), 0);
-		   galois_region_xor(ffdata[i-1]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
-               }
-             }
-           }
-        } 
-       //k=2,3
-       for(i=0;i<M;i++){
-           i1=i-(i/4)*4;
-           for(j=2;j<4;j++){
-               if(j%2!=0 && i1<2 && erased[j]==0 && erased[j-1]==0) {                                                                 
-		   galois_region_xor(fdata[i+2]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);      
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fdata[i]+j*blocksize,0); 
-                   galois_region_xor(fdata[i+2]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize); 
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fdata[i]+j*blocksize,0);
-	       }
-               if(j%2==0 && i1>=2 && erased[j]==0 && erased[j+1]==0){ 
-                   galois_w08_region_multiply((fdata[i-2]+(j+1)*blocksize),2,blocksize,(ffdata[i-2]+(j+1)*blocksize), 0);
-		   galois_region_xor(ffdata[i-2]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
-               }
-           }
-        } 
-
-       //k=4,5
-       for(i=0;i<M;i++){
-           i1=i-(i/8)*8;
-           for(j=4;j<6;j++){
-               if(j%2!=0 && i1<4 && erased[j]==0 && erased[j-1]==0) {                                                                 
-		   galois_region_xor(fdata[i+4]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);      
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fdata[i]+j*blocksize,0); 
-                   galois_region_xor(fdata[i+4]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize); 
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fdata[i]+j*blocksize,0);
-	       }
-               if(j%2==0 && i1>=4 && erased[j]==0 && erased[j+1]==0){ 
-                   galois_w08_region_multiply((fdata[i-4]+(j+1)*blocksize),2,blocksize,(ffdata[i-4]+(j+1)*blocksize), 0);
-		   galois_region_xor(ffdata[i-4]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
-               }
-           }
-        } 
-      
-       //k=6,7
-       for(i=0;i<M;i++){
-           i1=i-(i/16)*16;
-           for(j=6;j<8;j++){
-               if(j%2!=0 && i1<8 && erased[j]==0 && erased[j-1]==0) {                                                                 
-		   galois_region_xor(fdata[i+8]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);      
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fdata[i]+j*blocksize,0); 
-                   galois_region_xor(fdata[i+8]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize); 
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fdata[i]+j*blocksize,0);
-	       }
-               if(j%2==0 && i1>=8 && erased[j]==0 && erased[j+1]==0){ 
-                   galois_w08_region_multiply((fdata[i-8]+(j+1)*blocksize),2,blocksize,(ffdata[i-8]+(j+1)*blocksize), 0);
-		   galois_region_xor(ffdata[i-8]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
-               }
-           }
-        }
-
-        //k=8,9
-       for(i=0;i<M;i++){
-           i1=i-(i/32)*32;
-           for(j=8;j<10;j++){
-               if(j%2!=0 && i1<16 && erased[j]==0 && erased[j-1]==0) {                                                                 
-		   galois_region_xor(fdata[i+16]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);      
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fdata[i]+j*blocksize,0); 
-                   galois_region_xor(fdata[i+16]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize); 
-                   galois_w08_region_multiply(fdata[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fdata[i]+j*blocksize,0);
-	       } 
-               if(j%2==0 && i1>=16 && erased[j]==0 && erased[j+1]==0){ 
-                   galois_w08_region_multiply((fdata[i-16]+(j+1)*blocksize),2,blocksize,(ffdata[i-16]+(j+1)*blocksize), 0);
-		   galois_region_xor(ffdata[i-16]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
-               }
-           }
-        }
+       clay_uncouple(fdata, fcoding, k, m, bs, cw);
+   t6 = clay_now(); 
+   chunk_stage_end(&d->st, Stage_Couple, (uint64_t) (k+m)*M*bs);
 
-        //k=10/11/12/13 or m=0/1/2/3
-         for(i=0;i<M;i++){
-           i1=i-(i/64)*64;
-           for(j=0;j<2;j++){
-              if(j%2!=0 && i1<32 && erased[k+j]==0 && erased[k+j-1]==0){ 
-                 galois_region_xor(fcoding[i+32]+(j-1)*blocksize,fcoding[i]+j*blocksize,blocksize);
-                 galois_w08_region_multiply(fcoding[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fcoding[i]+j*blocksize,0);
-                 galois_region_xor(fcoding[i+32]+(j-1)*blocksize,fcoding[i]+j*blocksize,blocksize);
-                 galois_w08_region_multiply(fcoding[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fcoding[i]+j*blocksize,0); 
-	      }
-              if(j%2==0 && i1>=32&& erased[k+j]==0 && erased[k+j-1]==0){ 
-                  //printf("%d ",i);
-                  //printf("\n");  
-                  galois_w08_region_multiply((fcoding[i-32]+(j+1)*blocksize),2,blocksize,(ccoding[i-32]+(j+1)*blocksize), 0);
-		  galois_w8_region_xor(ccoding[i-32]+(j+1)*blocksize,fcoding[i]+j*blocksize, blocksize);
-                  
-               }
-           }
-        } 
-      
-        for(i=0;i<M;i++){
-           i1=i-(i/128)*128;
-           for(j=2;j<4;j++){
-              if(j%2!=0 && i1<64 && erased[k+j]==0 && erased[k+j-1]==0){ 
-                 galois_region_xor(fcoding[i+64]+(j-1)*blocksize,fcoding[i]+j*blocksize,blocksize);
-                 galois_w08_region_multiply(fcoding[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fcoding[i]+j*blocksize,0);
-                 galois_region_xor(fcoding[i+64]+(j-1)*blocksize,fcoding[i]+j*blocksize,blocksize);
-                 galois_w08_region_multiply(fcoding[i]+j*blocksize,galois_single_divide(1,3,w),blocksize,fcoding[i]+j*blocksize,0); 
-	      }
-              if(j%2==0 && i1>=64 && erased[k+j]==0 && erased[k+j-1]==0){ 
-                  galois_w08_region_multiply((fcoding[i-64]+(j+1)*blocksize),2,blocksize,(ccoding[i-64]+(j+1)*blocksize), 0);
-		  galois_region_xor(ccoding[i-64]+(j+1)*blocksize,fcoding[i]+j*blocksize, blocksize);
-               }
-           }
-        }
-   timing_set(&t6); 
-
-   timing_set(&t3);
+   t3 = clay_now();
 		/* Choose proper decoding method */
 		if (tech == Reed_Sol_Van || tech == Reed_Sol_R6_Op) {
                         for(j=0;j<M;j++){
                            for(i1=0;i1<k;i1++){
-                              pdata[i1]=fdata[j]+i1*blocksize;}
+                              pdata[i1]=fdata[j]+i1*bs;}
                               //printf("\n");
                               //printf("%d ",pdata[1][2]);
                            for(i1=0;i1<m;i1++){
-                              pcoding[i1]=fcoding[j]+i1*blocksize;}   
-			      i = jerasure_matrix_decode(k, m, w, matrix, 1, erasures, pdata, pcoding, blocksize);
+                              pcoding[i1]=fcoding[j]+i1*bs;}   
+			      i = jerasure_matrix_decode(k, m, w, matrix, 1, erasures, pdata, pcoding, bs);
                            //printf("\n");
                            //printf("%d \n",i);
                          }
                         
 		}
 		else if (tech == Cauchy_Orig || tech == Cauchy_Good || tech == Liberation || tech == Blaum_Roth || tech == Liber8tion) {
-			i = jerasure_schedule_decode_lazy(k, m, w, bitmatrix, erasures, data, coding, blocksize, packetsize, 1);
+			/* The lazy schedule decoder cannot cope with an empty erasure list */
+			i = 0;
+			for (j = 0; j < M && numerased > 0 && i != -1; j++) {
+				for (i1 = 0; i1 < k; i1++) pdata[i1] = fdata[j]+i1*bs;
+				for (i1 = 0; i1 < m; i1++) pcoding[i1] = fcoding[j]+i1*bs;
+				i = jerasure_schedule_decode_lazy(k, m, w, bitmatrix, erasures, pdata, pcoding, bs, packetsize, 1);
+			}
 		}
 		else {
 			fprintf(stderr, "Not a valid coding technique.\n");
 			exit(0);
 		}
 
-     timing_set(&t4);
+     t4 = clay_now();
+     chunk_stage_end(&d->st, Stage_Mds, (uint64_t) k*M*bs);
         
 		/* Exit if decoding was unsuccessful */
-                //printf("%d \n",i);
 		if (i == -1) {
 			fprintf(stderr, "Unsuccessful!\n");
 			exit(0);
 		}
+	d->dsec += (t4-t3);
+	d->tsec += (t6-t5);
+}
+
+/* Writes the object bytes of read-in n, the layers of d->fdata with one
+   writev */
+static void clay_write_readin(clay_worker *d, int n)
+{
+	long off, total, bs;
+	int i, nw;
+
+	bs = (n == readins) ? lastbs : blocksize;
+	off = (long)(n-1)*k*M*blocksize;
+	nw = 0;
+	total = off;
+	for (i = 0; i < M && total < origsize; i++) {
+		d->wiov[nw].iov_base = d->fdata[i];
+		d->wiov[nw].iov_len = (total+k*bs <= origsize) ? k*bs : origsize-total;
+		total += d->wiov[nw].iov_len;
+		nw++;
+	}
+	if (out_seekable) {
+		if (chunk_io_vec(ofd, d->wiov, nw, out_base+off, 1) != total-off) {
+			perror("Writing the decoded file");
+			exit(1);
+		}
+	}
+	else {
+		pthread_mutex_lock(&out_lock);
+		while (out_next != n) pthread_cond_wait(&out_turn, &out_lock);
+		pthread_mutex_unlock(&out_lock);
+		if (chunk_io_vec(ofd, d->wiov, nw, -1, 1) != total-off) {
+			perror("Writing the decoded file");
+			exit(1);
+		}
+		pthread_mutex_lock(&out_lock);
+		out_next++;
+		pthread_cond_broadcast(&out_turn);
+		pthread_mutex_unlock(&out_lock);
+	}
+	chunk_stage_end(&d->st, Stage_Write, total-off);
+	d->st.readins++;
+}
+
+/* Buffers for one read-in.  fdata/fcoding are read into directly; a whole
+   read-in is too much memory to pin as registered buffers. */
+static void clay_worker_init(clay_worker *d)
+{
+	int i, j;
+
+	d->dsec = 0.0;
+	d->tsec = 0.0;
+	chunk_stage_init(&d->st);
+	if (use_perf) chunk_stage_perf(&d->st);
+	d->erased = (int *)malloc(sizeof(int)*(k+m));
+	for (i = 0; i < k+m; i++)
+		d->erased[i] = 0;
+	d->erasures = (int *)malloc(sizeof(int)*(k+m+1));
+	d->rep.bad = (char *)malloc(sizeof(char)*(k+m)*M);
+	d->rep.u = (char **)malloc(sizeof(char *)*(k+m)*M);
+	d->rep.layer = (char *)malloc(sizeof(char)*M);
+	memset(d->rep.bad, 0, (k+m)*M);
+	for (i = 0; i < (k+m)*M; i++) d->rep.u[i] = NULL;
+	memset(d->rep.layer, 0, M);
+
+        /* Pointers into fdata/fcoding, one layer at a time */
+        d->pdata = (char **)malloc(sizeof(char*)*k);
+        d->pcoding = (char **)malloc(sizeof(char*)*m);
+
+        /* One read-in: M layers of k+m sub-chunks */
+        d->fdata = (char **)malloc(sizeof(char*)*M);
+            for(j=0;j<M;j++){
+               d->fdata[j] = chunk_io_alloc(sizeof(char)*k*blocksize);}
+
+        d->fcoding = (char **)malloc(sizeof(char*)*M);
+            for (i = 0; i < M; i++) {
+		d->fcoding[i] = chunk_io_alloc(sizeof(char)*m*blocksize);
+	     }
+        d->e=(char *)malloc(sizeof(char)*7);
+        d->e1=(char *)malloc(sizeof(char)*7);
+
+	d->cfd = (int *)malloc(sizeof(int)*(k+m));
+	d->riov = (struct iovec *)malloc(sizeof(struct iovec)*M);
+	d->wiov = (struct iovec *)malloc(sizeof(struct iovec)*M);
+	d->fname = (char *)malloc(sizeof(char)*(strlen(curdir)+strlen(cs1)+strlen(extension)+40));
+	d->ioerr = (char *)malloc(sizeof(char)*(k+m));
+	if (use_uring || use_direct) chunk_io_init(&d->cio, 256, use_uring);
+	d->cio.tagged = d->ioerr;
+}
+
+static void clay_worker_free(clay_worker *d)
+{
+	int i;
+
+	for (i = 0; i < M; i++) {
+		free(d->fdata[i]);
+		free(d->fcoding[i]);
+	}
+	free(d->fdata);
+	free(d->fcoding);
+	free(d->pdata);
+	free(d->pcoding);
+	free(d->erased);
+	free(d->erasures);
+	free(d->rep.bad);
+	free(d->rep.u);
+	free(d->rep.layer);
+	free(d->e);
+	free(d->e1);
+	free(d->cfd);
+	free(d->riov);
+	free(d->ioerr);
+	free(d->wiov);
+	free(d->fname);
+	if (use_uring) chunk_io_exit(&d->cio);
+	chunk_stage_perf_close(&d->st);
+}
+
+/* Parallel mode: read-ins are handed out in order, each decoded and
+   written by whichever worker took it */
+static void *clay_worker_main(void *arg)
+{
+	clay_worker *d;
+	int rn;
+
+	d = (clay_worker *) arg;
+	clay_worker_init(d);
+	while ((rn = __sync_fetch_and_add(&next_readin, 1)) <= readins) {
+		n = rn;
+		clay_decode_readin(d, rn);
+		clay_write_readin(d, rn);
+	}
+	clay_worker_free(d);
+	return NULL;
+}
+
+int main (int argc, char **argv) {
+	FILE *fp;				// File pointer
+
+	/* Parameters */
+	long buffersize;
+	char *c_tech;
+	int nthreads;			// decode workers, 1 is the plain loop
 	
-		/* Create decoded file */
-		sprintf(fname, "%s/Coding/%s_decoded%s", curdir, cs1, extension);
-		if (n == 1) {
-			fp = fopen(fname, "wb");
+	int i;				// loop control variable, s
+	struct stat status;		// used to find size of individual files
+	chunk_header chdr;		// layout from the chunk headers
+	chunk_header ihdr;		// header of each chunk, checked against chdr
+	uint64_t *choff;		// sub-chunk offset table, NULL for old objects
+	uint64_t *hoff;
+	clay_worker *workers;
+		
+	/* Used to recreate file names */
+	char *temp;
+	char *cs2;
+	char *fname;
+
+	/* Used to time decoding */
+	double t1, t2, t3, t4;
+	double tsec;
+	double totalsec;
+        double transec;
+
+	
+	signal(SIGQUIT, ctrl_bs_handler);
+
+	matrix = NULL;
+	bitmatrix = NULL;
+	totalsec = 0.0;
+	
+	/* Start timing */
+	t1 = clay_now();
+	chunk_stage_init(&stages);
+
+	/* Error checking parameters */
+	if (argc < 2) {
+		fprintf(stderr, "usage: inputfile [uring] [direct] [stdout] [parallel [threads]] [perf]\n");
+		fprintf(stderr, "\nuring reads the k+m files in batches through io_uring.");
+		fprintf(stderr, "\ndirect reads the k+m files with O_DIRECT.");
+		fprintf(stderr, "\nstdout writes the decoded object to stdout instead of Coding/<name>_decoded.");
+		fprintf(stderr, "\nparallel decodes that many read-ins at once, one per CPU by default.");
+		fprintf(stderr, "\nperf also counts cycles, instructions and cache misses of each stage, where the CPU lets it.\n");
+		exit(0);
+	}
+	use_uring = 0;
+	use_direct = 0;
+	use_perf = 0;
+	ofd = -1;
+	nthreads = 1;
+	for (i = 2; i < argc; i++) {
+		if (strcmp(argv[i], "uring") == 0) {
+			use_uring = 1;
 		}
-		else {
-			fp = fopen(fname, "ab");
+		else if (strcmp(argv[i], "direct") == 0) {
+			use_direct = 1;
 		}
-		for (i = 0; i < M; i++) {
-			if (total+k*blocksize <= origsize) {
-				{fwrite(fdata[i], sizeof(char), k*blocksize, fp);}
-				 total+= k*blocksize;
-			}
-			else {
-				for(j=0;j<10*blocksize;j++){
-					if (total < origsize) {  
-						fprintf(fp, "%c", fdata[i][j]);
-						total++;
-					}
-					else {
-						break;
-					}
-					
-				}
+		else if (strcmp(argv[i], "stdout") == 0) {
+			/* The decoded bytes get the real stdout; everything else 
+			   printed goes to stderr */
+			ofd = dup(1);
+			if (ofd < 0) { perror("stdout"); exit(1); }
+			dup2(2, 1);
+		}
+		else if (strcmp(argv[i], "parallel") == 0) {
+			nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+			if (i+1 < argc && sscanf(argv[i+1], "%d", &nthreads) == 1) i++;
+			if (nthreads <= 0) {
+				fprintf(stderr, "Invalid number of threads\n");
+				exit(0);
 			}
 		}
-		n++;
-		fclose(fp);
-		totalsec += timing_delta(&t3, &t4);
+		else if (strcmp(argv[i], "perf") == 0) {
+			/* Workers open their own counters; they only try if these
+			   could be opened */
+			use_perf = (chunk_stage_perf(&stages) == 0);
+		}
+		else {
+			fprintf(stderr, "Unknown option %s\n", argv[i]);
+			exit(0);
+		}
 	}
+	curdir = (char *)malloc(sizeof(char)*1000);
+	assert(curdir == getcwd(curdir, 1000));
 	
+	/* Begin recreation of file names */
+	cs1 = (char*)malloc(sizeof(char)*strlen(argv[1])+1);
+	cs2 = strrchr(argv[1], '/');
+	if (cs2 != NULL) {
+		cs2++;
+		strcpy(cs1, cs2);
+	}
+	else {
+		strcpy(cs1, argv[1]);
+	}
+	cs2 = strchr(cs1, '.');
+	if (cs2 != NULL) {
+                extension = strdup(cs2);
+		*cs2 = '\0';
+	} else {
+           extension = strdup("");
+        }	
+	fname = (char *)malloc(sizeof(char*)*(100+strlen(argv[1])+20));
+
+	/* Read in parameters from the header of any surviving chunk */
+	temp = (char *)malloc(sizeof(char)*(strlen(argv[1])+20));
+	c_tech = (char *)malloc(sizeof(char)*(strlen(argv[1])+20));
+	sprintf(fname, "%s/Coding", curdir);
+	if (chunk_header_find(fname, cs1, extension, &chdr, &choff) == 0) {
+		if (chdr.family != Chunk_Clay) {
+			fprintf(stderr, "%s was not encoded by clay-encoder\n", argv[1]);
+			exit(0);
+		}
+		if (chdr.subchunks != M) {
+			fprintf(stderr, "Chunks have %d sub-chunks, this decoder expects %d\n", chdr.subchunks, M);
+			exit(0);
+		}
+		origsize = chdr.size;
+		k = chdr.k;
+		m = chdr.m;
+		if ((1 << ((k+m)/2)) != M || (k+m)%2 != 0) {
+			fprintf(stderr, "Chunks have k=%d m=%d; the Clay code here has %d layers: k+m must be 14\n", k, m, M);
+			exit(0);
+		}
+		w = chdr.w;
+		packetsize = chdr.packetsize;
+		buffersize = chdr.buffersize;
+		tech = chdr.tech;
+		method = tech;
+		readins = chdr.readins;
+		strcpy(c_tech, Methods[tech]);
+		hdr_size = chdr.hdr_size;
+		blocksize = chdr.blocksize;
+		lastbs = chdr.lastbs;
+	}
+	else {
+		choff = NULL;
+		hdr_size = 0;
+		/* Objects encoded before chunk headers: read in parameters from 
+		   the metadata file */
+		sprintf(fname, "%s/Coding/%s_meta.txt", curdir, cs1);
+
+		fp = fopen(fname, "rb");
+	        if (fp == NULL) {
+	          fprintf(stderr, "Error: no chunk header and no metadata file %s\n", fname);
+	          exit(1);
+	        }
+		if (fscanf(fp, "%s", temp) != 1) {
+			fprintf(stderr, "Metadata file - bad format\n");
+			exit(0);
+		}
+	
+		if (fscanf(fp, "%ld", &origsize) != 1) {
+			fprintf(stderr, "Original size is not valid\n");
+			exit(0);
+		}
+		if (fscanf(fp, "%d %d %d %d %ld", &k, &m, &w, &packetsize, &buffersize) != 5) {
+			fprintf(stderr, "Parameters are not correct\n");
+			exit(0);
+		}
+		if (fscanf(fp, "%s", c_tech) != 1) {
+			fprintf(stderr, "Metadata file - bad format\n");
+			exit(0);
+		}
+		if (fscanf(fp, "%d", &tech) != 1) {
+			fprintf(stderr, "Metadata file - bad format\n");
+			exit(0);
+		}
+		method = tech;
+		if (fscanf(fp, "%d", &readins) != 1) {
+			fprintf(stderr, "Metadata file - bad format\n");
+			exit(0);
+		}
+		fclose(fp);	
+	}
+	cw = coupling_w(w);
+	sprintf(temp, "%d", k);
+	md = strlen(temp);
+
+	/* Objects without a header: a read-in is buffersize, or with whole-file
+	   chunks the size of any surviving chunk gives the sub-chunk size */
+	if (blocksize == 0 && buffersize != origsize) {
+		blocksize = buffersize/k/M;
+	}
+	for (i = 0; i < k+m && blocksize == 0; i++) {
+		if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i+1, extension);
+		else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i-k+1, extension);
+		if (stat(fname, &status) == 0) blocksize = status.st_size/M;
+	}
+	if (lastbs == 0) lastbs = blocksize;
+ 
+        printf("origsize:%ld\n",origsize);
+        //printf("packetsize:%d\n",packetsize);
+        printf("buffersize:%ld\n",buffersize);
+         
+        printf("buffersize2:%ld\n ",buffersize);
+        printf("blocksize:%ld\n",blocksize);
+        printf("readins:%d\n", readins);
+
+	/* Each chunk carries the CRCs of its own sub-chunks, and its own
+	   sub-chunk order.  A chunk that is there but whose header cannot be
+	   read, or is not that of this object, is erased like a missing one:
+	   without its offsets and CRCs nothing in it can be placed or checked. */
+	crcs = (uint32_t **)malloc(sizeof(uint32_t*)*(k+m));
+	offs = (uint64_t **)malloc(sizeof(uint64_t*)*(k+m));
+	hdrbad = (char *)malloc(sizeof(char)*(k+m));
+	for (i = 0; i < k+m; i++) {
+		crcs[i] = NULL;
+		offs[i] = NULL;
+		hdrbad[i] = 0;
+		if (choff == NULL) continue;
+		if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i+1, extension);
+		else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i-k+1, extension);
+		if (chunk_header_load(fname, &ihdr, &hoff, &crcs[i]) != 0) {
+			crcs[i] = NULL;
+			if (access(fname, F_OK) != 0) continue;
+		}
+		else if (chunk_header_match(&ihdr, &chdr, i) == 0) {
+			offs[i] = hoff;
+			continue;
+		}
+		else {
+			free(hoff);
+			free(crcs[i]);
+			crcs[i] = NULL;
+		}
+		fprintf(stderr, "%s: the chunk header is damaged or not that of this object, treating the chunk as erased\n", fname);
+		hdrbad[i] = 1;
+	}
+
+	t3 = clay_now();
+	/* Create coding matrix or bitmatrix */
+	switch(tech) {
+		case No_Coding:
+			break;
+		case Reed_Sol_Van:
+			matrix = reed_sol_vandermonde_coding_matrix(k, m, w);
+			break;
+		case Reed_Sol_R6_Op:
+			matrix = reed_sol_r6_coding_matrix(k, w);
+			break;
+		case Cauchy_Orig:
+			matrix = cauchy_original_coding_matrix(k, m, w);
+			bitmatrix = jerasure_matrix_to_bitmatrix(k, m, w, matrix);
+			break;
+		case Cauchy_Good:
+			matrix = cauchy_good_general_coding_matrix(k, m, w);
+			bitmatrix = jerasure_matrix_to_bitmatrix(k, m, w, matrix);
+			break;
+		case Liberation:
+			bitmatrix = liberation_coding_bitmatrix(k, w);
+			break;
+		case Blaum_Roth:
+			bitmatrix = blaum_roth_coding_bitmatrix(k, w);
+			break;
+		case Liber8tion:
+			bitmatrix = liber8tion_coding_bitmatrix(k);
+	}
+	t4 = clay_now();
+	totalsec += (t4-t3);
+	
+        
+	/* Create decoded file */
+	if (ofd < 0) {
+		sprintf(fname, "%s/Coding/%s_decoded%s", curdir, cs1, extension);
+		ofd = open(fname, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (ofd < 0) { perror(fname); exit(1); }
+	}
+	out_base = lseek(ofd, 0, SEEK_CUR);
+	out_seekable = (out_base >= 0 && !(fcntl(ofd, F_GETFL) & O_APPEND));
+	if (out_base < 0) out_base = 0;
+	out_next = 1;
+	chunk_stage_end(&stages, Stage_Setup, 0);
+
+	/* Begin decoding process */
+	if (nthreads > readins) nthreads = readins;
+	if (nthreads < 1) nthreads = 1;
+	workers = (clay_worker *)malloc(sizeof(clay_worker)*nthreads);
+	if (nthreads == 1) {
+		clay_worker_init(&workers[0]);
+		for (n = 1; n <= readins; n++) {
+			clay_decode_readin(&workers[0], n);
+			clay_write_readin(&workers[0], n);
+		}
+		clay_worker_free(&workers[0]);
+	}
+	else {
+		/* GF tables are built on first use; do it before the workers
+		   race for them.  galois_region_xor() works in GF(2^32). */
+		galois_single_multiply(1, 1, w);
+		galois_single_multiply(1, 1, cw);
+		galois_single_multiply(1, 1, 32);
+		crc32c(0, fname, 1);
+		next_readin = 1;
+		for (i = 0; i < nthreads; i++) {
+			if (pthread_create(&workers[i].tid, NULL, clay_worker_main, &workers[i]) != 0) {
+				perror("pthread_create");
+				exit(1);
+			}
+		}
+		for (i = 0; i < nthreads; i++) pthread_join(workers[i].tid, NULL);
+	}
+	transec = 0.0;
+	for (i = 0; i < nthreads; i++) {
+		totalsec += workers[i].dsec;
+		transec += workers[i].tsec;
+		chunk_stage_add(&stages, &workers[i].st);
+	}
+	stages.threads = nthreads;
+	free(workers);
+
+	if (ofd >= 0) close(ofd);
+
 	/* Free allocated memory */
 	free(cs1);
 	free(extension);
 	free(fname);
-	free(data);
-	free(coding);
-	free(erasures);
-	free(erased);
 	
 	/* Stop timing and print time */
-	timing_set(&t2);
-        tsec = timing_delta(&t1, &t2);
-        transec = timing_delta(&t5, &t6);
+	t2 = clay_now();
+        tsec = (t2-t1);
         printf("decoding(sec)_mid: %0.10f\n", totalsec);
         printf("decoding(sec)_tran: %0.10f\n", transec);
-        totalsec += timing_delta(&t5, &t6);
+        totalsec += transec;
         printf("decoding(sec)_mid: %0.10f\n", totalsec);
 	printf("Decoding (MB/sec): %0.10f\n", (((double) origsize)/1024.0/1024.0)/totalsec);
 	printf("De_Total (MB/sec): %0.10f\n\n", (((double) origsize)/1024.0/1024.0)/tsec);
+	chunk_stage_report(&stages, stdout, "clay-decoder", origsize);
 
 	return 0;
 }	
@@ -65,17 +65,30 @@ is the file name with "_k#" or "_m#" and then the extension.
 #include <stdlib.h>
 #include <errno.h>
 #include <signal.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <gf_rand.h>
 #include <unistd.h>
 #include "jerasure.h"
+#include "galois.h"
 #include "reed_sol.h"
 #include "cauchy.h"
 #include "liberation.h"
 #include "timing.h"
+#include "chunk-io.h"
+#include "chunk-header.h"
+#include "crc32c.h"
+#include "chunk-stage.h"
+#include "chunk-mem.h"
+#include "coupling.h"
 
 #define N 10
 #define M 128
 #define r 2
+
+/* With buffersize 0, objects larger than this are encoded in read-ins of
+   about this size, so memory use does not grow with the object */
+#define STREAM_BUFSIZE (64L*1024*1024)
 enum Coding_Technique {Reed_Sol_Van, Reed_Sol_R6_Op, Cauchy_Orig, Cauchy_Good, Liberation, Blaum_Roth, Liber8tion, RDP, EVENODD, No_Coding};
 
 char *Methods[N] = {"reed_sol_van", "reed_sol_r6_op", "cauchy_orig", "cauchy_good", "liberation", "blaum_roth", "liber8tion", "no_coding"};
@@ -84,16 +97,83 @@ char *Methods[N] = {"reed_sol_van", "reed_sol_r6_op", "cauchy_orig", "cauchy_goo
 int readins, n;
 enum Coding_Technique method;
 
+/* Time and bytes of each stage, for the report at the end */
+chunk_stage stages;
+
+/* Bytes of each class of buffer, for the report at the end */
+chunk_mem mem;
+
 /* Function prototypes */
 int is_prime(int w);
 void ctrl_bs_handler(int dummy);
 
-int jfread(void *ptr, int size, int nmembers, FILE *stream)
+long jfread(void *ptr, int size, long nmembers, FILE *stream)
 {
   if (stream != NULL) return fread(ptr, size, nmembers, stream);
 
-  MOA_Fill_Random_Region(ptr, size);
-  return size;
+  MOA_Fill_Random_Region(ptr, size*nmembers);
+  return nmembers;
+}
+
+/* madvise() of the part of the mapped inputfile from off to off+len, 
+   whole pages only and clipped to the file */
+void map_advise(char *map, long size, long off, long len, int advice)
+{
+  long page, end;
+
+  page = sysconf(_SC_PAGESIZE);
+  end = (off+len < size) ? off+len : size;
+  off = off/page*page;
+  if (off >= end) return;
+  madvise(map+off, end-off, advice);
+}
+
+/* CRC32C of sub-chunk (node, layer); crc is the table of the current
+   read-in.  The coupling loops call this as soon as a layer of a node pair
+   is final, while it is still in cache, so the checksums need no pass of
+   their own.  The coupling up to here is charged to its stage first. */
+void subchunk_crc(uint32_t *crc, int node, int layer, char *sub, int blocksize)
+{
+  chunk_stage_end(&stages, Stage_Couple, 0);
+  crc[(long)node*M+layer] = crc32c(0, sub, blocksize);
+  chunk_stage_end(&stages, Stage_Crc, blocksize);
+}
+
+#define CLAY_SCHEDULE_COUPLE
+#include "clay-schedule.h"
+
+/* Couples a read-in: C[z][t] += r*U[z'][t^1] for every sub-chunk (z, t)
+   that is coupled, pair by pair, each pair's sub-chunks CRC'ed layer by
+   layer once they are final.  The profiles clay-gen wrote a schedule for
+   run it; the rest take the loops here, which do the same in the same
+   order.  Node t is in pair t/2 and is coupled where bit t/2 of the layer
+   differs from t%2, z' being z with that bit flipped; with k+m odd the
+   last node has no pair. */
+void clay_couple(char **fdata, char **fcoding, char **ffdata, char **ccoding, uint32_t *rcrc, int k, int m, long blocksize, int cw)
+{
+  int p, h, i, j, j2;
+  char *u;
+
+  if (clay_couple_schedule(k, m, M, fdata, fcoding, ffdata, ccoding, rcrc, blocksize, cw) == 0) return;
+  for (p = 0; p < (k+m)/2; p++) {
+    h = 1 << p;
+    for (i = 0; i < M; i++) {
+      for (j = 2*p; j < 2*p+2; j++) {
+        if (((i & h) != 0) == (j%2 != 0)) continue;
+        j2 = j^1;
+        u = (j2 < k) ? ffdata[i^h]+j2*blocksize : ccoding[i^h]+(j2-k)*blocksize;
+        coupling_region_multiply(u, r, blocksize, (j < k) ? fdata[i]+j*blocksize : fcoding[i]+(j-k)*blocksize, 1, cw);
+      }
+      for (j = 2*p; j < 2*p+2; j++) {
+        subchunk_crc(rcrc, j, i, (j < k) ? fdata[i]+j*blocksize : fcoding[i]+(j-k)*blocksize, blocksize);
+      }
+    }
+  }
+  for (j = 2*((k+m)/2); j < k+m; j++) {
+    for (i = 0; i < M; i++) {
+      subchunk_crc(rcrc, j, i, (j < k) ? fdata[i]+j*blocksize : fcoding[i]+(j-k)*blocksize, blocksize);
+    }
+  }
 }
 
 static void print_data_and_coding(int k, int m, int w, int size,
@@ -137,18 +217,44 @@ static void print_data_and_coding(int k, int m, int w, int size,
 int main (int argc, char **argv) {
 	FILE *fp, *fp2;				// file pointers
 	char *block;				// padding file
-	int size, newsize;			// size of file and temp size 
+	long size, newsize;			// size of file and temp size 
 	struct stat status;			// finding file size
 
 	
 	enum Coding_Technique tech;		// coding technique (parameter)
 	int k, m, w, packetsize;		// parameters
-	int buffersize;					// paramter
+	int cw;					// coupling word size
+	long buffersize;				// paramter
 	int i,j,i1,j1;						// loop control variables
-	int blocksize;					// size of k+m files
-	int total;
-	int extra; 
-	int stripe_size;
+	long blocksize;					// size of k+m files
+	long total;
+	long extra; 
+	long stripe_size;
+	long unit_size;				// newsize and buffersize are multiples of this
+	int use_mmap;				// map the inputfile instead of reading it
+	char *map;				// mapped inputfile
+	char *tail;				// zero-padded copy of the layers past the end of the file
+	long tailstart = 0;			// file offset of tail[0]
+	long off;
+	int use_uring;				// write the k+m files through io_uring
+	int use_direct;				// write the k+m files with O_DIRECT
+	long unit;				// a read-in is a multiple of this
+	chunk_io cio;
+	struct iovec *uiov;			// two registered sets of layer buffers
+	int *cfd;				// descriptors of the k+m files
+	chunk_header chdr;			// layout stored at the front of every chunk
+	uint64_t *choff;			// sub-chunk offset tables, M per file
+	int *chlay;				// layer at every position, M per file
+	int use_permute;			// repair-friendly sub-chunk order
+	int runs;
+	char *hbuf;				// packed headers of the k+m files
+	uint32_t *chcrc;			// CRC32C of every sub-chunk, read-in by read-in
+	uint32_t *rcrc;				// CRCs of the current read-in
+	uint32_t *fcrc;				// CRCs of one file
+	long crccap;				// read-ins chcrc has room for
+	int use_stdin;				// encode a stream of unknown length from stdin
+	char *tbuf;				// packed trailers of the k+m files
+	long tlen;
 	
 	/* Jerasure Arguments */
 	char **data;				
@@ -181,25 +287,34 @@ int main (int argc, char **argv) {
 	struct timing start;
 
 	/* Find buffersize */
-	int up, down;
+	long up, down;
 
 
 	signal(SIGQUIT, ctrl_bs_handler);
 
 	/* Start timing */
 	timing_set(&t1);
+	chunk_stage_init(&stages);
+	chunk_mem_init(&mem);
 	totalsec = 0.0;
+	transec = 0.0;
 	matrix = NULL;
 	bitmatrix = NULL;
 	schedule = NULL;
 	
 	/* Error check Arguments*/
-	if (argc != 8) {
-		fprintf(stderr,  "usage: inputfile k m coding_technique w packetsize buffersize\n");
+	if (argc < 8) {
+		fprintf(stderr,  "usage: inputfile k m coding_technique w packetsize buffersize [mmap] [uring] [direct] [stdin] [permute] [perf]\n");
 		fprintf(stderr,  "\nChoose one of the following coding techniques: \nreed_sol_van, \nreed_sol_r6_op, \ncauchy_orig, \ncauchy_good, \nliberation, \nblaum_roth, \nliber8tion");
 		fprintf(stderr,  "\n\nPacketsize is ignored for the reed_sol's");
 		fprintf(stderr,  "\nBuffersize of 0 means the buffersize is chosen automatically.\n");
-		fprintf(stderr,  "\nIf you just want to test speed, use an inputfile of \"-number\" where number is the size of the fake file you want to test.\n\n");
+		fprintf(stderr,  "\nIf you just want to test speed, use an inputfile of \"-number\" where number is the size of the fake file you want to test.\n");
+		fprintf(stderr,  "\nmmap encodes straight out of a read-only mapping of the inputfile.");
+		fprintf(stderr,  "\nuring writes the k+m files in batches through io_uring, overlapped with encoding.");
+		fprintf(stderr,  "\ndirect writes the k+m files with O_DIRECT; sub-chunks are padded to %d bytes.", CHUNK_IO_ALIGN);
+		fprintf(stderr,  "\nstdin encodes a stream of unknown length from stdin; inputfile only names the chunks.");
+		fprintf(stderr,  "\npermute stores the sub-chunks of each chunk so that repair reads are a few long runs.");
+		fprintf(stderr,  "\nperf also counts cycles, instructions and cache misses of each stage, where the CPU lets it.\n\n");
 		exit(0);
 	}
 	/* Conversion of parameters and error checking */	
@@ -211,6 +326,10 @@ int main (int argc, char **argv) {
 		fprintf(stderr,  "Invalid value for m\n");
 		exit(0);
 	}
+	if ((1 << ((k+m)/2)) != M || (k+m)%2 != 0) {
+		fprintf(stderr, "The Clay code here has %d layers: k+m must be 14\n", M);
+		exit(0);
+	}
 	if (sscanf(argv[5],"%d", &w) == 0 || w <= 0) {
 		fprintf(stderr,  "Invalid value for w.\n");
 		exit(0);
@@ -224,50 +343,61 @@ int main (int argc, char **argv) {
 			exit(0);
 		}
 	}
-	if (argc != 8) {
+	if (argc < 8) {
 		buffersize = 0;
 	}
 	else {
-		if (sscanf(argv[7], "%d", &buffersize) == 0 || buffersize < 0) {
+		if (sscanf(argv[7], "%ld", &buffersize) == 0 || buffersize < 0) {
 			fprintf(stderr, "Invalid value for buffersize\n");
 			exit(0);
 		}
 		
 	}
 
-	/* Determine proper buffersize by finding the closest valid buffersize to the input value  */
-	if (buffersize != 0) {
-		if (packetsize != 0 && buffersize%(sizeof(long)*w*k*packetsize) != 0) { 
-			up = buffersize;
-			down = buffersize;
-			while (up%(sizeof(long)*w*k*packetsize) != 0 && (down%(sizeof(long)*w*k*packetsize) != 0)) {
-				up++;
-				if (down == 0) {
-					down--;
-				}
-			}
-			if (up%(sizeof(long)*w*k*packetsize) == 0) {
-				buffersize = up;
-			}
-			else {
-				if (down != 0) {
-					buffersize = down;
-				}
-			}
+	/* Optional trailing arguments */
+	use_mmap = 0;
+	use_uring = 0;
+	use_direct = 0;
+	use_stdin = 0;
+	use_permute = 0;
+	for (i = 8; i < argc; i++) {
+		if (strcmp(argv[i], "mmap") == 0) {
+			use_mmap = 1;
 		}
-		else if (packetsize == 0 && buffersize%(sizeof(long)*w*k) != 0) {
-			up = buffersize;
-			down = buffersize;
-			while (up%(sizeof(long)*w*k) != 0 && down%(sizeof(long)*w*k) != 0) {
-				up++;
-				down--;
-			}
-			if (up%(sizeof(long)*w*k) == 0) {
-				buffersize = up;
-			}
-			else {
-				buffersize = down;
-			}
+		else if (strcmp(argv[i], "uring") == 0) {
+			use_uring = 1;
+		}
+		else if (strcmp(argv[i], "direct") == 0) {
+			use_direct = 1;
+		}
+		else if (strcmp(argv[i], "stdin") == 0) {
+			use_stdin = 1;
+		}
+		else if (strcmp(argv[i], "permute") == 0) {
+			use_permute = 1;
+		}
+		else if (strcmp(argv[i], "perf") == 0) {
+			chunk_stage_perf(&stages);
+		}
+		else {
+			fprintf(stderr, "Unknown option %s\n", argv[i]);
+			exit(0);
+		}
+	}
+
+	/* Determine proper buffersize by finding the closest valid buffersize to the input value.
+	   A read-in is M layers of k sub-chunks, each a whole number of words
+	   (or packets). */
+	if (packetsize != 0) unit_size = sizeof(long)*w*k*packetsize*M;
+	else unit_size = sizeof(long)*w*k*M;
+	if (buffersize != 0 && buffersize%unit_size != 0) {
+		up = (buffersize/unit_size+1)*unit_size;
+		down = (buffersize/unit_size)*unit_size;
+		if (down == 0 || up-buffersize <= buffersize-down) {
+			buffersize = up;
+		}
+		else {
+			buffersize = down;
 		}
 	}
 
@@ -372,12 +502,24 @@ int main (int argc, char **argv) {
 
 	/* Set global variable method for signal handler */
 	method = tech;
+	cw = coupling_w(w);
 
 	/* Get current working directory for construction of file names */
 	curdir = (char*)malloc(sizeof(char)*1000);	
 	assert(curdir == getcwd(curdir, 1000));
 
-        if (argv[1][0] != '-') {
+        if (use_stdin) {
+		/* The length is not known until the stream ends: size is 
+		   counted up as read-ins come in, and a stream cannot be mapped */
+		fp = stdin;
+		size = 0;
+		use_mmap = 0;
+		i = mkdir("Coding", S_IRWXU);
+		if (i == -1 && errno != EEXIST) {
+			fprintf(stderr, "Unable to create Coding directory.\n");
+			exit(0);
+		}
+        } else if (argv[1][0] != '-') {
 
 		/* Open file and error check */
 		fp = fopen(argv[1], "rb");
@@ -397,34 +539,40 @@ int main (int argc, char **argv) {
 		stat(argv[1], &status);	
 		size = status.st_size;
         } else {
-        	if (sscanf(argv[1]+1, "%d", &size) != 1 || size <= 0) {
+        	if (sscanf(argv[1]+1, "%ld", &size) != 1 || size <= 0) {
                 	fprintf(stderr, "Files starting with '-' should be sizes for randomly created input\n");
 			exit(1);
 		}
         	fp = NULL;
+		use_mmap = 0;
+		use_uring = 0;
+		use_direct = 0;
 		MOA_Seed(time(0));
         }
 
 	newsize = size;
 	
 	/* Find new size by determining next closest multiple */
-	if (packetsize != 0) {
-		if (size%(k*w*packetsize*sizeof(long)) != 0) {
-			while (newsize%(k*w*packetsize*sizeof(long)) != 0) 
-				newsize++;
-		}
+	newsize = ((newsize+unit_size-1)/unit_size)*unit_size;
+
+	/* Large objects are streamed through a fixed-size buffer */
+	if (buffersize == 0 && (newsize > STREAM_BUFSIZE || use_stdin)) {
+		buffersize = (STREAM_BUFSIZE/unit_size)*unit_size;
+		if (buffersize == 0) buffersize = unit_size;
 	}
-	else {
-		if (size%(k*w*M*sizeof(long)) != 0) {
-			while (newsize%(k*w*M*sizeof(long)) != 0) 
-				newsize++;
-		}
+
+	/* With O_DIRECT every sub-chunk (blocksize) has to be a multiple of 
+	   CHUNK_IO_ALIGN as well */
+	unit = unit_size;
+	if (use_direct) {
+		if (packetsize != 0) unit = k*M*chunk_io_align_unit(w*packetsize*sizeof(long));
+		else unit = k*M*chunk_io_align_unit(w*sizeof(long));
+		newsize = ((newsize+unit-1)/unit)*unit;
+		if (buffersize != 0) buffersize = ((buffersize+unit-1)/unit)*unit;
 	}
 	
 	if (buffersize != 0) {
-		while (newsize%buffersize != 0) {
-			newsize++;
-		}
+		newsize = ((newsize+buffersize-1)/buffersize)*buffersize;
 	}
 
 
@@ -432,28 +580,58 @@ int main (int argc, char **argv) {
 	
 	stripe_size = newsize/M;
 	blocksize= stripe_size/k;
-        printf("size:%d\n", size);
-        printf("newsize:%d\n",newsize);
-	printf("stripe_size:%d\n",stripe_size);	
-	printf("blocksize:%d\n", blocksize);
+        printf("size:%ld\n", size);
+        printf("newsize:%ld\n",newsize);
+	printf("stripe_size:%ld\n",stripe_size);	
+	printf("blocksize:%ld\n", blocksize);
 
-	/* Allow for buffersize and determine number of read-ins */
-	if (size > buffersize && buffersize != 0) {
+	/* Allow for buffersize and determine number of read-ins.  A stream 
+	   has at least one; readins is raised as long as read-ins come back
+	   full. */
+	if (use_stdin) {
+		readins = 1;
+		block = (char *)chunk_mem_alloc(&mem, Mem_Input, sizeof(char)*buffersize);
+		blocksize = buffersize/k/M;
+	}
+	else if (size > buffersize && buffersize != 0) {
 		if (newsize%buffersize != 0) {
 			readins = newsize/buffersize;
 		}
 		else {
 			readins = newsize/buffersize;
 		}
-		block = (char *)malloc(sizeof(char)*buffersize);
-		blocksize = buffersize/k;
+		if (!use_mmap) block = (char *)chunk_mem_alloc(&mem, Mem_Input, sizeof(char)*buffersize);
+		blocksize = buffersize/k/M;
 	}
 	else {
 		readins = 1;
 		buffersize = size;
-		block = (char *)malloc(sizeof(char)*newsize);
+		if (!use_mmap) block = (char *)chunk_mem_alloc(&mem, Mem_Input, sizeof(char)*newsize);
 	}
-	printf("blocksize:%d\n", blocksize);
+
+	/* Map the inputfile.  Layers that run past the end of the file are 
+	   copied once into tail and zero-padded. */
+	map = NULL;
+	tail = NULL;
+	if (use_mmap) {
+		block = NULL;
+		map = (char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+		if (map == MAP_FAILED) {
+			perror("mmap");
+			exit(1);
+		}
+		madvise(map, size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+		madvise(map, size, MADV_HUGEPAGE);
+#endif
+		tailstart = (size/(k*blocksize))*(k*blocksize);
+		/* Aligned for O_DIRECT, like block */
+		tail = chunk_io_alloc(sizeof(char)*(newsize-tailstart+1));
+		chunk_mem_add(&mem, Mem_Input, sizeof(char)*(newsize-tailstart+1));
+		memset(tail, 0, newsize-tailstart);
+		memcpy(tail, map+tailstart, size-tailstart);
+	}
+	printf("blocksize:%ld\n", blocksize);
 
 	/* Break inputfile name into the filename and extension */	
 	s1 = (char*)malloc(sizeof(char)*(strlen(argv[1])+20));
@@ -482,8 +660,7 @@ int main (int argc, char **argv) {
 	data = (char **)malloc(sizeof(char*)*k);
 	coding = (char **)malloc(sizeof(char*)*m);
 	for (i = 0; i < m; i++) {
-		coding[i] = (char *)malloc(sizeof(char)*blocksize);
-                if (coding[i] == NULL) { perror("malloc"); exit(1); }
+		coding[i] = (char *)chunk_mem_alloc(&mem, Mem_Coding, sizeof(char)*blocksize);
 	}
 
 
@@ -499,17 +676,86 @@ int main (int argc, char **argv) {
 	    }*/
 	
         ffdata = (char **)malloc(sizeof(char*)*M);
-            for (i = 0; i < M; i++) {
-		ffdata[i] = (char *)malloc(sizeof(char)*k*blocksize);
-                if (ffdata[i] == NULL) { perror("malloc"); exit(1); }
+            for (i = 0; i < M && !use_mmap; i++) {
+		ffdata[i] = (char *)chunk_mem_alloc(&mem, Mem_Uncoupled, sizeof(char)*k*blocksize);
 	     }
         ccoding = (char **)malloc(sizeof(char*)*M);
             for (i = 0; i < M; i++) {
-		ccoding[i] = (char *)malloc(sizeof(char)*m*blocksize);
-                if (ccoding[i] == NULL) { perror("malloc"); exit(1); }
+		ccoding[i] = (char *)chunk_mem_alloc(&mem, Mem_Uncoupled, sizeof(char)*m*blocksize);
 	     }
 
-        e = (char *)malloc(sizeof(char)*7);
+	/* Every chunk file starts with a header describing the whole layout */
+	choff = (uint64_t *)chunk_mem_alloc(&mem, Mem_Meta, sizeof(uint64_t)*(k+m)*M);
+	chlay = (int *)chunk_mem_alloc(&mem, Mem_Meta, sizeof(int)*(k+m)*M);
+	chunk_header_init(&chdr, choff, Chunk_Clay, k, m, w, M, tech, packetsize, size, buffersize, blocksize, use_stdin ? 0 : readins);
+	for (i = 0; i < k+m; i++) {
+		if (use_permute) {
+			chunk_permute(choff+(long)i*M, chlay+(long)i*M, i, M, blocksize);
+		}
+		else {
+			for (j = 0; j < M; j++) {
+				choff[(long)i*M+j] = choff[j];
+				chlay[(long)i*M+j] = j;
+			}
+		}
+	}
+	if (use_permute) {
+		/* Separate reads from the k+m-1 helpers of one failed node */
+		for (i = 0; i < k+m; i++) {
+			runs = 0;
+			for (j = 0; j < k+m; j++) {
+				if (j != i) runs += chunk_repair_runs(choff+(long)j*M, M, i/2, i%2, blocksize);
+			}
+			printf("repair reads for node %d: %d\n", i, runs);
+		}
+	}
+	if (use_stdin) chdr.flags |= CHUNK_TRAILER;
+	hbuf = chunk_io_alloc((k+m)*chdr.hdr_size);
+	chunk_mem_add(&mem, Mem_Meta, (k+m)*chdr.hdr_size);
+	for (i = 0; i < k+m; i++) {
+		chunk_header_pack(&chdr, choff+(long)i*M, NULL, i, hbuf+i*chdr.hdr_size);
+	}
+	crccap = readins;
+	chcrc = (uint32_t *)chunk_mem_alloc(&mem, Mem_Meta, sizeof(uint32_t)*(k+m)*crccap*M);
+
+        /* With uring, two sets of layer buffers are registered once and used 
+           alternately, so the writes of one read-in are in flight while the 
+           next one is encoded.  direct goes through the same path, with 
+           blocking writes unless uring is given too. */
+        cfd = NULL;
+        uiov = NULL;
+        if (use_uring || use_direct) {
+		chunk_io_init(&cio, 256, use_uring);
+		uiov = (struct iovec *)malloc(sizeof(struct iovec)*4*M);
+		for (i = 0; i < 2; i++) {
+			for (j = 0; j < M; j++) {
+				uiov[i*2*M+j].iov_len = k*blocksize;
+				uiov[i*2*M+j].iov_base = chunk_io_alloc(sizeof(char)*k*blocksize);
+				uiov[i*2*M+M+j].iov_len = m*blocksize;
+				uiov[i*2*M+M+j].iov_base = chunk_io_alloc(sizeof(char)*m*blocksize);
+				chunk_mem_add(&mem, Mem_Io, sizeof(char)*k*blocksize);
+				chunk_mem_add(&mem, Mem_Io, sizeof(char)*m*blocksize);
+			}
+		}
+		chunk_io_register(&cio, uiov, 4*M);
+		cfd = (int *)malloc(sizeof(int)*(k+m));
+		for (i = 1; i <= k+m; i++) {
+			if (i <= k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, s1, md, i, extension);
+			else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, s1, md, i-k, extension);
+			cfd[i-1] = chunk_io_open(fname, O_WRONLY | O_CREAT | O_TRUNC, use_direct);
+			if (cfd[i-1] < 0) { perror(fname); exit(1); }
+			chunk_io_pwrite(&cio, cfd[i-1], hbuf+(i-1)*chdr.hdr_size, chdr.hdr_size, 0, -1);
+		}
+        }
+        else {
+		/* One set of layer buffers, reused by every read-in */
+		for (j = 0; j < M; j++) {
+			fdata[j] = (char *)chunk_mem_alloc(&mem, Mem_Layers, sizeof(char)*k*blocksize);
+			fcoding[j] = (char *)chunk_mem_alloc(&mem, Mem_Layers, sizeof(char)*m*blocksize);
+		}
+        }
+
+        e = (char *)chunk_mem_alloc(&mem, Mem_Scratch, sizeof(char)*7);
 	
         //extra1 = (char *)malloc(sizeof(char)*blocksize);
 	//extra2 = (char *)malloc(sizeof(char)*blocksize);
@@ -554,41 +800,81 @@ int main (int argc, char **argv) {
 	timing_set(&start);
 	timing_set(&t4);
 	totalsec += timing_delta(&t3, &t4);
+	chunk_stage_end(&stages, Stage_Setup, 0);
 
 	
 
 	/* Read in data until finished */
 	n = 1;
 	total = 0;
+	chunk_mem_mark(&mem);
 
 	while (n <= readins) {
 		/* Check if padding is needed, if so, add appropriate 
 		   number of zeros */
-		if (total < size && total+buffersize <= size) {
-			total += jfread(block, sizeof(char), buffersize, fp);
+		if (use_mmap) {
+			/* ffdata[j] is the uncoupled layer j, straight from the mapping.
+			   The pages of the next read-in are asked for now, so that 
+			   they are read while this one is encoded. */
+			map_advise(map, size, (long)n*buffersize, buffersize, MADV_WILLNEED);
+			for (j = 0; j < M; j++) {
+				off = (n-1)*buffersize + j*k*blocksize;
+				if (off+k*blocksize <= size) ffdata[j] = map+off;
+				else ffdata[j] = tail+(off-tailstart);
+			}
 		}
-		else if (total < size && total+buffersize > size) {
+		else if (use_stdin) {
+			/* A full read-in means there may be more; a stream that ends
+			   exactly on a read-in boundary gets no empty one */
 			extra = jfread(block, sizeof(char), buffersize, fp);
-			for (i = extra; i < buffersize; i++) {
-				block[i] = '0';
+			if (extra == 0 && n > 1) {
+				readins = n-1;
+				break;
 			}
-		}
-		else if (total == size) {
-			for (i = 0; i < buffersize; i++) {
-				block[i] = '0';
+			total += extra;
+			size = total;
+			if (extra == buffersize) readins = n+1;
+			else {
+				/* The last read-in is only as long as what is left of
+				   the stream, rounded up to unit */
+				blocksize = ((extra+unit-1)/unit)*unit/k/M;
+				if (blocksize == 0) blocksize = unit/k/M;
+				chdr.lastbs = blocksize;
 			}
+			memset(block+extra, 0, k*M*blocksize-extra);
+		}
+		else {
+			/* Past the end of the file the read-in is zero-padded */
+			extra = 0;
+			if (total < size) extra = jfread(block, sizeof(char), buffersize, fp);
+			total += extra;
+			memset(block+extra, 0, k*M*blocksize-extra);
+		}
+		chunk_stage_end(&stages, Stage_Read, use_mmap ? 0 : extra);
+		if (n > crccap) {
+			crccap *= 2;
+			chcrc = (uint32_t *)realloc(chcrc, sizeof(uint32_t)*(k+m)*crccap*M);
+			if (chcrc == NULL) { perror("realloc"); exit(1); }
+			chunk_mem_add(&mem, Mem_Meta, sizeof(uint32_t)*(k+m)*(crccap/2)*M);
+		}
+		rcrc = chcrc+(long)(n-1)*(k+m)*M;
+		if (use_direct && fp != NULL && !use_mmap && !use_stdin) {
+			posix_fadvise(fileno(fp), 0, 0, POSIX_FADV_DONTNEED);
 		}
 
-                printf("total:%d\n ",total);
-                printf("buffersize:%d\n ",buffersize);
+                printf("total:%ld\n ",total);
+                printf("buffersize:%ld\n ",buffersize);
 
       timing_set(&t3);	
+      chunk_stage_mark(&stages);
       /* Encode according to coding method */
       for(j=0;j<M;j++){
-            fcoding[j] = (char *)malloc(sizeof(char)*m*blocksize);
-            fdata[j] = (char *)malloc(sizeof(char)*k*blocksize); 
+            if (cfd != NULL) {
+                fdata[j] = uiov[(n%2)*2*M+j].iov_base;
+                fcoding[j] = uiov[(n%2)*2*M+M+j].iov_base;
+            }
             for (i = 0; i < k; i++) {
-		 data[i] = block+((j*k+i)*blocksize);
+		 data[i] = (use_mmap ? ffdata[j]+i*blocksize : block+((j*k+i)*blocksize));
             }
                  //printf("data[0]:%p\n",data[0]);
                  //printf("data[0][0]:%d\n",&data[0][0]);
@@ -623,6 +909,7 @@ int main (int argc, char **argv) {
 			case EVENODD:
 				assert(0);
 		}
+		chunk_stage_end(&stages, Stage_Mds, k*blocksize);
 
              for(i=0;i<k;i++){
                for(i1=0;i1<blocksize;i1++){
@@ -632,6 +919,7 @@ int main (int argc, char **argv) {
                for(i1=0;i1<blocksize;i1++){
                    fcoding[j][i*blocksize+i1]=coding[i][i1];}
              }
+             chunk_stage_end(&stages, Stage_Copy, (k+m)*blocksize);
 
       }
       timing_set(&t4); 
@@ -642,7 +930,7 @@ int main (int argc, char **argv) {
         for(i=0;i<7;i++){
                e[0]=20; e[1]=18;e[2]=21;e[3]=16;e[4]=25;e[5]=13;e[6]=54;}
         printf("\n");
-         for(i=0;i<M;i++){
+        for(i=0;i<M && !use_mmap;i++){
             for(j=0;j<k*blocksize;j++){
               ffdata[i][j]=fdata[i][j];
             }
@@ -652,6 +940,7 @@ int main (int argc, char **argv) {
               ccoding[i][j]=fcoding[i][j];
             }
         }
+        chunk_stage_end(&stages, Stage_Copy, (uint64_t) (use_mmap ? m : k+m)*M*blocksize);
 
        /*
         //k=0,1
@@ -661,8 +950,7 @@ int main (int argc, char **argv) {
 		   galois_w8_region_xor(fdata[i+1]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);
 	       }
                if(j%2==0 && i%2!=0){ 
-                   galois_w08_region_multiply((ffdata[i-1]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-1]+(j+1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i-1]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
+                   coupling_region_multiply(ffdata[i-1]+(j+1)*blocksize,e[j/2],blocksize,fdata[i]+j*blocksize, 1, cw);
                }
            }
            //k=2,3,4,5,6,7
@@ -672,8 +960,7 @@ int main (int argc, char **argv) {
 		   galois_w8_region_xor(fdata[i+2]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);
 	        }
                if(j%2==0 && i1>=2){ 
-                   galois_w08_region_multiply((ffdata[i-2]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-2]+(j+1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i-2]+(j+1)*blocksize,fdata[i]+j*blocksize,blocksize);
+                   coupling_region_multiply(ffdata[i-2]+(j+1)*blocksize,e[j/2],blocksize,fdata[i]+j*blocksize, 1, cw);
                }
            }
            //k=8/9
@@ -684,8 +971,7 @@ int main (int argc, char **argv) {
 	        }
               if(j%2==0 && i/4==1){ 
                    //printf("j:%d\n",j);
-                   galois_w08_region_multiply((ffdata[i-4]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-4]+(j+1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i-4]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
+                   coupling_region_multiply(ffdata[i-4]+(j+1)*blocksize,e[j/2],blocksize,fdata[i]+j*blocksize, 1, cw);
                }
            }
            //k=10/11/12/13 or m=0/1/2/3
@@ -694,120 +980,31 @@ int main (int argc, char **argv) {
 		   galois_w8_region_xor(fcoding[i+4]+(j-1)*blocksize,fcoding[i]+j*blocksize,blocksize);
 	        }
               if(j%2==0 && i/4==1){ 
-                   galois_w08_region_multiply((ccoding[i-4]+(j+1)*blocksize),e[4+j/2],blocksize,(ccoding[i-4]+(j+1)*blocksize), 0);
+                   coupling_region_multiply((ccoding[i-4]+(j+1)*blocksize),e[4+j/2],blocksize,(ccoding[i-4]+(j+1)*blocksize), 0, cw);
 		   galois_w8_region_xor(ccoding[i-4]+(j+1)*blocksize,fcoding[i]+j*blocksize, blocksize);
                }
            }
         }  
          */
 
-       //j=(6/4)*4;
-       //printf("j====%d",j); j=4
-
-        //k=0,1
-       for(i=0;i<M;i++){
-           for(j=0;j<2;j++){
-               if(j%2!=0 && i%2==0){ 
-                   galois_w08_region_multiply((ffdata[i+1]+(j-1)*blocksize),r,blocksize,(ffdata[i+1]+(j-1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i+1]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);
-	       }
-               if(j%2==0 && i%2!=0){ 
-                   galois_w08_region_multiply((ffdata[i-1]+(j+1)*blocksize),r,blocksize,(ffdata[i-1]+(j+1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i-1]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
-               }
-           }
-        }
-        //k=2,3
-        for(i=0;i<M;i++){
-           i1=i-(i/4)*4;
-           for(j=2;j<4;j++){
-               if(j%2!=0 && i1<2) { 
-                   galois_w08_region_multiply((ffdata[i+2]+(j-1)*blocksize),r,blocksize,(ffdata[i+2]+(j-1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i+2]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);
-                 }
-               if(j%2==0 && i1>=2){ 
-                   galois_w08_region_multiply((ffdata[i-2]+(j+1)*blocksize),r,blocksize,(ffdata[i-2]+(j+1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i-2]+(j+1)*blocksize,fdata[i]+j*blocksize,blocksize);
-               }
-           }
-        } 
-        //k=4,5
-        for(i=0;i<M;i++){
-           i1=i-(i/8)*8;
-           for(j=4;j<6;j++){
-               if(j%2!=0 && i1<4) { 
-                   galois_w08_region_multiply((ffdata[i+4]+(j-1)*blocksize),r,blocksize,(ffdata[i+4]+(j-1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i+4]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);
-                 }
-               if(j%2==0 && i1>=4){ 
-                   galois_w08_region_multiply((ffdata[i-4]+(j+1)*blocksize),r,blocksize,(ffdata[i-4]+(j+1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i-4]+(j+1)*blocksize,fdata[i]+j*blocksize,blocksize);
-               }
-           }
-        }  
-       //6,7
-       for(i=0;i<M;i++){
-           i1=i-(i/16)*16;
-           for(j=6;j<8;j++){
-               if(j%2!=0 && i1<8) { 
-                   galois_w08_region_multiply((ffdata[i+8]+(j-1)*blocksize),r,blocksize,(ffdata[i+8]+(j-1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i+8]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);
-                 }
-               if(j%2==0 && i1>=8){ 
-                   galois_w08_region_multiply((ffdata[i-8]+(j+1)*blocksize),r,blocksize,(ffdata[i-8]+(j+1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i-8]+(j+1)*blocksize,fdata[i]+j*blocksize,blocksize);
-               }
-           }
-        }  
-
-        //k=8,9
-        for(i=0;i<M;i++){
-           i1=i-(i/32)*32;
-           for(j=8;j<10;j++){
-              if(j%2!=0 && i1<16){ 
-                   galois_w08_region_multiply((ffdata[i+16]+(j-1)*blocksize),r,blocksize,(ffdata[i+16]+(j-1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i+16]+(j-1)*blocksize,fdata[i]+j*blocksize,blocksize);
-	        }
-              if(j%2==0 && i1>=16){ 
-                   //printf("j:%d\n",j);
-                   galois_w08_region_multiply((ffdata[i-16]+(j+1)*blocksize),r,blocksize,(ffdata[i-16]+(j+1)*blocksize), 0);
-		   galois_w8_region_xor(ffdata[i-16]+(j+1)*blocksize,fdata[i]+j*blocksize, blocksize);
-               }
-           }
-        } 
-        //k=10/11/12/13 or m=0/1/2/3
-        for(i=0;i<M;i++){
-           i1=i-(i/64)*64;
-           for(j=0;j<2;j++){
-              if(j%2!=0 && i1<32){ 
-                   galois_w08_region_multiply((ccoding[i+32]+(j-1)*blocksize),r,blocksize,(ccoding[i+32]+(j-1)*blocksize), 0);
-		   galois_w8_region_xor(ccoding[i+32]+(j-1)*blocksize,fcoding[i]+j*blocksize,blocksize);
-	        }
-              if(j%2==0 && i1>=32){ 
-                   galois_w08_region_multiply((ccoding[i-32]+(j+1)*blocksize),r,blocksize,(ccoding[i-32]+(j+1)*blocksize), 0);
-		   galois_w8_region_xor(ccoding[i-32]+(j+1)*blocksize,fcoding[i]+j*blocksize, blocksize);
-               }
-           }
-        } 
-
-        for(i=0;i<M;i++){
-           i1=i-(i/128)*128;
-           for(j=2;j<4;j++){
-              if(j%2!=0 && i1<64){ 
-                   galois_w08_region_multiply((ccoding[i+64]+(j-1)*blocksize),r,blocksize,(ccoding[i+64]+(j-1)*blocksize), 0);
-		   galois_w8_region_xor(ccoding[i+64]+(j-1)*blocksize,fcoding[i]+j*blocksize,blocksize);
-	        }
-              if(j%2==0 && i1>=64){ 
-                   galois_w08_region_multiply((ccoding[i-64]+(j+1)*blocksize),r,blocksize,(ccoding[i-64]+(j+1)*blocksize), 0);
-		   galois_w8_region_xor(ccoding[i-64]+(j+1)*blocksize,fcoding[i]+j*blocksize, blocksize);
-               }
-
-           }
-        } 
+       clay_couple(fdata, fcoding, ffdata, ccoding, rcrc, k, m, blocksize, cw);
        timing_set(&t6); 
+       chunk_stage_end(&stages, Stage_Couple, (uint64_t) (k+m)*M*blocksize);
+       transec += timing_delta(&t5, &t6);
 
 		/* Write data and encoded data to k+m files */
-		for	(i = 1; i <= k; i++) {
+		if (cfd != NULL) {
+			/* Reap the previous read-in, then queue this one as one batch */
+			chunk_io_done(&cio, "Writing the chunks");
+			for (i = 0; i < k+m; i++) {
+				for (j = 0; j < M; j++) {
+					if (i < k) chunk_io_pwrite(&cio, cfd[i], fdata[j]+i*blocksize, blocksize, chdr.hdr_size+chunk_subchunk_pos(choff+(long)i*M, M, n, j, chdr.blocksize, blocksize), (n%2)*2*M+j);
+					else chunk_io_pwrite(&cio, cfd[i], fcoding[j]+(i-k)*blocksize, blocksize, chdr.hdr_size+chunk_subchunk_pos(choff+(long)i*M, M, n, j, chdr.blocksize, blocksize), (n%2)*2*M+M+j);
+				}
+			}
+			chunk_io_submit(&cio);
+		}
+		for	(i = 1; i <= k && cfd == NULL; i++) {
 			if (fp == NULL) {
                                 for(j=0;j<M;j++)
 				{bzero(&fdata[j][(i-1)*blocksize], blocksize);}
@@ -815,17 +1012,18 @@ int main (int argc, char **argv) {
 				sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, s1, md, i, extension);
 				if (n == 1) {
 					fp2 = fopen(fname, "wb");
+					fwrite(hbuf+(i-1)*chdr.hdr_size, sizeof(char), chdr.hdr_size, fp2);
 				}
 				else {
 					fp2 = fopen(fname, "ab");
 				}
                                 for(j=0;j<M;j++)
-				{fwrite(&fdata[j][(i-1)*blocksize], sizeof(char), blocksize, fp2);}
+				{fwrite(&fdata[chlay[(long)(i-1)*M+j]][(i-1)*blocksize], sizeof(char), blocksize, fp2);}
 				fclose(fp2);
 			}
 			
 		}
-		for	(i = 1; i <= m; i++) {
+		for	(i = 1; i <= m && cfd == NULL; i++) {
 			if (fp == NULL) {
 				for(j=0;j<M;j++)
 				{bzero(&fcoding[j][(i-1)*blocksize], blocksize);}
@@ -833,50 +1031,94 @@ int main (int argc, char **argv) {
 				sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, s1, md, i, extension);
 				if (n == 1) {
 					fp2 = fopen(fname, "wb");
+					fwrite(hbuf+(k+i-1)*chdr.hdr_size, sizeof(char), chdr.hdr_size, fp2);
 				}
 				else {
 					fp2 = fopen(fname, "ab");
 				}
 				for(j=0;j<M;j++)
-				{fwrite(&fcoding[j][(i-1)*blocksize], sizeof(char), blocksize, fp2);}
+				{fwrite(&fcoding[chlay[(long)(k+i-1)*M+j]][(i-1)*blocksize], sizeof(char), blocksize, fp2);}
 				fclose(fp2);
 			}
 		}
+		chunk_stage_end(&stages, Stage_Write, (uint64_t) (k+m)*M*blocksize);
+		stages.readins++;
+		/* Only the read-in in hand and the next one stay resident */
+		if (use_mmap) map_advise(map, size, (long)(n-1)*buffersize, buffersize, MADV_DONTNEED);
 		n++;
 		/* Calculate encoding time */
 		totalsec += timing_delta(&t3, &t4);
 	}
 
-	/* Create metadata file */
-        if (fp != NULL) {
-		sprintf(fname, "%s/Coding/%s_meta.txt", curdir, s1);
-		fp2 = fopen(fname, "wb");
-		fprintf(fp2, "%s\n", argv[1]);
-		fprintf(fp2, "%d\n", size);
-		fprintf(fp2, "%d %d %d %d %d\n", k, m, w, packetsize, buffersize);
-		fprintf(fp2, "%s\n", argv[4]);
-		fprintf(fp2, "%d\n", tech);
-		fprintf(fp2, "%d\n", readins);
-		fclose(fp2);
-	}
+	chunk_mem_mark_end(&mem);
 
+	/* The CRCs are known now: rewrite the headers with them, or for a 
+	   stream append them with the size as a trailer */
+	fcrc = (uint32_t *)chunk_mem_alloc(&mem, Mem_Meta, sizeof(uint32_t)*readins*M);
+	tlen = chunk_trailer_size(&chdr, readins);
+	tbuf = (char *)chunk_mem_alloc(&mem, Mem_Meta, sizeof(char)*(k+m)*tlen);
+	for (i = 0; i < k+m; i++) {
+		chunk_crc_gather(chcrc, k+m, M, readins, i, fcrc);
+		if (use_stdin) chunk_trailer_pack(&chdr, fcrc, size, readins, tbuf+i*tlen);
+		else chunk_header_pack(&chdr, choff+(long)i*M, fcrc, i, hbuf+i*chdr.hdr_size);
+	}
+	if (cfd != NULL) {
+		chunk_io_done(&cio, "Writing the chunks");
+		for (i = 0; i < k+m; i++) {
+			if (use_stdin) {
+				chunk_io_undirect(cfd[i]);
+				chunk_io_pwrite(&cio, cfd[i], tbuf+i*tlen, tlen, chdr.hdr_size+chunk_data_size(&chdr, readins), -1);
+			}
+			else chunk_io_pwrite(&cio, cfd[i], hbuf+i*chdr.hdr_size, chdr.hdr_size, 0, -1);
+		}
+		chunk_io_done(&cio, "Writing the chunk headers");
+		chunk_io_exit(&cio);
+		for (i = 0; i < k+m; i++) close(cfd[i]);
+	}
+	else if (fp != NULL) {
+		for (i = 0; i < k+m; i++) {
+			if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, s1, md, i+1, extension);
+			else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, s1, md, i-k+1, extension);
+			if (use_stdin) {
+				fp2 = fopen(fname, "ab");
+				fwrite(tbuf+i*tlen, sizeof(char), tlen, fp2);
+			}
+			else {
+				fp2 = fopen(fname, "r+b");
+				fwrite(hbuf+i*chdr.hdr_size, sizeof(char), chdr.hdr_size, fp2);
+			}
+			fclose(fp2);
+		}
+	}
+	chunk_stage_end(&stages, Stage_Write, 0);
+	free(fcrc);
+	free(tbuf);
 
 	/* Free allocated memory */
 	free(s1);
 	free(fname);
 	free(block);
+	free(choff);
+	free(chlay);
+	free(hbuf);
+	free(chcrc);
+	if (use_mmap) {
+		munmap(map, size);
+		free(tail);
+	}
 	free(curdir);
 	
 	/* Calculate rate in MB/sec and print */
 	timing_set(&t2);
 	tsec = timing_delta(&t1, &t2);
-        transec = timing_delta(&t5, &t6);
         printf("time(sec): %0.10f\n", totalsec);
         printf("time_tran(sec): %0.10f\n", transec);
-        totalsec += timing_delta(&t5, &t6);
+        totalsec += transec;
         printf("alltime(sec): %0.10f\n", totalsec);
 	printf("Encoding (MB/sec): %0.10f\n", (((double) size)/1024.0/1024.0)/totalsec);
 	printf("En_Total (MB/sec): %0.10f\n", (((double) size)/1024.0/1024.0)/tsec);
+	chunk_stage_report(&stages, stdout, "clay-encoder", size);
+	chunk_mem_report(&mem, stdout, "clay-encoder", (uint64_t) k*M*chdr.blocksize, readins);
 
 	return 0;
 }
@@ -0,0 +1,189 @@
+/* *
+ * clay-gen.c - writes clay-schedule.h, the coupling of fixed Clay profiles
+ * as straight-line code.
+ *
+ * usage: k,m [k,m ...] > clay-schedule.h
+ *
+ * For each profile, nodes 2p and 2p+1 are pair p and are coupled across
+ * bit p of the layer index; with k odd, data node k-1 and coding node k
+ * are a pair like any other.  k+m has to be even, as the tools require,
+ * and there are M = 2^((k+m)/2) layers.  The header has, for each
+ * profile,
+ *
+ *   clay_couple_K_M()     what clay-encoder does after the MDS encode:
+ *                         C[z][t] += r*U[z'][t'] wherever t is coupled,
+ *                         pair by pair and layer by layer, each sub-chunk
+ *                         CRC'ed as soon as its pair is done
+ *   clay_uncouple_K_M()   what clay-decoder does before the MDS decode,
+ *                         once every sub-chunk is there: U back from the
+ *                         C of both halves of each coupled pair, in
+ *                         place in the buffers that were read
+ *
+ * with every layer, node offset and coefficient a constant and in the
+ * order the generic loops in the tools go, so that the chunks come out
+ * the same byte for byte.  clay_couple_schedule() and
+ * clay_uncouple_schedule() pick the one for (k, m, M) and return -1 when
+ * there is none; the tools then run their generic loops.
+ *
+ * The header takes coupling_region_multiply() from coupling.h; for the
+ * coupling it expects subchunk_crc() to be defined by the file that
+ * includes it, which asks for the half it needs with CLAY_SCHEDULE_COUPLE
+ * or CLAY_SCHEDULE_UNCOUPLE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAXP 16			/* profiles */
+#define MAXLOG 10		/* 2^10 layers at most */
+#define r 2
+
+int ks[MAXP], ms[MAXP];
+
+/* Sub-chunk of node t in layer z: C from dbuf/cbuf, or the copies in the
+   other pair of arrays */
+static void gen_sub(char *s, const char *dbuf, const char *cbuf, int z, int t, int k)
+{
+	if (t < k) {
+		if (t == 0) sprintf(s, "%s[%d]", dbuf, z);
+		else if (t == 1) sprintf(s, "%s[%d]+bs", dbuf, z);
+		else sprintf(s, "%s[%d]+%d*bs", dbuf, z, t);
+	}
+	else {
+		if (t == k) sprintf(s, "%s[%d]", cbuf, z);
+		else if (t == k+1) sprintf(s, "%s[%d]+bs", cbuf, z);
+		else sprintf(s, "%s[%d]+%d*bs", cbuf, z, t-k);
+	}
+}
+
+static void gen_couple(int k, int m)
+{
+	char c[64], u[64];
+	int n, M, p, z, h, t;
+
+	n = k+m;
+	M = 1 << (n/2);
+	printf("/* k=%d m=%d, %d layers */\n", k, m, M);
+	printf("static void clay_couple_%d_%d(char **fdata, char **fcoding, char **ffdata, char **ccoding, uint32_t *rcrc, long bs, int cw)\n{\n", k, m);
+	for (p = 0; p < n/2; p++) {
+		h = 1 << p;
+		for (z = 0; z < M; z++) {
+			for (t = 2*p; t < 2*p+2; t++) {
+				if (t%2 == 1 && !(z & h)) {
+					gen_sub(u, "ffdata", "ccoding", z+h, t-1, k);
+					gen_sub(c, "fdata", "fcoding", z, t, k);
+					printf("\tcoupling_region_multiply(%s, %d, bs, %s, 1, cw);\n", u, r, c);
+				}
+				if (t%2 == 0 && (z & h)) {
+					gen_sub(u, "ffdata", "ccoding", z-h, t+1, k);
+					gen_sub(c, "fdata", "fcoding", z, t, k);
+					printf("\tcoupling_region_multiply(%s, %d, bs, %s, 1, cw);\n", u, r, c);
+				}
+			}
+			for (t = 2*p; t < 2*p+2; t++) {
+				gen_sub(c, "fdata", "fcoding", z, t, k);
+				printf("\tsubchunk_crc(rcrc, %d, %d, %s, bs);\n", t, z, c);
+			}
+		}
+	}
+	printf("}\n\n");
+}
+
+static void gen_uncouple(int k, int m)
+{
+	char c[64], cp[64];
+	int n, M, p, z, h, t;
+
+	n = k+m;
+	M = 1 << (n/2);
+	printf("/* k=%d m=%d, %d layers; inv is 1/(1+%d) */\n", k, m, M, r);
+	printf("static void clay_uncouple_%d_%d(char **fdata, char **fcoding, long bs, int inv, int cw)\n{\n", k, m);
+	for (p = 0; p < n/2; p++) {
+		h = 1 << p;
+		for (z = 0; z < M; z++) {
+			for (t = 2*p; t < 2*p+2; t++) {
+				gen_sub(c, "fdata", "fcoding", z, t, k);
+				if (t%2 == 1 && !(z & h)) {
+					gen_sub(cp, "fdata", "fcoding", z+h, t-1, k);
+					printf("\tgalois_region_xor(%s, %s, bs);\n", cp, c);
+					printf("\tcoupling_region_multiply(%s, inv, bs, %s, 0, cw);\n", c, c);
+					printf("\tgalois_region_xor(%s, %s, bs);\n", cp, c);
+					printf("\tcoupling_region_multiply(%s, inv, bs, %s, 0, cw);\n", c, c);
+				}
+				if (t%2 == 0 && (z & h)) {
+					gen_sub(cp, "fdata", "fcoding", z-h, t+1, k);
+					printf("\tcoupling_region_multiply(%s, %d, bs, %s, 1, cw);\n", cp, r, c);
+				}
+			}
+		}
+	}
+	printf("}\n\n");
+}
+
+static void gen_dispatch(int np, const char *what, const char *params, const char *args)
+{
+	int i;
+
+	printf("/* Runs the %s schedule of (k, m, layers); -1 if there is none */\n", what);
+	printf("static int clay_%s_schedule(int k, int m, int layers, %s)\n{\n", what, params);
+	for (i = 0; i < np; i++) {
+		printf("\tif (k == %d && m == %d && layers == %d) {\n", ks[i], ms[i], 1 << ((ks[i]+ms[i])/2));
+		printf("\t\tclay_%s_%d_%d(%s);\n", what, ks[i], ms[i], args);
+		printf("\t\treturn 0;\n\t}\n");
+	}
+	printf("\treturn -1;\n}\n");
+}
+
+int main(int argc, char **argv)
+{
+	int np, i, j;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: k,m [k,m ...] > clay-schedule.h\n");
+		fprintf(stderr, "\nWrites straight-line coupling and uncoupling for each profile, with 2^((k+m)/2) layers.\n\n");
+		exit(0);
+	}
+	np = 0;
+	for (i = 1; i < argc; i++) {
+		if (np == MAXP || sscanf(argv[i], "%d,%d", &ks[np], &ms[np]) != 2 || ks[np] <= 0 || ms[np] <= 0) {
+			fprintf(stderr, "Invalid profile %s\n", argv[i]);
+			exit(0);
+		}
+		if ((ks[np]+ms[np])%2 != 0) {
+			fprintf(stderr, "%s: k+m must be even\n", argv[i]);
+			exit(0);
+		}
+		if ((ks[np]+ms[np])/2 > MAXLOG || (ks[np]+ms[np])/2 < 1) {
+			fprintf(stderr, "%s: k+m gives 2^%d layers, at most 2^%d are allowed\n", argv[i], (ks[np]+ms[np])/2, MAXLOG);
+			exit(0);
+		}
+		for (j = 0; j < np; j++) {
+			if (ks[j] == ks[np] && ms[j] == ms[np]) break;
+		}
+		if (j == np) np++;
+	}
+
+	printf("/* *\n * clay-schedule.h - generated by clay-gen");
+	for (i = 1; i < argc; i++) printf(" %s", argv[i]);
+	printf("; do not edit.\n *\n");
+	printf(" * Straight-line coupling (CLAY_SCHEDULE_COUPLE) and uncoupling\n");
+	printf(" * (CLAY_SCHEDULE_UNCOUPLE) of the profiles");
+	for (i = 0; i < np; i++) printf("%s %d+%d", i ? "," : "", ks[i], ms[i]);
+	printf(".\n * See clay-gen.c.\n */\n\n");
+	printf("#ifndef _CLAY_SCHEDULE_H\n#define _CLAY_SCHEDULE_H\n\n");
+	printf("#include \"coupling.h\"\n\n");
+
+	printf("#ifdef CLAY_SCHEDULE_COUPLE\n\n");
+	for (i = 0; i < np; i++) gen_couple(ks[i], ms[i]);
+	gen_dispatch(np, "couple", "char **fdata, char **fcoding, char **ffdata, char **ccoding, uint32_t *rcrc, long bs, int cw",
+		"fdata, fcoding, ffdata, ccoding, rcrc, bs, cw");
+	printf("\n#endif\n\n");
+
+	printf("#ifdef CLAY_SCHEDULE_UNCOUPLE\n\n");
+	for (i = 0; i < np; i++) gen_uncouple(ks[i], ms[i]);
+	gen_dispatch(np, "uncouple", "char **fdata, char **fcoding, long bs, int inv, int cw",
+		"fdata, fcoding, bs, inv, cw");
+	printf("\n#endif\n\n#endif\n");
+	return 0;
+}
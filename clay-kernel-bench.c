@@ -0,0 +1,223 @@
+/* *
+ * clay-kernel-bench.c - the pairwise coupling kernels, timed on their own.
+ *
+ * usage: w min_ms [all] [pow2]
+ *
+ * Times, for one pair of sub-chunks of each size from 64 B to 16 MiB
+ * (every fourth power of two, or every one with "pow2"):
+ *
+ *   couple     C1 = U1 + c*U2, C2 = U2 + c*U1, the encoders' transform
+ *   uncouple   U1 = (C1 + c*C2)/(1+c*c) and the same for U2, as the
+ *              decoders undo it when both sub-chunks of a pair survive
+ *   xor        C1 ^= U2, C2 ^= U1, the other half of the mul transform
+ *
+ * with coupling_region_multiply() and galois_region_xor(), the calls the
+ * tools make, in GF(2^cw) for cw = coupling_w(w).  The coefficients are
+ * those of the codes (Clay's r and mul's e[]), or 1 .. 2^cw-1 with "all"
+ * (cw = 8 only).  Each is run with buffers that are aligned and with
+ * buffers that are off by one word, and with each region multiply GF-
+ * Complete can dispatch to: its default, the split table with SIMD, and
+ * the split table without (a level the library was built without is
+ * skipped).  Every point is repeated until it takes min_ms, and printed
+ * as a CSV row of GB/s over both sub-chunks and of cycles per byte (TSC
+ * cycles, on x86 only).
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "gf_complete.h"
+#include "jerasure.h"
+#include "galois.h"
+#include "chunk-io.h"
+#include "coupling.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define kernel_cycles() ((double) __rdtsc())
+#else
+#define kernel_cycles() (0.0)
+#endif
+
+#define MAXSIZE (16*1024*1024)
+#define r 2
+
+enum Kernel {Couple, Uncouple, Xor};
+
+char *Kernels[] = {"couple", "uncouple", "xor"};
+
+typedef struct {
+	const char *name;
+	int mult_type, region_type;
+	int arg1, arg2;
+} kernel_level;
+
+static double kernel_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec/1e9;
+}
+
+/* Makes level the field galois_wNN_region_multiply() uses; -1 if GF-
+   Complete cannot do it here */
+static int kernel_level_set(kernel_level *l, int cw)
+{
+	gf_t *gf;
+
+	gf = (gf_t *)malloc(sizeof(gf_t));
+	if (gf == NULL) {
+		perror("malloc");
+		exit(1);
+	}
+	if (!gf_init_hard(gf, cw, l->mult_type, l->region_type, GF_DIVIDE_DEFAULT, 0, l->arg1, l->arg2, NULL, NULL)) {
+		free(gf);
+		return -1;
+	}
+	galois_change_technique(gf, cw);
+	return 0;
+}
+
+static void kernel_run(int kernel, char *u1, char *u2, char *c1, char *c2, int c, int inv, int len, int cw)
+{
+	switch (kernel) {
+		case Couple:
+			coupling_region_multiply(u2, c, len, c1, 1, cw);
+			coupling_region_multiply(u1, c, len, c2, 1, cw);
+			break;
+		case Uncouple:
+			memcpy(u1, c1, len);
+			coupling_region_multiply(c2, c, len, u1, 1, cw);
+			coupling_region_multiply(u1, inv, len, u1, 0, cw);
+			memcpy(u2, c2, len);
+			coupling_region_multiply(c1, c, len, u2, 1, cw);
+			coupling_region_multiply(u2, inv, len, u2, 0, cw);
+			break;
+		case Xor:
+			galois_region_xor(u2, c1, len);
+			galois_region_xor(u1, c2, len);
+			break;
+	}
+}
+
+/* couple followed by uncouple has to give the pair back */
+static int kernel_check(char **buf, int c, int inv, int cw)
+{
+	char *u1, *u2;
+	int len, ret;
+
+	len = 4096;
+	u1 = chunk_io_alloc(len);
+	u2 = chunk_io_alloc(len);
+	memcpy(u1, buf[0], len);
+	memcpy(u2, buf[1], len);
+	memcpy(buf[2], buf[0], len);
+	memcpy(buf[3], buf[1], len);
+	kernel_run(Couple, buf[0], buf[1], buf[2], buf[3], c, inv, len, cw);
+	kernel_run(Uncouple, buf[0], buf[1], buf[2], buf[3], c, inv, len, cw);
+	ret = (memcmp(u1, buf[0], len) != 0 || memcmp(u2, buf[1], len) != 0);
+	free(u1);
+	free(u2);
+	return ret;
+}
+
+int main(int argc, char **argv)
+{
+	static int coefs[] = {r, 20, 18, 17, 16, 15, 13, 167};	/* Clay's r, mul's e[] */
+	kernel_level levels[3];
+	char *buf[4];
+	double min, t1, t2, c1, c2;
+	long n, i;
+	int w, cw, all, step, nc, ic, il, kernel, align, off, size, c, inv;
+
+	if (argc < 3) {
+		fprintf(stderr, "usage: w min_ms [all] [pow2]\n");
+		fprintf(stderr, "\nw is coupled in GF(2^8), GF(2^16) or GF(2^32) like the encoders do; all runs every coefficient (w=8).\n\n");
+		exit(0);
+	}
+	if (sscanf(argv[1], "%d", &w) != 1 || w <= 0 || w > 32) {
+		fprintf(stderr, "Invalid value for w\n");
+		exit(0);
+	}
+	if (sscanf(argv[2], "%lf", &min) != 1 || min <= 0) {
+		fprintf(stderr, "Invalid value for min_ms\n");
+		exit(0);
+	}
+	min /= 1000.0;
+	cw = coupling_w(w);
+	all = 0;
+	step = 4;
+	for (i = 3; i < argc; i++) {
+		if (strcmp(argv[i], "all") == 0) all = 1;
+		else if (strcmp(argv[i], "pow2") == 0) step = 2;
+		else {
+			fprintf(stderr, "Unknown option %s\n", argv[i]);
+			exit(0);
+		}
+	}
+	if (all && cw != 8) {
+		fprintf(stderr, "all is only for w=8\n");
+		exit(0);
+	}
+	nc = all ? 255 : sizeof(coefs)/sizeof(int);
+
+	levels[0] = (kernel_level) {"default", GF_MULT_DEFAULT, GF_REGION_DEFAULT, 0, 0};
+	levels[1] = (kernel_level) {"simd", GF_MULT_SPLIT_TABLE, GF_REGION_SIMD, cw, 4};
+	levels[2] = (kernel_level) {"nosimd", GF_MULT_SPLIT_TABLE, GF_REGION_NOSIMD, cw, 4};
+
+	/* Room for the unaligned runs, which start one word in */
+	srand48(1);
+	for (i = 0; i < 4; i++) {
+		buf[i] = chunk_io_alloc(MAXSIZE+64);
+		for (n = 0; n < (MAXSIZE+64)/4; n++) ((uint32_t *)buf[i])[n] = mrand48();
+	}
+
+	printf("kernel,level,w,coef,size,align,GBs,cycles_per_byte\n");
+	for (il = 0; il < 3; il++) {
+		if (kernel_level_set(&levels[il], cw) != 0) {
+			fprintf(stderr, "%s: not available for w=%d, skipped\n", levels[il].name, cw);
+			continue;
+		}
+		for (ic = 0; ic < nc; ic++) {
+			c = all ? ic+1 : coefs[ic];
+			inv = (galois_single_multiply(c, c, cw) == 1) ? 0 : galois_single_divide(1, 1 ^ galois_single_multiply(c, c, cw), cw);
+			if (inv != 0 && kernel_check(buf, c, inv, cw) != 0) {
+				fprintf(stderr, "%s: uncouple does not undo couple for coefficient %d\n", levels[il].name, c);
+				exit(1);
+			}
+			for (kernel = Couple; kernel <= Xor; kernel++) {
+				if (kernel == Uncouple && inv == 0) continue;
+				if (kernel == Xor && ic > 0) continue;
+				for (size = 64; size <= MAXSIZE; size *= step) {
+					for (align = 1; align >= 0; align--) {
+						off = align ? 0 : cw/8;
+
+						/* Doubles the repeats until they take min */
+						for (n = 1; ; n *= 2) {
+							t1 = kernel_now();
+							c1 = kernel_cycles();
+							for (i = 0; i < n; i++) {
+								kernel_run(kernel, buf[0]+off, buf[1]+off, buf[2]+off, buf[3]+off, c, inv, size, cw);
+							}
+							c2 = kernel_cycles();
+							t2 = kernel_now();
+							if (t2-t1 >= min) break;
+						}
+						printf("%s,%s,%d,%d,%d,%s,%.3f,", Kernels[kernel], levels[il].name, cw, (kernel == Xor) ? 1 : c,
+							size, align ? "aligned" : "unaligned", 2.0*size*n/(t2-t1)/1e9);
+						if (c2 > c1) printf("%.4f\n", (c2-c1)/(2.0*size*n));
+						else printf("-\n");
+					}
+				}
+			}
+			fflush(stdout);
+		}
+	}
+	for (i = 0; i < 4; i++) free(buf[i]);
+	return 0;
+}
@@ -0,0 +1,4980 @@
+/* *
+ * clay-schedule.h - generated by clay-gen 10,4; do not edit.
+ *
+ * Straight-line coupling (CLAY_SCHEDULE_COUPLE) and uncoupling
+ * (CLAY_SCHEDULE_UNCOUPLE) of the profiles 10+4.
+ * See clay-gen.c.
+ */
+
+#ifndef _CLAY_SCHEDULE_H
+#define _CLAY_SCHEDULE_H
+
+#include "coupling.h"
+
+#ifdef CLAY_SCHEDULE_COUPLE
+
+/* k=10 m=4, 128 layers */
+static void clay_couple_10_4(char **fdata, char **fcoding, char **ffdata, char **ccoding, uint32_t *rcrc, long bs, int cw)
+{
+	coupling_region_multiply(ffdata[1], 2, bs, fdata[0]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 0, fdata[0], bs);
+	subchunk_crc(rcrc, 1, 0, fdata[0]+bs, bs);
+	coupling_region_multiply(ffdata[0]+bs, 2, bs, fdata[1], 1, cw);
+	subchunk_crc(rcrc, 0, 1, fdata[1], bs);
+	subchunk_crc(rcrc, 1, 1, fdata[1]+bs, bs);
+	coupling_region_multiply(ffdata[3], 2, bs, fdata[2]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 2, fdata[2], bs);
+	subchunk_crc(rcrc, 1, 2, fdata[2]+bs, bs);
+	coupling_region_multiply(ffdata[2]+bs, 2, bs, fdata[3], 1, cw);
+	subchunk_crc(rcrc, 0, 3, fdata[3], bs);
+	subchunk_crc(rcrc, 1, 3, fdata[3]+bs, bs);
+	coupling_region_multiply(ffdata[5], 2, bs, fdata[4]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 4, fdata[4], bs);
+	subchunk_crc(rcrc, 1, 4, fdata[4]+bs, bs);
+	coupling_region_multiply(ffdata[4]+bs, 2, bs, fdata[5], 1, cw);
+	subchunk_crc(rcrc, 0, 5, fdata[5], bs);
+	subchunk_crc(rcrc, 1, 5, fdata[5]+bs, bs);
+	coupling_region_multiply(ffdata[7], 2, bs, fdata[6]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 6, fdata[6], bs);
+	subchunk_crc(rcrc, 1, 6, fdata[6]+bs, bs);
+	coupling_region_multiply(ffdata[6]+bs, 2, bs, fdata[7], 1, cw);
+	subchunk_crc(rcrc, 0, 7, fdata[7], bs);
+	subchunk_crc(rcrc, 1, 7, fdata[7]+bs, bs);
+	coupling_region_multiply(ffdata[9], 2, bs, fdata[8]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 8, fdata[8], bs);
+	subchunk_crc(rcrc, 1, 8, fdata[8]+bs, bs);
+	coupling_region_multiply(ffdata[8]+bs, 2, bs, fdata[9], 1, cw);
+	subchunk_crc(rcrc, 0, 9, fdata[9], bs);
+	subchunk_crc(rcrc, 1, 9, fdata[9]+bs, bs);
+	coupling_region_multiply(ffdata[11], 2, bs, fdata[10]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 10, fdata[10], bs);
+	subchunk_crc(rcrc, 1, 10, fdata[10]+bs, bs);
+	coupling_region_multiply(ffdata[10]+bs, 2, bs, fdata[11], 1, cw);
+	subchunk_crc(rcrc, 0, 11, fdata[11], bs);
+	subchunk_crc(rcrc, 1, 11, fdata[11]+bs, bs);
+	coupling_region_multiply(ffdata[13], 2, bs, fdata[12]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 12, fdata[12], bs);
+	subchunk_crc(rcrc, 1, 12, fdata[12]+bs, bs);
+	coupling_region_multiply(ffdata[12]+bs, 2, bs, fdata[13], 1, cw);
+	subchunk_crc(rcrc, 0, 13, fdata[13], bs);
+	subchunk_crc(rcrc, 1, 13, fdata[13]+bs, bs);
+	coupling_region_multiply(ffdata[15], 2, bs, fdata[14]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 14, fdata[14], bs);
+	subchunk_crc(rcrc, 1, 14, fdata[14]+bs, bs);
+	coupling_region_multiply(ffdata[14]+bs, 2, bs, fdata[15], 1, cw);
+	subchunk_crc(rcrc, 0, 15, fdata[15], bs);
+	subchunk_crc(rcrc, 1, 15, fdata[15]+bs, bs);
+	coupling_region_multiply(ffdata[17], 2, bs, fdata[16]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 16, fdata[16], bs);
+	subchunk_crc(rcrc, 1, 16, fdata[16]+bs, bs);
+	coupling_region_multiply(ffdata[16]+bs, 2, bs, fdata[17], 1, cw);
+	subchunk_crc(rcrc, 0, 17, fdata[17], bs);
+	subchunk_crc(rcrc, 1, 17, fdata[17]+bs, bs);
+	coupling_region_multiply(ffdata[19], 2, bs, fdata[18]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 18, fdata[18], bs);
+	subchunk_crc(rcrc, 1, 18, fdata[18]+bs, bs);
+	coupling_region_multiply(ffdata[18]+bs, 2, bs, fdata[19], 1, cw);
+	subchunk_crc(rcrc, 0, 19, fdata[19], bs);
+	subchunk_crc(rcrc, 1, 19, fdata[19]+bs, bs);
+	coupling_region_multiply(ffdata[21], 2, bs, fdata[20]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 20, fdata[20], bs);
+	subchunk_crc(rcrc, 1, 20, fdata[20]+bs, bs);
+	coupling_region_multiply(ffdata[20]+bs, 2, bs, fdata[21], 1, cw);
+	subchunk_crc(rcrc, 0, 21, fdata[21], bs);
+	subchunk_crc(rcrc, 1, 21, fdata[21]+bs, bs);
+	coupling_region_multiply(ffdata[23], 2, bs, fdata[22]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 22, fdata[22], bs);
+	subchunk_crc(rcrc, 1, 22, fdata[22]+bs, bs);
+	coupling_region_multiply(ffdata[22]+bs, 2, bs, fdata[23], 1, cw);
+	subchunk_crc(rcrc, 0, 23, fdata[23], bs);
+	subchunk_crc(rcrc, 1, 23, fdata[23]+bs, bs);
+	coupling_region_multiply(ffdata[25], 2, bs, fdata[24]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 24, fdata[24], bs);
+	subchunk_crc(rcrc, 1, 24, fdata[24]+bs, bs);
+	coupling_region_multiply(ffdata[24]+bs, 2, bs, fdata[25], 1, cw);
+	subchunk_crc(rcrc, 0, 25, fdata[25], bs);
+	subchunk_crc(rcrc, 1, 25, fdata[25]+bs, bs);
+	coupling_region_multiply(ffdata[27], 2, bs, fdata[26]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 26, fdata[26], bs);
+	subchunk_crc(rcrc, 1, 26, fdata[26]+bs, bs);
+	coupling_region_multiply(ffdata[26]+bs, 2, bs, fdata[27], 1, cw);
+	subchunk_crc(rcrc, 0, 27, fdata[27], bs);
+	subchunk_crc(rcrc, 1, 27, fdata[27]+bs, bs);
+	coupling_region_multiply(ffdata[29], 2, bs, fdata[28]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 28, fdata[28], bs);
+	subchunk_crc(rcrc, 1, 28, fdata[28]+bs, bs);
+	coupling_region_multiply(ffdata[28]+bs, 2, bs, fdata[29], 1, cw);
+	subchunk_crc(rcrc, 0, 29, fdata[29], bs);
+	subchunk_crc(rcrc, 1, 29, fdata[29]+bs, bs);
+	coupling_region_multiply(ffdata[31], 2, bs, fdata[30]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 30, fdata[30], bs);
+	subchunk_crc(rcrc, 1, 30, fdata[30]+bs, bs);
+	coupling_region_multiply(ffdata[30]+bs, 2, bs, fdata[31], 1, cw);
+	subchunk_crc(rcrc, 0, 31, fdata[31], bs);
+	subchunk_crc(rcrc, 1, 31, fdata[31]+bs, bs);
+	coupling_region_multiply(ffdata[33], 2, bs, fdata[32]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 32, fdata[32], bs);
+	subchunk_crc(rcrc, 1, 32, fdata[32]+bs, bs);
+	coupling_region_multiply(ffdata[32]+bs, 2, bs, fdata[33], 1, cw);
+	subchunk_crc(rcrc, 0, 33, fdata[33], bs);
+	subchunk_crc(rcrc, 1, 33, fdata[33]+bs, bs);
+	coupling_region_multiply(ffdata[35], 2, bs, fdata[34]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 34, fdata[34], bs);
+	subchunk_crc(rcrc, 1, 34, fdata[34]+bs, bs);
+	coupling_region_multiply(ffdata[34]+bs, 2, bs, fdata[35], 1, cw);
+	subchunk_crc(rcrc, 0, 35, fdata[35], bs);
+	subchunk_crc(rcrc, 1, 35, fdata[35]+bs, bs);
+	coupling_region_multiply(ffdata[37], 2, bs, fdata[36]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 36, fdata[36], bs);
+	subchunk_crc(rcrc, 1, 36, fdata[36]+bs, bs);
+	coupling_region_multiply(ffdata[36]+bs, 2, bs, fdata[37], 1, cw);
+	subchunk_crc(rcrc, 0, 37, fdata[37], bs);
+	subchunk_crc(rcrc, 1, 37, fdata[37]+bs, bs);
+	coupling_region_multiply(ffdata[39], 2, bs, fdata[38]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 38, fdata[38], bs);
+	subchunk_crc(rcrc, 1, 38, fdata[38]+bs, bs);
+	coupling_region_multiply(ffdata[38]+bs, 2, bs, fdata[39], 1, cw);
+	subchunk_crc(rcrc, 0, 39, fdata[39], bs);
+	subchunk_crc(rcrc, 1, 39, fdata[39]+bs, bs);
+	coupling_region_multiply(ffdata[41], 2, bs, fdata[40]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 40, fdata[40], bs);
+	subchunk_crc(rcrc, 1, 40, fdata[40]+bs, bs);
+	coupling_region_multiply(ffdata[40]+bs, 2, bs, fdata[41], 1, cw);
+	subchunk_crc(rcrc, 0, 41, fdata[41], bs);
+	subchunk_crc(rcrc, 1, 41, fdata[41]+bs, bs);
+	coupling_region_multiply(ffdata[43], 2, bs, fdata[42]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 42, fdata[42], bs);
+	subchunk_crc(rcrc, 1, 42, fdata[42]+bs, bs);
+	coupling_region_multiply(ffdata[42]+bs, 2, bs, fdata[43], 1, cw);
+	subchunk_crc(rcrc, 0, 43, fdata[43], bs);
+	subchunk_crc(rcrc, 1, 43, fdata[43]+bs, bs);
+	coupling_region_multiply(ffdata[45], 2, bs, fdata[44]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 44, fdata[44], bs);
+	subchunk_crc(rcrc, 1, 44, fdata[44]+bs, bs);
+	coupling_region_multiply(ffdata[44]+bs, 2, bs, fdata[45], 1, cw);
+	subchunk_crc(rcrc, 0, 45, fdata[45], bs);
+	subchunk_crc(rcrc, 1, 45, fdata[45]+bs, bs);
+	coupling_region_multiply(ffdata[47], 2, bs, fdata[46]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 46, fdata[46], bs);
+	subchunk_crc(rcrc, 1, 46, fdata[46]+bs, bs);
+	coupling_region_multiply(ffdata[46]+bs, 2, bs, fdata[47], 1, cw);
+	subchunk_crc(rcrc, 0, 47, fdata[47], bs);
+	subchunk_crc(rcrc, 1, 47, fdata[47]+bs, bs);
+	coupling_region_multiply(ffdata[49], 2, bs, fdata[48]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 48, fdata[48], bs);
+	subchunk_crc(rcrc, 1, 48, fdata[48]+bs, bs);
+	coupling_region_multiply(ffdata[48]+bs, 2, bs, fdata[49], 1, cw);
+	subchunk_crc(rcrc, 0, 49, fdata[49], bs);
+	subchunk_crc(rcrc, 1, 49, fdata[49]+bs, bs);
+	coupling_region_multiply(ffdata[51], 2, bs, fdata[50]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 50, fdata[50], bs);
+	subchunk_crc(rcrc, 1, 50, fdata[50]+bs, bs);
+	coupling_region_multiply(ffdata[50]+bs, 2, bs, fdata[51], 1, cw);
+	subchunk_crc(rcrc, 0, 51, fdata[51], bs);
+	subchunk_crc(rcrc, 1, 51, fdata[51]+bs, bs);
+	coupling_region_multiply(ffdata[53], 2, bs, fdata[52]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 52, fdata[52], bs);
+	subchunk_crc(rcrc, 1, 52, fdata[52]+bs, bs);
+	coupling_region_multiply(ffdata[52]+bs, 2, bs, fdata[53], 1, cw);
+	subchunk_crc(rcrc, 0, 53, fdata[53], bs);
+	subchunk_crc(rcrc, 1, 53, fdata[53]+bs, bs);
+	coupling_region_multiply(ffdata[55], 2, bs, fdata[54]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 54, fdata[54], bs);
+	subchunk_crc(rcrc, 1, 54, fdata[54]+bs, bs);
+	coupling_region_multiply(ffdata[54]+bs, 2, bs, fdata[55], 1, cw);
+	subchunk_crc(rcrc, 0, 55, fdata[55], bs);
+	subchunk_crc(rcrc, 1, 55, fdata[55]+bs, bs);
+	coupling_region_multiply(ffdata[57], 2, bs, fdata[56]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 56, fdata[56], bs);
+	subchunk_crc(rcrc, 1, 56, fdata[56]+bs, bs);
+	coupling_region_multiply(ffdata[56]+bs, 2, bs, fdata[57], 1, cw);
+	subchunk_crc(rcrc, 0, 57, fdata[57], bs);
+	subchunk_crc(rcrc, 1, 57, fdata[57]+bs, bs);
+	coupling_region_multiply(ffdata[59], 2, bs, fdata[58]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 58, fdata[58], bs);
+	subchunk_crc(rcrc, 1, 58, fdata[58]+bs, bs);
+	coupling_region_multiply(ffdata[58]+bs, 2, bs, fdata[59], 1, cw);
+	subchunk_crc(rcrc, 0, 59, fdata[59], bs);
+	subchunk_crc(rcrc, 1, 59, fdata[59]+bs, bs);
+	coupling_region_multiply(ffdata[61], 2, bs, fdata[60]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 60, fdata[60], bs);
+	subchunk_crc(rcrc, 1, 60, fdata[60]+bs, bs);
+	coupling_region_multiply(ffdata[60]+bs, 2, bs, fdata[61], 1, cw);
+	subchunk_crc(rcrc, 0, 61, fdata[61], bs);
+	subchunk_crc(rcrc, 1, 61, fdata[61]+bs, bs);
+	coupling_region_multiply(ffdata[63], 2, bs, fdata[62]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 62, fdata[62], bs);
+	subchunk_crc(rcrc, 1, 62, fdata[62]+bs, bs);
+	coupling_region_multiply(ffdata[62]+bs, 2, bs, fdata[63], 1, cw);
+	subchunk_crc(rcrc, 0, 63, fdata[63], bs);
+	subchunk_crc(rcrc, 1, 63, fdata[63]+bs, bs);
+	coupling_region_multiply(ffdata[65], 2, bs, fdata[64]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 64, fdata[64], bs);
+	subchunk_crc(rcrc, 1, 64, fdata[64]+bs, bs);
+	coupling_region_multiply(ffdata[64]+bs, 2, bs, fdata[65], 1, cw);
+	subchunk_crc(rcrc, 0, 65, fdata[65], bs);
+	subchunk_crc(rcrc, 1, 65, fdata[65]+bs, bs);
+	coupling_region_multiply(ffdata[67], 2, bs, fdata[66]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 66, fdata[66], bs);
+	subchunk_crc(rcrc, 1, 66, fdata[66]+bs, bs);
+	coupling_region_multiply(ffdata[66]+bs, 2, bs, fdata[67], 1, cw);
+	subchunk_crc(rcrc, 0, 67, fdata[67], bs);
+	subchunk_crc(rcrc, 1, 67, fdata[67]+bs, bs);
+	coupling_region_multiply(ffdata[69], 2, bs, fdata[68]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 68, fdata[68], bs);
+	subchunk_crc(rcrc, 1, 68, fdata[68]+bs, bs);
+	coupling_region_multiply(ffdata[68]+bs, 2, bs, fdata[69], 1, cw);
+	subchunk_crc(rcrc, 0, 69, fdata[69], bs);
+	subchunk_crc(rcrc, 1, 69, fdata[69]+bs, bs);
+	coupling_region_multiply(ffdata[71], 2, bs, fdata[70]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 70, fdata[70], bs);
+	subchunk_crc(rcrc, 1, 70, fdata[70]+bs, bs);
+	coupling_region_multiply(ffdata[70]+bs, 2, bs, fdata[71], 1, cw);
+	subchunk_crc(rcrc, 0, 71, fdata[71], bs);
+	subchunk_crc(rcrc, 1, 71, fdata[71]+bs, bs);
+	coupling_region_multiply(ffdata[73], 2, bs, fdata[72]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 72, fdata[72], bs);
+	subchunk_crc(rcrc, 1, 72, fdata[72]+bs, bs);
+	coupling_region_multiply(ffdata[72]+bs, 2, bs, fdata[73], 1, cw);
+	subchunk_crc(rcrc, 0, 73, fdata[73], bs);
+	subchunk_crc(rcrc, 1, 73, fdata[73]+bs, bs);
+	coupling_region_multiply(ffdata[75], 2, bs, fdata[74]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 74, fdata[74], bs);
+	subchunk_crc(rcrc, 1, 74, fdata[74]+bs, bs);
+	coupling_region_multiply(ffdata[74]+bs, 2, bs, fdata[75], 1, cw);
+	subchunk_crc(rcrc, 0, 75, fdata[75], bs);
+	subchunk_crc(rcrc, 1, 75, fdata[75]+bs, bs);
+	coupling_region_multiply(ffdata[77], 2, bs, fdata[76]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 76, fdata[76], bs);
+	subchunk_crc(rcrc, 1, 76, fdata[76]+bs, bs);
+	coupling_region_multiply(ffdata[76]+bs, 2, bs, fdata[77], 1, cw);
+	subchunk_crc(rcrc, 0, 77, fdata[77], bs);
+	subchunk_crc(rcrc, 1, 77, fdata[77]+bs, bs);
+	coupling_region_multiply(ffdata[79], 2, bs, fdata[78]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 78, fdata[78], bs);
+	subchunk_crc(rcrc, 1, 78, fdata[78]+bs, bs);
+	coupling_region_multiply(ffdata[78]+bs, 2, bs, fdata[79], 1, cw);
+	subchunk_crc(rcrc, 0, 79, fdata[79], bs);
+	subchunk_crc(rcrc, 1, 79, fdata[79]+bs, bs);
+	coupling_region_multiply(ffdata[81], 2, bs, fdata[80]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 80, fdata[80], bs);
+	subchunk_crc(rcrc, 1, 80, fdata[80]+bs, bs);
+	coupling_region_multiply(ffdata[80]+bs, 2, bs, fdata[81], 1, cw);
+	subchunk_crc(rcrc, 0, 81, fdata[81], bs);
+	subchunk_crc(rcrc, 1, 81, fdata[81]+bs, bs);
+	coupling_region_multiply(ffdata[83], 2, bs, fdata[82]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 82, fdata[82], bs);
+	subchunk_crc(rcrc, 1, 82, fdata[82]+bs, bs);
+	coupling_region_multiply(ffdata[82]+bs, 2, bs, fdata[83], 1, cw);
+	subchunk_crc(rcrc, 0, 83, fdata[83], bs);
+	subchunk_crc(rcrc, 1, 83, fdata[83]+bs, bs);
+	coupling_region_multiply(ffdata[85], 2, bs, fdata[84]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 84, fdata[84], bs);
+	subchunk_crc(rcrc, 1, 84, fdata[84]+bs, bs);
+	coupling_region_multiply(ffdata[84]+bs, 2, bs, fdata[85], 1, cw);
+	subchunk_crc(rcrc, 0, 85, fdata[85], bs);
+	subchunk_crc(rcrc, 1, 85, fdata[85]+bs, bs);
+	coupling_region_multiply(ffdata[87], 2, bs, fdata[86]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 86, fdata[86], bs);
+	subchunk_crc(rcrc, 1, 86, fdata[86]+bs, bs);
+	coupling_region_multiply(ffdata[86]+bs, 2, bs, fdata[87], 1, cw);
+	subchunk_crc(rcrc, 0, 87, fdata[87], bs);
+	subchunk_crc(rcrc, 1, 87, fdata[87]+bs, bs);
+	coupling_region_multiply(ffdata[89], 2, bs, fdata[88]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 88, fdata[88], bs);
+	subchunk_crc(rcrc, 1, 88, fdata[88]+bs, bs);
+	coupling_region_multiply(ffdata[88]+bs, 2, bs, fdata[89], 1, cw);
+	subchunk_crc(rcrc, 0, 89, fdata[89], bs);
+	subchunk_crc(rcrc, 1, 89, fdata[89]+bs, bs);
+	coupling_region_multiply(ffdata[91], 2, bs, fdata[90]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 90, fdata[90], bs);
+	subchunk_crc(rcrc, 1, 90, fdata[90]+bs, bs);
+	coupling_region_multiply(ffdata[90]+bs, 2, bs, fdata[91], 1, cw);
+	subchunk_crc(rcrc, 0, 91, fdata[91], bs);
+	subchunk_crc(rcrc, 1, 91, fdata[91]+bs, bs);
+	coupling_region_multiply(ffdata[93], 2, bs, fdata[92]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 92, fdata[92], bs);
+	subchunk_crc(rcrc, 1, 92, fdata[92]+bs, bs);
+	coupling_region_multiply(ffdata[92]+bs, 2, bs, fdata[93], 1, cw);
+	subchunk_crc(rcrc, 0, 93, fdata[93], bs);
+	subchunk_crc(rcrc, 1, 93, fdata[93]+bs, bs);
+	coupling_region_multiply(ffdata[95], 2, bs, fdata[94]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 94, fdata[94], bs);
+	subchunk_crc(rcrc, 1, 94, fdata[94]+bs, bs);
+	coupling_region_multiply(ffdata[94]+bs, 2, bs, fdata[95], 1, cw);
+	subchunk_crc(rcrc, 0, 95, fdata[95], bs);
+	subchunk_crc(rcrc, 1, 95, fdata[95]+bs, bs);
+	coupling_region_multiply(ffdata[97], 2, bs, fdata[96]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 96, fdata[96], bs);
+	subchunk_crc(rcrc, 1, 96, fdata[96]+bs, bs);
+	coupling_region_multiply(ffdata[96]+bs, 2, bs, fdata[97], 1, cw);
+	subchunk_crc(rcrc, 0, 97, fdata[97], bs);
+	subchunk_crc(rcrc, 1, 97, fdata[97]+bs, bs);
+	coupling_region_multiply(ffdata[99], 2, bs, fdata[98]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 98, fdata[98], bs);
+	subchunk_crc(rcrc, 1, 98, fdata[98]+bs, bs);
+	coupling_region_multiply(ffdata[98]+bs, 2, bs, fdata[99], 1, cw);
+	subchunk_crc(rcrc, 0, 99, fdata[99], bs);
+	subchunk_crc(rcrc, 1, 99, fdata[99]+bs, bs);
+	coupling_region_multiply(ffdata[101], 2, bs, fdata[100]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 100, fdata[100], bs);
+	subchunk_crc(rcrc, 1, 100, fdata[100]+bs, bs);
+	coupling_region_multiply(ffdata[100]+bs, 2, bs, fdata[101], 1, cw);
+	subchunk_crc(rcrc, 0, 101, fdata[101], bs);
+	subchunk_crc(rcrc, 1, 101, fdata[101]+bs, bs);
+	coupling_region_multiply(ffdata[103], 2, bs, fdata[102]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 102, fdata[102], bs);
+	subchunk_crc(rcrc, 1, 102, fdata[102]+bs, bs);
+	coupling_region_multiply(ffdata[102]+bs, 2, bs, fdata[103], 1, cw);
+	subchunk_crc(rcrc, 0, 103, fdata[103], bs);
+	subchunk_crc(rcrc, 1, 103, fdata[103]+bs, bs);
+	coupling_region_multiply(ffdata[105], 2, bs, fdata[104]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 104, fdata[104], bs);
+	subchunk_crc(rcrc, 1, 104, fdata[104]+bs, bs);
+	coupling_region_multiply(ffdata[104]+bs, 2, bs, fdata[105], 1, cw);
+	subchunk_crc(rcrc, 0, 105, fdata[105], bs);
+	subchunk_crc(rcrc, 1, 105, fdata[105]+bs, bs);
+	coupling_region_multiply(ffdata[107], 2, bs, fdata[106]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 106, fdata[106], bs);
+	subchunk_crc(rcrc, 1, 106, fdata[106]+bs, bs);
+	coupling_region_multiply(ffdata[106]+bs, 2, bs, fdata[107], 1, cw);
+	subchunk_crc(rcrc, 0, 107, fdata[107], bs);
+	subchunk_crc(rcrc, 1, 107, fdata[107]+bs, bs);
+	coupling_region_multiply(ffdata[109], 2, bs, fdata[108]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 108, fdata[108], bs);
+	subchunk_crc(rcrc, 1, 108, fdata[108]+bs, bs);
+	coupling_region_multiply(ffdata[108]+bs, 2, bs, fdata[109], 1, cw);
+	subchunk_crc(rcrc, 0, 109, fdata[109], bs);
+	subchunk_crc(rcrc, 1, 109, fdata[109]+bs, bs);
+	coupling_region_multiply(ffdata[111], 2, bs, fdata[110]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 110, fdata[110], bs);
+	subchunk_crc(rcrc, 1, 110, fdata[110]+bs, bs);
+	coupling_region_multiply(ffdata[110]+bs, 2, bs, fdata[111], 1, cw);
+	subchunk_crc(rcrc, 0, 111, fdata[111], bs);
+	subchunk_crc(rcrc, 1, 111, fdata[111]+bs, bs);
+	coupling_region_multiply(ffdata[113], 2, bs, fdata[112]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 112, fdata[112], bs);
+	subchunk_crc(rcrc, 1, 112, fdata[112]+bs, bs);
+	coupling_region_multiply(ffdata[112]+bs, 2, bs, fdata[113], 1, cw);
+	subchunk_crc(rcrc, 0, 113, fdata[113], bs);
+	subchunk_crc(rcrc, 1, 113, fdata[113]+bs, bs);
+	coupling_region_multiply(ffdata[115], 2, bs, fdata[114]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 114, fdata[114], bs);
+	subchunk_crc(rcrc, 1, 114, fdata[114]+bs, bs);
+	coupling_region_multiply(ffdata[114]+bs, 2, bs, fdata[115], 1, cw);
+	subchunk_crc(rcrc, 0, 115, fdata[115], bs);
+	subchunk_crc(rcrc, 1, 115, fdata[115]+bs, bs);
+	coupling_region_multiply(ffdata[117], 2, bs, fdata[116]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 116, fdata[116], bs);
+	subchunk_crc(rcrc, 1, 116, fdata[116]+bs, bs);
+	coupling_region_multiply(ffdata[116]+bs, 2, bs, fdata[117], 1, cw);
+	subchunk_crc(rcrc, 0, 117, fdata[117], bs);
+	subchunk_crc(rcrc, 1, 117, fdata[117]+bs, bs);
+	coupling_region_multiply(ffdata[119], 2, bs, fdata[118]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 118, fdata[118], bs);
+	subchunk_crc(rcrc, 1, 118, fdata[118]+bs, bs);
+	coupling_region_multiply(ffdata[118]+bs, 2, bs, fdata[119], 1, cw);
+	subchunk_crc(rcrc, 0, 119, fdata[119], bs);
+	subchunk_crc(rcrc, 1, 119, fdata[119]+bs, bs);
+	coupling_region_multiply(ffdata[121], 2, bs, fdata[120]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 120, fdata[120], bs);
+	subchunk_crc(rcrc, 1, 120, fdata[120]+bs, bs);
+	coupling_region_multiply(ffdata[120]+bs, 2, bs, fdata[121], 1, cw);
+	subchunk_crc(rcrc, 0, 121, fdata[121], bs);
+	subchunk_crc(rcrc, 1, 121, fdata[121]+bs, bs);
+	coupling_region_multiply(ffdata[123], 2, bs, fdata[122]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 122, fdata[122], bs);
+	subchunk_crc(rcrc, 1, 122, fdata[122]+bs, bs);
+	coupling_region_multiply(ffdata[122]+bs, 2, bs, fdata[123], 1, cw);
+	subchunk_crc(rcrc, 0, 123, fdata[123], bs);
+	subchunk_crc(rcrc, 1, 123, fdata[123]+bs, bs);
+	coupling_region_multiply(ffdata[125], 2, bs, fdata[124]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 124, fdata[124], bs);
+	subchunk_crc(rcrc, 1, 124, fdata[124]+bs, bs);
+	coupling_region_multiply(ffdata[124]+bs, 2, bs, fdata[125], 1, cw);
+	subchunk_crc(rcrc, 0, 125, fdata[125], bs);
+	subchunk_crc(rcrc, 1, 125, fdata[125]+bs, bs);
+	coupling_region_multiply(ffdata[127], 2, bs, fdata[126]+bs, 1, cw);
+	subchunk_crc(rcrc, 0, 126, fdata[126], bs);
+	subchunk_crc(rcrc, 1, 126, fdata[126]+bs, bs);
+	coupling_region_multiply(ffdata[126]+bs, 2, bs, fdata[127], 1, cw);
+	subchunk_crc(rcrc, 0, 127, fdata[127], bs);
+	subchunk_crc(rcrc, 1, 127, fdata[127]+bs, bs);
+	coupling_region_multiply(ffdata[2]+2*bs, 2, bs, fdata[0]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 0, fdata[0]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 0, fdata[0]+3*bs, bs);
+	coupling_region_multiply(ffdata[3]+2*bs, 2, bs, fdata[1]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 1, fdata[1]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 1, fdata[1]+3*bs, bs);
+	coupling_region_multiply(ffdata[0]+3*bs, 2, bs, fdata[2]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 2, fdata[2]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 2, fdata[2]+3*bs, bs);
+	coupling_region_multiply(ffdata[1]+3*bs, 2, bs, fdata[3]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 3, fdata[3]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 3, fdata[3]+3*bs, bs);
+	coupling_region_multiply(ffdata[6]+2*bs, 2, bs, fdata[4]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 4, fdata[4]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 4, fdata[4]+3*bs, bs);
+	coupling_region_multiply(ffdata[7]+2*bs, 2, bs, fdata[5]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 5, fdata[5]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 5, fdata[5]+3*bs, bs);
+	coupling_region_multiply(ffdata[4]+3*bs, 2, bs, fdata[6]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 6, fdata[6]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 6, fdata[6]+3*bs, bs);
+	coupling_region_multiply(ffdata[5]+3*bs, 2, bs, fdata[7]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 7, fdata[7]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 7, fdata[7]+3*bs, bs);
+	coupling_region_multiply(ffdata[10]+2*bs, 2, bs, fdata[8]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 8, fdata[8]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 8, fdata[8]+3*bs, bs);
+	coupling_region_multiply(ffdata[11]+2*bs, 2, bs, fdata[9]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 9, fdata[9]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 9, fdata[9]+3*bs, bs);
+	coupling_region_multiply(ffdata[8]+3*bs, 2, bs, fdata[10]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 10, fdata[10]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 10, fdata[10]+3*bs, bs);
+	coupling_region_multiply(ffdata[9]+3*bs, 2, bs, fdata[11]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 11, fdata[11]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 11, fdata[11]+3*bs, bs);
+	coupling_region_multiply(ffdata[14]+2*bs, 2, bs, fdata[12]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 12, fdata[12]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 12, fdata[12]+3*bs, bs);
+	coupling_region_multiply(ffdata[15]+2*bs, 2, bs, fdata[13]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 13, fdata[13]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 13, fdata[13]+3*bs, bs);
+	coupling_region_multiply(ffdata[12]+3*bs, 2, bs, fdata[14]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 14, fdata[14]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 14, fdata[14]+3*bs, bs);
+	coupling_region_multiply(ffdata[13]+3*bs, 2, bs, fdata[15]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 15, fdata[15]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 15, fdata[15]+3*bs, bs);
+	coupling_region_multiply(ffdata[18]+2*bs, 2, bs, fdata[16]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 16, fdata[16]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 16, fdata[16]+3*bs, bs);
+	coupling_region_multiply(ffdata[19]+2*bs, 2, bs, fdata[17]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 17, fdata[17]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 17, fdata[17]+3*bs, bs);
+	coupling_region_multiply(ffdata[16]+3*bs, 2, bs, fdata[18]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 18, fdata[18]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 18, fdata[18]+3*bs, bs);
+	coupling_region_multiply(ffdata[17]+3*bs, 2, bs, fdata[19]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 19, fdata[19]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 19, fdata[19]+3*bs, bs);
+	coupling_region_multiply(ffdata[22]+2*bs, 2, bs, fdata[20]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 20, fdata[20]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 20, fdata[20]+3*bs, bs);
+	coupling_region_multiply(ffdata[23]+2*bs, 2, bs, fdata[21]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 21, fdata[21]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 21, fdata[21]+3*bs, bs);
+	coupling_region_multiply(ffdata[20]+3*bs, 2, bs, fdata[22]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 22, fdata[22]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 22, fdata[22]+3*bs, bs);
+	coupling_region_multiply(ffdata[21]+3*bs, 2, bs, fdata[23]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 23, fdata[23]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 23, fdata[23]+3*bs, bs);
+	coupling_region_multiply(ffdata[26]+2*bs, 2, bs, fdata[24]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 24, fdata[24]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 24, fdata[24]+3*bs, bs);
+	coupling_region_multiply(ffdata[27]+2*bs, 2, bs, fdata[25]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 25, fdata[25]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 25, fdata[25]+3*bs, bs);
+	coupling_region_multiply(ffdata[24]+3*bs, 2, bs, fdata[26]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 26, fdata[26]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 26, fdata[26]+3*bs, bs);
+	coupling_region_multiply(ffdata[25]+3*bs, 2, bs, fdata[27]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 27, fdata[27]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 27, fdata[27]+3*bs, bs);
+	coupling_region_multiply(ffdata[30]+2*bs, 2, bs, fdata[28]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 28, fdata[28]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 28, fdata[28]+3*bs, bs);
+	coupling_region_multiply(ffdata[31]+2*bs, 2, bs, fdata[29]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 29, fdata[29]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 29, fdata[29]+3*bs, bs);
+	coupling_region_multiply(ffdata[28]+3*bs, 2, bs, fdata[30]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 30, fdata[30]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 30, fdata[30]+3*bs, bs);
+	coupling_region_multiply(ffdata[29]+3*bs, 2, bs, fdata[31]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 31, fdata[31]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 31, fdata[31]+3*bs, bs);
+	coupling_region_multiply(ffdata[34]+2*bs, 2, bs, fdata[32]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 32, fdata[32]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 32, fdata[32]+3*bs, bs);
+	coupling_region_multiply(ffdata[35]+2*bs, 2, bs, fdata[33]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 33, fdata[33]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 33, fdata[33]+3*bs, bs);
+	coupling_region_multiply(ffdata[32]+3*bs, 2, bs, fdata[34]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 34, fdata[34]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 34, fdata[34]+3*bs, bs);
+	coupling_region_multiply(ffdata[33]+3*bs, 2, bs, fdata[35]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 35, fdata[35]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 35, fdata[35]+3*bs, bs);
+	coupling_region_multiply(ffdata[38]+2*bs, 2, bs, fdata[36]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 36, fdata[36]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 36, fdata[36]+3*bs, bs);
+	coupling_region_multiply(ffdata[39]+2*bs, 2, bs, fdata[37]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 37, fdata[37]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 37, fdata[37]+3*bs, bs);
+	coupling_region_multiply(ffdata[36]+3*bs, 2, bs, fdata[38]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 38, fdata[38]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 38, fdata[38]+3*bs, bs);
+	coupling_region_multiply(ffdata[37]+3*bs, 2, bs, fdata[39]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 39, fdata[39]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 39, fdata[39]+3*bs, bs);
+	coupling_region_multiply(ffdata[42]+2*bs, 2, bs, fdata[40]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 40, fdata[40]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 40, fdata[40]+3*bs, bs);
+	coupling_region_multiply(ffdata[43]+2*bs, 2, bs, fdata[41]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 41, fdata[41]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 41, fdata[41]+3*bs, bs);
+	coupling_region_multiply(ffdata[40]+3*bs, 2, bs, fdata[42]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 42, fdata[42]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 42, fdata[42]+3*bs, bs);
+	coupling_region_multiply(ffdata[41]+3*bs, 2, bs, fdata[43]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 43, fdata[43]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 43, fdata[43]+3*bs, bs);
+	coupling_region_multiply(ffdata[46]+2*bs, 2, bs, fdata[44]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 44, fdata[44]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 44, fdata[44]+3*bs, bs);
+	coupling_region_multiply(ffdata[47]+2*bs, 2, bs, fdata[45]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 45, fdata[45]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 45, fdata[45]+3*bs, bs);
+	coupling_region_multiply(ffdata[44]+3*bs, 2, bs, fdata[46]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 46, fdata[46]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 46, fdata[46]+3*bs, bs);
+	coupling_region_multiply(ffdata[45]+3*bs, 2, bs, fdata[47]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 47, fdata[47]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 47, fdata[47]+3*bs, bs);
+	coupling_region_multiply(ffdata[50]+2*bs, 2, bs, fdata[48]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 48, fdata[48]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 48, fdata[48]+3*bs, bs);
+	coupling_region_multiply(ffdata[51]+2*bs, 2, bs, fdata[49]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 49, fdata[49]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 49, fdata[49]+3*bs, bs);
+	coupling_region_multiply(ffdata[48]+3*bs, 2, bs, fdata[50]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 50, fdata[50]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 50, fdata[50]+3*bs, bs);
+	coupling_region_multiply(ffdata[49]+3*bs, 2, bs, fdata[51]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 51, fdata[51]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 51, fdata[51]+3*bs, bs);
+	coupling_region_multiply(ffdata[54]+2*bs, 2, bs, fdata[52]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 52, fdata[52]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 52, fdata[52]+3*bs, bs);
+	coupling_region_multiply(ffdata[55]+2*bs, 2, bs, fdata[53]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 53, fdata[53]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 53, fdata[53]+3*bs, bs);
+	coupling_region_multiply(ffdata[52]+3*bs, 2, bs, fdata[54]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 54, fdata[54]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 54, fdata[54]+3*bs, bs);
+	coupling_region_multiply(ffdata[53]+3*bs, 2, bs, fdata[55]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 55, fdata[55]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 55, fdata[55]+3*bs, bs);
+	coupling_region_multiply(ffdata[58]+2*bs, 2, bs, fdata[56]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 56, fdata[56]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 56, fdata[56]+3*bs, bs);
+	coupling_region_multiply(ffdata[59]+2*bs, 2, bs, fdata[57]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 57, fdata[57]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 57, fdata[57]+3*bs, bs);
+	coupling_region_multiply(ffdata[56]+3*bs, 2, bs, fdata[58]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 58, fdata[58]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 58, fdata[58]+3*bs, bs);
+	coupling_region_multiply(ffdata[57]+3*bs, 2, bs, fdata[59]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 59, fdata[59]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 59, fdata[59]+3*bs, bs);
+	coupling_region_multiply(ffdata[62]+2*bs, 2, bs, fdata[60]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 60, fdata[60]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 60, fdata[60]+3*bs, bs);
+	coupling_region_multiply(ffdata[63]+2*bs, 2, bs, fdata[61]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 61, fdata[61]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 61, fdata[61]+3*bs, bs);
+	coupling_region_multiply(ffdata[60]+3*bs, 2, bs, fdata[62]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 62, fdata[62]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 62, fdata[62]+3*bs, bs);
+	coupling_region_multiply(ffdata[61]+3*bs, 2, bs, fdata[63]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 63, fdata[63]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 63, fdata[63]+3*bs, bs);
+	coupling_region_multiply(ffdata[66]+2*bs, 2, bs, fdata[64]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 64, fdata[64]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 64, fdata[64]+3*bs, bs);
+	coupling_region_multiply(ffdata[67]+2*bs, 2, bs, fdata[65]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 65, fdata[65]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 65, fdata[65]+3*bs, bs);
+	coupling_region_multiply(ffdata[64]+3*bs, 2, bs, fdata[66]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 66, fdata[66]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 66, fdata[66]+3*bs, bs);
+	coupling_region_multiply(ffdata[65]+3*bs, 2, bs, fdata[67]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 67, fdata[67]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 67, fdata[67]+3*bs, bs);
+	coupling_region_multiply(ffdata[70]+2*bs, 2, bs, fdata[68]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 68, fdata[68]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 68, fdata[68]+3*bs, bs);
+	coupling_region_multiply(ffdata[71]+2*bs, 2, bs, fdata[69]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 69, fdata[69]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 69, fdata[69]+3*bs, bs);
+	coupling_region_multiply(ffdata[68]+3*bs, 2, bs, fdata[70]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 70, fdata[70]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 70, fdata[70]+3*bs, bs);
+	coupling_region_multiply(ffdata[69]+3*bs, 2, bs, fdata[71]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 71, fdata[71]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 71, fdata[71]+3*bs, bs);
+	coupling_region_multiply(ffdata[74]+2*bs, 2, bs, fdata[72]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 72, fdata[72]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 72, fdata[72]+3*bs, bs);
+	coupling_region_multiply(ffdata[75]+2*bs, 2, bs, fdata[73]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 73, fdata[73]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 73, fdata[73]+3*bs, bs);
+	coupling_region_multiply(ffdata[72]+3*bs, 2, bs, fdata[74]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 74, fdata[74]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 74, fdata[74]+3*bs, bs);
+	coupling_region_multiply(ffdata[73]+3*bs, 2, bs, fdata[75]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 75, fdata[75]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 75, fdata[75]+3*bs, bs);
+	coupling_region_multiply(ffdata[78]+2*bs, 2, bs, fdata[76]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 76, fdata[76]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 76, fdata[76]+3*bs, bs);
+	coupling_region_multiply(ffdata[79]+2*bs, 2, bs, fdata[77]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 77, fdata[77]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 77, fdata[77]+3*bs, bs);
+	coupling_region_multiply(ffdata[76]+3*bs, 2, bs, fdata[78]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 78, fdata[78]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 78, fdata[78]+3*bs, bs);
+	coupling_region_multiply(ffdata[77]+3*bs, 2, bs, fdata[79]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 79, fdata[79]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 79, fdata[79]+3*bs, bs);
+	coupling_region_multiply(ffdata[82]+2*bs, 2, bs, fdata[80]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 80, fdata[80]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 80, fdata[80]+3*bs, bs);
+	coupling_region_multiply(ffdata[83]+2*bs, 2, bs, fdata[81]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 81, fdata[81]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 81, fdata[81]+3*bs, bs);
+	coupling_region_multiply(ffdata[80]+3*bs, 2, bs, fdata[82]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 82, fdata[82]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 82, fdata[82]+3*bs, bs);
+	coupling_region_multiply(ffdata[81]+3*bs, 2, bs, fdata[83]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 83, fdata[83]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 83, fdata[83]+3*bs, bs);
+	coupling_region_multiply(ffdata[86]+2*bs, 2, bs, fdata[84]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 84, fdata[84]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 84, fdata[84]+3*bs, bs);
+	coupling_region_multiply(ffdata[87]+2*bs, 2, bs, fdata[85]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 85, fdata[85]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 85, fdata[85]+3*bs, bs);
+	coupling_region_multiply(ffdata[84]+3*bs, 2, bs, fdata[86]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 86, fdata[86]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 86, fdata[86]+3*bs, bs);
+	coupling_region_multiply(ffdata[85]+3*bs, 2, bs, fdata[87]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 87, fdata[87]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 87, fdata[87]+3*bs, bs);
+	coupling_region_multiply(ffdata[90]+2*bs, 2, bs, fdata[88]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 88, fdata[88]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 88, fdata[88]+3*bs, bs);
+	coupling_region_multiply(ffdata[91]+2*bs, 2, bs, fdata[89]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 89, fdata[89]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 89, fdata[89]+3*bs, bs);
+	coupling_region_multiply(ffdata[88]+3*bs, 2, bs, fdata[90]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 90, fdata[90]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 90, fdata[90]+3*bs, bs);
+	coupling_region_multiply(ffdata[89]+3*bs, 2, bs, fdata[91]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 91, fdata[91]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 91, fdata[91]+3*bs, bs);
+	coupling_region_multiply(ffdata[94]+2*bs, 2, bs, fdata[92]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 92, fdata[92]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 92, fdata[92]+3*bs, bs);
+	coupling_region_multiply(ffdata[95]+2*bs, 2, bs, fdata[93]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 93, fdata[93]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 93, fdata[93]+3*bs, bs);
+	coupling_region_multiply(ffdata[92]+3*bs, 2, bs, fdata[94]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 94, fdata[94]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 94, fdata[94]+3*bs, bs);
+	coupling_region_multiply(ffdata[93]+3*bs, 2, bs, fdata[95]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 95, fdata[95]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 95, fdata[95]+3*bs, bs);
+	coupling_region_multiply(ffdata[98]+2*bs, 2, bs, fdata[96]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 96, fdata[96]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 96, fdata[96]+3*bs, bs);
+	coupling_region_multiply(ffdata[99]+2*bs, 2, bs, fdata[97]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 97, fdata[97]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 97, fdata[97]+3*bs, bs);
+	coupling_region_multiply(ffdata[96]+3*bs, 2, bs, fdata[98]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 98, fdata[98]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 98, fdata[98]+3*bs, bs);
+	coupling_region_multiply(ffdata[97]+3*bs, 2, bs, fdata[99]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 99, fdata[99]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 99, fdata[99]+3*bs, bs);
+	coupling_region_multiply(ffdata[102]+2*bs, 2, bs, fdata[100]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 100, fdata[100]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 100, fdata[100]+3*bs, bs);
+	coupling_region_multiply(ffdata[103]+2*bs, 2, bs, fdata[101]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 101, fdata[101]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 101, fdata[101]+3*bs, bs);
+	coupling_region_multiply(ffdata[100]+3*bs, 2, bs, fdata[102]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 102, fdata[102]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 102, fdata[102]+3*bs, bs);
+	coupling_region_multiply(ffdata[101]+3*bs, 2, bs, fdata[103]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 103, fdata[103]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 103, fdata[103]+3*bs, bs);
+	coupling_region_multiply(ffdata[106]+2*bs, 2, bs, fdata[104]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 104, fdata[104]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 104, fdata[104]+3*bs, bs);
+	coupling_region_multiply(ffdata[107]+2*bs, 2, bs, fdata[105]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 105, fdata[105]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 105, fdata[105]+3*bs, bs);
+	coupling_region_multiply(ffdata[104]+3*bs, 2, bs, fdata[106]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 106, fdata[106]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 106, fdata[106]+3*bs, bs);
+	coupling_region_multiply(ffdata[105]+3*bs, 2, bs, fdata[107]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 107, fdata[107]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 107, fdata[107]+3*bs, bs);
+	coupling_region_multiply(ffdata[110]+2*bs, 2, bs, fdata[108]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 108, fdata[108]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 108, fdata[108]+3*bs, bs);
+	coupling_region_multiply(ffdata[111]+2*bs, 2, bs, fdata[109]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 109, fdata[109]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 109, fdata[109]+3*bs, bs);
+	coupling_region_multiply(ffdata[108]+3*bs, 2, bs, fdata[110]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 110, fdata[110]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 110, fdata[110]+3*bs, bs);
+	coupling_region_multiply(ffdata[109]+3*bs, 2, bs, fdata[111]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 111, fdata[111]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 111, fdata[111]+3*bs, bs);
+	coupling_region_multiply(ffdata[114]+2*bs, 2, bs, fdata[112]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 112, fdata[112]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 112, fdata[112]+3*bs, bs);
+	coupling_region_multiply(ffdata[115]+2*bs, 2, bs, fdata[113]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 113, fdata[113]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 113, fdata[113]+3*bs, bs);
+	coupling_region_multiply(ffdata[112]+3*bs, 2, bs, fdata[114]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 114, fdata[114]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 114, fdata[114]+3*bs, bs);
+	coupling_region_multiply(ffdata[113]+3*bs, 2, bs, fdata[115]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 115, fdata[115]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 115, fdata[115]+3*bs, bs);
+	coupling_region_multiply(ffdata[118]+2*bs, 2, bs, fdata[116]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 116, fdata[116]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 116, fdata[116]+3*bs, bs);
+	coupling_region_multiply(ffdata[119]+2*bs, 2, bs, fdata[117]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 117, fdata[117]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 117, fdata[117]+3*bs, bs);
+	coupling_region_multiply(ffdata[116]+3*bs, 2, bs, fdata[118]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 118, fdata[118]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 118, fdata[118]+3*bs, bs);
+	coupling_region_multiply(ffdata[117]+3*bs, 2, bs, fdata[119]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 119, fdata[119]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 119, fdata[119]+3*bs, bs);
+	coupling_region_multiply(ffdata[122]+2*bs, 2, bs, fdata[120]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 120, fdata[120]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 120, fdata[120]+3*bs, bs);
+	coupling_region_multiply(ffdata[123]+2*bs, 2, bs, fdata[121]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 121, fdata[121]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 121, fdata[121]+3*bs, bs);
+	coupling_region_multiply(ffdata[120]+3*bs, 2, bs, fdata[122]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 122, fdata[122]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 122, fdata[122]+3*bs, bs);
+	coupling_region_multiply(ffdata[121]+3*bs, 2, bs, fdata[123]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 123, fdata[123]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 123, fdata[123]+3*bs, bs);
+	coupling_region_multiply(ffdata[126]+2*bs, 2, bs, fdata[124]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 124, fdata[124]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 124, fdata[124]+3*bs, bs);
+	coupling_region_multiply(ffdata[127]+2*bs, 2, bs, fdata[125]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 125, fdata[125]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 125, fdata[125]+3*bs, bs);
+	coupling_region_multiply(ffdata[124]+3*bs, 2, bs, fdata[126]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 126, fdata[126]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 126, fdata[126]+3*bs, bs);
+	coupling_region_multiply(ffdata[125]+3*bs, 2, bs, fdata[127]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 2, 127, fdata[127]+2*bs, bs);
+	subchunk_crc(rcrc, 3, 127, fdata[127]+3*bs, bs);
+	coupling_region_multiply(ffdata[4]+4*bs, 2, bs, fdata[0]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 0, fdata[0]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 0, fdata[0]+5*bs, bs);
+	coupling_region_multiply(ffdata[5]+4*bs, 2, bs, fdata[1]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 1, fdata[1]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 1, fdata[1]+5*bs, bs);
+	coupling_region_multiply(ffdata[6]+4*bs, 2, bs, fdata[2]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 2, fdata[2]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 2, fdata[2]+5*bs, bs);
+	coupling_region_multiply(ffdata[7]+4*bs, 2, bs, fdata[3]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 3, fdata[3]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 3, fdata[3]+5*bs, bs);
+	coupling_region_multiply(ffdata[0]+5*bs, 2, bs, fdata[4]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 4, fdata[4]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 4, fdata[4]+5*bs, bs);
+	coupling_region_multiply(ffdata[1]+5*bs, 2, bs, fdata[5]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 5, fdata[5]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 5, fdata[5]+5*bs, bs);
+	coupling_region_multiply(ffdata[2]+5*bs, 2, bs, fdata[6]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 6, fdata[6]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 6, fdata[6]+5*bs, bs);
+	coupling_region_multiply(ffdata[3]+5*bs, 2, bs, fdata[7]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 7, fdata[7]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 7, fdata[7]+5*bs, bs);
+	coupling_region_multiply(ffdata[12]+4*bs, 2, bs, fdata[8]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 8, fdata[8]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 8, fdata[8]+5*bs, bs);
+	coupling_region_multiply(ffdata[13]+4*bs, 2, bs, fdata[9]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 9, fdata[9]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 9, fdata[9]+5*bs, bs);
+	coupling_region_multiply(ffdata[14]+4*bs, 2, bs, fdata[10]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 10, fdata[10]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 10, fdata[10]+5*bs, bs);
+	coupling_region_multiply(ffdata[15]+4*bs, 2, bs, fdata[11]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 11, fdata[11]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 11, fdata[11]+5*bs, bs);
+	coupling_region_multiply(ffdata[8]+5*bs, 2, bs, fdata[12]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 12, fdata[12]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 12, fdata[12]+5*bs, bs);
+	coupling_region_multiply(ffdata[9]+5*bs, 2, bs, fdata[13]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 13, fdata[13]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 13, fdata[13]+5*bs, bs);
+	coupling_region_multiply(ffdata[10]+5*bs, 2, bs, fdata[14]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 14, fdata[14]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 14, fdata[14]+5*bs, bs);
+	coupling_region_multiply(ffdata[11]+5*bs, 2, bs, fdata[15]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 15, fdata[15]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 15, fdata[15]+5*bs, bs);
+	coupling_region_multiply(ffdata[20]+4*bs, 2, bs, fdata[16]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 16, fdata[16]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 16, fdata[16]+5*bs, bs);
+	coupling_region_multiply(ffdata[21]+4*bs, 2, bs, fdata[17]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 17, fdata[17]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 17, fdata[17]+5*bs, bs);
+	coupling_region_multiply(ffdata[22]+4*bs, 2, bs, fdata[18]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 18, fdata[18]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 18, fdata[18]+5*bs, bs);
+	coupling_region_multiply(ffdata[23]+4*bs, 2, bs, fdata[19]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 19, fdata[19]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 19, fdata[19]+5*bs, bs);
+	coupling_region_multiply(ffdata[16]+5*bs, 2, bs, fdata[20]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 20, fdata[20]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 20, fdata[20]+5*bs, bs);
+	coupling_region_multiply(ffdata[17]+5*bs, 2, bs, fdata[21]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 21, fdata[21]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 21, fdata[21]+5*bs, bs);
+	coupling_region_multiply(ffdata[18]+5*bs, 2, bs, fdata[22]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 22, fdata[22]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 22, fdata[22]+5*bs, bs);
+	coupling_region_multiply(ffdata[19]+5*bs, 2, bs, fdata[23]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 23, fdata[23]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 23, fdata[23]+5*bs, bs);
+	coupling_region_multiply(ffdata[28]+4*bs, 2, bs, fdata[24]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 24, fdata[24]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 24, fdata[24]+5*bs, bs);
+	coupling_region_multiply(ffdata[29]+4*bs, 2, bs, fdata[25]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 25, fdata[25]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 25, fdata[25]+5*bs, bs);
+	coupling_region_multiply(ffdata[30]+4*bs, 2, bs, fdata[26]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 26, fdata[26]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 26, fdata[26]+5*bs, bs);
+	coupling_region_multiply(ffdata[31]+4*bs, 2, bs, fdata[27]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 27, fdata[27]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 27, fdata[27]+5*bs, bs);
+	coupling_region_multiply(ffdata[24]+5*bs, 2, bs, fdata[28]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 28, fdata[28]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 28, fdata[28]+5*bs, bs);
+	coupling_region_multiply(ffdata[25]+5*bs, 2, bs, fdata[29]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 29, fdata[29]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 29, fdata[29]+5*bs, bs);
+	coupling_region_multiply(ffdata[26]+5*bs, 2, bs, fdata[30]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 30, fdata[30]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 30, fdata[30]+5*bs, bs);
+	coupling_region_multiply(ffdata[27]+5*bs, 2, bs, fdata[31]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 31, fdata[31]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 31, fdata[31]+5*bs, bs);
+	coupling_region_multiply(ffdata[36]+4*bs, 2, bs, fdata[32]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 32, fdata[32]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 32, fdata[32]+5*bs, bs);
+	coupling_region_multiply(ffdata[37]+4*bs, 2, bs, fdata[33]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 33, fdata[33]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 33, fdata[33]+5*bs, bs);
+	coupling_region_multiply(ffdata[38]+4*bs, 2, bs, fdata[34]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 34, fdata[34]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 34, fdata[34]+5*bs, bs);
+	coupling_region_multiply(ffdata[39]+4*bs, 2, bs, fdata[35]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 35, fdata[35]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 35, fdata[35]+5*bs, bs);
+	coupling_region_multiply(ffdata[32]+5*bs, 2, bs, fdata[36]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 36, fdata[36]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 36, fdata[36]+5*bs, bs);
+	coupling_region_multiply(ffdata[33]+5*bs, 2, bs, fdata[37]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 37, fdata[37]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 37, fdata[37]+5*bs, bs);
+	coupling_region_multiply(ffdata[34]+5*bs, 2, bs, fdata[38]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 38, fdata[38]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 38, fdata[38]+5*bs, bs);
+	coupling_region_multiply(ffdata[35]+5*bs, 2, bs, fdata[39]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 39, fdata[39]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 39, fdata[39]+5*bs, bs);
+	coupling_region_multiply(ffdata[44]+4*bs, 2, bs, fdata[40]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 40, fdata[40]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 40, fdata[40]+5*bs, bs);
+	coupling_region_multiply(ffdata[45]+4*bs, 2, bs, fdata[41]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 41, fdata[41]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 41, fdata[41]+5*bs, bs);
+	coupling_region_multiply(ffdata[46]+4*bs, 2, bs, fdata[42]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 42, fdata[42]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 42, fdata[42]+5*bs, bs);
+	coupling_region_multiply(ffdata[47]+4*bs, 2, bs, fdata[43]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 43, fdata[43]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 43, fdata[43]+5*bs, bs);
+	coupling_region_multiply(ffdata[40]+5*bs, 2, bs, fdata[44]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 44, fdata[44]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 44, fdata[44]+5*bs, bs);
+	coupling_region_multiply(ffdata[41]+5*bs, 2, bs, fdata[45]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 45, fdata[45]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 45, fdata[45]+5*bs, bs);
+	coupling_region_multiply(ffdata[42]+5*bs, 2, bs, fdata[46]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 46, fdata[46]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 46, fdata[46]+5*bs, bs);
+	coupling_region_multiply(ffdata[43]+5*bs, 2, bs, fdata[47]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 47, fdata[47]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 47, fdata[47]+5*bs, bs);
+	coupling_region_multiply(ffdata[52]+4*bs, 2, bs, fdata[48]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 48, fdata[48]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 48, fdata[48]+5*bs, bs);
+	coupling_region_multiply(ffdata[53]+4*bs, 2, bs, fdata[49]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 49, fdata[49]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 49, fdata[49]+5*bs, bs);
+	coupling_region_multiply(ffdata[54]+4*bs, 2, bs, fdata[50]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 50, fdata[50]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 50, fdata[50]+5*bs, bs);
+	coupling_region_multiply(ffdata[55]+4*bs, 2, bs, fdata[51]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 51, fdata[51]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 51, fdata[51]+5*bs, bs);
+	coupling_region_multiply(ffdata[48]+5*bs, 2, bs, fdata[52]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 52, fdata[52]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 52, fdata[52]+5*bs, bs);
+	coupling_region_multiply(ffdata[49]+5*bs, 2, bs, fdata[53]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 53, fdata[53]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 53, fdata[53]+5*bs, bs);
+	coupling_region_multiply(ffdata[50]+5*bs, 2, bs, fdata[54]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 54, fdata[54]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 54, fdata[54]+5*bs, bs);
+	coupling_region_multiply(ffdata[51]+5*bs, 2, bs, fdata[55]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 55, fdata[55]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 55, fdata[55]+5*bs, bs);
+	coupling_region_multiply(ffdata[60]+4*bs, 2, bs, fdata[56]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 56, fdata[56]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 56, fdata[56]+5*bs, bs);
+	coupling_region_multiply(ffdata[61]+4*bs, 2, bs, fdata[57]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 57, fdata[57]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 57, fdata[57]+5*bs, bs);
+	coupling_region_multiply(ffdata[62]+4*bs, 2, bs, fdata[58]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 58, fdata[58]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 58, fdata[58]+5*bs, bs);
+	coupling_region_multiply(ffdata[63]+4*bs, 2, bs, fdata[59]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 59, fdata[59]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 59, fdata[59]+5*bs, bs);
+	coupling_region_multiply(ffdata[56]+5*bs, 2, bs, fdata[60]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 60, fdata[60]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 60, fdata[60]+5*bs, bs);
+	coupling_region_multiply(ffdata[57]+5*bs, 2, bs, fdata[61]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 61, fdata[61]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 61, fdata[61]+5*bs, bs);
+	coupling_region_multiply(ffdata[58]+5*bs, 2, bs, fdata[62]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 62, fdata[62]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 62, fdata[62]+5*bs, bs);
+	coupling_region_multiply(ffdata[59]+5*bs, 2, bs, fdata[63]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 63, fdata[63]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 63, fdata[63]+5*bs, bs);
+	coupling_region_multiply(ffdata[68]+4*bs, 2, bs, fdata[64]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 64, fdata[64]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 64, fdata[64]+5*bs, bs);
+	coupling_region_multiply(ffdata[69]+4*bs, 2, bs, fdata[65]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 65, fdata[65]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 65, fdata[65]+5*bs, bs);
+	coupling_region_multiply(ffdata[70]+4*bs, 2, bs, fdata[66]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 66, fdata[66]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 66, fdata[66]+5*bs, bs);
+	coupling_region_multiply(ffdata[71]+4*bs, 2, bs, fdata[67]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 67, fdata[67]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 67, fdata[67]+5*bs, bs);
+	coupling_region_multiply(ffdata[64]+5*bs, 2, bs, fdata[68]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 68, fdata[68]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 68, fdata[68]+5*bs, bs);
+	coupling_region_multiply(ffdata[65]+5*bs, 2, bs, fdata[69]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 69, fdata[69]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 69, fdata[69]+5*bs, bs);
+	coupling_region_multiply(ffdata[66]+5*bs, 2, bs, fdata[70]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 70, fdata[70]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 70, fdata[70]+5*bs, bs);
+	coupling_region_multiply(ffdata[67]+5*bs, 2, bs, fdata[71]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 71, fdata[71]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 71, fdata[71]+5*bs, bs);
+	coupling_region_multiply(ffdata[76]+4*bs, 2, bs, fdata[72]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 72, fdata[72]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 72, fdata[72]+5*bs, bs);
+	coupling_region_multiply(ffdata[77]+4*bs, 2, bs, fdata[73]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 73, fdata[73]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 73, fdata[73]+5*bs, bs);
+	coupling_region_multiply(ffdata[78]+4*bs, 2, bs, fdata[74]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 74, fdata[74]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 74, fdata[74]+5*bs, bs);
+	coupling_region_multiply(ffdata[79]+4*bs, 2, bs, fdata[75]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 75, fdata[75]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 75, fdata[75]+5*bs, bs);
+	coupling_region_multiply(ffdata[72]+5*bs, 2, bs, fdata[76]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 76, fdata[76]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 76, fdata[76]+5*bs, bs);
+	coupling_region_multiply(ffdata[73]+5*bs, 2, bs, fdata[77]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 77, fdata[77]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 77, fdata[77]+5*bs, bs);
+	coupling_region_multiply(ffdata[74]+5*bs, 2, bs, fdata[78]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 78, fdata[78]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 78, fdata[78]+5*bs, bs);
+	coupling_region_multiply(ffdata[75]+5*bs, 2, bs, fdata[79]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 79, fdata[79]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 79, fdata[79]+5*bs, bs);
+	coupling_region_multiply(ffdata[84]+4*bs, 2, bs, fdata[80]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 80, fdata[80]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 80, fdata[80]+5*bs, bs);
+	coupling_region_multiply(ffdata[85]+4*bs, 2, bs, fdata[81]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 81, fdata[81]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 81, fdata[81]+5*bs, bs);
+	coupling_region_multiply(ffdata[86]+4*bs, 2, bs, fdata[82]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 82, fdata[82]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 82, fdata[82]+5*bs, bs);
+	coupling_region_multiply(ffdata[87]+4*bs, 2, bs, fdata[83]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 83, fdata[83]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 83, fdata[83]+5*bs, bs);
+	coupling_region_multiply(ffdata[80]+5*bs, 2, bs, fdata[84]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 84, fdata[84]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 84, fdata[84]+5*bs, bs);
+	coupling_region_multiply(ffdata[81]+5*bs, 2, bs, fdata[85]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 85, fdata[85]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 85, fdata[85]+5*bs, bs);
+	coupling_region_multiply(ffdata[82]+5*bs, 2, bs, fdata[86]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 86, fdata[86]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 86, fdata[86]+5*bs, bs);
+	coupling_region_multiply(ffdata[83]+5*bs, 2, bs, fdata[87]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 87, fdata[87]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 87, fdata[87]+5*bs, bs);
+	coupling_region_multiply(ffdata[92]+4*bs, 2, bs, fdata[88]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 88, fdata[88]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 88, fdata[88]+5*bs, bs);
+	coupling_region_multiply(ffdata[93]+4*bs, 2, bs, fdata[89]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 89, fdata[89]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 89, fdata[89]+5*bs, bs);
+	coupling_region_multiply(ffdata[94]+4*bs, 2, bs, fdata[90]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 90, fdata[90]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 90, fdata[90]+5*bs, bs);
+	coupling_region_multiply(ffdata[95]+4*bs, 2, bs, fdata[91]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 91, fdata[91]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 91, fdata[91]+5*bs, bs);
+	coupling_region_multiply(ffdata[88]+5*bs, 2, bs, fdata[92]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 92, fdata[92]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 92, fdata[92]+5*bs, bs);
+	coupling_region_multiply(ffdata[89]+5*bs, 2, bs, fdata[93]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 93, fdata[93]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 93, fdata[93]+5*bs, bs);
+	coupling_region_multiply(ffdata[90]+5*bs, 2, bs, fdata[94]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 94, fdata[94]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 94, fdata[94]+5*bs, bs);
+	coupling_region_multiply(ffdata[91]+5*bs, 2, bs, fdata[95]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 95, fdata[95]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 95, fdata[95]+5*bs, bs);
+	coupling_region_multiply(ffdata[100]+4*bs, 2, bs, fdata[96]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 96, fdata[96]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 96, fdata[96]+5*bs, bs);
+	coupling_region_multiply(ffdata[101]+4*bs, 2, bs, fdata[97]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 97, fdata[97]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 97, fdata[97]+5*bs, bs);
+	coupling_region_multiply(ffdata[102]+4*bs, 2, bs, fdata[98]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 98, fdata[98]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 98, fdata[98]+5*bs, bs);
+	coupling_region_multiply(ffdata[103]+4*bs, 2, bs, fdata[99]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 99, fdata[99]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 99, fdata[99]+5*bs, bs);
+	coupling_region_multiply(ffdata[96]+5*bs, 2, bs, fdata[100]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 100, fdata[100]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 100, fdata[100]+5*bs, bs);
+	coupling_region_multiply(ffdata[97]+5*bs, 2, bs, fdata[101]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 101, fdata[101]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 101, fdata[101]+5*bs, bs);
+	coupling_region_multiply(ffdata[98]+5*bs, 2, bs, fdata[102]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 102, fdata[102]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 102, fdata[102]+5*bs, bs);
+	coupling_region_multiply(ffdata[99]+5*bs, 2, bs, fdata[103]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 103, fdata[103]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 103, fdata[103]+5*bs, bs);
+	coupling_region_multiply(ffdata[108]+4*bs, 2, bs, fdata[104]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 104, fdata[104]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 104, fdata[104]+5*bs, bs);
+	coupling_region_multiply(ffdata[109]+4*bs, 2, bs, fdata[105]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 105, fdata[105]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 105, fdata[105]+5*bs, bs);
+	coupling_region_multiply(ffdata[110]+4*bs, 2, bs, fdata[106]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 106, fdata[106]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 106, fdata[106]+5*bs, bs);
+	coupling_region_multiply(ffdata[111]+4*bs, 2, bs, fdata[107]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 107, fdata[107]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 107, fdata[107]+5*bs, bs);
+	coupling_region_multiply(ffdata[104]+5*bs, 2, bs, fdata[108]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 108, fdata[108]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 108, fdata[108]+5*bs, bs);
+	coupling_region_multiply(ffdata[105]+5*bs, 2, bs, fdata[109]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 109, fdata[109]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 109, fdata[109]+5*bs, bs);
+	coupling_region_multiply(ffdata[106]+5*bs, 2, bs, fdata[110]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 110, fdata[110]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 110, fdata[110]+5*bs, bs);
+	coupling_region_multiply(ffdata[107]+5*bs, 2, bs, fdata[111]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 111, fdata[111]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 111, fdata[111]+5*bs, bs);
+	coupling_region_multiply(ffdata[116]+4*bs, 2, bs, fdata[112]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 112, fdata[112]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 112, fdata[112]+5*bs, bs);
+	coupling_region_multiply(ffdata[117]+4*bs, 2, bs, fdata[113]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 113, fdata[113]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 113, fdata[113]+5*bs, bs);
+	coupling_region_multiply(ffdata[118]+4*bs, 2, bs, fdata[114]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 114, fdata[114]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 114, fdata[114]+5*bs, bs);
+	coupling_region_multiply(ffdata[119]+4*bs, 2, bs, fdata[115]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 115, fdata[115]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 115, fdata[115]+5*bs, bs);
+	coupling_region_multiply(ffdata[112]+5*bs, 2, bs, fdata[116]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 116, fdata[116]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 116, fdata[116]+5*bs, bs);
+	coupling_region_multiply(ffdata[113]+5*bs, 2, bs, fdata[117]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 117, fdata[117]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 117, fdata[117]+5*bs, bs);
+	coupling_region_multiply(ffdata[114]+5*bs, 2, bs, fdata[118]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 118, fdata[118]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 118, fdata[118]+5*bs, bs);
+	coupling_region_multiply(ffdata[115]+5*bs, 2, bs, fdata[119]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 119, fdata[119]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 119, fdata[119]+5*bs, bs);
+	coupling_region_multiply(ffdata[124]+4*bs, 2, bs, fdata[120]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 120, fdata[120]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 120, fdata[120]+5*bs, bs);
+	coupling_region_multiply(ffdata[125]+4*bs, 2, bs, fdata[121]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 121, fdata[121]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 121, fdata[121]+5*bs, bs);
+	coupling_region_multiply(ffdata[126]+4*bs, 2, bs, fdata[122]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 122, fdata[122]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 122, fdata[122]+5*bs, bs);
+	coupling_region_multiply(ffdata[127]+4*bs, 2, bs, fdata[123]+5*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 123, fdata[123]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 123, fdata[123]+5*bs, bs);
+	coupling_region_multiply(ffdata[120]+5*bs, 2, bs, fdata[124]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 124, fdata[124]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 124, fdata[124]+5*bs, bs);
+	coupling_region_multiply(ffdata[121]+5*bs, 2, bs, fdata[125]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 125, fdata[125]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 125, fdata[125]+5*bs, bs);
+	coupling_region_multiply(ffdata[122]+5*bs, 2, bs, fdata[126]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 126, fdata[126]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 126, fdata[126]+5*bs, bs);
+	coupling_region_multiply(ffdata[123]+5*bs, 2, bs, fdata[127]+4*bs, 1, cw);
+	subchunk_crc(rcrc, 4, 127, fdata[127]+4*bs, bs);
+	subchunk_crc(rcrc, 5, 127, fdata[127]+5*bs, bs);
+	coupling_region_multiply(ffdata[8]+6*bs, 2, bs, fdata[0]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 0, fdata[0]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 0, fdata[0]+7*bs, bs);
+	coupling_region_multiply(ffdata[9]+6*bs, 2, bs, fdata[1]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 1, fdata[1]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 1, fdata[1]+7*bs, bs);
+	coupling_region_multiply(ffdata[10]+6*bs, 2, bs, fdata[2]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 2, fdata[2]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 2, fdata[2]+7*bs, bs);
+	coupling_region_multiply(ffdata[11]+6*bs, 2, bs, fdata[3]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 3, fdata[3]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 3, fdata[3]+7*bs, bs);
+	coupling_region_multiply(ffdata[12]+6*bs, 2, bs, fdata[4]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 4, fdata[4]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 4, fdata[4]+7*bs, bs);
+	coupling_region_multiply(ffdata[13]+6*bs, 2, bs, fdata[5]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 5, fdata[5]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 5, fdata[5]+7*bs, bs);
+	coupling_region_multiply(ffdata[14]+6*bs, 2, bs, fdata[6]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 6, fdata[6]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 6, fdata[6]+7*bs, bs);
+	coupling_region_multiply(ffdata[15]+6*bs, 2, bs, fdata[7]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 7, fdata[7]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 7, fdata[7]+7*bs, bs);
+	coupling_region_multiply(ffdata[0]+7*bs, 2, bs, fdata[8]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 8, fdata[8]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 8, fdata[8]+7*bs, bs);
+	coupling_region_multiply(ffdata[1]+7*bs, 2, bs, fdata[9]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 9, fdata[9]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 9, fdata[9]+7*bs, bs);
+	coupling_region_multiply(ffdata[2]+7*bs, 2, bs, fdata[10]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 10, fdata[10]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 10, fdata[10]+7*bs, bs);
+	coupling_region_multiply(ffdata[3]+7*bs, 2, bs, fdata[11]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 11, fdata[11]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 11, fdata[11]+7*bs, bs);
+	coupling_region_multiply(ffdata[4]+7*bs, 2, bs, fdata[12]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 12, fdata[12]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 12, fdata[12]+7*bs, bs);
+	coupling_region_multiply(ffdata[5]+7*bs, 2, bs, fdata[13]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 13, fdata[13]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 13, fdata[13]+7*bs, bs);
+	coupling_region_multiply(ffdata[6]+7*bs, 2, bs, fdata[14]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 14, fdata[14]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 14, fdata[14]+7*bs, bs);
+	coupling_region_multiply(ffdata[7]+7*bs, 2, bs, fdata[15]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 15, fdata[15]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 15, fdata[15]+7*bs, bs);
+	coupling_region_multiply(ffdata[24]+6*bs, 2, bs, fdata[16]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 16, fdata[16]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 16, fdata[16]+7*bs, bs);
+	coupling_region_multiply(ffdata[25]+6*bs, 2, bs, fdata[17]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 17, fdata[17]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 17, fdata[17]+7*bs, bs);
+	coupling_region_multiply(ffdata[26]+6*bs, 2, bs, fdata[18]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 18, fdata[18]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 18, fdata[18]+7*bs, bs);
+	coupling_region_multiply(ffdata[27]+6*bs, 2, bs, fdata[19]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 19, fdata[19]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 19, fdata[19]+7*bs, bs);
+	coupling_region_multiply(ffdata[28]+6*bs, 2, bs, fdata[20]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 20, fdata[20]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 20, fdata[20]+7*bs, bs);
+	coupling_region_multiply(ffdata[29]+6*bs, 2, bs, fdata[21]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 21, fdata[21]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 21, fdata[21]+7*bs, bs);
+	coupling_region_multiply(ffdata[30]+6*bs, 2, bs, fdata[22]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 22, fdata[22]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 22, fdata[22]+7*bs, bs);
+	coupling_region_multiply(ffdata[31]+6*bs, 2, bs, fdata[23]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 23, fdata[23]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 23, fdata[23]+7*bs, bs);
+	coupling_region_multiply(ffdata[16]+7*bs, 2, bs, fdata[24]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 24, fdata[24]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 24, fdata[24]+7*bs, bs);
+	coupling_region_multiply(ffdata[17]+7*bs, 2, bs, fdata[25]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 25, fdata[25]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 25, fdata[25]+7*bs, bs);
+	coupling_region_multiply(ffdata[18]+7*bs, 2, bs, fdata[26]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 26, fdata[26]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 26, fdata[26]+7*bs, bs);
+	coupling_region_multiply(ffdata[19]+7*bs, 2, bs, fdata[27]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 27, fdata[27]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 27, fdata[27]+7*bs, bs);
+	coupling_region_multiply(ffdata[20]+7*bs, 2, bs, fdata[28]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 28, fdata[28]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 28, fdata[28]+7*bs, bs);
+	coupling_region_multiply(ffdata[21]+7*bs, 2, bs, fdata[29]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 29, fdata[29]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 29, fdata[29]+7*bs, bs);
+	coupling_region_multiply(ffdata[22]+7*bs, 2, bs, fdata[30]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 30, fdata[30]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 30, fdata[30]+7*bs, bs);
+	coupling_region_multiply(ffdata[23]+7*bs, 2, bs, fdata[31]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 31, fdata[31]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 31, fdata[31]+7*bs, bs);
+	coupling_region_multiply(ffdata[40]+6*bs, 2, bs, fdata[32]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 32, fdata[32]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 32, fdata[32]+7*bs, bs);
+	coupling_region_multiply(ffdata[41]+6*bs, 2, bs, fdata[33]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 33, fdata[33]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 33, fdata[33]+7*bs, bs);
+	coupling_region_multiply(ffdata[42]+6*bs, 2, bs, fdata[34]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 34, fdata[34]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 34, fdata[34]+7*bs, bs);
+	coupling_region_multiply(ffdata[43]+6*bs, 2, bs, fdata[35]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 35, fdata[35]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 35, fdata[35]+7*bs, bs);
+	coupling_region_multiply(ffdata[44]+6*bs, 2, bs, fdata[36]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 36, fdata[36]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 36, fdata[36]+7*bs, bs);
+	coupling_region_multiply(ffdata[45]+6*bs, 2, bs, fdata[37]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 37, fdata[37]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 37, fdata[37]+7*bs, bs);
+	coupling_region_multiply(ffdata[46]+6*bs, 2, bs, fdata[38]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 38, fdata[38]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 38, fdata[38]+7*bs, bs);
+	coupling_region_multiply(ffdata[47]+6*bs, 2, bs, fdata[39]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 39, fdata[39]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 39, fdata[39]+7*bs, bs);
+	coupling_region_multiply(ffdata[32]+7*bs, 2, bs, fdata[40]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 40, fdata[40]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 40, fdata[40]+7*bs, bs);
+	coupling_region_multiply(ffdata[33]+7*bs, 2, bs, fdata[41]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 41, fdata[41]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 41, fdata[41]+7*bs, bs);
+	coupling_region_multiply(ffdata[34]+7*bs, 2, bs, fdata[42]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 42, fdata[42]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 42, fdata[42]+7*bs, bs);
+	coupling_region_multiply(ffdata[35]+7*bs, 2, bs, fdata[43]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 43, fdata[43]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 43, fdata[43]+7*bs, bs);
+	coupling_region_multiply(ffdata[36]+7*bs, 2, bs, fdata[44]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 44, fdata[44]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 44, fdata[44]+7*bs, bs);
+	coupling_region_multiply(ffdata[37]+7*bs, 2, bs, fdata[45]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 45, fdata[45]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 45, fdata[45]+7*bs, bs);
+	coupling_region_multiply(ffdata[38]+7*bs, 2, bs, fdata[46]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 46, fdata[46]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 46, fdata[46]+7*bs, bs);
+	coupling_region_multiply(ffdata[39]+7*bs, 2, bs, fdata[47]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 47, fdata[47]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 47, fdata[47]+7*bs, bs);
+	coupling_region_multiply(ffdata[56]+6*bs, 2, bs, fdata[48]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 48, fdata[48]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 48, fdata[48]+7*bs, bs);
+	coupling_region_multiply(ffdata[57]+6*bs, 2, bs, fdata[49]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 49, fdata[49]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 49, fdata[49]+7*bs, bs);
+	coupling_region_multiply(ffdata[58]+6*bs, 2, bs, fdata[50]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 50, fdata[50]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 50, fdata[50]+7*bs, bs);
+	coupling_region_multiply(ffdata[59]+6*bs, 2, bs, fdata[51]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 51, fdata[51]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 51, fdata[51]+7*bs, bs);
+	coupling_region_multiply(ffdata[60]+6*bs, 2, bs, fdata[52]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 52, fdata[52]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 52, fdata[52]+7*bs, bs);
+	coupling_region_multiply(ffdata[61]+6*bs, 2, bs, fdata[53]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 53, fdata[53]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 53, fdata[53]+7*bs, bs);
+	coupling_region_multiply(ffdata[62]+6*bs, 2, bs, fdata[54]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 54, fdata[54]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 54, fdata[54]+7*bs, bs);
+	coupling_region_multiply(ffdata[63]+6*bs, 2, bs, fdata[55]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 55, fdata[55]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 55, fdata[55]+7*bs, bs);
+	coupling_region_multiply(ffdata[48]+7*bs, 2, bs, fdata[56]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 56, fdata[56]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 56, fdata[56]+7*bs, bs);
+	coupling_region_multiply(ffdata[49]+7*bs, 2, bs, fdata[57]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 57, fdata[57]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 57, fdata[57]+7*bs, bs);
+	coupling_region_multiply(ffdata[50]+7*bs, 2, bs, fdata[58]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 58, fdata[58]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 58, fdata[58]+7*bs, bs);
+	coupling_region_multiply(ffdata[51]+7*bs, 2, bs, fdata[59]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 59, fdata[59]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 59, fdata[59]+7*bs, bs);
+	coupling_region_multiply(ffdata[52]+7*bs, 2, bs, fdata[60]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 60, fdata[60]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 60, fdata[60]+7*bs, bs);
+	coupling_region_multiply(ffdata[53]+7*bs, 2, bs, fdata[61]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 61, fdata[61]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 61, fdata[61]+7*bs, bs);
+	coupling_region_multiply(ffdata[54]+7*bs, 2, bs, fdata[62]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 62, fdata[62]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 62, fdata[62]+7*bs, bs);
+	coupling_region_multiply(ffdata[55]+7*bs, 2, bs, fdata[63]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 63, fdata[63]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 63, fdata[63]+7*bs, bs);
+	coupling_region_multiply(ffdata[72]+6*bs, 2, bs, fdata[64]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 64, fdata[64]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 64, fdata[64]+7*bs, bs);
+	coupling_region_multiply(ffdata[73]+6*bs, 2, bs, fdata[65]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 65, fdata[65]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 65, fdata[65]+7*bs, bs);
+	coupling_region_multiply(ffdata[74]+6*bs, 2, bs, fdata[66]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 66, fdata[66]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 66, fdata[66]+7*bs, bs);
+	coupling_region_multiply(ffdata[75]+6*bs, 2, bs, fdata[67]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 67, fdata[67]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 67, fdata[67]+7*bs, bs);
+	coupling_region_multiply(ffdata[76]+6*bs, 2, bs, fdata[68]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 68, fdata[68]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 68, fdata[68]+7*bs, bs);
+	coupling_region_multiply(ffdata[77]+6*bs, 2, bs, fdata[69]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 69, fdata[69]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 69, fdata[69]+7*bs, bs);
+	coupling_region_multiply(ffdata[78]+6*bs, 2, bs, fdata[70]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 70, fdata[70]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 70, fdata[70]+7*bs, bs);
+	coupling_region_multiply(ffdata[79]+6*bs, 2, bs, fdata[71]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 71, fdata[71]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 71, fdata[71]+7*bs, bs);
+	coupling_region_multiply(ffdata[64]+7*bs, 2, bs, fdata[72]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 72, fdata[72]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 72, fdata[72]+7*bs, bs);
+	coupling_region_multiply(ffdata[65]+7*bs, 2, bs, fdata[73]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 73, fdata[73]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 73, fdata[73]+7*bs, bs);
+	coupling_region_multiply(ffdata[66]+7*bs, 2, bs, fdata[74]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 74, fdata[74]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 74, fdata[74]+7*bs, bs);
+	coupling_region_multiply(ffdata[67]+7*bs, 2, bs, fdata[75]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 75, fdata[75]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 75, fdata[75]+7*bs, bs);
+	coupling_region_multiply(ffdata[68]+7*bs, 2, bs, fdata[76]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 76, fdata[76]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 76, fdata[76]+7*bs, bs);
+	coupling_region_multiply(ffdata[69]+7*bs, 2, bs, fdata[77]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 77, fdata[77]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 77, fdata[77]+7*bs, bs);
+	coupling_region_multiply(ffdata[70]+7*bs, 2, bs, fdata[78]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 78, fdata[78]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 78, fdata[78]+7*bs, bs);
+	coupling_region_multiply(ffdata[71]+7*bs, 2, bs, fdata[79]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 79, fdata[79]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 79, fdata[79]+7*bs, bs);
+	coupling_region_multiply(ffdata[88]+6*bs, 2, bs, fdata[80]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 80, fdata[80]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 80, fdata[80]+7*bs, bs);
+	coupling_region_multiply(ffdata[89]+6*bs, 2, bs, fdata[81]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 81, fdata[81]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 81, fdata[81]+7*bs, bs);
+	coupling_region_multiply(ffdata[90]+6*bs, 2, bs, fdata[82]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 82, fdata[82]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 82, fdata[82]+7*bs, bs);
+	coupling_region_multiply(ffdata[91]+6*bs, 2, bs, fdata[83]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 83, fdata[83]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 83, fdata[83]+7*bs, bs);
+	coupling_region_multiply(ffdata[92]+6*bs, 2, bs, fdata[84]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 84, fdata[84]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 84, fdata[84]+7*bs, bs);
+	coupling_region_multiply(ffdata[93]+6*bs, 2, bs, fdata[85]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 85, fdata[85]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 85, fdata[85]+7*bs, bs);
+	coupling_region_multiply(ffdata[94]+6*bs, 2, bs, fdata[86]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 86, fdata[86]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 86, fdata[86]+7*bs, bs);
+	coupling_region_multiply(ffdata[95]+6*bs, 2, bs, fdata[87]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 87, fdata[87]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 87, fdata[87]+7*bs, bs);
+	coupling_region_multiply(ffdata[80]+7*bs, 2, bs, fdata[88]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 88, fdata[88]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 88, fdata[88]+7*bs, bs);
+	coupling_region_multiply(ffdata[81]+7*bs, 2, bs, fdata[89]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 89, fdata[89]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 89, fdata[89]+7*bs, bs);
+	coupling_region_multiply(ffdata[82]+7*bs, 2, bs, fdata[90]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 90, fdata[90]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 90, fdata[90]+7*bs, bs);
+	coupling_region_multiply(ffdata[83]+7*bs, 2, bs, fdata[91]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 91, fdata[91]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 91, fdata[91]+7*bs, bs);
+	coupling_region_multiply(ffdata[84]+7*bs, 2, bs, fdata[92]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 92, fdata[92]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 92, fdata[92]+7*bs, bs);
+	coupling_region_multiply(ffdata[85]+7*bs, 2, bs, fdata[93]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 93, fdata[93]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 93, fdata[93]+7*bs, bs);
+	coupling_region_multiply(ffdata[86]+7*bs, 2, bs, fdata[94]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 94, fdata[94]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 94, fdata[94]+7*bs, bs);
+	coupling_region_multiply(ffdata[87]+7*bs, 2, bs, fdata[95]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 95, fdata[95]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 95, fdata[95]+7*bs, bs);
+	coupling_region_multiply(ffdata[104]+6*bs, 2, bs, fdata[96]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 96, fdata[96]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 96, fdata[96]+7*bs, bs);
+	coupling_region_multiply(ffdata[105]+6*bs, 2, bs, fdata[97]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 97, fdata[97]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 97, fdata[97]+7*bs, bs);
+	coupling_region_multiply(ffdata[106]+6*bs, 2, bs, fdata[98]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 98, fdata[98]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 98, fdata[98]+7*bs, bs);
+	coupling_region_multiply(ffdata[107]+6*bs, 2, bs, fdata[99]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 99, fdata[99]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 99, fdata[99]+7*bs, bs);
+	coupling_region_multiply(ffdata[108]+6*bs, 2, bs, fdata[100]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 100, fdata[100]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 100, fdata[100]+7*bs, bs);
+	coupling_region_multiply(ffdata[109]+6*bs, 2, bs, fdata[101]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 101, fdata[101]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 101, fdata[101]+7*bs, bs);
+	coupling_region_multiply(ffdata[110]+6*bs, 2, bs, fdata[102]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 102, fdata[102]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 102, fdata[102]+7*bs, bs);
+	coupling_region_multiply(ffdata[111]+6*bs, 2, bs, fdata[103]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 103, fdata[103]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 103, fdata[103]+7*bs, bs);
+	coupling_region_multiply(ffdata[96]+7*bs, 2, bs, fdata[104]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 104, fdata[104]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 104, fdata[104]+7*bs, bs);
+	coupling_region_multiply(ffdata[97]+7*bs, 2, bs, fdata[105]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 105, fdata[105]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 105, fdata[105]+7*bs, bs);
+	coupling_region_multiply(ffdata[98]+7*bs, 2, bs, fdata[106]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 106, fdata[106]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 106, fdata[106]+7*bs, bs);
+	coupling_region_multiply(ffdata[99]+7*bs, 2, bs, fdata[107]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 107, fdata[107]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 107, fdata[107]+7*bs, bs);
+	coupling_region_multiply(ffdata[100]+7*bs, 2, bs, fdata[108]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 108, fdata[108]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 108, fdata[108]+7*bs, bs);
+	coupling_region_multiply(ffdata[101]+7*bs, 2, bs, fdata[109]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 109, fdata[109]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 109, fdata[109]+7*bs, bs);
+	coupling_region_multiply(ffdata[102]+7*bs, 2, bs, fdata[110]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 110, fdata[110]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 110, fdata[110]+7*bs, bs);
+	coupling_region_multiply(ffdata[103]+7*bs, 2, bs, fdata[111]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 111, fdata[111]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 111, fdata[111]+7*bs, bs);
+	coupling_region_multiply(ffdata[120]+6*bs, 2, bs, fdata[112]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 112, fdata[112]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 112, fdata[112]+7*bs, bs);
+	coupling_region_multiply(ffdata[121]+6*bs, 2, bs, fdata[113]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 113, fdata[113]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 113, fdata[113]+7*bs, bs);
+	coupling_region_multiply(ffdata[122]+6*bs, 2, bs, fdata[114]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 114, fdata[114]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 114, fdata[114]+7*bs, bs);
+	coupling_region_multiply(ffdata[123]+6*bs, 2, bs, fdata[115]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 115, fdata[115]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 115, fdata[115]+7*bs, bs);
+	coupling_region_multiply(ffdata[124]+6*bs, 2, bs, fdata[116]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 116, fdata[116]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 116, fdata[116]+7*bs, bs);
+	coupling_region_multiply(ffdata[125]+6*bs, 2, bs, fdata[117]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 117, fdata[117]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 117, fdata[117]+7*bs, bs);
+	coupling_region_multiply(ffdata[126]+6*bs, 2, bs, fdata[118]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 118, fdata[118]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 118, fdata[118]+7*bs, bs);
+	coupling_region_multiply(ffdata[127]+6*bs, 2, bs, fdata[119]+7*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 119, fdata[119]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 119, fdata[119]+7*bs, bs);
+	coupling_region_multiply(ffdata[112]+7*bs, 2, bs, fdata[120]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 120, fdata[120]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 120, fdata[120]+7*bs, bs);
+	coupling_region_multiply(ffdata[113]+7*bs, 2, bs, fdata[121]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 121, fdata[121]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 121, fdata[121]+7*bs, bs);
+	coupling_region_multiply(ffdata[114]+7*bs, 2, bs, fdata[122]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 122, fdata[122]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 122, fdata[122]+7*bs, bs);
+	coupling_region_multiply(ffdata[115]+7*bs, 2, bs, fdata[123]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 123, fdata[123]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 123, fdata[123]+7*bs, bs);
+	coupling_region_multiply(ffdata[116]+7*bs, 2, bs, fdata[124]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 124, fdata[124]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 124, fdata[124]+7*bs, bs);
+	coupling_region_multiply(ffdata[117]+7*bs, 2, bs, fdata[125]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 125, fdata[125]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 125, fdata[125]+7*bs, bs);
+	coupling_region_multiply(ffdata[118]+7*bs, 2, bs, fdata[126]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 126, fdata[126]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 126, fdata[126]+7*bs, bs);
+	coupling_region_multiply(ffdata[119]+7*bs, 2, bs, fdata[127]+6*bs, 1, cw);
+	subchunk_crc(rcrc, 6, 127, fdata[127]+6*bs, bs);
+	subchunk_crc(rcrc, 7, 127, fdata[127]+7*bs, bs);
+	coupling_region_multiply(ffdata[16]+8*bs, 2, bs, fdata[0]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 0, fdata[0]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 0, fdata[0]+9*bs, bs);
+	coupling_region_multiply(ffdata[17]+8*bs, 2, bs, fdata[1]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 1, fdata[1]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 1, fdata[1]+9*bs, bs);
+	coupling_region_multiply(ffdata[18]+8*bs, 2, bs, fdata[2]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 2, fdata[2]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 2, fdata[2]+9*bs, bs);
+	coupling_region_multiply(ffdata[19]+8*bs, 2, bs, fdata[3]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 3, fdata[3]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 3, fdata[3]+9*bs, bs);
+	coupling_region_multiply(ffdata[20]+8*bs, 2, bs, fdata[4]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 4, fdata[4]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 4, fdata[4]+9*bs, bs);
+	coupling_region_multiply(ffdata[21]+8*bs, 2, bs, fdata[5]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 5, fdata[5]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 5, fdata[5]+9*bs, bs);
+	coupling_region_multiply(ffdata[22]+8*bs, 2, bs, fdata[6]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 6, fdata[6]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 6, fdata[6]+9*bs, bs);
+	coupling_region_multiply(ffdata[23]+8*bs, 2, bs, fdata[7]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 7, fdata[7]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 7, fdata[7]+9*bs, bs);
+	coupling_region_multiply(ffdata[24]+8*bs, 2, bs, fdata[8]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 8, fdata[8]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 8, fdata[8]+9*bs, bs);
+	coupling_region_multiply(ffdata[25]+8*bs, 2, bs, fdata[9]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 9, fdata[9]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 9, fdata[9]+9*bs, bs);
+	coupling_region_multiply(ffdata[26]+8*bs, 2, bs, fdata[10]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 10, fdata[10]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 10, fdata[10]+9*bs, bs);
+	coupling_region_multiply(ffdata[27]+8*bs, 2, bs, fdata[11]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 11, fdata[11]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 11, fdata[11]+9*bs, bs);
+	coupling_region_multiply(ffdata[28]+8*bs, 2, bs, fdata[12]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 12, fdata[12]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 12, fdata[12]+9*bs, bs);
+	coupling_region_multiply(ffdata[29]+8*bs, 2, bs, fdata[13]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 13, fdata[13]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 13, fdata[13]+9*bs, bs);
+	coupling_region_multiply(ffdata[30]+8*bs, 2, bs, fdata[14]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 14, fdata[14]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 14, fdata[14]+9*bs, bs);
+	coupling_region_multiply(ffdata[31]+8*bs, 2, bs, fdata[15]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 15, fdata[15]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 15, fdata[15]+9*bs, bs);
+	coupling_region_multiply(ffdata[0]+9*bs, 2, bs, fdata[16]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 16, fdata[16]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 16, fdata[16]+9*bs, bs);
+	coupling_region_multiply(ffdata[1]+9*bs, 2, bs, fdata[17]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 17, fdata[17]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 17, fdata[17]+9*bs, bs);
+	coupling_region_multiply(ffdata[2]+9*bs, 2, bs, fdata[18]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 18, fdata[18]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 18, fdata[18]+9*bs, bs);
+	coupling_region_multiply(ffdata[3]+9*bs, 2, bs, fdata[19]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 19, fdata[19]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 19, fdata[19]+9*bs, bs);
+	coupling_region_multiply(ffdata[4]+9*bs, 2, bs, fdata[20]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 20, fdata[20]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 20, fdata[20]+9*bs, bs);
+	coupling_region_multiply(ffdata[5]+9*bs, 2, bs, fdata[21]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 21, fdata[21]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 21, fdata[21]+9*bs, bs);
+	coupling_region_multiply(ffdata[6]+9*bs, 2, bs, fdata[22]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 22, fdata[22]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 22, fdata[22]+9*bs, bs);
+	coupling_region_multiply(ffdata[7]+9*bs, 2, bs, fdata[23]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 23, fdata[23]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 23, fdata[23]+9*bs, bs);
+	coupling_region_multiply(ffdata[8]+9*bs, 2, bs, fdata[24]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 24, fdata[24]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 24, fdata[24]+9*bs, bs);
+	coupling_region_multiply(ffdata[9]+9*bs, 2, bs, fdata[25]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 25, fdata[25]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 25, fdata[25]+9*bs, bs);
+	coupling_region_multiply(ffdata[10]+9*bs, 2, bs, fdata[26]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 26, fdata[26]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 26, fdata[26]+9*bs, bs);
+	coupling_region_multiply(ffdata[11]+9*bs, 2, bs, fdata[27]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 27, fdata[27]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 27, fdata[27]+9*bs, bs);
+	coupling_region_multiply(ffdata[12]+9*bs, 2, bs, fdata[28]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 28, fdata[28]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 28, fdata[28]+9*bs, bs);
+	coupling_region_multiply(ffdata[13]+9*bs, 2, bs, fdata[29]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 29, fdata[29]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 29, fdata[29]+9*bs, bs);
+	coupling_region_multiply(ffdata[14]+9*bs, 2, bs, fdata[30]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 30, fdata[30]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 30, fdata[30]+9*bs, bs);
+	coupling_region_multiply(ffdata[15]+9*bs, 2, bs, fdata[31]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 31, fdata[31]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 31, fdata[31]+9*bs, bs);
+	coupling_region_multiply(ffdata[48]+8*bs, 2, bs, fdata[32]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 32, fdata[32]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 32, fdata[32]+9*bs, bs);
+	coupling_region_multiply(ffdata[49]+8*bs, 2, bs, fdata[33]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 33, fdata[33]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 33, fdata[33]+9*bs, bs);
+	coupling_region_multiply(ffdata[50]+8*bs, 2, bs, fdata[34]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 34, fdata[34]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 34, fdata[34]+9*bs, bs);
+	coupling_region_multiply(ffdata[51]+8*bs, 2, bs, fdata[35]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 35, fdata[35]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 35, fdata[35]+9*bs, bs);
+	coupling_region_multiply(ffdata[52]+8*bs, 2, bs, fdata[36]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 36, fdata[36]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 36, fdata[36]+9*bs, bs);
+	coupling_region_multiply(ffdata[53]+8*bs, 2, bs, fdata[37]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 37, fdata[37]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 37, fdata[37]+9*bs, bs);
+	coupling_region_multiply(ffdata[54]+8*bs, 2, bs, fdata[38]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 38, fdata[38]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 38, fdata[38]+9*bs, bs);
+	coupling_region_multiply(ffdata[55]+8*bs, 2, bs, fdata[39]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 39, fdata[39]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 39, fdata[39]+9*bs, bs);
+	coupling_region_multiply(ffdata[56]+8*bs, 2, bs, fdata[40]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 40, fdata[40]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 40, fdata[40]+9*bs, bs);
+	coupling_region_multiply(ffdata[57]+8*bs, 2, bs, fdata[41]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 41, fdata[41]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 41, fdata[41]+9*bs, bs);
+	coupling_region_multiply(ffdata[58]+8*bs, 2, bs, fdata[42]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 42, fdata[42]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 42, fdata[42]+9*bs, bs);
+	coupling_region_multiply(ffdata[59]+8*bs, 2, bs, fdata[43]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 43, fdata[43]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 43, fdata[43]+9*bs, bs);
+	coupling_region_multiply(ffdata[60]+8*bs, 2, bs, fdata[44]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 44, fdata[44]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 44, fdata[44]+9*bs, bs);
+	coupling_region_multiply(ffdata[61]+8*bs, 2, bs, fdata[45]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 45, fdata[45]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 45, fdata[45]+9*bs, bs);
+	coupling_region_multiply(ffdata[62]+8*bs, 2, bs, fdata[46]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 46, fdata[46]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 46, fdata[46]+9*bs, bs);
+	coupling_region_multiply(ffdata[63]+8*bs, 2, bs, fdata[47]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 47, fdata[47]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 47, fdata[47]+9*bs, bs);
+	coupling_region_multiply(ffdata[32]+9*bs, 2, bs, fdata[48]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 48, fdata[48]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 48, fdata[48]+9*bs, bs);
+	coupling_region_multiply(ffdata[33]+9*bs, 2, bs, fdata[49]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 49, fdata[49]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 49, fdata[49]+9*bs, bs);
+	coupling_region_multiply(ffdata[34]+9*bs, 2, bs, fdata[50]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 50, fdata[50]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 50, fdata[50]+9*bs, bs);
+	coupling_region_multiply(ffdata[35]+9*bs, 2, bs, fdata[51]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 51, fdata[51]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 51, fdata[51]+9*bs, bs);
+	coupling_region_multiply(ffdata[36]+9*bs, 2, bs, fdata[52]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 52, fdata[52]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 52, fdata[52]+9*bs, bs);
+	coupling_region_multiply(ffdata[37]+9*bs, 2, bs, fdata[53]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 53, fdata[53]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 53, fdata[53]+9*bs, bs);
+	coupling_region_multiply(ffdata[38]+9*bs, 2, bs, fdata[54]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 54, fdata[54]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 54, fdata[54]+9*bs, bs);
+	coupling_region_multiply(ffdata[39]+9*bs, 2, bs, fdata[55]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 55, fdata[55]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 55, fdata[55]+9*bs, bs);
+	coupling_region_multiply(ffdata[40]+9*bs, 2, bs, fdata[56]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 56, fdata[56]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 56, fdata[56]+9*bs, bs);
+	coupling_region_multiply(ffdata[41]+9*bs, 2, bs, fdata[57]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 57, fdata[57]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 57, fdata[57]+9*bs, bs);
+	coupling_region_multiply(ffdata[42]+9*bs, 2, bs, fdata[58]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 58, fdata[58]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 58, fdata[58]+9*bs, bs);
+	coupling_region_multiply(ffdata[43]+9*bs, 2, bs, fdata[59]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 59, fdata[59]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 59, fdata[59]+9*bs, bs);
+	coupling_region_multiply(ffdata[44]+9*bs, 2, bs, fdata[60]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 60, fdata[60]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 60, fdata[60]+9*bs, bs);
+	coupling_region_multiply(ffdata[45]+9*bs, 2, bs, fdata[61]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 61, fdata[61]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 61, fdata[61]+9*bs, bs);
+	coupling_region_multiply(ffdata[46]+9*bs, 2, bs, fdata[62]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 62, fdata[62]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 62, fdata[62]+9*bs, bs);
+	coupling_region_multiply(ffdata[47]+9*bs, 2, bs, fdata[63]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 63, fdata[63]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 63, fdata[63]+9*bs, bs);
+	coupling_region_multiply(ffdata[80]+8*bs, 2, bs, fdata[64]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 64, fdata[64]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 64, fdata[64]+9*bs, bs);
+	coupling_region_multiply(ffdata[81]+8*bs, 2, bs, fdata[65]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 65, fdata[65]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 65, fdata[65]+9*bs, bs);
+	coupling_region_multiply(ffdata[82]+8*bs, 2, bs, fdata[66]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 66, fdata[66]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 66, fdata[66]+9*bs, bs);
+	coupling_region_multiply(ffdata[83]+8*bs, 2, bs, fdata[67]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 67, fdata[67]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 67, fdata[67]+9*bs, bs);
+	coupling_region_multiply(ffdata[84]+8*bs, 2, bs, fdata[68]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 68, fdata[68]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 68, fdata[68]+9*bs, bs);
+	coupling_region_multiply(ffdata[85]+8*bs, 2, bs, fdata[69]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 69, fdata[69]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 69, fdata[69]+9*bs, bs);
+	coupling_region_multiply(ffdata[86]+8*bs, 2, bs, fdata[70]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 70, fdata[70]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 70, fdata[70]+9*bs, bs);
+	coupling_region_multiply(ffdata[87]+8*bs, 2, bs, fdata[71]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 71, fdata[71]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 71, fdata[71]+9*bs, bs);
+	coupling_region_multiply(ffdata[88]+8*bs, 2, bs, fdata[72]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 72, fdata[72]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 72, fdata[72]+9*bs, bs);
+	coupling_region_multiply(ffdata[89]+8*bs, 2, bs, fdata[73]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 73, fdata[73]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 73, fdata[73]+9*bs, bs);
+	coupling_region_multiply(ffdata[90]+8*bs, 2, bs, fdata[74]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 74, fdata[74]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 74, fdata[74]+9*bs, bs);
+	coupling_region_multiply(ffdata[91]+8*bs, 2, bs, fdata[75]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 75, fdata[75]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 75, fdata[75]+9*bs, bs);
+	coupling_region_multiply(ffdata[92]+8*bs, 2, bs, fdata[76]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 76, fdata[76]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 76, fdata[76]+9*bs, bs);
+	coupling_region_multiply(ffdata[93]+8*bs, 2, bs, fdata[77]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 77, fdata[77]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 77, fdata[77]+9*bs, bs);
+	coupling_region_multiply(ffdata[94]+8*bs, 2, bs, fdata[78]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 78, fdata[78]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 78, fdata[78]+9*bs, bs);
+	coupling_region_multiply(ffdata[95]+8*bs, 2, bs, fdata[79]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 79, fdata[79]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 79, fdata[79]+9*bs, bs);
+	coupling_region_multiply(ffdata[64]+9*bs, 2, bs, fdata[80]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 80, fdata[80]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 80, fdata[80]+9*bs, bs);
+	coupling_region_multiply(ffdata[65]+9*bs, 2, bs, fdata[81]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 81, fdata[81]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 81, fdata[81]+9*bs, bs);
+	coupling_region_multiply(ffdata[66]+9*bs, 2, bs, fdata[82]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 82, fdata[82]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 82, fdata[82]+9*bs, bs);
+	coupling_region_multiply(ffdata[67]+9*bs, 2, bs, fdata[83]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 83, fdata[83]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 83, fdata[83]+9*bs, bs);
+	coupling_region_multiply(ffdata[68]+9*bs, 2, bs, fdata[84]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 84, fdata[84]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 84, fdata[84]+9*bs, bs);
+	coupling_region_multiply(ffdata[69]+9*bs, 2, bs, fdata[85]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 85, fdata[85]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 85, fdata[85]+9*bs, bs);
+	coupling_region_multiply(ffdata[70]+9*bs, 2, bs, fdata[86]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 86, fdata[86]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 86, fdata[86]+9*bs, bs);
+	coupling_region_multiply(ffdata[71]+9*bs, 2, bs, fdata[87]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 87, fdata[87]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 87, fdata[87]+9*bs, bs);
+	coupling_region_multiply(ffdata[72]+9*bs, 2, bs, fdata[88]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 88, fdata[88]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 88, fdata[88]+9*bs, bs);
+	coupling_region_multiply(ffdata[73]+9*bs, 2, bs, fdata[89]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 89, fdata[89]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 89, fdata[89]+9*bs, bs);
+	coupling_region_multiply(ffdata[74]+9*bs, 2, bs, fdata[90]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 90, fdata[90]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 90, fdata[90]+9*bs, bs);
+	coupling_region_multiply(ffdata[75]+9*bs, 2, bs, fdata[91]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 91, fdata[91]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 91, fdata[91]+9*bs, bs);
+	coupling_region_multiply(ffdata[76]+9*bs, 2, bs, fdata[92]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 92, fdata[92]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 92, fdata[92]+9*bs, bs);
+	coupling_region_multiply(ffdata[77]+9*bs, 2, bs, fdata[93]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 93, fdata[93]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 93, fdata[93]+9*bs, bs);
+	coupling_region_multiply(ffdata[78]+9*bs, 2, bs, fdata[94]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 94, fdata[94]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 94, fdata[94]+9*bs, bs);
+	coupling_region_multiply(ffdata[79]+9*bs, 2, bs, fdata[95]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 95, fdata[95]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 95, fdata[95]+9*bs, bs);
+	coupling_region_multiply(ffdata[112]+8*bs, 2, bs, fdata[96]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 96, fdata[96]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 96, fdata[96]+9*bs, bs);
+	coupling_region_multiply(ffdata[113]+8*bs, 2, bs, fdata[97]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 97, fdata[97]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 97, fdata[97]+9*bs, bs);
+	coupling_region_multiply(ffdata[114]+8*bs, 2, bs, fdata[98]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 98, fdata[98]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 98, fdata[98]+9*bs, bs);
+	coupling_region_multiply(ffdata[115]+8*bs, 2, bs, fdata[99]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 99, fdata[99]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 99, fdata[99]+9*bs, bs);
+	coupling_region_multiply(ffdata[116]+8*bs, 2, bs, fdata[100]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 100, fdata[100]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 100, fdata[100]+9*bs, bs);
+	coupling_region_multiply(ffdata[117]+8*bs, 2, bs, fdata[101]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 101, fdata[101]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 101, fdata[101]+9*bs, bs);
+	coupling_region_multiply(ffdata[118]+8*bs, 2, bs, fdata[102]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 102, fdata[102]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 102, fdata[102]+9*bs, bs);
+	coupling_region_multiply(ffdata[119]+8*bs, 2, bs, fdata[103]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 103, fdata[103]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 103, fdata[103]+9*bs, bs);
+	coupling_region_multiply(ffdata[120]+8*bs, 2, bs, fdata[104]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 104, fdata[104]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 104, fdata[104]+9*bs, bs);
+	coupling_region_multiply(ffdata[121]+8*bs, 2, bs, fdata[105]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 105, fdata[105]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 105, fdata[105]+9*bs, bs);
+	coupling_region_multiply(ffdata[122]+8*bs, 2, bs, fdata[106]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 106, fdata[106]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 106, fdata[106]+9*bs, bs);
+	coupling_region_multiply(ffdata[123]+8*bs, 2, bs, fdata[107]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 107, fdata[107]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 107, fdata[107]+9*bs, bs);
+	coupling_region_multiply(ffdata[124]+8*bs, 2, bs, fdata[108]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 108, fdata[108]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 108, fdata[108]+9*bs, bs);
+	coupling_region_multiply(ffdata[125]+8*bs, 2, bs, fdata[109]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 109, fdata[109]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 109, fdata[109]+9*bs, bs);
+	coupling_region_multiply(ffdata[126]+8*bs, 2, bs, fdata[110]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 110, fdata[110]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 110, fdata[110]+9*bs, bs);
+	coupling_region_multiply(ffdata[127]+8*bs, 2, bs, fdata[111]+9*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 111, fdata[111]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 111, fdata[111]+9*bs, bs);
+	coupling_region_multiply(ffdata[96]+9*bs, 2, bs, fdata[112]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 112, fdata[112]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 112, fdata[112]+9*bs, bs);
+	coupling_region_multiply(ffdata[97]+9*bs, 2, bs, fdata[113]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 113, fdata[113]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 113, fdata[113]+9*bs, bs);
+	coupling_region_multiply(ffdata[98]+9*bs, 2, bs, fdata[114]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 114, fdata[114]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 114, fdata[114]+9*bs, bs);
+	coupling_region_multiply(ffdata[99]+9*bs, 2, bs, fdata[115]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 115, fdata[115]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 115, fdata[115]+9*bs, bs);
+	coupling_region_multiply(ffdata[100]+9*bs, 2, bs, fdata[116]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 116, fdata[116]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 116, fdata[116]+9*bs, bs);
+	coupling_region_multiply(ffdata[101]+9*bs, 2, bs, fdata[117]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 117, fdata[117]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 117, fdata[117]+9*bs, bs);
+	coupling_region_multiply(ffdata[102]+9*bs, 2, bs, fdata[118]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 118, fdata[118]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 118, fdata[118]+9*bs, bs);
+	coupling_region_multiply(ffdata[103]+9*bs, 2, bs, fdata[119]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 119, fdata[119]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 119, fdata[119]+9*bs, bs);
+	coupling_region_multiply(ffdata[104]+9*bs, 2, bs, fdata[120]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 120, fdata[120]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 120, fdata[120]+9*bs, bs);
+	coupling_region_multiply(ffdata[105]+9*bs, 2, bs, fdata[121]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 121, fdata[121]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 121, fdata[121]+9*bs, bs);
+	coupling_region_multiply(ffdata[106]+9*bs, 2, bs, fdata[122]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 122, fdata[122]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 122, fdata[122]+9*bs, bs);
+	coupling_region_multiply(ffdata[107]+9*bs, 2, bs, fdata[123]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 123, fdata[123]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 123, fdata[123]+9*bs, bs);
+	coupling_region_multiply(ffdata[108]+9*bs, 2, bs, fdata[124]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 124, fdata[124]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 124, fdata[124]+9*bs, bs);
+	coupling_region_multiply(ffdata[109]+9*bs, 2, bs, fdata[125]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 125, fdata[125]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 125, fdata[125]+9*bs, bs);
+	coupling_region_multiply(ffdata[110]+9*bs, 2, bs, fdata[126]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 126, fdata[126]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 126, fdata[126]+9*bs, bs);
+	coupling_region_multiply(ffdata[111]+9*bs, 2, bs, fdata[127]+8*bs, 1, cw);
+	subchunk_crc(rcrc, 8, 127, fdata[127]+8*bs, bs);
+	subchunk_crc(rcrc, 9, 127, fdata[127]+9*bs, bs);
+	coupling_region_multiply(ccoding[32], 2, bs, fcoding[0]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 0, fcoding[0], bs);
+	subchunk_crc(rcrc, 11, 0, fcoding[0]+bs, bs);
+	coupling_region_multiply(ccoding[33], 2, bs, fcoding[1]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 1, fcoding[1], bs);
+	subchunk_crc(rcrc, 11, 1, fcoding[1]+bs, bs);
+	coupling_region_multiply(ccoding[34], 2, bs, fcoding[2]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 2, fcoding[2], bs);
+	subchunk_crc(rcrc, 11, 2, fcoding[2]+bs, bs);
+	coupling_region_multiply(ccoding[35], 2, bs, fcoding[3]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 3, fcoding[3], bs);
+	subchunk_crc(rcrc, 11, 3, fcoding[3]+bs, bs);
+	coupling_region_multiply(ccoding[36], 2, bs, fcoding[4]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 4, fcoding[4], bs);
+	subchunk_crc(rcrc, 11, 4, fcoding[4]+bs, bs);
+	coupling_region_multiply(ccoding[37], 2, bs, fcoding[5]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 5, fcoding[5], bs);
+	subchunk_crc(rcrc, 11, 5, fcoding[5]+bs, bs);
+	coupling_region_multiply(ccoding[38], 2, bs, fcoding[6]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 6, fcoding[6], bs);
+	subchunk_crc(rcrc, 11, 6, fcoding[6]+bs, bs);
+	coupling_region_multiply(ccoding[39], 2, bs, fcoding[7]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 7, fcoding[7], bs);
+	subchunk_crc(rcrc, 11, 7, fcoding[7]+bs, bs);
+	coupling_region_multiply(ccoding[40], 2, bs, fcoding[8]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 8, fcoding[8], bs);
+	subchunk_crc(rcrc, 11, 8, fcoding[8]+bs, bs);
+	coupling_region_multiply(ccoding[41], 2, bs, fcoding[9]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 9, fcoding[9], bs);
+	subchunk_crc(rcrc, 11, 9, fcoding[9]+bs, bs);
+	coupling_region_multiply(ccoding[42], 2, bs, fcoding[10]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 10, fcoding[10], bs);
+	subchunk_crc(rcrc, 11, 10, fcoding[10]+bs, bs);
+	coupling_region_multiply(ccoding[43], 2, bs, fcoding[11]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 11, fcoding[11], bs);
+	subchunk_crc(rcrc, 11, 11, fcoding[11]+bs, bs);
+	coupling_region_multiply(ccoding[44], 2, bs, fcoding[12]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 12, fcoding[12], bs);
+	subchunk_crc(rcrc, 11, 12, fcoding[12]+bs, bs);
+	coupling_region_multiply(ccoding[45], 2, bs, fcoding[13]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 13, fcoding[13], bs);
+	subchunk_crc(rcrc, 11, 13, fcoding[13]+bs, bs);
+	coupling_region_multiply(ccoding[46], 2, bs, fcoding[14]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 14, fcoding[14], bs);
+	subchunk_crc(rcrc, 11, 14, fcoding[14]+bs, bs);
+	coupling_region_multiply(ccoding[47], 2, bs, fcoding[15]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 15, fcoding[15], bs);
+	subchunk_crc(rcrc, 11, 15, fcoding[15]+bs, bs);
+	coupling_region_multiply(ccoding[48], 2, bs, fcoding[16]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 16, fcoding[16], bs);
+	subchunk_crc(rcrc, 11, 16, fcoding[16]+bs, bs);
+	coupling_region_multiply(ccoding[49], 2, bs, fcoding[17]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 17, fcoding[17], bs);
+	subchunk_crc(rcrc, 11, 17, fcoding[17]+bs, bs);
+	coupling_region_multiply(ccoding[50], 2, bs, fcoding[18]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 18, fcoding[18], bs);
+	subchunk_crc(rcrc, 11, 18, fcoding[18]+bs, bs);
+	coupling_region_multiply(ccoding[51], 2, bs, fcoding[19]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 19, fcoding[19], bs);
+	subchunk_crc(rcrc, 11, 19, fcoding[19]+bs, bs);
+	coupling_region_multiply(ccoding[52], 2, bs, fcoding[20]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 20, fcoding[20], bs);
+	subchunk_crc(rcrc, 11, 20, fcoding[20]+bs, bs);
+	coupling_region_multiply(ccoding[53], 2, bs, fcoding[21]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 21, fcoding[21], bs);
+	subchunk_crc(rcrc, 11, 21, fcoding[21]+bs, bs);
+	coupling_region_multiply(ccoding[54], 2, bs, fcoding[22]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 22, fcoding[22], bs);
+	subchunk_crc(rcrc, 11, 22, fcoding[22]+bs, bs);
+	coupling_region_multiply(ccoding[55], 2, bs, fcoding[23]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 23, fcoding[23], bs);
+	subchunk_crc(rcrc, 11, 23, fcoding[23]+bs, bs);
+	coupling_region_multiply(ccoding[56], 2, bs, fcoding[24]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 24, fcoding[24], bs);
+	subchunk_crc(rcrc, 11, 24, fcoding[24]+bs, bs);
+	coupling_region_multiply(ccoding[57], 2, bs, fcoding[25]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 25, fcoding[25], bs);
+	subchunk_crc(rcrc, 11, 25, fcoding[25]+bs, bs);
+	coupling_region_multiply(ccoding[58], 2, bs, fcoding[26]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 26, fcoding[26], bs);
+	subchunk_crc(rcrc, 11, 26, fcoding[26]+bs, bs);
+	coupling_region_multiply(ccoding[59], 2, bs, fcoding[27]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 27, fcoding[27], bs);
+	subchunk_crc(rcrc, 11, 27, fcoding[27]+bs, bs);
+	coupling_region_multiply(ccoding[60], 2, bs, fcoding[28]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 28, fcoding[28], bs);
+	subchunk_crc(rcrc, 11, 28, fcoding[28]+bs, bs);
+	coupling_region_multiply(ccoding[61], 2, bs, fcoding[29]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 29, fcoding[29], bs);
+	subchunk_crc(rcrc, 11, 29, fcoding[29]+bs, bs);
+	coupling_region_multiply(ccoding[62], 2, bs, fcoding[30]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 30, fcoding[30], bs);
+	subchunk_crc(rcrc, 11, 30, fcoding[30]+bs, bs);
+	coupling_region_multiply(ccoding[63], 2, bs, fcoding[31]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 31, fcoding[31], bs);
+	subchunk_crc(rcrc, 11, 31, fcoding[31]+bs, bs);
+	coupling_region_multiply(ccoding[0]+bs, 2, bs, fcoding[32], 1, cw);
+	subchunk_crc(rcrc, 10, 32, fcoding[32], bs);
+	subchunk_crc(rcrc, 11, 32, fcoding[32]+bs, bs);
+	coupling_region_multiply(ccoding[1]+bs, 2, bs, fcoding[33], 1, cw);
+	subchunk_crc(rcrc, 10, 33, fcoding[33], bs);
+	subchunk_crc(rcrc, 11, 33, fcoding[33]+bs, bs);
+	coupling_region_multiply(ccoding[2]+bs, 2, bs, fcoding[34], 1, cw);
+	subchunk_crc(rcrc, 10, 34, fcoding[34], bs);
+	subchunk_crc(rcrc, 11, 34, fcoding[34]+bs, bs);
+	coupling_region_multiply(ccoding[3]+bs, 2, bs, fcoding[35], 1, cw);
+	subchunk_crc(rcrc, 10, 35, fcoding[35], bs);
+	subchunk_crc(rcrc, 11, 35, fcoding[35]+bs, bs);
+	coupling_region_multiply(ccoding[4]+bs, 2, bs, fcoding[36], 1, cw);
+	subchunk_crc(rcrc, 10, 36, fcoding[36], bs);
+	subchunk_crc(rcrc, 11, 36, fcoding[36]+bs, bs);
+	coupling_region_multiply(ccoding[5]+bs, 2, bs, fcoding[37], 1, cw);
+	subchunk_crc(rcrc, 10, 37, fcoding[37], bs);
+	subchunk_crc(rcrc, 11, 37, fcoding[37]+bs, bs);
+	coupling_region_multiply(ccoding[6]+bs, 2, bs, fcoding[38], 1, cw);
+	subchunk_crc(rcrc, 10, 38, fcoding[38], bs);
+	subchunk_crc(rcrc, 11, 38, fcoding[38]+bs, bs);
+	coupling_region_multiply(ccoding[7]+bs, 2, bs, fcoding[39], 1, cw);
+	subchunk_crc(rcrc, 10, 39, fcoding[39], bs);
+	subchunk_crc(rcrc, 11, 39, fcoding[39]+bs, bs);
+	coupling_region_multiply(ccoding[8]+bs, 2, bs, fcoding[40], 1, cw);
+	subchunk_crc(rcrc, 10, 40, fcoding[40], bs);
+	subchunk_crc(rcrc, 11, 40, fcoding[40]+bs, bs);
+	coupling_region_multiply(ccoding[9]+bs, 2, bs, fcoding[41], 1, cw);
+	subchunk_crc(rcrc, 10, 41, fcoding[41], bs);
+	subchunk_crc(rcrc, 11, 41, fcoding[41]+bs, bs);
+	coupling_region_multiply(ccoding[10]+bs, 2, bs, fcoding[42], 1, cw);
+	subchunk_crc(rcrc, 10, 42, fcoding[42], bs);
+	subchunk_crc(rcrc, 11, 42, fcoding[42]+bs, bs);
+	coupling_region_multiply(ccoding[11]+bs, 2, bs, fcoding[43], 1, cw);
+	subchunk_crc(rcrc, 10, 43, fcoding[43], bs);
+	subchunk_crc(rcrc, 11, 43, fcoding[43]+bs, bs);
+	coupling_region_multiply(ccoding[12]+bs, 2, bs, fcoding[44], 1, cw);
+	subchunk_crc(rcrc, 10, 44, fcoding[44], bs);
+	subchunk_crc(rcrc, 11, 44, fcoding[44]+bs, bs);
+	coupling_region_multiply(ccoding[13]+bs, 2, bs, fcoding[45], 1, cw);
+	subchunk_crc(rcrc, 10, 45, fcoding[45], bs);
+	subchunk_crc(rcrc, 11, 45, fcoding[45]+bs, bs);
+	coupling_region_multiply(ccoding[14]+bs, 2, bs, fcoding[46], 1, cw);
+	subchunk_crc(rcrc, 10, 46, fcoding[46], bs);
+	subchunk_crc(rcrc, 11, 46, fcoding[46]+bs, bs);
+	coupling_region_multiply(ccoding[15]+bs, 2, bs, fcoding[47], 1, cw);
+	subchunk_crc(rcrc, 10, 47, fcoding[47], bs);
+	subchunk_crc(rcrc, 11, 47, fcoding[47]+bs, bs);
+	coupling_region_multiply(ccoding[16]+bs, 2, bs, fcoding[48], 1, cw);
+	subchunk_crc(rcrc, 10, 48, fcoding[48], bs);
+	subchunk_crc(rcrc, 11, 48, fcoding[48]+bs, bs);
+	coupling_region_multiply(ccoding[17]+bs, 2, bs, fcoding[49], 1, cw);
+	subchunk_crc(rcrc, 10, 49, fcoding[49], bs);
+	subchunk_crc(rcrc, 11, 49, fcoding[49]+bs, bs);
+	coupling_region_multiply(ccoding[18]+bs, 2, bs, fcoding[50], 1, cw);
+	subchunk_crc(rcrc, 10, 50, fcoding[50], bs);
+	subchunk_crc(rcrc, 11, 50, fcoding[50]+bs, bs);
+	coupling_region_multiply(ccoding[19]+bs, 2, bs, fcoding[51], 1, cw);
+	subchunk_crc(rcrc, 10, 51, fcoding[51], bs);
+	subchunk_crc(rcrc, 11, 51, fcoding[51]+bs, bs);
+	coupling_region_multiply(ccoding[20]+bs, 2, bs, fcoding[52], 1, cw);
+	subchunk_crc(rcrc, 10, 52, fcoding[52], bs);
+	subchunk_crc(rcrc, 11, 52, fcoding[52]+bs, bs);
+	coupling_region_multiply(ccoding[21]+bs, 2, bs, fcoding[53], 1, cw);
+	subchunk_crc(rcrc, 10, 53, fcoding[53], bs);
+	subchunk_crc(rcrc, 11, 53, fcoding[53]+bs, bs);
+	coupling_region_multiply(ccoding[22]+bs, 2, bs, fcoding[54], 1, cw);
+	subchunk_crc(rcrc, 10, 54, fcoding[54], bs);
+	subchunk_crc(rcrc, 11, 54, fcoding[54]+bs, bs);
+	coupling_region_multiply(ccoding[23]+bs, 2, bs, fcoding[55], 1, cw);
+	subchunk_crc(rcrc, 10, 55, fcoding[55], bs);
+	subchunk_crc(rcrc, 11, 55, fcoding[55]+bs, bs);
+	coupling_region_multiply(ccoding[24]+bs, 2, bs, fcoding[56], 1, cw);
+	subchunk_crc(rcrc, 10, 56, fcoding[56], bs);
+	subchunk_crc(rcrc, 11, 56, fcoding[56]+bs, bs);
+	coupling_region_multiply(ccoding[25]+bs, 2, bs, fcoding[57], 1, cw);
+	subchunk_crc(rcrc, 10, 57, fcoding[57], bs);
+	subchunk_crc(rcrc, 11, 57, fcoding[57]+bs, bs);
+	coupling_region_multiply(ccoding[26]+bs, 2, bs, fcoding[58], 1, cw);
+	subchunk_crc(rcrc, 10, 58, fcoding[58], bs);
+	subchunk_crc(rcrc, 11, 58, fcoding[58]+bs, bs);
+	coupling_region_multiply(ccoding[27]+bs, 2, bs, fcoding[59], 1, cw);
+	subchunk_crc(rcrc, 10, 59, fcoding[59], bs);
+	subchunk_crc(rcrc, 11, 59, fcoding[59]+bs, bs);
+	coupling_region_multiply(ccoding[28]+bs, 2, bs, fcoding[60], 1, cw);
+	subchunk_crc(rcrc, 10, 60, fcoding[60], bs);
+	subchunk_crc(rcrc, 11, 60, fcoding[60]+bs, bs);
+	coupling_region_multiply(ccoding[29]+bs, 2, bs, fcoding[61], 1, cw);
+	subchunk_crc(rcrc, 10, 61, fcoding[61], bs);
+	subchunk_crc(rcrc, 11, 61, fcoding[61]+bs, bs);
+	coupling_region_multiply(ccoding[30]+bs, 2, bs, fcoding[62], 1, cw);
+	subchunk_crc(rcrc, 10, 62, fcoding[62], bs);
+	subchunk_crc(rcrc, 11, 62, fcoding[62]+bs, bs);
+	coupling_region_multiply(ccoding[31]+bs, 2, bs, fcoding[63], 1, cw);
+	subchunk_crc(rcrc, 10, 63, fcoding[63], bs);
+	subchunk_crc(rcrc, 11, 63, fcoding[63]+bs, bs);
+	coupling_region_multiply(ccoding[96], 2, bs, fcoding[64]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 64, fcoding[64], bs);
+	subchunk_crc(rcrc, 11, 64, fcoding[64]+bs, bs);
+	coupling_region_multiply(ccoding[97], 2, bs, fcoding[65]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 65, fcoding[65], bs);
+	subchunk_crc(rcrc, 11, 65, fcoding[65]+bs, bs);
+	coupling_region_multiply(ccoding[98], 2, bs, fcoding[66]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 66, fcoding[66], bs);
+	subchunk_crc(rcrc, 11, 66, fcoding[66]+bs, bs);
+	coupling_region_multiply(ccoding[99], 2, bs, fcoding[67]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 67, fcoding[67], bs);
+	subchunk_crc(rcrc, 11, 67, fcoding[67]+bs, bs);
+	coupling_region_multiply(ccoding[100], 2, bs, fcoding[68]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 68, fcoding[68], bs);
+	subchunk_crc(rcrc, 11, 68, fcoding[68]+bs, bs);
+	coupling_region_multiply(ccoding[101], 2, bs, fcoding[69]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 69, fcoding[69], bs);
+	subchunk_crc(rcrc, 11, 69, fcoding[69]+bs, bs);
+	coupling_region_multiply(ccoding[102], 2, bs, fcoding[70]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 70, fcoding[70], bs);
+	subchunk_crc(rcrc, 11, 70, fcoding[70]+bs, bs);
+	coupling_region_multiply(ccoding[103], 2, bs, fcoding[71]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 71, fcoding[71], bs);
+	subchunk_crc(rcrc, 11, 71, fcoding[71]+bs, bs);
+	coupling_region_multiply(ccoding[104], 2, bs, fcoding[72]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 72, fcoding[72], bs);
+	subchunk_crc(rcrc, 11, 72, fcoding[72]+bs, bs);
+	coupling_region_multiply(ccoding[105], 2, bs, fcoding[73]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 73, fcoding[73], bs);
+	subchunk_crc(rcrc, 11, 73, fcoding[73]+bs, bs);
+	coupling_region_multiply(ccoding[106], 2, bs, fcoding[74]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 74, fcoding[74], bs);
+	subchunk_crc(rcrc, 11, 74, fcoding[74]+bs, bs);
+	coupling_region_multiply(ccoding[107], 2, bs, fcoding[75]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 75, fcoding[75], bs);
+	subchunk_crc(rcrc, 11, 75, fcoding[75]+bs, bs);
+	coupling_region_multiply(ccoding[108], 2, bs, fcoding[76]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 76, fcoding[76], bs);
+	subchunk_crc(rcrc, 11, 76, fcoding[76]+bs, bs);
+	coupling_region_multiply(ccoding[109], 2, bs, fcoding[77]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 77, fcoding[77], bs);
+	subchunk_crc(rcrc, 11, 77, fcoding[77]+bs, bs);
+	coupling_region_multiply(ccoding[110], 2, bs, fcoding[78]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 78, fcoding[78], bs);
+	subchunk_crc(rcrc, 11, 78, fcoding[78]+bs, bs);
+	coupling_region_multiply(ccoding[111], 2, bs, fcoding[79]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 79, fcoding[79], bs);
+	subchunk_crc(rcrc, 11, 79, fcoding[79]+bs, bs);
+	coupling_region_multiply(ccoding[112], 2, bs, fcoding[80]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 80, fcoding[80], bs);
+	subchunk_crc(rcrc, 11, 80, fcoding[80]+bs, bs);
+	coupling_region_multiply(ccoding[113], 2, bs, fcoding[81]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 81, fcoding[81], bs);
+	subchunk_crc(rcrc, 11, 81, fcoding[81]+bs, bs);
+	coupling_region_multiply(ccoding[114], 2, bs, fcoding[82]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 82, fcoding[82], bs);
+	subchunk_crc(rcrc, 11, 82, fcoding[82]+bs, bs);
+	coupling_region_multiply(ccoding[115], 2, bs, fcoding[83]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 83, fcoding[83], bs);
+	subchunk_crc(rcrc, 11, 83, fcoding[83]+bs, bs);
+	coupling_region_multiply(ccoding[116], 2, bs, fcoding[84]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 84, fcoding[84], bs);
+	subchunk_crc(rcrc, 11, 84, fcoding[84]+bs, bs);
+	coupling_region_multiply(ccoding[117], 2, bs, fcoding[85]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 85, fcoding[85], bs);
+	subchunk_crc(rcrc, 11, 85, fcoding[85]+bs, bs);
+	coupling_region_multiply(ccoding[118], 2, bs, fcoding[86]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 86, fcoding[86], bs);
+	subchunk_crc(rcrc, 11, 86, fcoding[86]+bs, bs);
+	coupling_region_multiply(ccoding[119], 2, bs, fcoding[87]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 87, fcoding[87], bs);
+	subchunk_crc(rcrc, 11, 87, fcoding[87]+bs, bs);
+	coupling_region_multiply(ccoding[120], 2, bs, fcoding[88]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 88, fcoding[88], bs);
+	subchunk_crc(rcrc, 11, 88, fcoding[88]+bs, bs);
+	coupling_region_multiply(ccoding[121], 2, bs, fcoding[89]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 89, fcoding[89], bs);
+	subchunk_crc(rcrc, 11, 89, fcoding[89]+bs, bs);
+	coupling_region_multiply(ccoding[122], 2, bs, fcoding[90]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 90, fcoding[90], bs);
+	subchunk_crc(rcrc, 11, 90, fcoding[90]+bs, bs);
+	coupling_region_multiply(ccoding[123], 2, bs, fcoding[91]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 91, fcoding[91], bs);
+	subchunk_crc(rcrc, 11, 91, fcoding[91]+bs, bs);
+	coupling_region_multiply(ccoding[124], 2, bs, fcoding[92]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 92, fcoding[92], bs);
+	subchunk_crc(rcrc, 11, 92, fcoding[92]+bs, bs);
+	coupling_region_multiply(ccoding[125], 2, bs, fcoding[93]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 93, fcoding[93], bs);
+	subchunk_crc(rcrc, 11, 93, fcoding[93]+bs, bs);
+	coupling_region_multiply(ccoding[126], 2, bs, fcoding[94]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 94, fcoding[94], bs);
+	subchunk_crc(rcrc, 11, 94, fcoding[94]+bs, bs);
+	coupling_region_multiply(ccoding[127], 2, bs, fcoding[95]+bs, 1, cw);
+	subchunk_crc(rcrc, 10, 95, fcoding[95], bs);
+	subchunk_crc(rcrc, 11, 95, fcoding[95]+bs, bs);
+	coupling_region_multiply(ccoding[64]+bs, 2, bs, fcoding[96], 1, cw);
+	subchunk_crc(rcrc, 10, 96, fcoding[96], bs);
+	subchunk_crc(rcrc, 11, 96, fcoding[96]+bs, bs);
+	coupling_region_multiply(ccoding[65]+bs, 2, bs, fcoding[97], 1, cw);
+	subchunk_crc(rcrc, 10, 97, fcoding[97], bs);
+	subchunk_crc(rcrc, 11, 97, fcoding[97]+bs, bs);
+	coupling_region_multiply(ccoding[66]+bs, 2, bs, fcoding[98], 1, cw);
+	subchunk_crc(rcrc, 10, 98, fcoding[98], bs);
+	subchunk_crc(rcrc, 11, 98, fcoding[98]+bs, bs);
+	coupling_region_multiply(ccoding[67]+bs, 2, bs, fcoding[99], 1, cw);
+	subchunk_crc(rcrc, 10, 99, fcoding[99], bs);
+	subchunk_crc(rcrc, 11, 99, fcoding[99]+bs, bs);
+	coupling_region_multiply(ccoding[68]+bs, 2, bs, fcoding[100], 1, cw);
+	subchunk_crc(rcrc, 10, 100, fcoding[100], bs);
+	subchunk_crc(rcrc, 11, 100, fcoding[100]+bs, bs);
+	coupling_region_multiply(ccoding[69]+bs, 2, bs, fcoding[101], 1, cw);
+	subchunk_crc(rcrc, 10, 101, fcoding[101], bs);
+	subchunk_crc(rcrc, 11, 101, fcoding[101]+bs, bs);
+	coupling_region_multiply(ccoding[70]+bs, 2, bs, fcoding[102], 1, cw);
+	subchunk_crc(rcrc, 10, 102, fcoding[102], bs);
+	subchunk_crc(rcrc, 11, 102, fcoding[102]+bs, bs);
+	coupling_region_multiply(ccoding[71]+bs, 2, bs, fcoding[103], 1, cw);
+	subchunk_crc(rcrc, 10, 103, fcoding[103], bs);
+	subchunk_crc(rcrc, 11, 103, fcoding[103]+bs, bs);
+	coupling_region_multiply(ccoding[72]+bs, 2, bs, fcoding[104], 1, cw);
+	subchunk_crc(rcrc, 10, 104, fcoding[104], bs);
+	subchunk_crc(rcrc, 11, 104, fcoding[104]+bs, bs);
+	coupling_region_multiply(ccoding[73]+bs, 2, bs, fcoding[105], 1, cw);
+	subchunk_crc(rcrc, 10, 105, fcoding[105], bs);
+	subchunk_crc(rcrc, 11, 105, fcoding[105]+bs, bs);
+	coupling_region_multiply(ccoding[74]+bs, 2, bs, fcoding[106], 1, cw);
+	subchunk_crc(rcrc, 10, 106, fcoding[106], bs);
+	subchunk_crc(rcrc, 11, 106, fcoding[106]+bs, bs);
+	coupling_region_multiply(ccoding[75]+bs, 2, bs, fcoding[107], 1, cw);
+	subchunk_crc(rcrc, 10, 107, fcoding[107], bs);
+	subchunk_crc(rcrc, 11, 107, fcoding[107]+bs, bs);
+	coupling_region_multiply(ccoding[76]+bs, 2, bs, fcoding[108], 1, cw);
+	subchunk_crc(rcrc, 10, 108, fcoding[108], bs);
+	subchunk_crc(rcrc, 11, 108, fcoding[108]+bs, bs);
+	coupling_region_multiply(ccoding[77]+bs, 2, bs, fcoding[109], 1, cw);
+	subchunk_crc(rcrc, 10, 109, fcoding[109], bs);
+	subchunk_crc(rcrc, 11, 109, fcoding[109]+bs, bs);
+	coupling_region_multiply(ccoding[78]+bs, 2, bs, fcoding[110], 1, cw);
+	subchunk_crc(rcrc, 10, 110, fcoding[110], bs);
+	subchunk_crc(rcrc, 11, 110, fcoding[110]+bs, bs);
+	coupling_region_multiply(ccoding[79]+bs, 2, bs, fcoding[111], 1, cw);
+	subchunk_crc(rcrc, 10, 111, fcoding[111], bs);
+	subchunk_crc(rcrc, 11, 111, fcoding[111]+bs, bs);
+	coupling_region_multiply(ccoding[80]+bs, 2, bs, fcoding[112], 1, cw);
+	subchunk_crc(rcrc, 10, 112, fcoding[112], bs);
+	subchunk_crc(rcrc, 11, 112, fcoding[112]+bs, bs);
+	coupling_region_multiply(ccoding[81]+bs, 2, bs, fcoding[113], 1, cw);
+	subchunk_crc(rcrc, 10, 113, fcoding[113], bs);
+	subchunk_crc(rcrc, 11, 113, fcoding[113]+bs, bs);
+	coupling_region_multiply(ccoding[82]+bs, 2, bs, fcoding[114], 1, cw);
+	subchunk_crc(rcrc, 10, 114, fcoding[114], bs);
+	subchunk_crc(rcrc, 11, 114, fcoding[114]+bs, bs);
+	coupling_region_multiply(ccoding[83]+bs, 2, bs, fcoding[115], 1, cw);
+	subchunk_crc(rcrc, 10, 115, fcoding[115], bs);
+	subchunk_crc(rcrc, 11, 115, fcoding[115]+bs, bs);
+	coupling_region_multiply(ccoding[84]+bs, 2, bs, fcoding[116], 1, cw);
+	subchunk_crc(rcrc, 10, 116, fcoding[116], bs);
+	subchunk_crc(rcrc, 11, 116, fcoding[116]+bs, bs);
+	coupling_region_multiply(ccoding[85]+bs, 2, bs, fcoding[117], 1, cw);
+	subchunk_crc(rcrc, 10, 117, fcoding[117], bs);
+	subchunk_crc(rcrc, 11, 117, fcoding[117]+bs, bs);
+	coupling_region_multiply(ccoding[86]+bs, 2, bs, fcoding[118], 1, cw);
+	subchunk_crc(rcrc, 10, 118, fcoding[118], bs);
+	subchunk_crc(rcrc, 11, 118, fcoding[118]+bs, bs);
+	coupling_region_multiply(ccoding[87]+bs, 2, bs, fcoding[119], 1, cw);
+	subchunk_crc(rcrc, 10, 119, fcoding[119], bs);
+	subchunk_crc(rcrc, 11, 119, fcoding[119]+bs, bs);
+	coupling_region_multiply(ccoding[88]+bs, 2, bs, fcoding[120], 1, cw);
+	subchunk_crc(rcrc, 10, 120, fcoding[120], bs);
+	subchunk_crc(rcrc, 11, 120, fcoding[120]+bs, bs);
+	coupling_region_multiply(ccoding[89]+bs, 2, bs, fcoding[121], 1, cw);
+	subchunk_crc(rcrc, 10, 121, fcoding[121], bs);
+	subchunk_crc(rcrc, 11, 121, fcoding[121]+bs, bs);
+	coupling_region_multiply(ccoding[90]+bs, 2, bs, fcoding[122], 1, cw);
+	subchunk_crc(rcrc, 10, 122, fcoding[122], bs);
+	subchunk_crc(rcrc, 11, 122, fcoding[122]+bs, bs);
+	coupling_region_multiply(ccoding[91]+bs, 2, bs, fcoding[123], 1, cw);
+	subchunk_crc(rcrc, 10, 123, fcoding[123], bs);
+	subchunk_crc(rcrc, 11, 123, fcoding[123]+bs, bs);
+	coupling_region_multiply(ccoding[92]+bs, 2, bs, fcoding[124], 1, cw);
+	subchunk_crc(rcrc, 10, 124, fcoding[124], bs);
+	subchunk_crc(rcrc, 11, 124, fcoding[124]+bs, bs);
+	coupling_region_multiply(ccoding[93]+bs, 2, bs, fcoding[125], 1, cw);
+	subchunk_crc(rcrc, 10, 125, fcoding[125], bs);
+	subchunk_crc(rcrc, 11, 125, fcoding[125]+bs, bs);
+	coupling_region_multiply(ccoding[94]+bs, 2, bs, fcoding[126], 1, cw);
+	subchunk_crc(rcrc, 10, 126, fcoding[126], bs);
+	subchunk_crc(rcrc, 11, 126, fcoding[126]+bs, bs);
+	coupling_region_multiply(ccoding[95]+bs, 2, bs, fcoding[127], 1, cw);
+	subchunk_crc(rcrc, 10, 127, fcoding[127], bs);
+	subchunk_crc(rcrc, 11, 127, fcoding[127]+bs, bs);
+	coupling_region_multiply(ccoding[64]+2*bs, 2, bs, fcoding[0]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 0, fcoding[0]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 0, fcoding[0]+3*bs, bs);
+	coupling_region_multiply(ccoding[65]+2*bs, 2, bs, fcoding[1]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 1, fcoding[1]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 1, fcoding[1]+3*bs, bs);
+	coupling_region_multiply(ccoding[66]+2*bs, 2, bs, fcoding[2]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 2, fcoding[2]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 2, fcoding[2]+3*bs, bs);
+	coupling_region_multiply(ccoding[67]+2*bs, 2, bs, fcoding[3]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 3, fcoding[3]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 3, fcoding[3]+3*bs, bs);
+	coupling_region_multiply(ccoding[68]+2*bs, 2, bs, fcoding[4]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 4, fcoding[4]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 4, fcoding[4]+3*bs, bs);
+	coupling_region_multiply(ccoding[69]+2*bs, 2, bs, fcoding[5]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 5, fcoding[5]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 5, fcoding[5]+3*bs, bs);
+	coupling_region_multiply(ccoding[70]+2*bs, 2, bs, fcoding[6]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 6, fcoding[6]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 6, fcoding[6]+3*bs, bs);
+	coupling_region_multiply(ccoding[71]+2*bs, 2, bs, fcoding[7]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 7, fcoding[7]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 7, fcoding[7]+3*bs, bs);
+	coupling_region_multiply(ccoding[72]+2*bs, 2, bs, fcoding[8]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 8, fcoding[8]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 8, fcoding[8]+3*bs, bs);
+	coupling_region_multiply(ccoding[73]+2*bs, 2, bs, fcoding[9]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 9, fcoding[9]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 9, fcoding[9]+3*bs, bs);
+	coupling_region_multiply(ccoding[74]+2*bs, 2, bs, fcoding[10]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 10, fcoding[10]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 10, fcoding[10]+3*bs, bs);
+	coupling_region_multiply(ccoding[75]+2*bs, 2, bs, fcoding[11]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 11, fcoding[11]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 11, fcoding[11]+3*bs, bs);
+	coupling_region_multiply(ccoding[76]+2*bs, 2, bs, fcoding[12]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 12, fcoding[12]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 12, fcoding[12]+3*bs, bs);
+	coupling_region_multiply(ccoding[77]+2*bs, 2, bs, fcoding[13]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 13, fcoding[13]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 13, fcoding[13]+3*bs, bs);
+	coupling_region_multiply(ccoding[78]+2*bs, 2, bs, fcoding[14]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 14, fcoding[14]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 14, fcoding[14]+3*bs, bs);
+	coupling_region_multiply(ccoding[79]+2*bs, 2, bs, fcoding[15]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 15, fcoding[15]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 15, fcoding[15]+3*bs, bs);
+	coupling_region_multiply(ccoding[80]+2*bs, 2, bs, fcoding[16]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 16, fcoding[16]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 16, fcoding[16]+3*bs, bs);
+	coupling_region_multiply(ccoding[81]+2*bs, 2, bs, fcoding[17]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 17, fcoding[17]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 17, fcoding[17]+3*bs, bs);
+	coupling_region_multiply(ccoding[82]+2*bs, 2, bs, fcoding[18]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 18, fcoding[18]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 18, fcoding[18]+3*bs, bs);
+	coupling_region_multiply(ccoding[83]+2*bs, 2, bs, fcoding[19]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 19, fcoding[19]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 19, fcoding[19]+3*bs, bs);
+	coupling_region_multiply(ccoding[84]+2*bs, 2, bs, fcoding[20]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 20, fcoding[20]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 20, fcoding[20]+3*bs, bs);
+	coupling_region_multiply(ccoding[85]+2*bs, 2, bs, fcoding[21]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 21, fcoding[21]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 21, fcoding[21]+3*bs, bs);
+	coupling_region_multiply(ccoding[86]+2*bs, 2, bs, fcoding[22]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 22, fcoding[22]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 22, fcoding[22]+3*bs, bs);
+	coupling_region_multiply(ccoding[87]+2*bs, 2, bs, fcoding[23]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 23, fcoding[23]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 23, fcoding[23]+3*bs, bs);
+	coupling_region_multiply(ccoding[88]+2*bs, 2, bs, fcoding[24]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 24, fcoding[24]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 24, fcoding[24]+3*bs, bs);
+	coupling_region_multiply(ccoding[89]+2*bs, 2, bs, fcoding[25]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 25, fcoding[25]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 25, fcoding[25]+3*bs, bs);
+	coupling_region_multiply(ccoding[90]+2*bs, 2, bs, fcoding[26]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 26, fcoding[26]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 26, fcoding[26]+3*bs, bs);
+	coupling_region_multiply(ccoding[91]+2*bs, 2, bs, fcoding[27]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 27, fcoding[27]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 27, fcoding[27]+3*bs, bs);
+	coupling_region_multiply(ccoding[92]+2*bs, 2, bs, fcoding[28]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 28, fcoding[28]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 28, fcoding[28]+3*bs, bs);
+	coupling_region_multiply(ccoding[93]+2*bs, 2, bs, fcoding[29]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 29, fcoding[29]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 29, fcoding[29]+3*bs, bs);
+	coupling_region_multiply(ccoding[94]+2*bs, 2, bs, fcoding[30]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 30, fcoding[30]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 30, fcoding[30]+3*bs, bs);
+	coupling_region_multiply(ccoding[95]+2*bs, 2, bs, fcoding[31]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 31, fcoding[31]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 31, fcoding[31]+3*bs, bs);
+	coupling_region_multiply(ccoding[96]+2*bs, 2, bs, fcoding[32]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 32, fcoding[32]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 32, fcoding[32]+3*bs, bs);
+	coupling_region_multiply(ccoding[97]+2*bs, 2, bs, fcoding[33]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 33, fcoding[33]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 33, fcoding[33]+3*bs, bs);
+	coupling_region_multiply(ccoding[98]+2*bs, 2, bs, fcoding[34]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 34, fcoding[34]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 34, fcoding[34]+3*bs, bs);
+	coupling_region_multiply(ccoding[99]+2*bs, 2, bs, fcoding[35]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 35, fcoding[35]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 35, fcoding[35]+3*bs, bs);
+	coupling_region_multiply(ccoding[100]+2*bs, 2, bs, fcoding[36]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 36, fcoding[36]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 36, fcoding[36]+3*bs, bs);
+	coupling_region_multiply(ccoding[101]+2*bs, 2, bs, fcoding[37]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 37, fcoding[37]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 37, fcoding[37]+3*bs, bs);
+	coupling_region_multiply(ccoding[102]+2*bs, 2, bs, fcoding[38]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 38, fcoding[38]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 38, fcoding[38]+3*bs, bs);
+	coupling_region_multiply(ccoding[103]+2*bs, 2, bs, fcoding[39]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 39, fcoding[39]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 39, fcoding[39]+3*bs, bs);
+	coupling_region_multiply(ccoding[104]+2*bs, 2, bs, fcoding[40]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 40, fcoding[40]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 40, fcoding[40]+3*bs, bs);
+	coupling_region_multiply(ccoding[105]+2*bs, 2, bs, fcoding[41]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 41, fcoding[41]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 41, fcoding[41]+3*bs, bs);
+	coupling_region_multiply(ccoding[106]+2*bs, 2, bs, fcoding[42]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 42, fcoding[42]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 42, fcoding[42]+3*bs, bs);
+	coupling_region_multiply(ccoding[107]+2*bs, 2, bs, fcoding[43]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 43, fcoding[43]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 43, fcoding[43]+3*bs, bs);
+	coupling_region_multiply(ccoding[108]+2*bs, 2, bs, fcoding[44]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 44, fcoding[44]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 44, fcoding[44]+3*bs, bs);
+	coupling_region_multiply(ccoding[109]+2*bs, 2, bs, fcoding[45]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 45, fcoding[45]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 45, fcoding[45]+3*bs, bs);
+	coupling_region_multiply(ccoding[110]+2*bs, 2, bs, fcoding[46]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 46, fcoding[46]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 46, fcoding[46]+3*bs, bs);
+	coupling_region_multiply(ccoding[111]+2*bs, 2, bs, fcoding[47]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 47, fcoding[47]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 47, fcoding[47]+3*bs, bs);
+	coupling_region_multiply(ccoding[112]+2*bs, 2, bs, fcoding[48]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 48, fcoding[48]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 48, fcoding[48]+3*bs, bs);
+	coupling_region_multiply(ccoding[113]+2*bs, 2, bs, fcoding[49]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 49, fcoding[49]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 49, fcoding[49]+3*bs, bs);
+	coupling_region_multiply(ccoding[114]+2*bs, 2, bs, fcoding[50]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 50, fcoding[50]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 50, fcoding[50]+3*bs, bs);
+	coupling_region_multiply(ccoding[115]+2*bs, 2, bs, fcoding[51]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 51, fcoding[51]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 51, fcoding[51]+3*bs, bs);
+	coupling_region_multiply(ccoding[116]+2*bs, 2, bs, fcoding[52]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 52, fcoding[52]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 52, fcoding[52]+3*bs, bs);
+	coupling_region_multiply(ccoding[117]+2*bs, 2, bs, fcoding[53]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 53, fcoding[53]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 53, fcoding[53]+3*bs, bs);
+	coupling_region_multiply(ccoding[118]+2*bs, 2, bs, fcoding[54]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 54, fcoding[54]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 54, fcoding[54]+3*bs, bs);
+	coupling_region_multiply(ccoding[119]+2*bs, 2, bs, fcoding[55]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 55, fcoding[55]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 55, fcoding[55]+3*bs, bs);
+	coupling_region_multiply(ccoding[120]+2*bs, 2, bs, fcoding[56]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 56, fcoding[56]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 56, fcoding[56]+3*bs, bs);
+	coupling_region_multiply(ccoding[121]+2*bs, 2, bs, fcoding[57]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 57, fcoding[57]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 57, fcoding[57]+3*bs, bs);
+	coupling_region_multiply(ccoding[122]+2*bs, 2, bs, fcoding[58]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 58, fcoding[58]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 58, fcoding[58]+3*bs, bs);
+	coupling_region_multiply(ccoding[123]+2*bs, 2, bs, fcoding[59]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 59, fcoding[59]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 59, fcoding[59]+3*bs, bs);
+	coupling_region_multiply(ccoding[124]+2*bs, 2, bs, fcoding[60]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 60, fcoding[60]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 60, fcoding[60]+3*bs, bs);
+	coupling_region_multiply(ccoding[125]+2*bs, 2, bs, fcoding[61]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 61, fcoding[61]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 61, fcoding[61]+3*bs, bs);
+	coupling_region_multiply(ccoding[126]+2*bs, 2, bs, fcoding[62]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 62, fcoding[62]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 62, fcoding[62]+3*bs, bs);
+	coupling_region_multiply(ccoding[127]+2*bs, 2, bs, fcoding[63]+3*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 63, fcoding[63]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 63, fcoding[63]+3*bs, bs);
+	coupling_region_multiply(ccoding[0]+3*bs, 2, bs, fcoding[64]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 64, fcoding[64]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 64, fcoding[64]+3*bs, bs);
+	coupling_region_multiply(ccoding[1]+3*bs, 2, bs, fcoding[65]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 65, fcoding[65]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 65, fcoding[65]+3*bs, bs);
+	coupling_region_multiply(ccoding[2]+3*bs, 2, bs, fcoding[66]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 66, fcoding[66]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 66, fcoding[66]+3*bs, bs);
+	coupling_region_multiply(ccoding[3]+3*bs, 2, bs, fcoding[67]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 67, fcoding[67]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 67, fcoding[67]+3*bs, bs);
+	coupling_region_multiply(ccoding[4]+3*bs, 2, bs, fcoding[68]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 68, fcoding[68]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 68, fcoding[68]+3*bs, bs);
+	coupling_region_multiply(ccoding[5]+3*bs, 2, bs, fcoding[69]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 69, fcoding[69]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 69, fcoding[69]+3*bs, bs);
+	coupling_region_multiply(ccoding[6]+3*bs, 2, bs, fcoding[70]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 70, fcoding[70]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 70, fcoding[70]+3*bs, bs);
+	coupling_region_multiply(ccoding[7]+3*bs, 2, bs, fcoding[71]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 71, fcoding[71]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 71, fcoding[71]+3*bs, bs);
+	coupling_region_multiply(ccoding[8]+3*bs, 2, bs, fcoding[72]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 72, fcoding[72]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 72, fcoding[72]+3*bs, bs);
+	coupling_region_multiply(ccoding[9]+3*bs, 2, bs, fcoding[73]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 73, fcoding[73]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 73, fcoding[73]+3*bs, bs);
+	coupling_region_multiply(ccoding[10]+3*bs, 2, bs, fcoding[74]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 74, fcoding[74]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 74, fcoding[74]+3*bs, bs);
+	coupling_region_multiply(ccoding[11]+3*bs, 2, bs, fcoding[75]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 75, fcoding[75]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 75, fcoding[75]+3*bs, bs);
+	coupling_region_multiply(ccoding[12]+3*bs, 2, bs, fcoding[76]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 76, fcoding[76]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 76, fcoding[76]+3*bs, bs);
+	coupling_region_multiply(ccoding[13]+3*bs, 2, bs, fcoding[77]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 77, fcoding[77]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 77, fcoding[77]+3*bs, bs);
+	coupling_region_multiply(ccoding[14]+3*bs, 2, bs, fcoding[78]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 78, fcoding[78]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 78, fcoding[78]+3*bs, bs);
+	coupling_region_multiply(ccoding[15]+3*bs, 2, bs, fcoding[79]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 79, fcoding[79]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 79, fcoding[79]+3*bs, bs);
+	coupling_region_multiply(ccoding[16]+3*bs, 2, bs, fcoding[80]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 80, fcoding[80]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 80, fcoding[80]+3*bs, bs);
+	coupling_region_multiply(ccoding[17]+3*bs, 2, bs, fcoding[81]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 81, fcoding[81]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 81, fcoding[81]+3*bs, bs);
+	coupling_region_multiply(ccoding[18]+3*bs, 2, bs, fcoding[82]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 82, fcoding[82]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 82, fcoding[82]+3*bs, bs);
+	coupling_region_multiply(ccoding[19]+3*bs, 2, bs, fcoding[83]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 83, fcoding[83]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 83, fcoding[83]+3*bs, bs);
+	coupling_region_multiply(ccoding[20]+3*bs, 2, bs, fcoding[84]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 84, fcoding[84]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 84, fcoding[84]+3*bs, bs);
+	coupling_region_multiply(ccoding[21]+3*bs, 2, bs, fcoding[85]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 85, fcoding[85]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 85, fcoding[85]+3*bs, bs);
+	coupling_region_multiply(ccoding[22]+3*bs, 2, bs, fcoding[86]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 86, fcoding[86]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 86, fcoding[86]+3*bs, bs);
+	coupling_region_multiply(ccoding[23]+3*bs, 2, bs, fcoding[87]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 87, fcoding[87]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 87, fcoding[87]+3*bs, bs);
+	coupling_region_multiply(ccoding[24]+3*bs, 2, bs, fcoding[88]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 88, fcoding[88]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 88, fcoding[88]+3*bs, bs);
+	coupling_region_multiply(ccoding[25]+3*bs, 2, bs, fcoding[89]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 89, fcoding[89]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 89, fcoding[89]+3*bs, bs);
+	coupling_region_multiply(ccoding[26]+3*bs, 2, bs, fcoding[90]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 90, fcoding[90]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 90, fcoding[90]+3*bs, bs);
+	coupling_region_multiply(ccoding[27]+3*bs, 2, bs, fcoding[91]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 91, fcoding[91]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 91, fcoding[91]+3*bs, bs);
+	coupling_region_multiply(ccoding[28]+3*bs, 2, bs, fcoding[92]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 92, fcoding[92]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 92, fcoding[92]+3*bs, bs);
+	coupling_region_multiply(ccoding[29]+3*bs, 2, bs, fcoding[93]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 93, fcoding[93]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 93, fcoding[93]+3*bs, bs);
+	coupling_region_multiply(ccoding[30]+3*bs, 2, bs, fcoding[94]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 94, fcoding[94]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 94, fcoding[94]+3*bs, bs);
+	coupling_region_multiply(ccoding[31]+3*bs, 2, bs, fcoding[95]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 95, fcoding[95]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 95, fcoding[95]+3*bs, bs);
+	coupling_region_multiply(ccoding[32]+3*bs, 2, bs, fcoding[96]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 96, fcoding[96]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 96, fcoding[96]+3*bs, bs);
+	coupling_region_multiply(ccoding[33]+3*bs, 2, bs, fcoding[97]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 97, fcoding[97]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 97, fcoding[97]+3*bs, bs);
+	coupling_region_multiply(ccoding[34]+3*bs, 2, bs, fcoding[98]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 98, fcoding[98]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 98, fcoding[98]+3*bs, bs);
+	coupling_region_multiply(ccoding[35]+3*bs, 2, bs, fcoding[99]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 99, fcoding[99]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 99, fcoding[99]+3*bs, bs);
+	coupling_region_multiply(ccoding[36]+3*bs, 2, bs, fcoding[100]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 100, fcoding[100]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 100, fcoding[100]+3*bs, bs);
+	coupling_region_multiply(ccoding[37]+3*bs, 2, bs, fcoding[101]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 101, fcoding[101]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 101, fcoding[101]+3*bs, bs);
+	coupling_region_multiply(ccoding[38]+3*bs, 2, bs, fcoding[102]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 102, fcoding[102]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 102, fcoding[102]+3*bs, bs);
+	coupling_region_multiply(ccoding[39]+3*bs, 2, bs, fcoding[103]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 103, fcoding[103]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 103, fcoding[103]+3*bs, bs);
+	coupling_region_multiply(ccoding[40]+3*bs, 2, bs, fcoding[104]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 104, fcoding[104]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 104, fcoding[104]+3*bs, bs);
+	coupling_region_multiply(ccoding[41]+3*bs, 2, bs, fcoding[105]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 105, fcoding[105]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 105, fcoding[105]+3*bs, bs);
+	coupling_region_multiply(ccoding[42]+3*bs, 2, bs, fcoding[106]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 106, fcoding[106]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 106, fcoding[106]+3*bs, bs);
+	coupling_region_multiply(ccoding[43]+3*bs, 2, bs, fcoding[107]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 107, fcoding[107]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 107, fcoding[107]+3*bs, bs);
+	coupling_region_multiply(ccoding[44]+3*bs, 2, bs, fcoding[108]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 108, fcoding[108]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 108, fcoding[108]+3*bs, bs);
+	coupling_region_multiply(ccoding[45]+3*bs, 2, bs, fcoding[109]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 109, fcoding[109]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 109, fcoding[109]+3*bs, bs);
+	coupling_region_multiply(ccoding[46]+3*bs, 2, bs, fcoding[110]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 110, fcoding[110]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 110, fcoding[110]+3*bs, bs);
+	coupling_region_multiply(ccoding[47]+3*bs, 2, bs, fcoding[111]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 111, fcoding[111]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 111, fcoding[111]+3*bs, bs);
+	coupling_region_multiply(ccoding[48]+3*bs, 2, bs, fcoding[112]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 112, fcoding[112]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 112, fcoding[112]+3*bs, bs);
+	coupling_region_multiply(ccoding[49]+3*bs, 2, bs, fcoding[113]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 113, fcoding[113]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 113, fcoding[113]+3*bs, bs);
+	coupling_region_multiply(ccoding[50]+3*bs, 2, bs, fcoding[114]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 114, fcoding[114]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 114, fcoding[114]+3*bs, bs);
+	coupling_region_multiply(ccoding[51]+3*bs, 2, bs, fcoding[115]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 115, fcoding[115]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 115, fcoding[115]+3*bs, bs);
+	coupling_region_multiply(ccoding[52]+3*bs, 2, bs, fcoding[116]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 116, fcoding[116]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 116, fcoding[116]+3*bs, bs);
+	coupling_region_multiply(ccoding[53]+3*bs, 2, bs, fcoding[117]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 117, fcoding[117]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 117, fcoding[117]+3*bs, bs);
+	coupling_region_multiply(ccoding[54]+3*bs, 2, bs, fcoding[118]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 118, fcoding[118]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 118, fcoding[118]+3*bs, bs);
+	coupling_region_multiply(ccoding[55]+3*bs, 2, bs, fcoding[119]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 119, fcoding[119]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 119, fcoding[119]+3*bs, bs);
+	coupling_region_multiply(ccoding[56]+3*bs, 2, bs, fcoding[120]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 120, fcoding[120]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 120, fcoding[120]+3*bs, bs);
+	coupling_region_multiply(ccoding[57]+3*bs, 2, bs, fcoding[121]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 121, fcoding[121]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 121, fcoding[121]+3*bs, bs);
+	coupling_region_multiply(ccoding[58]+3*bs, 2, bs, fcoding[122]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 122, fcoding[122]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 122, fcoding[122]+3*bs, bs);
+	coupling_region_multiply(ccoding[59]+3*bs, 2, bs, fcoding[123]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 123, fcoding[123]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 123, fcoding[123]+3*bs, bs);
+	coupling_region_multiply(ccoding[60]+3*bs, 2, bs, fcoding[124]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 124, fcoding[124]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 124, fcoding[124]+3*bs, bs);
+	coupling_region_multiply(ccoding[61]+3*bs, 2, bs, fcoding[125]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 125, fcoding[125]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 125, fcoding[125]+3*bs, bs);
+	coupling_region_multiply(ccoding[62]+3*bs, 2, bs, fcoding[126]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 126, fcoding[126]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 126, fcoding[126]+3*bs, bs);
+	coupling_region_multiply(ccoding[63]+3*bs, 2, bs, fcoding[127]+2*bs, 1, cw);
+	subchunk_crc(rcrc, 12, 127, fcoding[127]+2*bs, bs);
+	subchunk_crc(rcrc, 13, 127, fcoding[127]+3*bs, bs);
+}
+
+/* Runs the couple schedule of (k, m, layers); -1 if there is none */
+static int clay_couple_schedule(int k, int m, int layers, char **fdata, char **fcoding, char **ffdata, char **ccoding, uint32_t *rcrc, long bs, int cw)
+{
+	if (k == 10 && m == 4 && layers == 128) {
+		clay_couple_10_4(fdata, fcoding, ffdata, ccoding, rcrc, bs, cw);
+		return 0;
+	}
+	return -1;
+}
+
+#endif
+
+#ifdef CLAY_SCHEDULE_UNCOUPLE
+
+/* k=10 m=4, 128 layers; inv is 1/(1+2) */
+static void clay_uncouple_10_4(char **fdata, char **fcoding, long bs, int inv, int cw)
+{
+	galois_region_xor(fdata[1], fdata[0]+bs, bs);
+	coupling_region_multiply(fdata[0]+bs, inv, bs, fdata[0]+bs, 0, cw);
+	galois_region_xor(fdata[1], fdata[0]+bs, bs);
+	coupling_region_multiply(fdata[0]+bs, inv, bs, fdata[0]+bs, 0, cw);
+	coupling_region_multiply(fdata[0]+bs, 2, bs, fdata[1], 1, cw);
+	galois_region_xor(fdata[3], fdata[2]+bs, bs);
+	coupling_region_multiply(fdata[2]+bs, inv, bs, fdata[2]+bs, 0, cw);
+	galois_region_xor(fdata[3], fdata[2]+bs, bs);
+	coupling_region_multiply(fdata[2]+bs, inv, bs, fdata[2]+bs, 0, cw);
+	coupling_region_multiply(fdata[2]+bs, 2, bs, fdata[3], 1, cw);
+	galois_region_xor(fdata[5], fdata[4]+bs, bs);
+	coupling_region_multiply(fdata[4]+bs, inv, bs, fdata[4]+bs, 0, cw);
+	galois_region_xor(fdata[5], fdata[4]+bs, bs);
+	coupling_region_multiply(fdata[4]+bs, inv, bs, fdata[4]+bs, 0, cw);
+	coupling_region_multiply(fdata[4]+bs, 2, bs, fdata[5], 1, cw);
+	galois_region_xor(fdata[7], fdata[6]+bs, bs);
+	coupling_region_multiply(fdata[6]+bs, inv, bs, fdata[6]+bs, 0, cw);
+	galois_region_xor(fdata[7], fdata[6]+bs, bs);
+	coupling_region_multiply(fdata[6]+bs, inv, bs, fdata[6]+bs, 0, cw);
+	coupling_region_multiply(fdata[6]+bs, 2, bs, fdata[7], 1, cw);
+	galois_region_xor(fdata[9], fdata[8]+bs, bs);
+	coupling_region_multiply(fdata[8]+bs, inv, bs, fdata[8]+bs, 0, cw);
+	galois_region_xor(fdata[9], fdata[8]+bs, bs);
+	coupling_region_multiply(fdata[8]+bs, inv, bs, fdata[8]+bs, 0, cw);
+	coupling_region_multiply(fdata[8]+bs, 2, bs, fdata[9], 1, cw);
+	galois_region_xor(fdata[11], fdata[10]+bs, bs);
+	coupling_region_multiply(fdata[10]+bs, inv, bs, fdata[10]+bs, 0, cw);
+	galois_region_xor(fdata[11], fdata[10]+bs, bs);
+	coupling_region_multiply(fdata[10]+bs, inv, bs, fdata[10]+bs, 0, cw);
+	coupling_region_multiply(fdata[10]+bs, 2, bs, fdata[11], 1, cw);
+	galois_region_xor(fdata[13], fdata[12]+bs, bs);
+	coupling_region_multiply(fdata[12]+bs, inv, bs, fdata[12]+bs, 0, cw);
+	galois_region_xor(fdata[13], fdata[12]+bs, bs);
+	coupling_region_multiply(fdata[12]+bs, inv, bs, fdata[12]+bs, 0, cw);
+	coupling_region_multiply(fdata[12]+bs, 2, bs, fdata[13], 1, cw);
+	galois_region_xor(fdata[15], fdata[14]+bs, bs);
+	coupling_region_multiply(fdata[14]+bs, inv, bs, fdata[14]+bs, 0, cw);
+	galois_region_xor(fdata[15], fdata[14]+bs, bs);
+	coupling_region_multiply(fdata[14]+bs, inv, bs, fdata[14]+bs, 0, cw);
+	coupling_region_multiply(fdata[14]+bs, 2, bs, fdata[15], 1, cw);
+	galois_region_xor(fdata[17], fdata[16]+bs, bs);
+	coupling_region_multiply(fdata[16]+bs, inv, bs, fdata[16]+bs, 0, cw);
+	galois_region_xor(fdata[17], fdata[16]+bs, bs);
+	coupling_region_multiply(fdata[16]+bs, inv, bs, fdata[16]+bs, 0, cw);
+	coupling_region_multiply(fdata[16]+bs, 2, bs, fdata[17], 1, cw);
+	galois_region_xor(fdata[19], fdata[18]+bs, bs);
+	coupling_region_multiply(fdata[18]+bs, inv, bs, fdata[18]+bs, 0, cw);
+	galois_region_xor(fdata[19], fdata[18]+bs, bs);
+	coupling_region_multiply(fdata[18]+bs, inv, bs, fdata[18]+bs, 0, cw);
+	coupling_region_multiply(fdata[18]+bs, 2, bs, fdata[19], 1, cw);
+	galois_region_xor(fdata[21], fdata[20]+bs, bs);
+	coupling_region_multiply(fdata[20]+bs, inv, bs, fdata[20]+bs, 0, cw);
+	galois_region_xor(fdata[21], fdata[20]+bs, bs);
+	coupling_region_multiply(fdata[20]+bs, inv, bs, fdata[20]+bs, 0, cw);
+	coupling_region_multiply(fdata[20]+bs, 2, bs, fdata[21], 1, cw);
+	galois_region_xor(fdata[23], fdata[22]+bs, bs);
+	coupling_region_multiply(fdata[22]+bs, inv, bs, fdata[22]+bs, 0, cw);
+	galois_region_xor(fdata[23], fdata[22]+bs, bs);
+	coupling_region_multiply(fdata[22]+bs, inv, bs, fdata[22]+bs, 0, cw);
+	coupling_region_multiply(fdata[22]+bs, 2, bs, fdata[23], 1, cw);
+	galois_region_xor(fdata[25], fdata[24]+bs, bs);
+	coupling_region_multiply(fdata[24]+bs, inv, bs, fdata[24]+bs, 0, cw);
+	galois_region_xor(fdata[25], fdata[24]+bs, bs);
+	coupling_region_multiply(fdata[24]+bs, inv, bs, fdata[24]+bs, 0, cw);
+	coupling_region_multiply(fdata[24]+bs, 2, bs, fdata[25], 1, cw);
+	galois_region_xor(fdata[27], fdata[26]+bs, bs);
+	coupling_region_multiply(fdata[26]+bs, inv, bs, fdata[26]+bs, 0, cw);
+	galois_region_xor(fdata[27], fdata[26]+bs, bs);
+	coupling_region_multiply(fdata[26]+bs, inv, bs, fdata[26]+bs, 0, cw);
+	coupling_region_multiply(fdata[26]+bs, 2, bs, fdata[27], 1, cw);
+	galois_region_xor(fdata[29], fdata[28]+bs, bs);
+	coupling_region_multiply(fdata[28]+bs, inv, bs, fdata[28]+bs, 0, cw);
+	galois_region_xor(fdata[29], fdata[28]+bs, bs);
+	coupling_region_multiply(fdata[28]+bs, inv, bs, fdata[28]+bs, 0, cw);
+	coupling_region_multiply(fdata[28]+bs, 2, bs, fdata[29], 1, cw);
+	galois_region_xor(fdata[31], fdata[30]+bs, bs);
+	coupling_region_multiply(fdata[30]+bs, inv, bs, fdata[30]+bs, 0, cw);
+	galois_region_xor(fdata[31], fdata[30]+bs, bs);
+	coupling_region_multiply(fdata[30]+bs, inv, bs, fdata[30]+bs, 0, cw);
+	coupling_region_multiply(fdata[30]+bs, 2, bs, fdata[31], 1, cw);
+	galois_region_xor(fdata[33], fdata[32]+bs, bs);
+	coupling_region_multiply(fdata[32]+bs, inv, bs, fdata[32]+bs, 0, cw);
+	galois_region_xor(fdata[33], fdata[32]+bs, bs);
+	coupling_region_multiply(fdata[32]+bs, inv, bs, fdata[32]+bs, 0, cw);
+	coupling_region_multiply(fdata[32]+bs, 2, bs, fdata[33], 1, cw);
+	galois_region_xor(fdata[35], fdata[34]+bs, bs);
+	coupling_region_multiply(fdata[34]+bs, inv, bs, fdata[34]+bs, 0, cw);
+	galois_region_xor(fdata[35], fdata[34]+bs, bs);
+	coupling_region_multiply(fdata[34]+bs, inv, bs, fdata[34]+bs, 0, cw);
+	coupling_region_multiply(fdata[34]+bs, 2, bs, fdata[35], 1, cw);
+	galois_region_xor(fdata[37], fdata[36]+bs, bs);
+	coupling_region_multiply(fdata[36]+bs, inv, bs, fdata[36]+bs, 0, cw);
+	galois_region_xor(fdata[37], fdata[36]+bs, bs);
+	coupling_region_multiply(fdata[36]+bs, inv, bs, fdata[36]+bs, 0, cw);
+	coupling_region_multiply(fdata[36]+bs, 2, bs, fdata[37], 1, cw);
+	galois_region_xor(fdata[39], fdata[38]+bs, bs);
+	coupling_region_multiply(fdata[38]+bs, inv, bs, fdata[38]+bs, 0, cw);
+	galois_region_xor(fdata[39], fdata[38]+bs, bs);
+	coupling_region_multiply(fdata[38]+bs, inv, bs, fdata[38]+bs, 0, cw);
+	coupling_region_multiply(fdata[38]+bs, 2, bs, fdata[39], 1, cw);
+	galois_region_xor(fdata[41], fdata[40]+bs, bs);
+	coupling_region_multiply(fdata[40]+bs, inv, bs, fdata[40]+bs, 0, cw);
+	galois_region_xor(fdata[41], fdata[40]+bs, bs);
+	coupling_region_multiply(fdata[40]+bs, inv, bs, fdata[40]+bs, 0, cw);
+	coupling_region_multiply(fdata[40]+bs, 2, bs, fdata[41], 1, cw);
+	galois_region_xor(fdata[43], fdata[42]+bs, bs);
+	coupling_region_multiply(fdata[42]+bs, inv, bs, fdata[42]+bs, 0, cw);
+	galois_region_xor(fdata[43], fdata[42]+bs, bs);
+	coupling_region_multiply(fdata[42]+bs, inv, bs, fdata[42]+bs, 0, cw);
+	coupling_region_multiply(fdata[42]+bs, 2, bs, fdata[43], 1, cw);
+	galois_region_xor(fdata[45], fdata[44]+bs, bs);
+	coupling_region_multiply(fdata[44]+bs, inv, bs, fdata[44]+bs, 0, cw);
+	galois_region_xor(fdata[45], fdata[44]+bs, bs);
+	coupling_region_multiply(fdata[44]+bs, inv, bs, fdata[44]+bs, 0, cw);
+	coupling_region_multiply(fdata[44]+bs, 2, bs, fdata[45], 1, cw);
+	galois_region_xor(fdata[47], fdata[46]+bs, bs);
+	coupling_region_multiply(fdata[46]+bs, inv, bs, fdata[46]+bs, 0, cw);
+	galois_region_xor(fdata[47], fdata[46]+bs, bs);
+	coupling_region_multiply(fdata[46]+bs, inv, bs, fdata[46]+bs, 0, cw);
+	coupling_region_multiply(fdata[46]+bs, 2, bs, fdata[47], 1, cw);
+	galois_region_xor(fdata[49], fdata[48]+bs, bs);
+	coupling_region_multiply(fdata[48]+bs, inv, bs, fdata[48]+bs, 0, cw);
+	galois_region_xor(fdata[49], fdata[48]+bs, bs);
+	coupling_region_multiply(fdata[48]+bs, inv, bs, fdata[48]+bs, 0, cw);
+	coupling_region_multiply(fdata[48]+bs, 2, bs, fdata[49], 1, cw);
+	galois_region_xor(fdata[51], fdata[50]+bs, bs);
+	coupling_region_multiply(fdata[50]+bs, inv, bs, fdata[50]+bs, 0, cw);
+	galois_region_xor(fdata[51], fdata[50]+bs, bs);
+	coupling_region_multiply(fdata[50]+bs, inv, bs, fdata[50]+bs, 0, cw);
+	coupling_region_multiply(fdata[50]+bs, 2, bs, fdata[51], 1, cw);
+	galois_region_xor(fdata[53], fdata[52]+bs, bs);
+	coupling_region_multiply(fdata[52]+bs, inv, bs, fdata[52]+bs, 0, cw);
+	galois_region_xor(fdata[53], fdata[52]+bs, bs);
+	coupling_region_multiply(fdata[52]+bs, inv, bs, fdata[52]+bs, 0, cw);
+	coupling_region_multiply(fdata[52]+bs, 2, bs, fdata[53], 1, cw);
+	galois_region_xor(fdata[55], fdata[54]+bs, bs);
+	coupling_region_multiply(fdata[54]+bs, inv, bs, fdata[54]+bs, 0, cw);
+	galois_region_xor(fdata[55], fdata[54]+bs, bs);
+	coupling_region_multiply(fdata[54]+bs, inv, bs, fdata[54]+bs, 0, cw);
+	coupling_region_multiply(fdata[54]+bs, 2, bs, fdata[55], 1, cw);
+	galois_region_xor(fdata[57], fdata[56]+bs, bs);
+	coupling_region_multiply(fdata[56]+bs, inv, bs, fdata[56]+bs, 0, cw);
+	galois_region_xor(fdata[57], fdata[56]+bs, bs);
+	coupling_region_multiply(fdata[56]+bs, inv, bs, fdata[56]+bs, 0, cw);
+	coupling_region_multiply(fdata[56]+bs, 2, bs, fdata[57], 1, cw);
+	galois_region_xor(fdata[59], fdata[58]+bs, bs);
+	coupling_region_multiply(fdata[58]+bs, inv, bs, fdata[58]+bs, 0, cw);
+	galois_region_xor(fdata[59], fdata[58]+bs, bs);
+	coupling_region_multiply(fdata[58]+bs, inv, bs, fdata[58]+bs, 0, cw);
+	coupling_region_multiply(fdata[58]+bs, 2, bs, fdata[59], 1, cw);
+	galois_region_xor(fdata[61], fdata[60]+bs, bs);
+	coupling_region_multiply(fdata[60]+bs, inv, bs, fdata[60]+bs, 0, cw);
+	galois_region_xor(fdata[61], fdata[60]+bs, bs);
+	coupling_region_multiply(fdata[60]+bs, inv, bs, fdata[60]+bs, 0, cw);
+	coupling_region_multiply(fdata[60]+bs, 2, bs, fdata[61], 1, cw);
+	galois_region_xor(fdata[63], fdata[62]+bs, bs);
+	coupling_region_multiply(fdata[62]+bs, inv, bs, fdata[62]+bs, 0, cw);
+	galois_region_xor(fdata[63], fdata[62]+bs, bs);
+	coupling_region_multiply(fdata[62]+bs, inv, bs, fdata[62]+bs, 0, cw);
+	coupling_region_multiply(fdata[62]+bs, 2, bs, fdata[63], 1, cw);
+	galois_region_xor(fdata[65], fdata[64]+bs, bs);
+	coupling_region_multiply(fdata[64]+bs, inv, bs, fdata[64]+bs, 0, cw);
+	galois_region_xor(fdata[65], fdata[64]+bs, bs);
+	coupling_region_multiply(fdata[64]+bs, inv, bs, fdata[64]+bs, 0, cw);
+	coupling_region_multiply(fdata[64]+bs, 2, bs, fdata[65], 1, cw);
+	galois_region_xor(fdata[67], fdata[66]+bs, bs);
+	coupling_region_multiply(fdata[66]+bs, inv, bs, fdata[66]+bs, 0, cw);
+	galois_region_xor(fdata[67], fdata[66]+bs, bs);
+	coupling_region_multiply(fdata[66]+bs, inv, bs, fdata[66]+bs, 0, cw);
+	coupling_region_multiply(fdata[66]+bs, 2, bs, fdata[67], 1, cw);
+	galois_region_xor(fdata[69], fdata[68]+bs, bs);
+	coupling_region_multiply(fdata[68]+bs, inv, bs, fdata[68]+bs, 0, cw);
+	galois_region_xor(fdata[69], fdata[68]+bs, bs);
+	coupling_region_multiply(fdata[68]+bs, inv, bs, fdata[68]+bs, 0, cw);
+	coupling_region_multiply(fdata[68]+bs, 2, bs, fdata[69], 1, cw);
+	galois_region_xor(fdata[71], fdata[70]+bs, bs);
+	coupling_region_multiply(fdata[70]+bs, inv, bs, fdata[70]+bs, 0, cw);
+	galois_region_xor(fdata[71], fdata[70]+bs, bs);
+	coupling_region_multiply(fdata[70]+bs, inv, bs, fdata[70]+bs, 0, cw);
+	coupling_region_multiply(fdata[70]+bs, 2, bs, fdata[71], 1, cw);
+	galois_region_xor(fdata[73], fdata[72]+bs, bs);
+	coupling_region_multiply(fdata[72]+bs, inv, bs, fdata[72]+bs, 0, cw);
+	galois_region_xor(fdata[73], fdata[72]+bs, bs);
+	coupling_region_multiply(fdata[72]+bs, inv, bs, fdata[72]+bs, 0, cw);
+	coupling_region_multiply(fdata[72]+bs, 2, bs, fdata[73], 1, cw);
+	galois_region_xor(fdata[75], fdata[74]+bs, bs);
+	coupling_region_multiply(fdata[74]+bs, inv, bs, fdata[74]+bs, 0, cw);
+	galois_region_xor(fdata[75], fdata[74]+bs, bs);
+	coupling_region_multiply(fdata[74]+bs, inv, bs, fdata[74]+bs, 0, cw);
+	coupling_region_multiply(fdata[74]+bs, 2, bs, fdata[75], 1, cw);
+	galois_region_xor(fdata[77], fdata[76]+bs, bs);
+	coupling_region_multiply(fdata[76]+bs, inv, bs, fdata[76]+bs, 0, cw);
+	galois_region_xor(fdata[77], fdata[76]+bs, bs);
+	coupling_region_multiply(fdata[76]+bs, inv, bs, fdata[76]+bs, 0, cw);
+	coupling_region_multiply(fdata[76]+bs, 2, bs, fdata[77], 1, cw);
+	galois_region_xor(fdata[79], fdata[78]+bs, bs);
+	coupling_region_multiply(fdata[78]+bs, inv, bs, fdata[78]+bs, 0, cw);
+	galois_region_xor(fdata[79], fdata[78]+bs, bs);
+	coupling_region_multiply(fdata[78]+bs, inv, bs, fdata[78]+bs, 0, cw);
+	coupling_region_multiply(fdata[78]+bs, 2, bs, fdata[79], 1, cw);
+	galois_region_xor(fdata[81], fdata[80]+bs, bs);
+	coupling_region_multiply(fdata[80]+bs, inv, bs, fdata[80]+bs, 0, cw);
+	galois_region_xor(fdata[81], fdata[80]+bs, bs);
+	coupling_region_multiply(fdata[80]+bs, inv, bs, fdata[80]+bs, 0, cw);
+	coupling_region_multiply(fdata[80]+bs, 2, bs, fdata[81], 1, cw);
+	galois_region_xor(fdata[83], fdata[82]+bs, bs);
+	coupling_region_multiply(fdata[82]+bs, inv, bs, fdata[82]+bs, 0, cw);
+	galois_region_xor(fdata[83], fdata[82]+bs, bs);
+	coupling_region_multiply(fdata[82]+bs, inv, bs, fdata[82]+bs, 0, cw);
+	coupling_region_multiply(fdata[82]+bs, 2, bs, fdata[83], 1, cw);
+	galois_region_xor(fdata[85], fdata[84]+bs, bs);
+	coupling_region_multiply(fdata[84]+bs, inv, bs, fdata[84]+bs, 0, cw);
+	galois_region_xor(fdata[85], fdata[84]+bs, bs);
+	coupling_region_multiply(fdata[84]+bs, inv, bs, fdata[84]+bs, 0, cw);
+	coupling_region_multiply(fdata[84]+bs, 2, bs, fdata[85], 1, cw);
+	galois_region_xor(fdata[87], fdata[86]+bs, bs);
+	coupling_region_multiply(fdata[86]+bs, inv, bs, fdata[86]+bs, 0, cw);
+	galois_region_xor(fdata[87], fdata[86]+bs, bs);
+	coupling_region_multiply(fdata[86]+bs, inv, bs, fdata[86]+bs, 0, cw);
+	coupling_region_multiply(fdata[86]+bs, 2, bs, fdata[87], 1, cw);
+	galois_region_xor(fdata[89], fdata[88]+bs, bs);
+	coupling_region_multiply(fdata[88]+bs, inv, bs, fdata[88]+bs, 0, cw);
+	galois_region_xor(fdata[89], fdata[88]+bs, bs);
+	coupling_region_multiply(fdata[88]+bs, inv, bs, fdata[88]+bs, 0, cw);
+	coupling_region_multiply(fdata[88]+bs, 2, bs, fdata[89], 1, cw);
+	galois_region_xor(fdata[91], fdata[90]+bs, bs);
+	coupling_region_multiply(fdata[90]+bs, inv, bs, fdata[90]+bs, 0, cw);
+	galois_region_xor(fdata[91], fdata[90]+bs, bs);
+	coupling_region_multiply(fdata[90]+bs, inv, bs, fdata[90]+bs, 0, cw);
+	coupling_region_multiply(fdata[90]+bs, 2, bs, fdata[91], 1, cw);
+	galois_region_xor(fdata[93], fdata[92]+bs, bs);
+	coupling_region_multiply(fdata[92]+bs, inv, bs, fdata[92]+bs, 0, cw);
+	galois_region_xor(fdata[93], fdata[92]+bs, bs);
+	coupling_region_multiply(fdata[92]+bs, inv, bs, fdata[92]+bs, 0, cw);
+	coupling_region_multiply(fdata[92]+bs, 2, bs, fdata[93], 1, cw);
+	galois_region_xor(fdata[95], fdata[94]+bs, bs);
+	coupling_region_multiply(fdata[94]+bs, inv, bs, fdata[94]+bs, 0, cw);
+	galois_region_xor(fdata[95], fdata[94]+bs, bs);
+	coupling_region_multiply(fdata[94]+bs, inv, bs, fdata[94]+bs, 0, cw);
+	coupling_region_multiply(fdata[94]+bs, 2, bs, fdata[95], 1, cw);
+	galois_region_xor(fdata[97], fdata[96]+bs, bs);
+	coupling_region_multiply(fdata[96]+bs, inv, bs, fdata[96]+bs, 0, cw);
+	galois_region_xor(fdata[97], fdata[96]+bs, bs);
+	coupling_region_multiply(fdata[96]+bs, inv, bs, fdata[96]+bs, 0, cw);
+	coupling_region_multiply(fdata[96]+bs, 2, bs, fdata[97], 1, cw);
+	galois_region_xor(fdata[99], fdata[98]+bs, bs);
+	coupling_region_multiply(fdata[98]+bs, inv, bs, fdata[98]+bs, 0, cw);
+	galois_region_xor(fdata[99], fdata[98]+bs, bs);
+	coupling_region_multiply(fdata[98]+bs, inv, bs, fdata[98]+bs, 0, cw);
+	coupling_region_multiply(fdata[98]+bs, 2, bs, fdata[99], 1, cw);
+	galois_region_xor(fdata[101], fdata[100]+bs, bs);
+	coupling_region_multiply(fdata[100]+bs, inv, bs, fdata[100]+bs, 0, cw);
+	galois_region_xor(fdata[101], fdata[100]+bs, bs);
+	coupling_region_multiply(fdata[100]+bs, inv, bs, fdata[100]+bs, 0, cw);
+	coupling_region_multiply(fdata[100]+bs, 2, bs, fdata[101], 1, cw);
+	galois_region_xor(fdata[103], fdata[102]+bs, bs);
+	coupling_region_multiply(fdata[102]+bs, inv, bs, fdata[102]+bs, 0, cw);
+	galois_region_xor(fdata[103], fdata[102]+bs, bs);
+	coupling_region_multiply(fdata[102]+bs, inv, bs, fdata[102]+bs, 0, cw);
+	coupling_region_multiply(fdata[102]+bs, 2, bs, fdata[103], 1, cw);
+	galois_region_xor(fdata[105], fdata[104]+bs, bs);
+	coupling_region_multiply(fdata[104]+bs, inv, bs, fdata[104]+bs, 0, cw);
+	galois_region_xor(fdata[105], fdata[104]+bs, bs);
+	coupling_region_multiply(fdata[104]+bs, inv, bs, fdata[104]+bs, 0, cw);
+	coupling_region_multiply(fdata[104]+bs, 2, bs, fdata[105], 1, cw);
+	galois_region_xor(fdata[107], fdata[106]+bs, bs);
+	coupling_region_multiply(fdata[106]+bs, inv, bs, fdata[106]+bs, 0, cw);
+	galois_region_xor(fdata[107], fdata[106]+bs, bs);
+	coupling_region_multiply(fdata[106]+bs, inv, bs, fdata[106]+bs, 0, cw);
+	coupling_region_multiply(fdata[106]+bs, 2, bs, fdata[107], 1, cw);
+	galois_region_xor(fdata[109], fdata[108]+bs, bs);
+	coupling_region_multiply(fdata[108]+bs, inv, bs, fdata[108]+bs, 0, cw);
+	galois_region_xor(fdata[109], fdata[108]+bs, bs);
+	coupling_region_multiply(fdata[108]+bs, inv, bs, fdata[108]+bs, 0, cw);
+	coupling_region_multiply(fdata[108]+bs, 2, bs, fdata[109], 1, cw);
+	galois_region_xor(fdata[111], fdata[110]+bs, bs);
+	coupling_region_multiply(fdata[110]+bs, inv, bs, fdata[110]+bs, 0, cw);
+	galois_region_xor(fdata[111], fdata[110]+bs, bs);
+	coupling_region_multiply(fdata[110]+bs, inv, bs, fdata[110]+bs, 0, cw);
+	coupling_region_multiply(fdata[110]+bs, 2, bs, fdata[111], 1, cw);
+	galois_region_xor(fdata[113], fdata[112]+bs, bs);
+	coupling_region_multiply(fdata[112]+bs, inv, bs, fdata[112]+bs, 0, cw);
+	galois_region_xor(fdata[113], fdata[112]+bs, bs);
+	coupling_region_multiply(fdata[112]+bs, inv, bs, fdata[112]+bs, 0, cw);
+	coupling_region_multiply(fdata[112]+bs, 2, bs, fdata[113], 1, cw);
+	galois_region_xor(fdata[115], fdata[114]+bs, bs);
+	coupling_region_multiply(fdata[114]+bs, inv, bs, fdata[114]+bs, 0, cw);
+	galois_region_xor(fdata[115], fdata[114]+bs, bs);
+	coupling_region_multiply(fdata[114]+bs, inv, bs, fdata[114]+bs, 0, cw);
+	coupling_region_multiply(fdata[114]+bs, 2, bs, fdata[115], 1, cw);
+	galois_region_xor(fdata[117], fdata[116]+bs, bs);
+	coupling_region_multiply(fdata[116]+bs, inv, bs, fdata[116]+bs, 0, cw);
+	galois_region_xor(fdata[117], fdata[116]+bs, bs);
+	coupling_region_multiply(fdata[116]+bs, inv, bs, fdata[116]+bs, 0, cw);
+	coupling_region_multiply(fdata[116]+bs, 2, bs, fdata[117], 1, cw);
+	galois_region_xor(fdata[119], fdata[118]+bs, bs);
+	coupling_region_multiply(fdata[118]+bs, inv, bs, fdata[118]+bs, 0, cw);
+	galois_region_xor(fdata[119], fdata[118]+bs, bs);
+	coupling_region_multiply(fdata[118]+bs, inv, bs, fdata[118]+bs, 0, cw);
+	coupling_region_multiply(fdata[118]+bs, 2, bs, fdata[119], 1, cw);
+	galois_region_xor(fdata[121], fdata[120]+bs, bs);
+	coupling_region_multiply(fdata[120]+bs, inv, bs, fdata[120]+bs, 0, cw);
+	galois_region_xor(fdata[121], fdata[120]+bs, bs);
+	coupling_region_multiply(fdata[120]+bs, inv, bs, fdata[120]+bs, 0, cw);
+	coupling_region_multiply(fdata[120]+bs, 2, bs, fdata[121], 1, cw);
+	galois_region_xor(fdata[123], fdata[122]+bs, bs);
+	coupling_region_multiply(fdata[122]+bs, inv, bs, fdata[122]+bs, 0, cw);
+	galois_region_xor(fdata[123], fdata[122]+bs, bs);
+	coupling_region_multiply(fdata[122]+bs, inv, bs, fdata[122]+bs, 0, cw);
+	coupling_region_multiply(fdata[122]+bs, 2, bs, fdata[123], 1, cw);
+	galois_region_xor(fdata[125], fdata[124]+bs, bs);
+	coupling_region_multiply(fdata[124]+bs, inv, bs, fdata[124]+bs, 0, cw);
+	galois_region_xor(fdata[125], fdata[124]+bs, bs);
+	coupling_region_multiply(fdata[124]+bs, inv, bs, fdata[124]+bs, 0, cw);
+	coupling_region_multiply(fdata[124]+bs, 2, bs, fdata[125], 1, cw);
+	galois_region_xor(fdata[127], fdata[126]+bs, bs);
+	coupling_region_multiply(fdata[126]+bs, inv, bs, fdata[126]+bs, 0, cw);
+	galois_region_xor(fdata[127], fdata[126]+bs, bs);
+	coupling_region_multiply(fdata[126]+bs, inv, bs, fdata[126]+bs, 0, cw);
+	coupling_region_multiply(fdata[126]+bs, 2, bs, fdata[127], 1, cw);
+	galois_region_xor(fdata[2]+2*bs, fdata[0]+3*bs, bs);
+	coupling_region_multiply(fdata[0]+3*bs, inv, bs, fdata[0]+3*bs, 0, cw);
+	galois_region_xor(fdata[2]+2*bs, fdata[0]+3*bs, bs);
+	coupling_region_multiply(fdata[0]+3*bs, inv, bs, fdata[0]+3*bs, 0, cw);
+	galois_region_xor(fdata[3]+2*bs, fdata[1]+3*bs, bs);
+	coupling_region_multiply(fdata[1]+3*bs, inv, bs, fdata[1]+3*bs, 0, cw);
+	galois_region_xor(fdata[3]+2*bs, fdata[1]+3*bs, bs);
+	coupling_region_multiply(fdata[1]+3*bs, inv, bs, fdata[1]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[0]+3*bs, 2, bs, fdata[2]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[1]+3*bs, 2, bs, fdata[3]+2*bs, 1, cw);
+	galois_region_xor(fdata[6]+2*bs, fdata[4]+3*bs, bs);
+	coupling_region_multiply(fdata[4]+3*bs, inv, bs, fdata[4]+3*bs, 0, cw);
+	galois_region_xor(fdata[6]+2*bs, fdata[4]+3*bs, bs);
+	coupling_region_multiply(fdata[4]+3*bs, inv, bs, fdata[4]+3*bs, 0, cw);
+	galois_region_xor(fdata[7]+2*bs, fdata[5]+3*bs, bs);
+	coupling_region_multiply(fdata[5]+3*bs, inv, bs, fdata[5]+3*bs, 0, cw);
+	galois_region_xor(fdata[7]+2*bs, fdata[5]+3*bs, bs);
+	coupling_region_multiply(fdata[5]+3*bs, inv, bs, fdata[5]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[4]+3*bs, 2, bs, fdata[6]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[5]+3*bs, 2, bs, fdata[7]+2*bs, 1, cw);
+	galois_region_xor(fdata[10]+2*bs, fdata[8]+3*bs, bs);
+	coupling_region_multiply(fdata[8]+3*bs, inv, bs, fdata[8]+3*bs, 0, cw);
+	galois_region_xor(fdata[10]+2*bs, fdata[8]+3*bs, bs);
+	coupling_region_multiply(fdata[8]+3*bs, inv, bs, fdata[8]+3*bs, 0, cw);
+	galois_region_xor(fdata[11]+2*bs, fdata[9]+3*bs, bs);
+	coupling_region_multiply(fdata[9]+3*bs, inv, bs, fdata[9]+3*bs, 0, cw);
+	galois_region_xor(fdata[11]+2*bs, fdata[9]+3*bs, bs);
+	coupling_region_multiply(fdata[9]+3*bs, inv, bs, fdata[9]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[8]+3*bs, 2, bs, fdata[10]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[9]+3*bs, 2, bs, fdata[11]+2*bs, 1, cw);
+	galois_region_xor(fdata[14]+2*bs, fdata[12]+3*bs, bs);
+	coupling_region_multiply(fdata[12]+3*bs, inv, bs, fdata[12]+3*bs, 0, cw);
+	galois_region_xor(fdata[14]+2*bs, fdata[12]+3*bs, bs);
+	coupling_region_multiply(fdata[12]+3*bs, inv, bs, fdata[12]+3*bs, 0, cw);
+	galois_region_xor(fdata[15]+2*bs, fdata[13]+3*bs, bs);
+	coupling_region_multiply(fdata[13]+3*bs, inv, bs, fdata[13]+3*bs, 0, cw);
+	galois_region_xor(fdata[15]+2*bs, fdata[13]+3*bs, bs);
+	coupling_region_multiply(fdata[13]+3*bs, inv, bs, fdata[13]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[12]+3*bs, 2, bs, fdata[14]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[13]+3*bs, 2, bs, fdata[15]+2*bs, 1, cw);
+	galois_region_xor(fdata[18]+2*bs, fdata[16]+3*bs, bs);
+	coupling_region_multiply(fdata[16]+3*bs, inv, bs, fdata[16]+3*bs, 0, cw);
+	galois_region_xor(fdata[18]+2*bs, fdata[16]+3*bs, bs);
+	coupling_region_multiply(fdata[16]+3*bs, inv, bs, fdata[16]+3*bs, 0, cw);
+	galois_region_xor(fdata[19]+2*bs, fdata[17]+3*bs, bs);
+	coupling_region_multiply(fdata[17]+3*bs, inv, bs, fdata[17]+3*bs, 0, cw);
+	galois_region_xor(fdata[19]+2*bs, fdata[17]+3*bs, bs);
+	coupling_region_multiply(fdata[17]+3*bs, inv, bs, fdata[17]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[16]+3*bs, 2, bs, fdata[18]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[17]+3*bs, 2, bs, fdata[19]+2*bs, 1, cw);
+	galois_region_xor(fdata[22]+2*bs, fdata[20]+3*bs, bs);
+	coupling_region_multiply(fdata[20]+3*bs, inv, bs, fdata[20]+3*bs, 0, cw);
+	galois_region_xor(fdata[22]+2*bs, fdata[20]+3*bs, bs);
+	coupling_region_multiply(fdata[20]+3*bs, inv, bs, fdata[20]+3*bs, 0, cw);
+	galois_region_xor(fdata[23]+2*bs, fdata[21]+3*bs, bs);
+	coupling_region_multiply(fdata[21]+3*bs, inv, bs, fdata[21]+3*bs, 0, cw);
+	galois_region_xor(fdata[23]+2*bs, fdata[21]+3*bs, bs);
+	coupling_region_multiply(fdata[21]+3*bs, inv, bs, fdata[21]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[20]+3*bs, 2, bs, fdata[22]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[21]+3*bs, 2, bs, fdata[23]+2*bs, 1, cw);
+	galois_region_xor(fdata[26]+2*bs, fdata[24]+3*bs, bs);
+	coupling_region_multiply(fdata[24]+3*bs, inv, bs, fdata[24]+3*bs, 0, cw);
+	galois_region_xor(fdata[26]+2*bs, fdata[24]+3*bs, bs);
+	coupling_region_multiply(fdata[24]+3*bs, inv, bs, fdata[24]+3*bs, 0, cw);
+	galois_region_xor(fdata[27]+2*bs, fdata[25]+3*bs, bs);
+	coupling_region_multiply(fdata[25]+3*bs, inv, bs, fdata[25]+3*bs, 0, cw);
+	galois_region_xor(fdata[27]+2*bs, fdata[25]+3*bs, bs);
+	coupling_region_multiply(fdata[25]+3*bs, inv, bs, fdata[25]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[24]+3*bs, 2, bs, fdata[26]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[25]+3*bs, 2, bs, fdata[27]+2*bs, 1, cw);
+	galois_region_xor(fdata[30]+2*bs, fdata[28]+3*bs, bs);
+	coupling_region_multiply(fdata[28]+3*bs, inv, bs, fdata[28]+3*bs, 0, cw);
+	galois_region_xor(fdata[30]+2*bs, fdata[28]+3*bs, bs);
+	coupling_region_multiply(fdata[28]+3*bs, inv, bs, fdata[28]+3*bs, 0, cw);
+	galois_region_xor(fdata[31]+2*bs, fdata[29]+3*bs, bs);
+	coupling_region_multiply(fdata[29]+3*bs, inv, bs, fdata[29]+3*bs, 0, cw);
+	galois_region_xor(fdata[31]+2*bs, fdata[29]+3*bs, bs);
+	coupling_region_multiply(fdata[29]+3*bs, inv, bs, fdata[29]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[28]+3*bs, 2, bs, fdata[30]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[29]+3*bs, 2, bs, fdata[31]+2*bs, 1, cw);
+	galois_region_xor(fdata[34]+2*bs, fdata[32]+3*bs, bs);
+	coupling_region_multiply(fdata[32]+3*bs, inv, bs, fdata[32]+3*bs, 0, cw);
+	galois_region_xor(fdata[34]+2*bs, fdata[32]+3*bs, bs);
+	coupling_region_multiply(fdata[32]+3*bs, inv, bs, fdata[32]+3*bs, 0, cw);
+	galois_region_xor(fdata[35]+2*bs, fdata[33]+3*bs, bs);
+	coupling_region_multiply(fdata[33]+3*bs, inv, bs, fdata[33]+3*bs, 0, cw);
+	galois_region_xor(fdata[35]+2*bs, fdata[33]+3*bs, bs);
+	coupling_region_multiply(fdata[33]+3*bs, inv, bs, fdata[33]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[32]+3*bs, 2, bs, fdata[34]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[33]+3*bs, 2, bs, fdata[35]+2*bs, 1, cw);
+	galois_region_xor(fdata[38]+2*bs, fdata[36]+3*bs, bs);
+	coupling_region_multiply(fdata[36]+3*bs, inv, bs, fdata[36]+3*bs, 0, cw);
+	galois_region_xor(fdata[38]+2*bs, fdata[36]+3*bs, bs);
+	coupling_region_multiply(fdata[36]+3*bs, inv, bs, fdata[36]+3*bs, 0, cw);
+	galois_region_xor(fdata[39]+2*bs, fdata[37]+3*bs, bs);
+	coupling_region_multiply(fdata[37]+3*bs, inv, bs, fdata[37]+3*bs, 0, cw);
+	galois_region_xor(fdata[39]+2*bs, fdata[37]+3*bs, bs);
+	coupling_region_multiply(fdata[37]+3*bs, inv, bs, fdata[37]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[36]+3*bs, 2, bs, fdata[38]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[37]+3*bs, 2, bs, fdata[39]+2*bs, 1, cw);
+	galois_region_xor(fdata[42]+2*bs, fdata[40]+3*bs, bs);
+	coupling_region_multiply(fdata[40]+3*bs, inv, bs, fdata[40]+3*bs, 0, cw);
+	galois_region_xor(fdata[42]+2*bs, fdata[40]+3*bs, bs);
+	coupling_region_multiply(fdata[40]+3*bs, inv, bs, fdata[40]+3*bs, 0, cw);
+	galois_region_xor(fdata[43]+2*bs, fdata[41]+3*bs, bs);
+	coupling_region_multiply(fdata[41]+3*bs, inv, bs, fdata[41]+3*bs, 0, cw);
+	galois_region_xor(fdata[43]+2*bs, fdata[41]+3*bs, bs);
+	coupling_region_multiply(fdata[41]+3*bs, inv, bs, fdata[41]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[40]+3*bs, 2, bs, fdata[42]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[41]+3*bs, 2, bs, fdata[43]+2*bs, 1, cw);
+	galois_region_xor(fdata[46]+2*bs, fdata[44]+3*bs, bs);
+	coupling_region_multiply(fdata[44]+3*bs, inv, bs, fdata[44]+3*bs, 0, cw);
+	galois_region_xor(fdata[46]+2*bs, fdata[44]+3*bs, bs);
+	coupling_region_multiply(fdata[44]+3*bs, inv, bs, fdata[44]+3*bs, 0, cw);
+	galois_region_xor(fdata[47]+2*bs, fdata[45]+3*bs, bs);
+	coupling_region_multiply(fdata[45]+3*bs, inv, bs, fdata[45]+3*bs, 0, cw);
+	galois_region_xor(fdata[47]+2*bs, fdata[45]+3*bs, bs);
+	coupling_region_multiply(fdata[45]+3*bs, inv, bs, fdata[45]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[44]+3*bs, 2, bs, fdata[46]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[45]+3*bs, 2, bs, fdata[47]+2*bs, 1, cw);
+	galois_region_xor(fdata[50]+2*bs, fdata[48]+3*bs, bs);
+	coupling_region_multiply(fdata[48]+3*bs, inv, bs, fdata[48]+3*bs, 0, cw);
+	galois_region_xor(fdata[50]+2*bs, fdata[48]+3*bs, bs);
+	coupling_region_multiply(fdata[48]+3*bs, inv, bs, fdata[48]+3*bs, 0, cw);
+	galois_region_xor(fdata[51]+2*bs, fdata[49]+3*bs, bs);
+	coupling_region_multiply(fdata[49]+3*bs, inv, bs, fdata[49]+3*bs, 0, cw);
+	galois_region_xor(fdata[51]+2*bs, fdata[49]+3*bs, bs);
+	coupling_region_multiply(fdata[49]+3*bs, inv, bs, fdata[49]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[48]+3*bs, 2, bs, fdata[50]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[49]+3*bs, 2, bs, fdata[51]+2*bs, 1, cw);
+	galois_region_xor(fdata[54]+2*bs, fdata[52]+3*bs, bs);
+	coupling_region_multiply(fdata[52]+3*bs, inv, bs, fdata[52]+3*bs, 0, cw);
+	galois_region_xor(fdata[54]+2*bs, fdata[52]+3*bs, bs);
+	coupling_region_multiply(fdata[52]+3*bs, inv, bs, fdata[52]+3*bs, 0, cw);
+	galois_region_xor(fdata[55]+2*bs, fdata[53]+3*bs, bs);
+	coupling_region_multiply(fdata[53]+3*bs, inv, bs, fdata[53]+3*bs, 0, cw);
+	galois_region_xor(fdata[55]+2*bs, fdata[53]+3*bs, bs);
+	coupling_region_multiply(fdata[53]+3*bs, inv, bs, fdata[53]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[52]+3*bs, 2, bs, fdata[54]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[53]+3*bs, 2, bs, fdata[55]+2*bs, 1, cw);
+	galois_region_xor(fdata[58]+2*bs, fdata[56]+3*bs, bs);
+	coupling_region_multiply(fdata[56]+3*bs, inv, bs, fdata[56]+3*bs, 0, cw);
+	galois_region_xor(fdata[58]+2*bs, fdata[56]+3*bs, bs);
+	coupling_region_multiply(fdata[56]+3*bs, inv, bs, fdata[56]+3*bs, 0, cw);
+	galois_region_xor(fdata[59]+2*bs, fdata[57]+3*bs, bs);
+	coupling_region_multiply(fdata[57]+3*bs, inv, bs, fdata[57]+3*bs, 0, cw);
+	galois_region_xor(fdata[59]+2*bs, fdata[57]+3*bs, bs);
+	coupling_region_multiply(fdata[57]+3*bs, inv, bs, fdata[57]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[56]+3*bs, 2, bs, fdata[58]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[57]+3*bs, 2, bs, fdata[59]+2*bs, 1, cw);
+	galois_region_xor(fdata[62]+2*bs, fdata[60]+3*bs, bs);
+	coupling_region_multiply(fdata[60]+3*bs, inv, bs, fdata[60]+3*bs, 0, cw);
+	galois_region_xor(fdata[62]+2*bs, fdata[60]+3*bs, bs);
+	coupling_region_multiply(fdata[60]+3*bs, inv, bs, fdata[60]+3*bs, 0, cw);
+	galois_region_xor(fdata[63]+2*bs, fdata[61]+3*bs, bs);
+	coupling_region_multiply(fdata[61]+3*bs, inv, bs, fdata[61]+3*bs, 0, cw);
+	galois_region_xor(fdata[63]+2*bs, fdata[61]+3*bs, bs);
+	coupling_region_multiply(fdata[61]+3*bs, inv, bs, fdata[61]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[60]+3*bs, 2, bs, fdata[62]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[61]+3*bs, 2, bs, fdata[63]+2*bs, 1, cw);
+	galois_region_xor(fdata[66]+2*bs, fdata[64]+3*bs, bs);
+	coupling_region_multiply(fdata[64]+3*bs, inv, bs, fdata[64]+3*bs, 0, cw);
+	galois_region_xor(fdata[66]+2*bs, fdata[64]+3*bs, bs);
+	coupling_region_multiply(fdata[64]+3*bs, inv, bs, fdata[64]+3*bs, 0, cw);
+	galois_region_xor(fdata[67]+2*bs, fdata[65]+3*bs, bs);
+	coupling_region_multiply(fdata[65]+3*bs, inv, bs, fdata[65]+3*bs, 0, cw);
+	galois_region_xor(fdata[67]+2*bs, fdata[65]+3*bs, bs);
+	coupling_region_multiply(fdata[65]+3*bs, inv, bs, fdata[65]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[64]+3*bs, 2, bs, fdata[66]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[65]+3*bs, 2, bs, fdata[67]+2*bs, 1, cw);
+	galois_region_xor(fdata[70]+2*bs, fdata[68]+3*bs, bs);
+	coupling_region_multiply(fdata[68]+3*bs, inv, bs, fdata[68]+3*bs, 0, cw);
+	galois_region_xor(fdata[70]+2*bs, fdata[68]+3*bs, bs);
+	coupling_region_multiply(fdata[68]+3*bs, inv, bs, fdata[68]+3*bs, 0, cw);
+	galois_region_xor(fdata[71]+2*bs, fdata[69]+3*bs, bs);
+	coupling_region_multiply(fdata[69]+3*bs, inv, bs, fdata[69]+3*bs, 0, cw);
+	galois_region_xor(fdata[71]+2*bs, fdata[69]+3*bs, bs);
+	coupling_region_multiply(fdata[69]+3*bs, inv, bs, fdata[69]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[68]+3*bs, 2, bs, fdata[70]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[69]+3*bs, 2, bs, fdata[71]+2*bs, 1, cw);
+	galois_region_xor(fdata[74]+2*bs, fdata[72]+3*bs, bs);
+	coupling_region_multiply(fdata[72]+3*bs, inv, bs, fdata[72]+3*bs, 0, cw);
+	galois_region_xor(fdata[74]+2*bs, fdata[72]+3*bs, bs);
+	coupling_region_multiply(fdata[72]+3*bs, inv, bs, fdata[72]+3*bs, 0, cw);
+	galois_region_xor(fdata[75]+2*bs, fdata[73]+3*bs, bs);
+	coupling_region_multiply(fdata[73]+3*bs, inv, bs, fdata[73]+3*bs, 0, cw);
+	galois_region_xor(fdata[75]+2*bs, fdata[73]+3*bs, bs);
+	coupling_region_multiply(fdata[73]+3*bs, inv, bs, fdata[73]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[72]+3*bs, 2, bs, fdata[74]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[73]+3*bs, 2, bs, fdata[75]+2*bs, 1, cw);
+	galois_region_xor(fdata[78]+2*bs, fdata[76]+3*bs, bs);
+	coupling_region_multiply(fdata[76]+3*bs, inv, bs, fdata[76]+3*bs, 0, cw);
+	galois_region_xor(fdata[78]+2*bs, fdata[76]+3*bs, bs);
+	coupling_region_multiply(fdata[76]+3*bs, inv, bs, fdata[76]+3*bs, 0, cw);
+	galois_region_xor(fdata[79]+2*bs, fdata[77]+3*bs, bs);
+	coupling_region_multiply(fdata[77]+3*bs, inv, bs, fdata[77]+3*bs, 0, cw);
+	galois_region_xor(fdata[79]+2*bs, fdata[77]+3*bs, bs);
+	coupling_region_multiply(fdata[77]+3*bs, inv, bs, fdata[77]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[76]+3*bs, 2, bs, fdata[78]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[77]+3*bs, 2, bs, fdata[79]+2*bs, 1, cw);
+	galois_region_xor(fdata[82]+2*bs, fdata[80]+3*bs, bs);
+	coupling_region_multiply(fdata[80]+3*bs, inv, bs, fdata[80]+3*bs, 0, cw);
+	galois_region_xor(fdata[82]+2*bs, fdata[80]+3*bs, bs);
+	coupling_region_multiply(fdata[80]+3*bs, inv, bs, fdata[80]+3*bs, 0, cw);
+	galois_region_xor(fdata[83]+2*bs, fdata[81]+3*bs, bs);
+	coupling_region_multiply(fdata[81]+3*bs, inv, bs, fdata[81]+3*bs, 0, cw);
+	galois_region_xor(fdata[83]+2*bs, fdata[81]+3*bs, bs);
+	coupling_region_multiply(fdata[81]+3*bs, inv, bs, fdata[81]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[80]+3*bs, 2, bs, fdata[82]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[81]+3*bs, 2, bs, fdata[83]+2*bs, 1, cw);
+	galois_region_xor(fdata[86]+2*bs, fdata[84]+3*bs, bs);
+	coupling_region_multiply(fdata[84]+3*bs, inv, bs, fdata[84]+3*bs, 0, cw);
+	galois_region_xor(fdata[86]+2*bs, fdata[84]+3*bs, bs);
+	coupling_region_multiply(fdata[84]+3*bs, inv, bs, fdata[84]+3*bs, 0, cw);
+	galois_region_xor(fdata[87]+2*bs, fdata[85]+3*bs, bs);
+	coupling_region_multiply(fdata[85]+3*bs, inv, bs, fdata[85]+3*bs, 0, cw);
+	galois_region_xor(fdata[87]+2*bs, fdata[85]+3*bs, bs);
+	coupling_region_multiply(fdata[85]+3*bs, inv, bs, fdata[85]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[84]+3*bs, 2, bs, fdata[86]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[85]+3*bs, 2, bs, fdata[87]+2*bs, 1, cw);
+	galois_region_xor(fdata[90]+2*bs, fdata[88]+3*bs, bs);
+	coupling_region_multiply(fdata[88]+3*bs, inv, bs, fdata[88]+3*bs, 0, cw);
+	galois_region_xor(fdata[90]+2*bs, fdata[88]+3*bs, bs);
+	coupling_region_multiply(fdata[88]+3*bs, inv, bs, fdata[88]+3*bs, 0, cw);
+	galois_region_xor(fdata[91]+2*bs, fdata[89]+3*bs, bs);
+	coupling_region_multiply(fdata[89]+3*bs, inv, bs, fdata[89]+3*bs, 0, cw);
+	galois_region_xor(fdata[91]+2*bs, fdata[89]+3*bs, bs);
+	coupling_region_multiply(fdata[89]+3*bs, inv, bs, fdata[89]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[88]+3*bs, 2, bs, fdata[90]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[89]+3*bs, 2, bs, fdata[91]+2*bs, 1, cw);
+	galois_region_xor(fdata[94]+2*bs, fdata[92]+3*bs, bs);
+	coupling_region_multiply(fdata[92]+3*bs, inv, bs, fdata[92]+3*bs, 0, cw);
+	galois_region_xor(fdata[94]+2*bs, fdata[92]+3*bs, bs);
+	coupling_region_multiply(fdata[92]+3*bs, inv, bs, fdata[92]+3*bs, 0, cw);
+	galois_region_xor(fdata[95]+2*bs, fdata[93]+3*bs, bs);
+	coupling_region_multiply(fdata[93]+3*bs, inv, bs, fdata[93]+3*bs, 0, cw);
+	galois_region_xor(fdata[95]+2*bs, fdata[93]+3*bs, bs);
+	coupling_region_multiply(fdata[93]+3*bs, inv, bs, fdata[93]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[92]+3*bs, 2, bs, fdata[94]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[93]+3*bs, 2, bs, fdata[95]+2*bs, 1, cw);
+	galois_region_xor(fdata[98]+2*bs, fdata[96]+3*bs, bs);
+	coupling_region_multiply(fdata[96]+3*bs, inv, bs, fdata[96]+3*bs, 0, cw);
+	galois_region_xor(fdata[98]+2*bs, fdata[96]+3*bs, bs);
+	coupling_region_multiply(fdata[96]+3*bs, inv, bs, fdata[96]+3*bs, 0, cw);
+	galois_region_xor(fdata[99]+2*bs, fdata[97]+3*bs, bs);
+	coupling_region_multiply(fdata[97]+3*bs, inv, bs, fdata[97]+3*bs, 0, cw);
+	galois_region_xor(fdata[99]+2*bs, fdata[97]+3*bs, bs);
+	coupling_region_multiply(fdata[97]+3*bs, inv, bs, fdata[97]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[96]+3*bs, 2, bs, fdata[98]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[97]+3*bs, 2, bs, fdata[99]+2*bs, 1, cw);
+	galois_region_xor(fdata[102]+2*bs, fdata[100]+3*bs, bs);
+	coupling_region_multiply(fdata[100]+3*bs, inv, bs, fdata[100]+3*bs, 0, cw);
+	galois_region_xor(fdata[102]+2*bs, fdata[100]+3*bs, bs);
+	coupling_region_multiply(fdata[100]+3*bs, inv, bs, fdata[100]+3*bs, 0, cw);
+	galois_region_xor(fdata[103]+2*bs, fdata[101]+3*bs, bs);
+	coupling_region_multiply(fdata[101]+3*bs, inv, bs, fdata[101]+3*bs, 0, cw);
+	galois_region_xor(fdata[103]+2*bs, fdata[101]+3*bs, bs);
+	coupling_region_multiply(fdata[101]+3*bs, inv, bs, fdata[101]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[100]+3*bs, 2, bs, fdata[102]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[101]+3*bs, 2, bs, fdata[103]+2*bs, 1, cw);
+	galois_region_xor(fdata[106]+2*bs, fdata[104]+3*bs, bs);
+	coupling_region_multiply(fdata[104]+3*bs, inv, bs, fdata[104]+3*bs, 0, cw);
+	galois_region_xor(fdata[106]+2*bs, fdata[104]+3*bs, bs);
+	coupling_region_multiply(fdata[104]+3*bs, inv, bs, fdata[104]+3*bs, 0, cw);
+	galois_region_xor(fdata[107]+2*bs, fdata[105]+3*bs, bs);
+	coupling_region_multiply(fdata[105]+3*bs, inv, bs, fdata[105]+3*bs, 0, cw);
+	galois_region_xor(fdata[107]+2*bs, fdata[105]+3*bs, bs);
+	coupling_region_multiply(fdata[105]+3*bs, inv, bs, fdata[105]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[104]+3*bs, 2, bs, fdata[106]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[105]+3*bs, 2, bs, fdata[107]+2*bs, 1, cw);
+	galois_region_xor(fdata[110]+2*bs, fdata[108]+3*bs, bs);
+	coupling_region_multiply(fdata[108]+3*bs, inv, bs, fdata[108]+3*bs, 0, cw);
+	galois_region_xor(fdata[110]+2*bs, fdata[108]+3*bs, bs);
+	coupling_region_multiply(fdata[108]+3*bs, inv, bs, fdata[108]+3*bs, 0, cw);
+	galois_region_xor(fdata[111]+2*bs, fdata[109]+3*bs, bs);
+	coupling_region_multiply(fdata[109]+3*bs, inv, bs, fdata[109]+3*bs, 0, cw);
+	galois_region_xor(fdata[111]+2*bs, fdata[109]+3*bs, bs);
+	coupling_region_multiply(fdata[109]+3*bs, inv, bs, fdata[109]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[108]+3*bs, 2, bs, fdata[110]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[109]+3*bs, 2, bs, fdata[111]+2*bs, 1, cw);
+	galois_region_xor(fdata[114]+2*bs, fdata[112]+3*bs, bs);
+	coupling_region_multiply(fdata[112]+3*bs, inv, bs, fdata[112]+3*bs, 0, cw);
+	galois_region_xor(fdata[114]+2*bs, fdata[112]+3*bs, bs);
+	coupling_region_multiply(fdata[112]+3*bs, inv, bs, fdata[112]+3*bs, 0, cw);
+	galois_region_xor(fdata[115]+2*bs, fdata[113]+3*bs, bs);
+	coupling_region_multiply(fdata[113]+3*bs, inv, bs, fdata[113]+3*bs, 0, cw);
+	galois_region_xor(fdata[115]+2*bs, fdata[113]+3*bs, bs);
+	coupling_region_multiply(fdata[113]+3*bs, inv, bs, fdata[113]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[112]+3*bs, 2, bs, fdata[114]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[113]+3*bs, 2, bs, fdata[115]+2*bs, 1, cw);
+	galois_region_xor(fdata[118]+2*bs, fdata[116]+3*bs, bs);
+	coupling_region_multiply(fdata[116]+3*bs, inv, bs, fdata[116]+3*bs, 0, cw);
+	galois_region_xor(fdata[118]+2*bs, fdata[116]+3*bs, bs);
+	coupling_region_multiply(fdata[116]+3*bs, inv, bs, fdata[116]+3*bs, 0, cw);
+	galois_region_xor(fdata[119]+2*bs, fdata[117]+3*bs, bs);
+	coupling_region_multiply(fdata[117]+3*bs, inv, bs, fdata[117]+3*bs, 0, cw);
+	galois_region_xor(fdata[119]+2*bs, fdata[117]+3*bs, bs);
+	coupling_region_multiply(fdata[117]+3*bs, inv, bs, fdata[117]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[116]+3*bs, 2, bs, fdata[118]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[117]+3*bs, 2, bs, fdata[119]+2*bs, 1, cw);
+	galois_region_xor(fdata[122]+2*bs, fdata[120]+3*bs, bs);
+	coupling_region_multiply(fdata[120]+3*bs, inv, bs, fdata[120]+3*bs, 0, cw);
+	galois_region_xor(fdata[122]+2*bs, fdata[120]+3*bs, bs);
+	coupling_region_multiply(fdata[120]+3*bs, inv, bs, fdata[120]+3*bs, 0, cw);
+	galois_region_xor(fdata[123]+2*bs, fdata[121]+3*bs, bs);
+	coupling_region_multiply(fdata[121]+3*bs, inv, bs, fdata[121]+3*bs, 0, cw);
+	galois_region_xor(fdata[123]+2*bs, fdata[121]+3*bs, bs);
+	coupling_region_multiply(fdata[121]+3*bs, inv, bs, fdata[121]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[120]+3*bs, 2, bs, fdata[122]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[121]+3*bs, 2, bs, fdata[123]+2*bs, 1, cw);
+	galois_region_xor(fdata[126]+2*bs, fdata[124]+3*bs, bs);
+	coupling_region_multiply(fdata[124]+3*bs, inv, bs, fdata[124]+3*bs, 0, cw);
+	galois_region_xor(fdata[126]+2*bs, fdata[124]+3*bs, bs);
+	coupling_region_multiply(fdata[124]+3*bs, inv, bs, fdata[124]+3*bs, 0, cw);
+	galois_region_xor(fdata[127]+2*bs, fdata[125]+3*bs, bs);
+	coupling_region_multiply(fdata[125]+3*bs, inv, bs, fdata[125]+3*bs, 0, cw);
+	galois_region_xor(fdata[127]+2*bs, fdata[125]+3*bs, bs);
+	coupling_region_multiply(fdata[125]+3*bs, inv, bs, fdata[125]+3*bs, 0, cw);
+	coupling_region_multiply(fdata[124]+3*bs, 2, bs, fdata[126]+2*bs, 1, cw);
+	coupling_region_multiply(fdata[125]+3*bs, 2, bs, fdata[127]+2*bs, 1, cw);
+	galois_region_xor(fdata[4]+4*bs, fdata[0]+5*bs, bs);
+	coupling_region_multiply(fdata[0]+5*bs, inv, bs, fdata[0]+5*bs, 0, cw);
+	galois_region_xor(fdata[4]+4*bs, fdata[0]+5*bs, bs);
+	coupling_region_multiply(fdata[0]+5*bs, inv, bs, fdata[0]+5*bs, 0, cw);
+	galois_region_xor(fdata[5]+4*bs, fdata[1]+5*bs, bs);
+	coupling_region_multiply(fdata[1]+5*bs, inv, bs, fdata[1]+5*bs, 0, cw);
+	galois_region_xor(fdata[5]+4*bs, fdata[1]+5*bs, bs);
+	coupling_region_multiply(fdata[1]+5*bs, inv, bs, fdata[1]+5*bs, 0, cw);
+	galois_region_xor(fdata[6]+4*bs, fdata[2]+5*bs, bs);
+	coupling_region_multiply(fdata[2]+5*bs, inv, bs, fdata[2]+5*bs, 0, cw);
+	galois_region_xor(fdata[6]+4*bs, fdata[2]+5*bs, bs);
+	coupling_region_multiply(fdata[2]+5*bs, inv, bs, fdata[2]+5*bs, 0, cw);
+	galois_region_xor(fdata[7]+4*bs, fdata[3]+5*bs, bs);
+	coupling_region_multiply(fdata[3]+5*bs, inv, bs, fdata[3]+5*bs, 0, cw);
+	galois_region_xor(fdata[7]+4*bs, fdata[3]+5*bs, bs);
+	coupling_region_multiply(fdata[3]+5*bs, inv, bs, fdata[3]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[0]+5*bs, 2, bs, fdata[4]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[1]+5*bs, 2, bs, fdata[5]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[2]+5*bs, 2, bs, fdata[6]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[3]+5*bs, 2, bs, fdata[7]+4*bs, 1, cw);
+	galois_region_xor(fdata[12]+4*bs, fdata[8]+5*bs, bs);
+	coupling_region_multiply(fdata[8]+5*bs, inv, bs, fdata[8]+5*bs, 0, cw);
+	galois_region_xor(fdata[12]+4*bs, fdata[8]+5*bs, bs);
+	coupling_region_multiply(fdata[8]+5*bs, inv, bs, fdata[8]+5*bs, 0, cw);
+	galois_region_xor(fdata[13]+4*bs, fdata[9]+5*bs, bs);
+	coupling_region_multiply(fdata[9]+5*bs, inv, bs, fdata[9]+5*bs, 0, cw);
+	galois_region_xor(fdata[13]+4*bs, fdata[9]+5*bs, bs);
+	coupling_region_multiply(fdata[9]+5*bs, inv, bs, fdata[9]+5*bs, 0, cw);
+	galois_region_xor(fdata[14]+4*bs, fdata[10]+5*bs, bs);
+	coupling_region_multiply(fdata[10]+5*bs, inv, bs, fdata[10]+5*bs, 0, cw);
+	galois_region_xor(fdata[14]+4*bs, fdata[10]+5*bs, bs);
+	coupling_region_multiply(fdata[10]+5*bs, inv, bs, fdata[10]+5*bs, 0, cw);
+	galois_region_xor(fdata[15]+4*bs, fdata[11]+5*bs, bs);
+	coupling_region_multiply(fdata[11]+5*bs, inv, bs, fdata[11]+5*bs, 0, cw);
+	galois_region_xor(fdata[15]+4*bs, fdata[11]+5*bs, bs);
+	coupling_region_multiply(fdata[11]+5*bs, inv, bs, fdata[11]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[8]+5*bs, 2, bs, fdata[12]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[9]+5*bs, 2, bs, fdata[13]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[10]+5*bs, 2, bs, fdata[14]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[11]+5*bs, 2, bs, fdata[15]+4*bs, 1, cw);
+	galois_region_xor(fdata[20]+4*bs, fdata[16]+5*bs, bs);
+	coupling_region_multiply(fdata[16]+5*bs, inv, bs, fdata[16]+5*bs, 0, cw);
+	galois_region_xor(fdata[20]+4*bs, fdata[16]+5*bs, bs);
+	coupling_region_multiply(fdata[16]+5*bs, inv, bs, fdata[16]+5*bs, 0, cw);
+	galois_region_xor(fdata[21]+4*bs, fdata[17]+5*bs, bs);
+	coupling_region_multiply(fdata[17]+5*bs, inv, bs, fdata[17]+5*bs, 0, cw);
+	galois_region_xor(fdata[21]+4*bs, fdata[17]+5*bs, bs);
+	coupling_region_multiply(fdata[17]+5*bs, inv, bs, fdata[17]+5*bs, 0, cw);
+	galois_region_xor(fdata[22]+4*bs, fdata[18]+5*bs, bs);
+	coupling_region_multiply(fdata[18]+5*bs, inv, bs, fdata[18]+5*bs, 0, cw);
+	galois_region_xor(fdata[22]+4*bs, fdata[18]+5*bs, bs);
+	coupling_region_multiply(fdata[18]+5*bs, inv, bs, fdata[18]+5*bs, 0, cw);
+	galois_region_xor(fdata[23]+4*bs, fdata[19]+5*bs, bs);
+	coupling_region_multiply(fdata[19]+5*bs, inv, bs, fdata[19]+5*bs, 0, cw);
+	galois_region_xor(fdata[23]+4*bs, fdata[19]+5*bs, bs);
+	coupling_region_multiply(fdata[19]+5*bs, inv, bs, fdata[19]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[16]+5*bs, 2, bs, fdata[20]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[17]+5*bs, 2, bs, fdata[21]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[18]+5*bs, 2, bs, fdata[22]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[19]+5*bs, 2, bs, fdata[23]+4*bs, 1, cw);
+	galois_region_xor(fdata[28]+4*bs, fdata[24]+5*bs, bs);
+	coupling_region_multiply(fdata[24]+5*bs, inv, bs, fdata[24]+5*bs, 0, cw);
+	galois_region_xor(fdata[28]+4*bs, fdata[24]+5*bs, bs);
+	coupling_region_multiply(fdata[24]+5*bs, inv, bs, fdata[24]+5*bs, 0, cw);
+	galois_region_xor(fdata[29]+4*bs, fdata[25]+5*bs, bs);
+	coupling_region_multiply(fdata[25]+5*bs, inv, bs, fdata[25]+5*bs, 0, cw);
+	galois_region_xor(fdata[29]+4*bs, fdata[25]+5*bs, bs);
+	coupling_region_multiply(fdata[25]+5*bs, inv, bs, fdata[25]+5*bs, 0, cw);
+	galois_region_xor(fdata[30]+4*bs, fdata[26]+5*bs, bs);
+	coupling_region_multiply(fdata[26]+5*bs, inv, bs, fdata[26]+5*bs, 0, cw);
+	galois_region_xor(fdata[30]+4*bs, fdata[26]+5*bs, bs);
+	coupling_region_multiply(fdata[26]+5*bs, inv, bs, fdata[26]+5*bs, 0, cw);
+	galois_region_xor(fdata[31]+4*bs, fdata[27]+5*bs, bs);
+	coupling_region_multiply(fdata[27]+5*bs, inv, bs, fdata[27]+5*bs, 0, cw);
+	galois_region_xor(fdata[31]+4*bs, fdata[27]+5*bs, bs);
+	coupling_region_multiply(fdata[27]+5*bs, inv, bs, fdata[27]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[24]+5*bs, 2, bs, fdata[28]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[25]+5*bs, 2, bs, fdata[29]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[26]+5*bs, 2, bs, fdata[30]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[27]+5*bs, 2, bs, fdata[31]+4*bs, 1, cw);
+	galois_region_xor(fdata[36]+4*bs, fdata[32]+5*bs, bs);
+	coupling_region_multiply(fdata[32]+5*bs, inv, bs, fdata[32]+5*bs, 0, cw);
+	galois_region_xor(fdata[36]+4*bs, fdata[32]+5*bs, bs);
+	coupling_region_multiply(fdata[32]+5*bs, inv, bs, fdata[32]+5*bs, 0, cw);
+	galois_region_xor(fdata[37]+4*bs, fdata[33]+5*bs, bs);
+	coupling_region_multiply(fdata[33]+5*bs, inv, bs, fdata[33]+5*bs, 0, cw);
+	galois_region_xor(fdata[37]+4*bs, fdata[33]+5*bs, bs);
+	coupling_region_multiply(fdata[33]+5*bs, inv, bs, fdata[33]+5*bs, 0, cw);
+	galois_region_xor(fdata[38]+4*bs, fdata[34]+5*bs, bs);
+	coupling_region_multiply(fdata[34]+5*bs, inv, bs, fdata[34]+5*bs, 0, cw);
+	galois_region_xor(fdata[38]+4*bs, fdata[34]+5*bs, bs);
+	coupling_region_multiply(fdata[34]+5*bs, inv, bs, fdata[34]+5*bs, 0, cw);
+	galois_region_xor(fdata[39]+4*bs, fdata[35]+5*bs, bs);
+	coupling_region_multiply(fdata[35]+5*bs, inv, bs, fdata[35]+5*bs, 0, cw);
+	galois_region_xor(fdata[39]+4*bs, fdata[35]+5*bs, bs);
+	coupling_region_multiply(fdata[35]+5*bs, inv, bs, fdata[35]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[32]+5*bs, 2, bs, fdata[36]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[33]+5*bs, 2, bs, fdata[37]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[34]+5*bs, 2, bs, fdata[38]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[35]+5*bs, 2, bs, fdata[39]+4*bs, 1, cw);
+	galois_region_xor(fdata[44]+4*bs, fdata[40]+5*bs, bs);
+	coupling_region_multiply(fdata[40]+5*bs, inv, bs, fdata[40]+5*bs, 0, cw);
+	galois_region_xor(fdata[44]+4*bs, fdata[40]+5*bs, bs);
+	coupling_region_multiply(fdata[40]+5*bs, inv, bs, fdata[40]+5*bs, 0, cw);
+	galois_region_xor(fdata[45]+4*bs, fdata[41]+5*bs, bs);
+	coupling_region_multiply(fdata[41]+5*bs, inv, bs, fdata[41]+5*bs, 0, cw);
+	galois_region_xor(fdata[45]+4*bs, fdata[41]+5*bs, bs);
+	coupling_region_multiply(fdata[41]+5*bs, inv, bs, fdata[41]+5*bs, 0, cw);
+	galois_region_xor(fdata[46]+4*bs, fdata[42]+5*bs, bs);
+	coupling_region_multiply(fdata[42]+5*bs, inv, bs, fdata[42]+5*bs, 0, cw);
+	galois_region_xor(fdata[46]+4*bs, fdata[42]+5*bs, bs);
+	coupling_region_multiply(fdata[42]+5*bs, inv, bs, fdata[42]+5*bs, 0, cw);
+	galois_region_xor(fdata[47]+4*bs, fdata[43]+5*bs, bs);
+	coupling_region_multiply(fdata[43]+5*bs, inv, bs, fdata[43]+5*bs, 0, cw);
+	galois_region_xor(fdata[47]+4*bs, fdata[43]+5*bs, bs);
+	coupling_region_multiply(fdata[43]+5*bs, inv, bs, fdata[43]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[40]+5*bs, 2, bs, fdata[44]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[41]+5*bs, 2, bs, fdata[45]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[42]+5*bs, 2, bs, fdata[46]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[43]+5*bs, 2, bs, fdata[47]+4*bs, 1, cw);
+	galois_region_xor(fdata[52]+4*bs, fdata[48]+5*bs, bs);
+	coupling_region_multiply(fdata[48]+5*bs, inv, bs, fdata[48]+5*bs, 0, cw);
+	galois_region_xor(fdata[52]+4*bs, fdata[48]+5*bs, bs);
+	coupling_region_multiply(fdata[48]+5*bs, inv, bs, fdata[48]+5*bs, 0, cw);
+	galois_region_xor(fdata[53]+4*bs, fdata[49]+5*bs, bs);
+	coupling_region_multiply(fdata[49]+5*bs, inv, bs, fdata[49]+5*bs, 0, cw);
+	galois_region_xor(fdata[53]+4*bs, fdata[49]+5*bs, bs);
+	coupling_region_multiply(fdata[49]+5*bs, inv, bs, fdata[49]+5*bs, 0, cw);
+	galois_region_xor(fdata[54]+4*bs, fdata[50]+5*bs, bs);
+	coupling_region_multiply(fdata[50]+5*bs, inv, bs, fdata[50]+5*bs, 0, cw);
+	galois_region_xor(fdata[54]+4*bs, fdata[50]+5*bs, bs);
+	coupling_region_multiply(fdata[50]+5*bs, inv, bs, fdata[50]+5*bs, 0, cw);
+	galois_region_xor(fdata[55]+4*bs, fdata[51]+5*bs, bs);
+	coupling_region_multiply(fdata[51]+5*bs, inv, bs, fdata[51]+5*bs, 0, cw);
+	galois_region_xor(fdata[55]+4*bs, fdata[51]+5*bs, bs);
+	coupling_region_multiply(fdata[51]+5*bs, inv, bs, fdata[51]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[48]+5*bs, 2, bs, fdata[52]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[49]+5*bs, 2, bs, fdata[53]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[50]+5*bs, 2, bs, fdata[54]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[51]+5*bs, 2, bs, fdata[55]+4*bs, 1, cw);
+	galois_region_xor(fdata[60]+4*bs, fdata[56]+5*bs, bs);
+	coupling_region_multiply(fdata[56]+5*bs, inv, bs, fdata[56]+5*bs, 0, cw);
+	galois_region_xor(fdata[60]+4*bs, fdata[56]+5*bs, bs);
+	coupling_region_multiply(fdata[56]+5*bs, inv, bs, fdata[56]+5*bs, 0, cw);
+	galois_region_xor(fdata[61]+4*bs, fdata[57]+5*bs, bs);
+	coupling_region_multiply(fdata[57]+5*bs, inv, bs, fdata[57]+5*bs, 0, cw);
+	galois_region_xor(fdata[61]+4*bs, fdata[57]+5*bs, bs);
+	coupling_region_multiply(fdata[57]+5*bs, inv, bs, fdata[57]+5*bs, 0, cw);
+	galois_region_xor(fdata[62]+4*bs, fdata[58]+5*bs, bs);
+	coupling_region_multiply(fdata[58]+5*bs, inv, bs, fdata[58]+5*bs, 0, cw);
+	galois_region_xor(fdata[62]+4*bs, fdata[58]+5*bs, bs);
+	coupling_region_multiply(fdata[58]+5*bs, inv, bs, fdata[58]+5*bs, 0, cw);
+	galois_region_xor(fdata[63]+4*bs, fdata[59]+5*bs, bs);
+	coupling_region_multiply(fdata[59]+5*bs, inv, bs, fdata[59]+5*bs, 0, cw);
+	galois_region_xor(fdata[63]+4*bs, fdata[59]+5*bs, bs);
+	coupling_region_multiply(fdata[59]+5*bs, inv, bs, fdata[59]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[56]+5*bs, 2, bs, fdata[60]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[57]+5*bs, 2, bs, fdata[61]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[58]+5*bs, 2, bs, fdata[62]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[59]+5*bs, 2, bs, fdata[63]+4*bs, 1, cw);
+	galois_region_xor(fdata[68]+4*bs, fdata[64]+5*bs, bs);
+	coupling_region_multiply(fdata[64]+5*bs, inv, bs, fdata[64]+5*bs, 0, cw);
+	galois_region_xor(fdata[68]+4*bs, fdata[64]+5*bs, bs);
+	coupling_region_multiply(fdata[64]+5*bs, inv, bs, fdata[64]+5*bs, 0, cw);
+	galois_region_xor(fdata[69]+4*bs, fdata[65]+5*bs, bs);
+	coupling_region_multiply(fdata[65]+5*bs, inv, bs, fdata[65]+5*bs, 0, cw);
+	galois_region_xor(fdata[69]+4*bs, fdata[65]+5*bs, bs);
+	coupling_region_multiply(fdata[65]+5*bs, inv, bs, fdata[65]+5*bs, 0, cw);
+	galois_region_xor(fdata[70]+4*bs, fdata[66]+5*bs, bs);
+	coupling_region_multiply(fdata[66]+5*bs, inv, bs, fdata[66]+5*bs, 0, cw);
+	galois_region_xor(fdata[70]+4*bs, fdata[66]+5*bs, bs);
+	coupling_region_multiply(fdata[66]+5*bs, inv, bs, fdata[66]+5*bs, 0, cw);
+	galois_region_xor(fdata[71]+4*bs, fdata[67]+5*bs, bs);
+	coupling_region_multiply(fdata[67]+5*bs, inv, bs, fdata[67]+5*bs, 0, cw);
+	galois_region_xor(fdata[71]+4*bs, fdata[67]+5*bs, bs);
+	coupling_region_multiply(fdata[67]+5*bs, inv, bs, fdata[67]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[64]+5*bs, 2, bs, fdata[68]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[65]+5*bs, 2, bs, fdata[69]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[66]+5*bs, 2, bs, fdata[70]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[67]+5*bs, 2, bs, fdata[71]+4*bs, 1, cw);
+	galois_region_xor(fdata[76]+4*bs, fdata[72]+5*bs, bs);
+	coupling_region_multiply(fdata[72]+5*bs, inv, bs, fdata[72]+5*bs, 0, cw);
+	galois_region_xor(fdata[76]+4*bs, fdata[72]+5*bs, bs);
+	coupling_region_multiply(fdata[72]+5*bs, inv, bs, fdata[72]+5*bs, 0, cw);
+	galois_region_xor(fdata[77]+4*bs, fdata[73]+5*bs, bs);
+	coupling_region_multiply(fdata[73]+5*bs, inv, bs, fdata[73]+5*bs, 0, cw);
+	galois_region_xor(fdata[77]+4*bs, fdata[73]+5*bs, bs);
+	coupling_region_multiply(fdata[73]+5*bs, inv, bs, fdata[73]+5*bs, 0, cw);
+	galois_region_xor(fdata[78]+4*bs, fdata[74]+5*bs, bs);
+	coupling_region_multiply(fdata[74]+5*bs, inv, bs, fdata[74]+5*bs, 0, cw);
+	galois_region_xor(fdata[78]+4*bs, fdata[74]+5*bs, bs);
+	coupling_region_multiply(fdata[74]+5*bs, inv, bs, fdata[74]+5*bs, 0, cw);
+	galois_region_xor(fdata[79]+4*bs, fdata[75]+5*bs, bs);
+	coupling_region_multiply(fdata[75]+5*bs, inv, bs, fdata[75]+5*bs, 0, cw);
+	galois_region_xor(fdata[79]+4*bs, fdata[75]+5*bs, bs);
+	coupling_region_multiply(fdata[75]+5*bs, inv, bs, fdata[75]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[72]+5*bs, 2, bs, fdata[76]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[73]+5*bs, 2, bs, fdata[77]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[74]+5*bs, 2, bs, fdata[78]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[75]+5*bs, 2, bs, fdata[79]+4*bs, 1, cw);
+	galois_region_xor(fdata[84]+4*bs, fdata[80]+5*bs, bs);
+	coupling_region_multiply(fdata[80]+5*bs, inv, bs, fdata[80]+5*bs, 0, cw);
+	galois_region_xor(fdata[84]+4*bs, fdata[80]+5*bs, bs);
+	coupling_region_multiply(fdata[80]+5*bs, inv, bs, fdata[80]+5*bs, 0, cw);
+	galois_region_xor(fdata[85]+4*bs, fdata[81]+5*bs, bs);
+	coupling_region_multiply(fdata[81]+5*bs, inv, bs, fdata[81]+5*bs, 0, cw);
+	galois_region_xor(fdata[85]+4*bs, fdata[81]+5*bs, bs);
+	coupling_region_multiply(fdata[81]+5*bs, inv, bs, fdata[81]+5*bs, 0, cw);
+	galois_region_xor(fdata[86]+4*bs, fdata[82]+5*bs, bs);
+	coupling_region_multiply(fdata[82]+5*bs, inv, bs, fdata[82]+5*bs, 0, cw);
+	galois_region_xor(fdata[86]+4*bs, fdata[82]+5*bs, bs);
+	coupling_region_multiply(fdata[82]+5*bs, inv, bs, fdata[82]+5*bs, 0, cw);
+	galois_region_xor(fdata[87]+4*bs, fdata[83]+5*bs, bs);
+	coupling_region_multiply(fdata[83]+5*bs, inv, bs, fdata[83]+5*bs, 0, cw);
+	galois_region_xor(fdata[87]+4*bs, fdata[83]+5*bs, bs);
+	coupling_region_multiply(fdata[83]+5*bs, inv, bs, fdata[83]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[80]+5*bs, 2, bs, fdata[84]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[81]+5*bs, 2, bs, fdata[85]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[82]+5*bs, 2, bs, fdata[86]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[83]+5*bs, 2, bs, fdata[87]+4*bs, 1, cw);
+	galois_region_xor(fdata[92]+4*bs, fdata[88]+5*bs, bs);
+	coupling_region_multiply(fdata[88]+5*bs, inv, bs, fdata[88]+5*bs, 0, cw);
+	galois_region_xor(fdata[92]+4*bs, fdata[88]+5*bs, bs);
+	coupling_region_multiply(fdata[88]+5*bs, inv, bs, fdata[88]+5*bs, 0, cw);
+	galois_region_xor(fdata[93]+4*bs, fdata[89]+5*bs, bs);
+	coupling_region_multiply(fdata[89]+5*bs, inv, bs, fdata[89]+5*bs, 0, cw);
+	galois_region_xor(fdata[93]+4*bs, fdata[89]+5*bs, bs);
+	coupling_region_multiply(fdata[89]+5*bs, inv, bs, fdata[89]+5*bs, 0, cw);
+	galois_region_xor(fdata[94]+4*bs, fdata[90]+5*bs, bs);
+	coupling_region_multiply(fdata[90]+5*bs, inv, bs, fdata[90]+5*bs, 0, cw);
+	galois_region_xor(fdata[94]+4*bs, fdata[90]+5*bs, bs);
+	coupling_region_multiply(fdata[90]+5*bs, inv, bs, fdata[90]+5*bs, 0, cw);
+	galois_region_xor(fdata[95]+4*bs, fdata[91]+5*bs, bs);
+	coupling_region_multiply(fdata[91]+5*bs, inv, bs, fdata[91]+5*bs, 0, cw);
+	galois_region_xor(fdata[95]+4*bs, fdata[91]+5*bs, bs);
+	coupling_region_multiply(fdata[91]+5*bs, inv, bs, fdata[91]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[88]+5*bs, 2, bs, fdata[92]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[89]+5*bs, 2, bs, fdata[93]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[90]+5*bs, 2, bs, fdata[94]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[91]+5*bs, 2, bs, fdata[95]+4*bs, 1, cw);
+	galois_region_xor(fdata[100]+4*bs, fdata[96]+5*bs, bs);
+	coupling_region_multiply(fdata[96]+5*bs, inv, bs, fdata[96]+5*bs, 0, cw);
+	galois_region_xor(fdata[100]+4*bs, fdata[96]+5*bs, bs);
+	coupling_region_multiply(fdata[96]+5*bs, inv, bs, fdata[96]+5*bs, 0, cw);
+	galois_region_xor(fdata[101]+4*bs, fdata[97]+5*bs, bs);
+	coupling_region_multiply(fdata[97]+5*bs, inv, bs, fdata[97]+5*bs, 0, cw);
+	galois_region_xor(fdata[101]+4*bs, fdata[97]+5*bs, bs);
+	coupling_region_multiply(fdata[97]+5*bs, inv, bs, fdata[97]+5*bs, 0, cw);
+	galois_region_xor(fdata[102]+4*bs, fdata[98]+5*bs, bs);
+	coupling_region_multiply(fdata[98]+5*bs, inv, bs, fdata[98]+5*bs, 0, cw);
+	galois_region_xor(fdata[102]+4*bs, fdata[98]+5*bs, bs);
+	coupling_region_multiply(fdata[98]+5*bs, inv, bs, fdata[98]+5*bs, 0, cw);
+	galois_region_xor(fdata[103]+4*bs, fdata[99]+5*bs, bs);
+	coupling_region_multiply(fdata[99]+5*bs, inv, bs, fdata[99]+5*bs, 0, cw);
+	galois_region_xor(fdata[103]+4*bs, fdata[99]+5*bs, bs);
+	coupling_region_multiply(fdata[99]+5*bs, inv, bs, fdata[99]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[96]+5*bs, 2, bs, fdata[100]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[97]+5*bs, 2, bs, fdata[101]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[98]+5*bs, 2, bs, fdata[102]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[99]+5*bs, 2, bs, fdata[103]+4*bs, 1, cw);
+	galois_region_xor(fdata[108]+4*bs, fdata[104]+5*bs, bs);
+	coupling_region_multiply(fdata[104]+5*bs, inv, bs, fdata[104]+5*bs, 0, cw);
+	galois_region_xor(fdata[108]+4*bs, fdata[104]+5*bs, bs);
+	coupling_region_multiply(fdata[104]+5*bs, inv, bs, fdata[104]+5*bs, 0, cw);
+	galois_region_xor(fdata[109]+4*bs, fdata[105]+5*bs, bs);
+	coupling_region_multiply(fdata[105]+5*bs, inv, bs, fdata[105]+5*bs, 0, cw);
+	galois_region_xor(fdata[109]+4*bs, fdata[105]+5*bs, bs);
+	coupling_region_multiply(fdata[105]+5*bs, inv, bs, fdata[105]+5*bs, 0, cw);
+	galois_region_xor(fdata[110]+4*bs, fdata[106]+5*bs, bs);
+	coupling_region_multiply(fdata[106]+5*bs, inv, bs, fdata[106]+5*bs, 0, cw);
+	galois_region_xor(fdata[110]+4*bs, fdata[106]+5*bs, bs);
+	coupling_region_multiply(fdata[106]+5*bs, inv, bs, fdata[106]+5*bs, 0, cw);
+	galois_region_xor(fdata[111]+4*bs, fdata[107]+5*bs, bs);
+	coupling_region_multiply(fdata[107]+5*bs, inv, bs, fdata[107]+5*bs, 0, cw);
+	galois_region_xor(fdata[111]+4*bs, fdata[107]+5*bs, bs);
+	coupling_region_multiply(fdata[107]+5*bs, inv, bs, fdata[107]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[104]+5*bs, 2, bs, fdata[108]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[105]+5*bs, 2, bs, fdata[109]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[106]+5*bs, 2, bs, fdata[110]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[107]+5*bs, 2, bs, fdata[111]+4*bs, 1, cw);
+	galois_region_xor(fdata[116]+4*bs, fdata[112]+5*bs, bs);
+	coupling_region_multiply(fdata[112]+5*bs, inv, bs, fdata[112]+5*bs, 0, cw);
+	galois_region_xor(fdata[116]+4*bs, fdata[112]+5*bs, bs);
+	coupling_region_multiply(fdata[112]+5*bs, inv, bs, fdata[112]+5*bs, 0, cw);
+	galois_region_xor(fdata[117]+4*bs, fdata[113]+5*bs, bs);
+	coupling_region_multiply(fdata[113]+5*bs, inv, bs, fdata[113]+5*bs, 0, cw);
+	galois_region_xor(fdata[117]+4*bs, fdata[113]+5*bs, bs);
+	coupling_region_multiply(fdata[113]+5*bs, inv, bs, fdata[113]+5*bs, 0, cw);
+	galois_region_xor(fdata[118]+4*bs, fdata[114]+5*bs, bs);
+	coupling_region_multiply(fdata[114]+5*bs, inv, bs, fdata[114]+5*bs, 0, cw);
+	galois_region_xor(fdata[118]+4*bs, fdata[114]+5*bs, bs);
+	coupling_region_multiply(fdata[114]+5*bs, inv, bs, fdata[114]+5*bs, 0, cw);
+	galois_region_xor(fdata[119]+4*bs, fdata[115]+5*bs, bs);
+	coupling_region_multiply(fdata[115]+5*bs, inv, bs, fdata[115]+5*bs, 0, cw);
+	galois_region_xor(fdata[119]+4*bs, fdata[115]+5*bs, bs);
+	coupling_region_multiply(fdata[115]+5*bs, inv, bs, fdata[115]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[112]+5*bs, 2, bs, fdata[116]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[113]+5*bs, 2, bs, fdata[117]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[114]+5*bs, 2, bs, fdata[118]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[115]+5*bs, 2, bs, fdata[119]+4*bs, 1, cw);
+	galois_region_xor(fdata[124]+4*bs, fdata[120]+5*bs, bs);
+	coupling_region_multiply(fdata[120]+5*bs, inv, bs, fdata[120]+5*bs, 0, cw);
+	galois_region_xor(fdata[124]+4*bs, fdata[120]+5*bs, bs);
+	coupling_region_multiply(fdata[120]+5*bs, inv, bs, fdata[120]+5*bs, 0, cw);
+	galois_region_xor(fdata[125]+4*bs, fdata[121]+5*bs, bs);
+	coupling_region_multiply(fdata[121]+5*bs, inv, bs, fdata[121]+5*bs, 0, cw);
+	galois_region_xor(fdata[125]+4*bs, fdata[121]+5*bs, bs);
+	coupling_region_multiply(fdata[121]+5*bs, inv, bs, fdata[121]+5*bs, 0, cw);
+	galois_region_xor(fdata[126]+4*bs, fdata[122]+5*bs, bs);
+	coupling_region_multiply(fdata[122]+5*bs, inv, bs, fdata[122]+5*bs, 0, cw);
+	galois_region_xor(fdata[126]+4*bs, fdata[122]+5*bs, bs);
+	coupling_region_multiply(fdata[122]+5*bs, inv, bs, fdata[122]+5*bs, 0, cw);
+	galois_region_xor(fdata[127]+4*bs, fdata[123]+5*bs, bs);
+	coupling_region_multiply(fdata[123]+5*bs, inv, bs, fdata[123]+5*bs, 0, cw);
+	galois_region_xor(fdata[127]+4*bs, fdata[123]+5*bs, bs);
+	coupling_region_multiply(fdata[123]+5*bs, inv, bs, fdata[123]+5*bs, 0, cw);
+	coupling_region_multiply(fdata[120]+5*bs, 2, bs, fdata[124]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[121]+5*bs, 2, bs, fdata[125]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[122]+5*bs, 2, bs, fdata[126]+4*bs, 1, cw);
+	coupling_region_multiply(fdata[123]+5*bs, 2, bs, fdata[127]+4*bs, 1, cw);
+	galois_region_xor(fdata[8]+6*bs, fdata[0]+7*bs, bs);
+	coupling_region_multiply(fdata[0]+7*bs, inv, bs, fdata[0]+7*bs, 0, cw);
+	galois_region_xor(fdata[8]+6*bs, fdata[0]+7*bs, bs);
+	coupling_region_multiply(fdata[0]+7*bs, inv, bs, fdata[0]+7*bs, 0, cw);
+	galois_region_xor(fdata[9]+6*bs, fdata[1]+7*bs, bs);
+	coupling_region_multiply(fdata[1]+7*bs, inv, bs, fdata[1]+7*bs, 0, cw);
+	galois_region_xor(fdata[9]+6*bs, fdata[1]+7*bs, bs);
+	coupling_region_multiply(fdata[1]+7*bs, inv, bs, fdata[1]+7*bs, 0, cw);
+	galois_region_xor(fdata[10]+6*bs, fdata[2]+7*bs, bs);
+	coupling_region_multiply(fdata[2]+7*bs, inv, bs, fdata[2]+7*bs, 0, cw);
+	galois_region_xor(fdata[10]+6*bs, fdata[2]+7*bs, bs);
+	coupling_region_multiply(fdata[2]+7*bs, inv, bs, fdata[2]+7*bs, 0, cw);
+	galois_region_xor(fdata[11]+6*bs, fdata[3]+7*bs, bs);
+	coupling_region_multiply(fdata[3]+7*bs, inv, bs, fdata[3]+7*bs, 0, cw);
+	galois_region_xor(fdata[11]+6*bs, fdata[3]+7*bs, bs);
+	coupling_region_multiply(fdata[3]+7*bs, inv, bs, fdata[3]+7*bs, 0, cw);
+	galois_region_xor(fdata[12]+6*bs, fdata[4]+7*bs, bs);
+	coupling_region_multiply(fdata[4]+7*bs, inv, bs, fdata[4]+7*bs, 0, cw);
+	galois_region_xor(fdata[12]+6*bs, fdata[4]+7*bs, bs);
+	coupling_region_multiply(fdata[4]+7*bs, inv, bs, fdata[4]+7*bs, 0, cw);
+	galois_region_xor(fdata[13]+6*bs, fdata[5]+7*bs, bs);
+	coupling_region_multiply(fdata[5]+7*bs, inv, bs, fdata[5]+7*bs, 0, cw);
+	galois_region_xor(fdata[13]+6*bs, fdata[5]+7*bs, bs);
+	coupling_region_multiply(fdata[5]+7*bs, inv, bs, fdata[5]+7*bs, 0, cw);
+	galois_region_xor(fdata[14]+6*bs, fdata[6]+7*bs, bs);
+	coupling_region_multiply(fdata[6]+7*bs, inv, bs, fdata[6]+7*bs, 0, cw);
+	galois_region_xor(fdata[14]+6*bs, fdata[6]+7*bs, bs);
+	coupling_region_multiply(fdata[6]+7*bs, inv, bs, fdata[6]+7*bs, 0, cw);
+	galois_region_xor(fdata[15]+6*bs, fdata[7]+7*bs, bs);
+	coupling_region_multiply(fdata[7]+7*bs, inv, bs, fdata[7]+7*bs, 0, cw);
+	galois_region_xor(fdata[15]+6*bs, fdata[7]+7*bs, bs);
+	coupling_region_multiply(fdata[7]+7*bs, inv, bs, fdata[7]+7*bs, 0, cw);
+	coupling_region_multiply(fdata[0]+7*bs, 2, bs, fdata[8]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[1]+7*bs, 2, bs, fdata[9]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[2]+7*bs, 2, bs, fdata[10]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[3]+7*bs, 2, bs, fdata[11]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[4]+7*bs, 2, bs, fdata[12]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[5]+7*bs, 2, bs, fdata[13]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[6]+7*bs, 2, bs, fdata[14]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[7]+7*bs, 2, bs, fdata[15]+6*bs, 1, cw);
+	galois_region_xor(fdata[24]+6*bs, fdata[16]+7*bs, bs);
+	coupling_region_multiply(fdata[16]+7*bs, inv, bs, fdata[16]+7*bs, 0, cw);
+	galois_region_xor(fdata[24]+6*bs, fdata[16]+7*bs, bs);
+	coupling_region_multiply(fdata[16]+7*bs, inv, bs, fdata[16]+7*bs, 0, cw);
+	galois_region_xor(fdata[25]+6*bs, fdata[17]+7*bs, bs);
+	coupling_region_multiply(fdata[17]+7*bs, inv, bs, fdata[17]+7*bs, 0, cw);
+	galois_region_xor(fdata[25]+6*bs, fdata[17]+7*bs, bs);
+	coupling_region_multiply(fdata[17]+7*bs, inv, bs, fdata[17]+7*bs, 0, cw);
+	galois_region_xor(fdata[26]+6*bs, fdata[18]+7*bs, bs);
+	coupling_region_multiply(fdata[18]+7*bs, inv, bs, fdata[18]+7*bs, 0, cw);
+	galois_region_xor(fdata[26]+6*bs, fdata[18]+7*bs, bs);
+	coupling_region_multiply(fdata[18]+7*bs, inv, bs, fdata[18]+7*bs, 0, cw);
+	galois_region_xor(fdata[27]+6*bs, fdata[19]+7*bs, bs);
+	coupling_region_multiply(fdata[19]+7*bs, inv, bs, fdata[19]+7*bs, 0, cw);
+	galois_region_xor(fdata[27]+6*bs, fdata[19]+7*bs, bs);
+	coupling_region_multiply(fdata[19]+7*bs, inv, bs, fdata[19]+7*bs, 0, cw);
+	galois_region_xor(fdata[28]+6*bs, fdata[20]+7*bs, bs);
+	coupling_region_multiply(fdata[20]+7*bs, inv, bs, fdata[20]+7*bs, 0, cw);
+	galois_region_xor(fdata[28]+6*bs, fdata[20]+7*bs, bs);
+	coupling_region_multiply(fdata[20]+7*bs, inv, bs, fdata[20]+7*bs, 0, cw);
+	galois_region_xor(fdata[29]+6*bs, fdata[21]+7*bs, bs);
+	coupling_region_multiply(fdata[21]+7*bs, inv, bs, fdata[21]+7*bs, 0, cw);
+	galois_region_xor(fdata[29]+6*bs, fdata[21]+7*bs, bs);
+	coupling_region_multiply(fdata[21]+7*bs, inv, bs, fdata[21]+7*bs, 0, cw);
+	galois_region_xor(fdata[30]+6*bs, fdata[22]+7*bs, bs);
+	coupling_region_multiply(fdata[22]+7*bs, inv, bs, fdata[22]+7*bs, 0, cw);
+	galois_region_xor(fdata[30]+6*bs, fdata[22]+7*bs, bs);
+	coupling_region_multiply(fdata[22]+7*bs, inv, bs, fdata[22]+7*bs, 0, cw);
+	galois_region_xor(fdata[31]+6*bs, fdata[23]+7*bs, bs);
+	coupling_region_multiply(fdata[23]+7*bs, inv, bs, fdata[23]+7*bs, 0, cw);
+	galois_region_xor(fdata[31]+6*bs, fdata[23]+7*bs, bs);
+	coupling_region_multiply(fdata[23]+7*bs, inv, bs, fdata[23]+7*bs, 0, cw);
+	coupling_region_multiply(fdata[16]+7*bs, 2, bs, fdata[24]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[17]+7*bs, 2, bs, fdata[25]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[18]+7*bs, 2, bs, fdata[26]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[19]+7*bs, 2, bs, fdata[27]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[20]+7*bs, 2, bs, fdata[28]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[21]+7*bs, 2, bs, fdata[29]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[22]+7*bs, 2, bs, fdata[30]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[23]+7*bs, 2, bs, fdata[31]+6*bs, 1, cw);
+	galois_region_xor(fdata[40]+6*bs, fdata[32]+7*bs, bs);
+	coupling_region_multiply(fdata[32]+7*bs, inv, bs, fdata[32]+7*bs, 0, cw);
+	galois_region_xor(fdata[40]+6*bs, fdata[32]+7*bs, bs);
+	coupling_region_multiply(fdata[32]+7*bs, inv, bs, fdata[32]+7*bs, 0, cw);
+	galois_region_xor(fdata[41]+6*bs, fdata[33]+7*bs, bs);
+	coupling_region_multiply(fdata[33]+7*bs, inv, bs, fdata[33]+7*bs, 0, cw);
+	galois_region_xor(fdata[41]+6*bs, fdata[33]+7*bs, bs);
+	coupling_region_multiply(fdata[33]+7*bs, inv, bs, fdata[33]+7*bs, 0, cw);
+	galois_region_xor(fdata[42]+6*bs, fdata[34]+7*bs, bs);
+	coupling_region_multiply(fdata[34]+7*bs, inv, bs, fdata[34]+7*bs, 0, cw);
+	galois_region_xor(fdata[42]+6*bs, fdata[34]+7*bs, bs);
+	coupling_region_multiply(fdata[34]+7*bs, inv, bs, fdata[34]+7*bs, 0, cw);
+	galois_region_xor(fdata[43]+6*bs, fdata[35]+7*bs, bs);
+	coupling_region_multiply(fdata[35]+7*bs, inv, bs, fdata[35]+7*bs, 0, cw);
+	galois_region_xor(fdata[43]+6*bs, fdata[35]+7*bs, bs);
+	coupling_region_multiply(fdata[35]+7*bs, inv, bs, fdata[35]+7*bs, 0, cw);
+	galois_region_xor(fdata[44]+6*bs, fdata[36]+7*bs, bs);
+	coupling_region_multiply(fdata[36]+7*bs, inv, bs, fdata[36]+7*bs, 0, cw);
+	galois_region_xor(fdata[44]+6*bs, fdata[36]+7*bs, bs);
+	coupling_region_multiply(fdata[36]+7*bs, inv, bs, fdata[36]+7*bs, 0, cw);
+	galois_region_xor(fdata[45]+6*bs, fdata[37]+7*bs, bs);
+	coupling_region_multiply(fdata[37]+7*bs, inv, bs, fdata[37]+7*bs, 0, cw);
+	galois_region_xor(fdata[45]+6*bs, fdata[37]+7*bs, bs);
+	coupling_region_multiply(fdata[37]+7*bs, inv, bs, fdata[37]+7*bs, 0, cw);
+	galois_region_xor(fdata[46]+6*bs, fdata[38]+7*bs, bs);
+	coupling_region_multiply(fdata[38]+7*bs, inv, bs, fdata[38]+7*bs, 0, cw);
+	galois_region_xor(fdata[46]+6*bs, fdata[38]+7*bs, bs);
+	coupling_region_multiply(fdata[38]+7*bs, inv, bs, fdata[38]+7*bs, 0, cw);
+	galois_region_xor(fdata[47]+6*bs, fdata[39]+7*bs, bs);
+	coupling_region_multiply(fdata[39]+7*bs, inv, bs, fdata[39]+7*bs, 0, cw);
+	galois_region_xor(fdata[47]+6*bs, fdata[39]+7*bs, bs);
+	coupling_region_multiply(fdata[39]+7*bs, inv, bs, fdata[39]+7*bs, 0, cw);
+	coupling_region_multiply(fdata[32]+7*bs, 2, bs, fdata[40]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[33]+7*bs, 2, bs, fdata[41]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[34]+7*bs, 2, bs, fdata[42]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[35]+7*bs, 2, bs, fdata[43]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[36]+7*bs, 2, bs, fdata[44]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[37]+7*bs, 2, bs, fdata[45]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[38]+7*bs, 2, bs, fdata[46]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[39]+7*bs, 2, bs, fdata[47]+6*bs, 1, cw);
+	galois_region_xor(fdata[56]+6*bs, fdata[48]+7*bs, bs);
+	coupling_region_multiply(fdata[48]+7*bs, inv, bs, fdata[48]+7*bs, 0, cw);
+	galois_region_xor(fdata[56]+6*bs, fdata[48]+7*bs, bs);
+	coupling_region_multiply(fdata[48]+7*bs, inv, bs, fdata[48]+7*bs, 0, cw);
+	galois_region_xor(fdata[57]+6*bs, fdata[49]+7*bs, bs);
+	coupling_region_multiply(fdata[49]+7*bs, inv, bs, fdata[49]+7*bs, 0, cw);
+	galois_region_xor(fdata[57]+6*bs, fdata[49]+7*bs, bs);
+	coupling_region_multiply(fdata[49]+7*bs, inv, bs, fdata[49]+7*bs, 0, cw);
+	galois_region_xor(fdata[58]+6*bs, fdata[50]+7*bs, bs);
+	coupling_region_multiply(fdata[50]+7*bs, inv, bs, fdata[50]+7*bs, 0, cw);
+	galois_region_xor(fdata[58]+6*bs, fdata[50]+7*bs, bs);
+	coupling_region_multiply(fdata[50]+7*bs, inv, bs, fdata[50]+7*bs, 0, cw);
+	galois_region_xor(fdata[59]+6*bs, fdata[51]+7*bs, bs);
+	coupling_region_multiply(fdata[51]+7*bs, inv, bs, fdata[51]+7*bs, 0, cw);
+	galois_region_xor(fdata[59]+6*bs, fdata[51]+7*bs, bs);
+	coupling_region_multiply(fdata[51]+7*bs, inv, bs, fdata[51]+7*bs, 0, cw);
+	galois_region_xor(fdata[60]+6*bs, fdata[52]+7*bs, bs);
+	coupling_region_multiply(fdata[52]+7*bs, inv, bs, fdata[52]+7*bs, 0, cw);
+	galois_region_xor(fdata[60]+6*bs, fdata[52]+7*bs, bs);
+	coupling_region_multiply(fdata[52]+7*bs, inv, bs, fdata[52]+7*bs, 0, cw);
+	galois_region_xor(fdata[61]+6*bs, fdata[53]+7*bs, bs);
+	coupling_region_multiply(fdata[53]+7*bs, inv, bs, fdata[53]+7*bs, 0, cw);
+	galois_region_xor(fdata[61]+6*bs, fdata[53]+7*bs, bs);
+	coupling_region_multiply(fdata[53]+7*bs, inv, bs, fdata[53]+7*bs, 0, cw);
+	galois_region_xor(fdata[62]+6*bs, fdata[54]+7*bs, bs);
+	coupling_region_multiply(fdata[54]+7*bs, inv, bs, fdata[54]+7*bs, 0, cw);
+	galois_region_xor(fdata[62]+6*bs, fdata[54]+7*bs, bs);
+	coupling_region_multiply(fdata[54]+7*bs, inv, bs, fdata[54]+7*bs, 0, cw);
+	galois_region_xor(fdata[63]+6*bs, fdata[55]+7*bs, bs);
+	coupling_region_multiply(fdata[55]+7*bs, inv, bs, fdata[55]+7*bs, 0, cw);
+	galois_region_xor(fdata[63]+6*bs, fdata[55]+7*bs, bs);
+	coupling_region_multiply(fdata[55]+7*bs, inv, bs, fdata[55]+7*bs, 0, cw);
+	coupling_region_multiply(fdata[48]+7*bs, 2, bs, fdata[56]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[49]+7*bs, 2, bs, fdata[57]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[50]+7*bs, 2, bs, fdata[58]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[51]+7*bs, 2, bs, fdata[59]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[52]+7*bs, 2, bs, fdata[60]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[53]+7*bs, 2, bs, fdata[61]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[54]+7*bs, 2, bs, fdata[62]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[55]+7*bs, 2, bs, fdata[63]+6*bs, 1, cw);
+	galois_region_xor(fdata[72]+6*bs, fdata[64]+7*bs, bs);
+	coupling_region_multiply(fdata[64]+7*bs, inv, bs, fdata[64]+7*bs, 0, cw);
+	galois_region_xor(fdata[72]+6*bs, fdata[64]+7*bs, bs);
+	coupling_region_multiply(fdata[64]+7*bs, inv, bs, fdata[64]+7*bs, 0, cw);
+	galois_region_xor(fdata[73]+6*bs, fdata[65]+7*bs, bs);
+	coupling_region_multiply(fdata[65]+7*bs, inv, bs, fdata[65]+7*bs, 0, cw);
+	galois_region_xor(fdata[73]+6*bs, fdata[65]+7*bs, bs);
+	coupling_region_multiply(fdata[65]+7*bs, inv, bs, fdata[65]+7*bs, 0, cw);
+	galois_region_xor(fdata[74]+6*bs, fdata[66]+7*bs, bs);
+	coupling_region_multiply(fdata[66]+7*bs, inv, bs, fdata[66]+7*bs, 0, cw);
+	galois_region_xor(fdata[74]+6*bs, fdata[66]+7*bs, bs);
+	coupling_region_multiply(fdata[66]+7*bs, inv, bs, fdata[66]+7*bs, 0, cw);
+	galois_region_xor(fdata[75]+6*bs, fdata[67]+7*bs, bs);
+	coupling_region_multiply(fdata[67]+7*bs, inv, bs, fdata[67]+7*bs, 0, cw);
+	galois_region_xor(fdata[75]+6*bs, fdata[67]+7*bs, bs);
+	coupling_region_multiply(fdata[67]+7*bs, inv, bs, fdata[67]+7*bs, 0, cw);
+	galois_region_xor(fdata[76]+6*bs, fdata[68]+7*bs, bs);
+	coupling_region_multiply(fdata[68]+7*bs, inv, bs, fdata[68]+7*bs, 0, cw);
+	galois_region_xor(fdata[76]+6*bs, fdata[68]+7*bs, bs);
+	coupling_region_multiply(fdata[68]+7*bs, inv, bs, fdata[68]+7*bs, 0, cw);
+	galois_region_xor(fdata[77]+6*bs, fdata[69]+7*bs, bs);
+	coupling_region_multiply(fdata[69]+7*bs, inv, bs, fdata[69]+7*bs, 0, cw);
+	galois_region_xor(fdata[77]+6*bs, fdata[69]+7*bs, bs);
+	coupling_region_multiply(fdata[69]+7*bs, inv, bs, fdata[69]+7*bs, 0, cw);
+	galois_region_xor(fdata[78]+6*bs, fdata[70]+7*bs, bs);
+	coupling_region_multiply(fdata[70]+7*bs, inv, bs, fdata[70]+7*bs, 0, cw);
+	galois_region_xor(fdata[78]+6*bs, fdata[70]+7*bs, bs);
+	coupling_region_multiply(fdata[70]+7*bs, inv, bs, fdata[70]+7*bs, 0, cw);
+	galois_region_xor(fdata[79]+6*bs, fdata[71]+7*bs, bs);
+	coupling_region_multiply(fdata[71]+7*bs, inv, bs, fdata[71]+7*bs, 0, cw);
+	galois_region_xor(fdata[79]+6*bs, fdata[71]+7*bs, bs);
+	coupling_region_multiply(fdata[71]+7*bs, inv, bs, fdata[71]+7*bs, 0, cw);
+	coupling_region_multiply(fdata[64]+7*bs, 2, bs, fdata[72]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[65]+7*bs, 2, bs, fdata[73]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[66]+7*bs, 2, bs, fdata[74]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[67]+7*bs, 2, bs, fdata[75]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[68]+7*bs, 2, bs, fdata[76]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[69]+7*bs, 2, bs, fdata[77]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[70]+7*bs, 2, bs, fdata[78]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[71]+7*bs, 2, bs, fdata[79]+6*bs, 1, cw);
+	galois_region_xor(fdata[88]+6*bs, fdata[80]+7*bs, bs);
+	coupling_region_multiply(fdata[80]+7*bs, inv, bs, fdata[80]+7*bs, 0, cw);
+	galois_region_xor(fdata[88]+6*bs, fdata[80]+7*bs, bs);
+	coupling_region_multiply(fdata[80]+7*bs, inv, bs, fdata[80]+7*bs, 0, cw);
+	galois_region_xor(fdata[89]+6*bs, fdata[81]+7*bs, bs);
+	coupling_region_multiply(fdata[81]+7*bs, inv, bs, fdata[81]+7*bs, 0, cw);
+	galois_region_xor(fdata[89]+6*bs, fdata[81]+7*bs, bs);
+	coupling_region_multiply(fdata[81]+7*bs, inv, bs, fdata[81]+7*bs, 0, cw);
+	galois_region_xor(fdata[90]+6*bs, fdata[82]+7*bs, bs);
+	coupling_region_multiply(fdata[82]+7*bs, inv, bs, fdata[82]+7*bs, 0, cw);
+	galois_region_xor(fdata[90]+6*bs, fdata[82]+7*bs, bs);
+	coupling_region_multiply(fdata[82]+7*bs, inv, bs, fdata[82]+7*bs, 0, cw);
+	galois_region_xor(fdata[91]+6*bs, fdata[83]+7*bs, bs);
+	coupling_region_multiply(fdata[83]+7*bs, inv, bs, fdata[83]+7*bs, 0, cw);
+	galois_region_xor(fdata[91]+6*bs, fdata[83]+7*bs, bs);
+	coupling_region_multiply(fdata[83]+7*bs, inv, bs, fdata[83]+7*bs, 0, cw);
+	galois_region_xor(fdata[92]+6*bs, fdata[84]+7*bs, bs);
+	coupling_region_multiply(fdata[84]+7*bs, inv, bs, fdata[84]+7*bs, 0, cw);
+	galois_region_xor(fdata[92]+6*bs, fdata[84]+7*bs, bs);
+	coupling_region_multiply(fdata[84]+7*bs, inv, bs, fdata[84]+7*bs, 0, cw);
+	galois_region_xor(fdata[93]+6*bs, fdata[85]+7*bs, bs);
+	coupling_region_multiply(fdata[85]+7*bs, inv, bs, fdata[85]+7*bs, 0, cw);
+	galois_region_xor(fdata[93]+6*bs, fdata[85]+7*bs, bs);
+	coupling_region_multiply(fdata[85]+7*bs, inv, bs, fdata[85]+7*bs, 0, cw);
+	galois_region_xor(fdata[94]+6*bs, fdata[86]+7*bs, bs);
+	coupling_region_multiply(fdata[86]+7*bs, inv, bs, fdata[86]+7*bs, 0, cw);
+	galois_region_xor(fdata[94]+6*bs, fdata[86]+7*bs, bs);
+	coupling_region_multiply(fdata[86]+7*bs, inv, bs, fdata[86]+7*bs, 0, cw);
+	galois_region_xor(fdata[95]+6*bs, fdata[87]+7*bs, bs);
+	coupling_region_multiply(fdata[87]+7*bs, inv, bs, fdata[87]+7*bs, 0, cw);
+	galois_region_xor(fdata[95]+6*bs, fdata[87]+7*bs, bs);
+	coupling_region_multiply(fdata[87]+7*bs, inv, bs, fdata[87]+7*bs, 0, cw);
+	coupling_region_multiply(fdata[80]+7*bs, 2, bs, fdata[88]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[81]+7*bs, 2, bs, fdata[89]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[82]+7*bs, 2, bs, fdata[90]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[83]+7*bs, 2, bs, fdata[91]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[84]+7*bs, 2, bs, fdata[92]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[85]+7*bs, 2, bs, fdata[93]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[86]+7*bs, 2, bs, fdata[94]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[87]+7*bs, 2, bs, fdata[95]+6*bs, 1, cw);
+	galois_region_xor(fdata[104]+6*bs, fdata[96]+7*bs, bs);
+	coupling_region_multiply(fdata[96]+7*bs, inv, bs, fdata[96]+7*bs, 0, cw);
+	galois_region_xor(fdata[104]+6*bs, fdata[96]+7*bs, bs);
+	coupling_region_multiply(fdata[96]+7*bs, inv, bs, fdata[96]+7*bs, 0, cw);
+	galois_region_xor(fdata[105]+6*bs, fdata[97]+7*bs, bs);
+	coupling_region_multiply(fdata[97]+7*bs, inv, bs, fdata[97]+7*bs, 0, cw);
+	galois_region_xor(fdata[105]+6*bs, fdata[97]+7*bs, bs);
+	coupling_region_multiply(fdata[97]+7*bs, inv, bs, fdata[97]+7*bs, 0, cw);
+	galois_region_xor(fdata[106]+6*bs, fdata[98]+7*bs, bs);
+	coupling_region_multiply(fdata[98]+7*bs, inv, bs, fdata[98]+7*bs, 0, cw);
+	galois_region_xor(fdata[106]+6*bs, fdata[98]+7*bs, bs);
+	coupling_region_multiply(fdata[98]+7*bs, inv, bs, fdata[98]+7*bs, 0, cw);
+	galois_region_xor(fdata[107]+6*bs, fdata[99]+7*bs, bs);
+	coupling_region_multiply(fdata[99]+7*bs, inv, bs, fdata[99]+7*bs, 0, cw);
+	galois_region_xor(fdata[107]+6*bs, fdata[99]+7*bs, bs);
+	coupling_region_multiply(fdata[99]+7*bs, inv, bs, fdata[99]+7*bs, 0, cw);
+	galois_region_xor(fdata[108]+6*bs, fdata[100]+7*bs, bs);
+	coupling_region_multiply(fdata[100]+7*bs, inv, bs, fdata[100]+7*bs, 0, cw);
+	galois_region_xor(fdata[108]+6*bs, fdata[100]+7*bs, bs);
+	coupling_region_multiply(fdata[100]+7*bs, inv, bs, fdata[100]+7*bs, 0, cw);
+	galois_region_xor(fdata[109]+6*bs, fdata[101]+7*bs, bs);
+	coupling_region_multiply(fdata[101]+7*bs, inv, bs, fdata[101]+7*bs, 0, cw);
+	galois_region_xor(fdata[109]+6*bs, fdata[101]+7*bs, bs);
+	coupling_region_multiply(fdata[101]+7*bs, inv, bs, fdata[101]+7*bs, 0, cw);
+	galois_region_xor(fdata[110]+6*bs, fdata[102]+7*bs, bs);
+	coupling_region_multiply(fdata[102]+7*bs, inv, bs, fdata[102]+7*bs, 0, cw);
+	galois_region_xor(fdata[110]+6*bs, fdata[102]+7*bs, bs);
+	coupling_region_multiply(fdata[102]+7*bs, inv, bs, fdata[102]+7*bs, 0, cw);
+	galois_region_xor(fdata[111]+6*bs, fdata[103]+7*bs, bs);
+	coupling_region_multiply(fdata[103]+7*bs, inv, bs, fdata[103]+7*bs, 0, cw);
+	galois_region_xor(fdata[111]+6*bs, fdata[103]+7*bs, bs);
+	coupling_region_multiply(fdata[103]+7*bs, inv, bs, fdata[103]+7*bs, 0, cw);
+	coupling_region_multiply(fdata[96]+7*bs, 2, bs, fdata[104]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[97]+7*bs, 2, bs, fdata[105]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[98]+7*bs, 2, bs, fdata[106]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[99]+7*bs, 2, bs, fdata[107]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[100]+7*bs, 2, bs, fdata[108]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[101]+7*bs, 2, bs, fdata[109]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[102]+7*bs, 2, bs, fdata[110]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[103]+7*bs, 2, bs, fdata[111]+6*bs, 1, cw);
+	galois_region_xor(fdata[120]+6*bs, fdata[112]+7*bs, bs);
+	coupling_region_multiply(fdata[112]+7*bs, inv, bs, fdata[112]+7*bs, 0, cw);
+	galois_region_xor(fdata[120]+6*bs, fdata[112]+7*bs, bs);
+	coupling_region_multiply(fdata[112]+7*bs, inv, bs, fdata[112]+7*bs, 0, cw);
+	galois_region_xor(fdata[121]+6*bs, fdata[113]+7*bs, bs);
+	coupling_region_multiply(fdata[113]+7*bs, inv, bs, fdata[113]+7*bs, 0, cw);
+	galois_region_xor(fdata[121]+6*bs, fdata[113]+7*bs, bs);
+	coupling_region_multiply(fdata[113]+7*bs, inv, bs, fdata[113]+7*bs, 0, cw);
+	galois_region_xor(fdata[122]+6*bs, fdata[114]+7*bs, bs);
+	coupling_region_multiply(fdata[114]+7*bs, inv, bs, fdata[114]+7*bs, 0, cw);
+	galois_region_xor(fdata[122]+6*bs, fdata[114]+7*bs, bs);
+	coupling_region_multiply(fdata[114]+7*bs, inv, bs, fdata[114]+7*bs, 0, cw);
+	galois_region_xor(fdata[123]+6*bs, fdata[115]+7*bs, bs);
+	coupling_region_multiply(fdata[115]+7*bs, inv, bs, fdata[115]+7*bs, 0, cw);
+	galois_region_xor(fdata[123]+6*bs, fdata[115]+7*bs, bs);
+	coupling_region_multiply(fdata[115]+7*bs, inv, bs, fdata[115]+7*bs, 0, cw);
+	galois_region_xor(fdata[124]+6*bs, fdata[116]+7*bs, bs);
+	coupling_region_multiply(fdata[116]+7*bs, inv, bs, fdata[116]+7*bs, 0, cw);
+	galois_region_xor(fdata[124]+6*bs, fdata[116]+7*bs, bs);
+	coupling_region_multiply(fdata[116]+7*bs, inv, bs, fdata[116]+7*bs, 0, cw);
+	galois_region_xor(fdata[125]+6*bs, fdata[117]+7*bs, bs);
+	coupling_region_multiply(fdata[117]+7*bs, inv, bs, fdata[117]+7*bs, 0, cw);
+	galois_region_xor(fdata[125]+6*bs, fdata[117]+7*bs, bs);
+	coupling_region_multiply(fdata[117]+7*bs, inv, bs, fdata[117]+7*bs, 0, cw);
+	galois_region_xor(fdata[126]+6*bs, fdata[118]+7*bs, bs);
+	coupling_region_multiply(fdata[118]+7*bs, inv, bs, fdata[118]+7*bs, 0, cw);
+	galois_region_xor(fdata[126]+6*bs, fdata[118]+7*bs, bs);
+	coupling_region_multiply(fdata[118]+7*bs, inv, bs, fdata[118]+7*bs, 0, cw);
+	galois_region_xor(fdata[127]+6*bs, fdata[119]+7*bs, bs);
+	coupling_region_multiply(fdata[119]+7*bs, inv, bs, fdata[119]+7*bs, 0, cw);
+	galois_region_xor(fdata[127]+6*bs, fdata[119]+7*bs, bs);
+	coupling_region_multiply(fdata[119]+7*bs, inv, bs, fdata[119]+7*bs, 0, cw);
+	coupling_region_multiply(fdata[112]+7*bs, 2, bs, fdata[120]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[113]+7*bs, 2, bs, fdata[121]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[114]+7*bs, 2, bs, fdata[122]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[115]+7*bs, 2, bs, fdata[123]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[116]+7*bs, 2, bs, fdata[124]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[117]+7*bs, 2, bs, fdata[125]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[118]+7*bs, 2, bs, fdata[126]+6*bs, 1, cw);
+	coupling_region_multiply(fdata[119]+7*bs, 2, bs, fdata[127]+6*bs, 1, cw);
+	galois_region_xor(fdata[16]+8*bs, fdata[0]+9*bs, bs);
+	coupling_region_multiply(fdata[0]+9*bs, inv, bs, fdata[0]+9*bs, 0, cw);
+	galois_region_xor(fdata[16]+8*bs, fdata[0]+9*bs, bs);
+	coupling_region_multiply(fdata[0]+9*bs, inv, bs, fdata[0]+9*bs, 0, cw);
+	galois_region_xor(fdata[17]+8*bs, fdata[1]+9*bs, bs);
+	coupling_region_multiply(fdata[1]+9*bs, inv, bs, fdata[1]+9*bs, 0, cw);
+	galois_region_xor(fdata[17]+8*bs, fdata[1]+9*bs, bs);
+	coupling_region_multiply(fdata[1]+9*bs, inv, bs, fdata[1]+9*bs, 0, cw);
+	galois_region_xor(fdata[18]+8*bs, fdata[2]+9*bs, bs);
+	coupling_region_multiply(fdata[2]+9*bs, inv, bs, fdata[2]+9*bs, 0, cw);
+	galois_region_xor(fdata[18]+8*bs, fdata[2]+9*bs, bs);
+	coupling_region_multiply(fdata[2]+9*bs, inv, bs, fdata[2]+9*bs, 0, cw);
+	galois_region_xor(fdata[19]+8*bs, fdata[3]+9*bs, bs);
+	coupling_region_multiply(fdata[3]+9*bs, inv, bs, fdata[3]+9*bs, 0, cw);
+	galois_region_xor(fdata[19]+8*bs, fdata[3]+9*bs, bs);
+	coupling_region_multiply(fdata[3]+9*bs, inv, bs, fdata[3]+9*bs, 0, cw);
+	galois_region_xor(fdata[20]+8*bs, fdata[4]+9*bs, bs);
+	coupling_region_multiply(fdata[4]+9*bs, inv, bs, fdata[4]+9*bs, 0, cw);
+	galois_region_xor(fdata[20]+8*bs, fdata[4]+9*bs, bs);
+	coupling_region_multiply(fdata[4]+9*bs, inv, bs, fdata[4]+9*bs, 0, cw);
+	galois_region_xor(fdata[21]+8*bs, fdata[5]+9*bs, bs);
+	coupling_region_multiply(fdata[5]+9*bs, inv, bs, fdata[5]+9*bs, 0, cw);
+	galois_region_xor(fdata[21]+8*bs, fdata[5]+9*bs, bs);
+	coupling_region_multiply(fdata[5]+9*bs, inv, bs, fdata[5]+9*bs, 0, cw);
+	galois_region_xor(fdata[22]+8*bs, fdata[6]+9*bs, bs);
+	coupling_region_multiply(fdata[6]+9*bs, inv, bs, fdata[6]+9*bs, 0, cw);
+	galois_region_xor(fdata[22]+8*bs, fdata[6]+9*bs, bs);
+	coupling_region_multiply(fdata[6]+9*bs, inv, bs, fdata[6]+9*bs, 0, cw);
+	galois_region_xor(fdata[23]+8*bs, fdata[7]+9*bs, bs);
+	coupling_region_multiply(fdata[7]+9*bs, inv, bs, fdata[7]+9*bs, 0, cw);
+	galois_region_xor(fdata[23]+8*bs, fdata[7]+9*bs, bs);
+	coupling_region_multiply(fdata[7]+9*bs, inv, bs, fdata[7]+9*bs, 0, cw);
+	galois_region_xor(fdata[24]+8*bs, fdata[8]+9*bs, bs);
+	coupling_region_multiply(fdata[8]+9*bs, inv, bs, fdata[8]+9*bs, 0, cw);
+	galois_region_xor(fdata[24]+8*bs, fdata[8]+9*bs, bs);
+	coupling_region_multiply(fdata[8]+9*bs, inv, bs, fdata[8]+9*bs, 0, cw);
+	galois_region_xor(fdata[25]+8*bs, fdata[9]+9*bs, bs);
+	coupling_region_multiply(fdata[9]+9*bs, inv, bs, fdata[9]+9*bs, 0, cw);
+	galois_region_xor(fdata[25]+8*bs, fdata[9]+9*bs, bs);
+	coupling_region_multiply(fdata[9]+9*bs, inv, bs, fdata[9]+9*bs, 0, cw);
+	galois_region_xor(fdata[26]+8*bs, fdata[10]+9*bs, bs);
+	coupling_region_multiply(fdata[10]+9*bs, inv, bs, fdata[10]+9*bs, 0, cw);
+	galois_region_xor(fdata[26]+8*bs, fdata[10]+9*bs, bs);
+	coupling_region_multiply(fdata[10]+9*bs, inv, bs, fdata[10]+9*bs, 0, cw);
+	galois_region_xor(fdata[27]+8*bs, fdata[11]+9*bs, bs);
+	coupling_region_multiply(fdata[11]+9*bs, inv, bs, fdata[11]+9*bs, 0, cw);
+	galois_region_xor(fdata[27]+8*bs, fdata[11]+9*bs, bs);
+	coupling_region_multiply(fdata[11]+9*bs, inv, bs, fdata[11]+9*bs, 0, cw);
+	galois_region_xor(fdata[28]+8*bs, fdata[12]+9*bs, bs);
+	coupling_region_multiply(fdata[12]+9*bs, inv, bs, fdata[12]+9*bs, 0, cw);
+	galois_region_xor(fdata[28]+8*bs, fdata[12]+9*bs, bs);
+	coupling_region_multiply(fdata[12]+9*bs, inv, bs, fdata[12]+9*bs, 0, cw);
+	galois_region_xor(fdata[29]+8*bs, fdata[13]+9*bs, bs);
+	coupling_region_multiply(fdata[13]+9*bs, inv, bs, fdata[13]+9*bs, 0, cw);
+	galois_region_xor(fdata[29]+8*bs, fdata[13]+9*bs, bs);
+	coupling_region_multiply(fdata[13]+9*bs, inv, bs, fdata[13]+9*bs, 0, cw);
+	galois_region_xor(fdata[30]+8*bs, fdata[14]+9*bs, bs);
+	coupling_region_multiply(fdata[14]+9*bs, inv, bs, fdata[14]+9*bs, 0, cw);
+	galois_region_xor(fdata[30]+8*bs, fdata[14]+9*bs, bs);
+	coupling_region_multiply(fdata[14]+9*bs, inv, bs, fdata[14]+9*bs, 0, cw);
+	galois_region_xor(fdata[31]+8*bs, fdata[15]+9*bs, bs);
+	coupling_region_multiply(fdata[15]+9*bs, inv, bs, fdata[15]+9*bs, 0, cw);
+	galois_region_xor(fdata[31]+8*bs, fdata[15]+9*bs, bs);
+	coupling_region_multiply(fdata[15]+9*bs, inv, bs, fdata[15]+9*bs, 0, cw);
+	coupling_region_multiply(fdata[0]+9*bs, 2, bs, fdata[16]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[1]+9*bs, 2, bs, fdata[17]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[2]+9*bs, 2, bs, fdata[18]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[3]+9*bs, 2, bs, fdata[19]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[4]+9*bs, 2, bs, fdata[20]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[5]+9*bs, 2, bs, fdata[21]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[6]+9*bs, 2, bs, fdata[22]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[7]+9*bs, 2, bs, fdata[23]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[8]+9*bs, 2, bs, fdata[24]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[9]+9*bs, 2, bs, fdata[25]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[10]+9*bs, 2, bs, fdata[26]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[11]+9*bs, 2, bs, fdata[27]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[12]+9*bs, 2, bs, fdata[28]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[13]+9*bs, 2, bs, fdata[29]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[14]+9*bs, 2, bs, fdata[30]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[15]+9*bs, 2, bs, fdata[31]+8*bs, 1, cw);
+	galois_region_xor(fdata[48]+8*bs, fdata[32]+9*bs, bs);
+	coupling_region_multiply(fdata[32]+9*bs, inv, bs, fdata[32]+9*bs, 0, cw);
+	galois_region_xor(fdata[48]+8*bs, fdata[32]+9*bs, bs);
+	coupling_region_multiply(fdata[32]+9*bs, inv, bs, fdata[32]+9*bs, 0, cw);
+	galois_region_xor(fdata[49]+8*bs, fdata[33]+9*bs, bs);
+	coupling_region_multiply(fdata[33]+9*bs, inv, bs, fdata[33]+9*bs, 0, cw);
+	galois_region_xor(fdata[49]+8*bs, fdata[33]+9*bs, bs);
+	coupling_region_multiply(fdata[33]+9*bs, inv, bs, fdata[33]+9*bs, 0, cw);
+	galois_region_xor(fdata[50]+8*bs, fdata[34]+9*bs, bs);
+	coupling_region_multiply(fdata[34]+9*bs, inv, bs, fdata[34]+9*bs, 0, cw);
+	galois_region_xor(fdata[50]+8*bs, fdata[34]+9*bs, bs);
+	coupling_region_multiply(fdata[34]+9*bs, inv, bs, fdata[34]+9*bs, 0, cw);
+	galois_region_xor(fdata[51]+8*bs, fdata[35]+9*bs, bs);
+	coupling_region_multiply(fdata[35]+9*bs, inv, bs, fdata[35]+9*bs, 0, cw);
+	galois_region_xor(fdata[51]+8*bs, fdata[35]+9*bs, bs);
+	coupling_region_multiply(fdata[35]+9*bs, inv, bs, fdata[35]+9*bs, 0, cw);
+	galois_region_xor(fdata[52]+8*bs, fdata[36]+9*bs, bs);
+	coupling_region_multiply(fdata[36]+9*bs, inv, bs, fdata[36]+9*bs, 0, cw);
+	galois_region_xor(fdata[52]+8*bs, fdata[36]+9*bs, bs);
+	coupling_region_multiply(fdata[36]+9*bs, inv, bs, fdata[36]+9*bs, 0, cw);
+	galois_region_xor(fdata[53]+8*bs, fdata[37]+9*bs, bs);
+	coupling_region_multiply(fdata[37]+9*bs, inv, bs, fdata[37]+9*bs, 0, cw);
+	galois_region_xor(fdata[53]+8*bs, fdata[37]+9*bs, bs);
+	coupling_region_multiply(fdata[37]+9*bs, inv, bs, fdata[37]+9*bs, 0, cw);
+	galois_region_xor(fdata[54]+8*bs, fdata[38]+9*bs, bs);
+	coupling_region_multiply(fdata[38]+9*bs, inv, bs, fdata[38]+9*bs, 0, cw);
+	galois_region_xor(fdata[54]+8*bs, fdata[38]+9*bs, bs);
+	coupling_region_multiply(fdata[38]+9*bs, inv, bs, fdata[38]+9*bs, 0, cw);
+	galois_region_xor(fdata[55]+8*bs, fdata[39]+9*bs, bs);
+	coupling_region_multiply(fdata[39]+9*bs, inv, bs, fdata[39]+9*bs, 0, cw);
+	galois_region_xor(fdata[55]+8*bs, fdata[39]+9*bs, bs);
+	coupling_region_multiply(fdata[39]+9*bs, inv, bs, fdata[39]+9*bs, 0, cw);
+	galois_region_xor(fdata[56]+8*bs, fdata[40]+9*bs, bs);
+	coupling_region_multiply(fdata[40]+9*bs, inv, bs, fdata[40]+9*bs, 0, cw);
+	galois_region_xor(fdata[56]+8*bs, fdata[40]+9*bs, bs);
+	coupling_region_multiply(fdata[40]+9*bs, inv, bs, fdata[40]+9*bs, 0, cw);
+	galois_region_xor(fdata[57]+8*bs, fdata[41]+9*bs, bs);
+	coupling_region_multiply(fdata[41]+9*bs, inv, bs, fdata[41]+9*bs, 0, cw);
+	galois_region_xor(fdata[57]+8*bs, fdata[41]+9*bs, bs);
+	coupling_region_multiply(fdata[41]+9*bs, inv, bs, fdata[41]+9*bs, 0, cw);
+	galois_region_xor(fdata[58]+8*bs, fdata[42]+9*bs, bs);
+	coupling_region_multiply(fdata[42]+9*bs, inv, bs, fdata[42]+9*bs, 0, cw);
+	galois_region_xor(fdata[58]+8*bs, fdata[42]+9*bs, bs);
+	coupling_region_multiply(fdata[42]+9*bs, inv, bs, fdata[42]+9*bs, 0, cw);
+	galois_region_xor(fdata[59]+8*bs, fdata[43]+9*bs, bs);
+	coupling_region_multiply(fdata[43]+9*bs, inv, bs, fdata[43]+9*bs, 0, cw);
+	galois_region_xor(fdata[59]+8*bs, fdata[43]+9*bs, bs);
+	coupling_region_multiply(fdata[43]+9*bs, inv, bs, fdata[43]+9*bs, 0, cw);
+	galois_region_xor(fdata[60]+8*bs, fdata[44]+9*bs, bs);
+	coupling_region_multiply(fdata[44]+9*bs, inv, bs, fdata[44]+9*bs, 0, cw);
+	galois_region_xor(fdata[60]+8*bs, fdata[44]+9*bs, bs);
+	coupling_region_multiply(fdata[44]+9*bs, inv, bs, fdata[44]+9*bs, 0, cw);
+	galois_region_xor(fdata[61]+8*bs, fdata[45]+9*bs, bs);
+	coupling_region_multiply(fdata[45]+9*bs, inv, bs, fdata[45]+9*bs, 0, cw);
+	galois_region_xor(fdata[61]+8*bs, fdata[45]+9*bs, bs);
+	coupling_region_multiply(fdata[45]+9*bs, inv, bs, fdata[45]+9*bs, 0, cw);
+	galois_region_xor(fdata[62]+8*bs, fdata[46]+9*bs, bs);
+	coupling_region_multiply(fdata[46]+9*bs, inv, bs, fdata[46]+9*bs, 0, cw);
+	galois_region_xor(fdata[62]+8*bs, fdata[46]+9*bs, bs);
+	coupling_region_multiply(fdata[46]+9*bs, inv, bs, fdata[46]+9*bs, 0, cw);
+	galois_region_xor(fdata[63]+8*bs, fdata[47]+9*bs, bs);
+	coupling_region_multiply(fdata[47]+9*bs, inv, bs, fdata[47]+9*bs, 0, cw);
+	galois_region_xor(fdata[63]+8*bs, fdata[47]+9*bs, bs);
+	coupling_region_multiply(fdata[47]+9*bs, inv, bs, fdata[47]+9*bs, 0, cw);
+	coupling_region_multiply(fdata[32]+9*bs, 2, bs, fdata[48]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[33]+9*bs, 2, bs, fdata[49]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[34]+9*bs, 2, bs, fdata[50]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[35]+9*bs, 2, bs, fdata[51]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[36]+9*bs, 2, bs, fdata[52]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[37]+9*bs, 2, bs, fdata[53]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[38]+9*bs, 2, bs, fdata[54]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[39]+9*bs, 2, bs, fdata[55]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[40]+9*bs, 2, bs, fdata[56]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[41]+9*bs, 2, bs, fdata[57]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[42]+9*bs, 2, bs, fdata[58]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[43]+9*bs, 2, bs, fdata[59]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[44]+9*bs, 2, bs, fdata[60]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[45]+9*bs, 2, bs, fdata[61]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[46]+9*bs, 2, bs, fdata[62]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[47]+9*bs, 2, bs, fdata[63]+8*bs, 1, cw);
+	galois_region_xor(fdata[80]+8*bs, fdata[64]+9*bs, bs);
+	coupling_region_multiply(fdata[64]+9*bs, inv, bs, fdata[64]+9*bs, 0, cw);
+	galois_region_xor(fdata[80]+8*bs, fdata[64]+9*bs, bs);
+	coupling_region_multiply(fdata[64]+9*bs, inv, bs, fdata[64]+9*bs, 0, cw);
+	galois_region_xor(fdata[81]+8*bs, fdata[65]+9*bs, bs);
+	coupling_region_multiply(fdata[65]+9*bs, inv, bs, fdata[65]+9*bs, 0, cw);
+	galois_region_xor(fdata[81]+8*bs, fdata[65]+9*bs, bs);
+	coupling_region_multiply(fdata[65]+9*bs, inv, bs, fdata[65]+9*bs, 0, cw);
+	galois_region_xor(fdata[82]+8*bs, fdata[66]+9*bs, bs);
+	coupling_region_multiply(fdata[66]+9*bs, inv, bs, fdata[66]+9*bs, 0, cw);
+	galois_region_xor(fdata[82]+8*bs, fdata[66]+9*bs, bs);
+	coupling_region_multiply(fdata[66]+9*bs, inv, bs, fdata[66]+9*bs, 0, cw);
+	galois_region_xor(fdata[83]+8*bs, fdata[67]+9*bs, bs);
+	coupling_region_multiply(fdata[67]+9*bs, inv, bs, fdata[67]+9*bs, 0, cw);
+	galois_region_xor(fdata[83]+8*bs, fdata[67]+9*bs, bs);
+	coupling_region_multiply(fdata[67]+9*bs, inv, bs, fdata[67]+9*bs, 0, cw);
+	galois_region_xor(fdata[84]+8*bs, fdata[68]+9*bs, bs);
+	coupling_region_multiply(fdata[68]+9*bs, inv, bs, fdata[68]+9*bs, 0, cw);
+	galois_region_xor(fdata[84]+8*bs, fdata[68]+9*bs, bs);
+	coupling_region_multiply(fdata[68]+9*bs, inv, bs, fdata[68]+9*bs, 0, cw);
+	galois_region_xor(fdata[85]+8*bs, fdata[69]+9*bs, bs);
+	coupling_region_multiply(fdata[69]+9*bs, inv, bs, fdata[69]+9*bs, 0, cw);
+	galois_region_xor(fdata[85]+8*bs, fdata[69]+9*bs, bs);
+	coupling_region_multiply(fdata[69]+9*bs, inv, bs, fdata[69]+9*bs, 0, cw);
+	galois_region_xor(fdata[86]+8*bs, fdata[70]+9*bs, bs);
+	coupling_region_multiply(fdata[70]+9*bs, inv, bs, fdata[70]+9*bs, 0, cw);
+	galois_region_xor(fdata[86]+8*bs, fdata[70]+9*bs, bs);
+	coupling_region_multiply(fdata[70]+9*bs, inv, bs, fdata[70]+9*bs, 0, cw);
+	galois_region_xor(fdata[87]+8*bs, fdata[71]+9*bs, bs);
+	coupling_region_multiply(fdata[71]+9*bs, inv, bs, fdata[71]+9*bs, 0, cw);
+	galois_region_xor(fdata[87]+8*bs, fdata[71]+9*bs, bs);
+	coupling_region_multiply(fdata[71]+9*bs, inv, bs, fdata[71]+9*bs, 0, cw);
+	galois_region_xor(fdata[88]+8*bs, fdata[72]+9*bs, bs);
+	coupling_region_multiply(fdata[72]+9*bs, inv, bs, fdata[72]+9*bs, 0, cw);
+	galois_region_xor(fdata[88]+8*bs, fdata[72]+9*bs, bs);
+	coupling_region_multiply(fdata[72]+9*bs, inv, bs, fdata[72]+9*bs, 0, cw);
+	galois_region_xor(fdata[89]+8*bs, fdata[73]+9*bs, bs);
+	coupling_region_multiply(fdata[73]+9*bs, inv, bs, fdata[73]+9*bs, 0, cw);
+	galois_region_xor(fdata[89]+8*bs, fdata[73]+9*bs, bs);
+	coupling_region_multiply(fdata[73]+9*bs, inv, bs, fdata[73]+9*bs, 0, cw);
+	galois_region_xor(fdata[90]+8*bs, fdata[74]+9*bs, bs);
+	coupling_region_multiply(fdata[74]+9*bs, inv, bs, fdata[74]+9*bs, 0, cw);
+	galois_region_xor(fdata[90]+8*bs, fdata[74]+9*bs, bs);
+	coupling_region_multiply(fdata[74]+9*bs, inv, bs, fdata[74]+9*bs, 0, cw);
+	galois_region_xor(fdata[91]+8*bs, fdata[75]+9*bs, bs);
+	coupling_region_multiply(fdata[75]+9*bs, inv, bs, fdata[75]+9*bs, 0, cw);
+	galois_region_xor(fdata[91]+8*bs, fdata[75]+9*bs, bs);
+	coupling_region_multiply(fdata[75]+9*bs, inv, bs, fdata[75]+9*bs, 0, cw);
+	galois_region_xor(fdata[92]+8*bs, fdata[76]+9*bs, bs);
+	coupling_region_multiply(fdata[76]+9*bs, inv, bs, fdata[76]+9*bs, 0, cw);
+	galois_region_xor(fdata[92]+8*bs, fdata[76]+9*bs, bs);
+	coupling_region_multiply(fdata[76]+9*bs, inv, bs, fdata[76]+9*bs, 0, cw);
+	galois_region_xor(fdata[93]+8*bs, fdata[77]+9*bs, bs);
+	coupling_region_multiply(fdata[77]+9*bs, inv, bs, fdata[77]+9*bs, 0, cw);
+	galois_region_xor(fdata[93]+8*bs, fdata[77]+9*bs, bs);
+	coupling_region_multiply(fdata[77]+9*bs, inv, bs, fdata[77]+9*bs, 0, cw);
+	galois_region_xor(fdata[94]+8*bs, fdata[78]+9*bs, bs);
+	coupling_region_multiply(fdata[78]+9*bs, inv, bs, fdata[78]+9*bs, 0, cw);
+	galois_region_xor(fdata[94]+8*bs, fdata[78]+9*bs, bs);
+	coupling_region_multiply(fdata[78]+9*bs, inv, bs, fdata[78]+9*bs, 0, cw);
+	galois_region_xor(fdata[95]+8*bs, fdata[79]+9*bs, bs);
+	coupling_region_multiply(fdata[79]+9*bs, inv, bs, fdata[79]+9*bs, 0, cw);
+	galois_region_xor(fdata[95]+8*bs, fdata[79]+9*bs, bs);
+	coupling_region_multiply(fdata[79]+9*bs, inv, bs, fdata[79]+9*bs, 0, cw);
+	coupling_region_multiply(fdata[64]+9*bs, 2, bs, fdata[80]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[65]+9*bs, 2, bs, fdata[81]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[66]+9*bs, 2, bs, fdata[82]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[67]+9*bs, 2, bs, fdata[83]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[68]+9*bs, 2, bs, fdata[84]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[69]+9*bs, 2, bs, fdata[85]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[70]+9*bs, 2, bs, fdata[86]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[71]+9*bs, 2, bs, fdata[87]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[72]+9*bs, 2, bs, fdata[88]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[73]+9*bs, 2, bs, fdata[89]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[74]+9*bs, 2, bs, fdata[90]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[75]+9*bs, 2, bs, fdata[91]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[76]+9*bs, 2, bs, fdata[92]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[77]+9*bs, 2, bs, fdata[93]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[78]+9*bs, 2, bs, fdata[94]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[79]+9*bs, 2, bs, fdata[95]+8*bs, 1, cw);
+	galois_region_xor(fdata[112]+8*bs, fdata[96]+9*bs, bs);
+	coupling_region_multiply(fdata[96]+9*bs, inv, bs, fdata[96]+9*bs, 0, cw);
+	galois_region_xor(fdata[112]+8*bs, fdata[96]+9*bs, bs);
+	coupling_region_multiply(fdata[96]+9*bs, inv, bs, fdata[96]+9*bs, 0, cw);
+	galois_region_xor(fdata[113]+8*bs, fdata[97]+9*bs, bs);
+	coupling_region_multiply(fdata[97]+9*bs, inv, bs, fdata[97]+9*bs, 0, cw);
+	galois_region_xor(fdata[113]+8*bs, fdata[97]+9*bs, bs);
+	coupling_region_multiply(fdata[97]+9*bs, inv, bs, fdata[97]+9*bs, 0, cw);
+	galois_region_xor(fdata[114]+8*bs, fdata[98]+9*bs, bs);
+	coupling_region_multiply(fdata[98]+9*bs, inv, bs, fdata[98]+9*bs, 0, cw);
+	galois_region_xor(fdata[114]+8*bs, fdata[98]+9*bs, bs);
+	coupling_region_multiply(fdata[98]+9*bs, inv, bs, fdata[98]+9*bs, 0, cw);
+	galois_region_xor(fdata[115]+8*bs, fdata[99]+9*bs, bs);
+	coupling_region_multiply(fdata[99]+9*bs, inv, bs, fdata[99]+9*bs, 0, cw);
+	galois_region_xor(fdata[115]+8*bs, fdata[99]+9*bs, bs);
+	coupling_region_multiply(fdata[99]+9*bs, inv, bs, fdata[99]+9*bs, 0, cw);
+	galois_region_xor(fdata[116]+8*bs, fdata[100]+9*bs, bs);
+	coupling_region_multiply(fdata[100]+9*bs, inv, bs, fdata[100]+9*bs, 0, cw);
+	galois_region_xor(fdata[116]+8*bs, fdata[100]+9*bs, bs);
+	coupling_region_multiply(fdata[100]+9*bs, inv, bs, fdata[100]+9*bs, 0, cw);
+	galois_region_xor(fdata[117]+8*bs, fdata[101]+9*bs, bs);
+	coupling_region_multiply(fdata[101]+9*bs, inv, bs, fdata[101]+9*bs, 0, cw);
+	galois_region_xor(fdata[117]+8*bs, fdata[101]+9*bs, bs);
+	coupling_region_multiply(fdata[101]+9*bs, inv, bs, fdata[101]+9*bs, 0, cw);
+	galois_region_xor(fdata[118]+8*bs, fdata[102]+9*bs, bs);
+	coupling_region_multiply(fdata[102]+9*bs, inv, bs, fdata[102]+9*bs, 0, cw);
+	galois_region_xor(fdata[118]+8*bs, fdata[102]+9*bs, bs);
+	coupling_region_multiply(fdata[102]+9*bs, inv, bs, fdata[102]+9*bs, 0, cw);
+	galois_region_xor(fdata[119]+8*bs, fdata[103]+9*bs, bs);
+	coupling_region_multiply(fdata[103]+9*bs, inv, bs, fdata[103]+9*bs, 0, cw);
+	galois_region_xor(fdata[119]+8*bs, fdata[103]+9*bs, bs);
+	coupling_region_multiply(fdata[103]+9*bs, inv, bs, fdata[103]+9*bs, 0, cw);
+	galois_region_xor(fdata[120]+8*bs, fdata[104]+9*bs, bs);
+	coupling_region_multiply(fdata[104]+9*bs, inv, bs, fdata[104]+9*bs, 0, cw);
+	galois_region_xor(fdata[120]+8*bs, fdata[104]+9*bs, bs);
+	coupling_region_multiply(fdata[104]+9*bs, inv, bs, fdata[104]+9*bs, 0, cw);
+	galois_region_xor(fdata[121]+8*bs, fdata[105]+9*bs, bs);
+	coupling_region_multiply(fdata[105]+9*bs, inv, bs, fdata[105]+9*bs, 0, cw);
+	galois_region_xor(fdata[121]+8*bs, fdata[105]+9*bs, bs);
+	coupling_region_multiply(fdata[105]+9*bs, inv, bs, fdata[105]+9*bs, 0, cw);
+	galois_region_xor(fdata[122]+8*bs, fdata[106]+9*bs, bs);
+	coupling_region_multiply(fdata[106]+9*bs, inv, bs, fdata[106]+9*bs, 0, cw);
+	galois_region_xor(fdata[122]+8*bs, fdata[106]+9*bs, bs);
+	coupling_region_multiply(fdata[106]+9*bs, inv, bs, fdata[106]+9*bs, 0, cw);
+	galois_region_xor(fdata[123]+8*bs, fdata[107]+9*bs, bs);
+	coupling_region_multiply(fdata[107]+9*bs, inv, bs, fdata[107]+9*bs, 0, cw);
+	galois_region_xor(fdata[123]+8*bs, fdata[107]+9*bs, bs);
+	coupling_region_multiply(fdata[107]+9*bs, inv, bs, fdata[107]+9*bs, 0, cw);
+	galois_region_xor(fdata[124]+8*bs, fdata[108]+9*bs, bs);
+	coupling_region_multiply(fdata[108]+9*bs, inv, bs, fdata[108]+9*bs, 0, cw);
+	galois_region_xor(fdata[124]+8*bs, fdata[108]+9*bs, bs);
+	coupling_region_multiply(fdata[108]+9*bs, inv, bs, fdata[108]+9*bs, 0, cw);
+	galois_region_xor(fdata[125]+8*bs, fdata[109]+9*bs, bs);
+	coupling_region_multiply(fdata[109]+9*bs, inv, bs, fdata[109]+9*bs, 0, cw);
+	galois_region_xor(fdata[125]+8*bs, fdata[109]+9*bs, bs);
+	coupling_region_multiply(fdata[109]+9*bs, inv, bs, fdata[109]+9*bs, 0, cw);
+	galois_region_xor(fdata[126]+8*bs, fdata[110]+9*bs, bs);
+	coupling_region_multiply(fdata[110]+9*bs, inv, bs, fdata[110]+9*bs, 0, cw);
+	galois_region_xor(fdata[126]+8*bs, fdata[110]+9*bs, bs);
+	coupling_region_multiply(fdata[110]+9*bs, inv, bs, fdata[110]+9*bs, 0, cw);
+	galois_region_xor(fdata[127]+8*bs, fdata[111]+9*bs, bs);
+	coupling_region_multiply(fdata[111]+9*bs, inv, bs, fdata[111]+9*bs, 0, cw);
+	galois_region_xor(fdata[127]+8*bs, fdata[111]+9*bs, bs);
+	coupling_region_multiply(fdata[111]+9*bs, inv, bs, fdata[111]+9*bs, 0, cw);
+	coupling_region_multiply(fdata[96]+9*bs, 2, bs, fdata[112]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[97]+9*bs, 2, bs, fdata[113]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[98]+9*bs, 2, bs, fdata[114]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[99]+9*bs, 2, bs, fdata[115]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[100]+9*bs, 2, bs, fdata[116]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[101]+9*bs, 2, bs, fdata[117]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[102]+9*bs, 2, bs, fdata[118]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[103]+9*bs, 2, bs, fdata[119]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[104]+9*bs, 2, bs, fdata[120]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[105]+9*bs, 2, bs, fdata[121]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[106]+9*bs, 2, bs, fdata[122]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[107]+9*bs, 2, bs, fdata[123]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[108]+9*bs, 2, bs, fdata[124]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[109]+9*bs, 2, bs, fdata[125]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[110]+9*bs, 2, bs, fdata[126]+8*bs, 1, cw);
+	coupling_region_multiply(fdata[111]+9*bs, 2, bs, fdata[127]+8*bs, 1, cw);
+	galois_region_xor(fcoding[32], fcoding[0]+bs, bs);
+	coupling_region_multiply(fcoding[0]+bs, inv, bs, fcoding[0]+bs, 0, cw);
+	galois_region_xor(fcoding[32], fcoding[0]+bs, bs);
+	coupling_region_multiply(fcoding[0]+bs, inv, bs, fcoding[0]+bs, 0, cw);
+	galois_region_xor(fcoding[33], fcoding[1]+bs, bs);
+	coupling_region_multiply(fcoding[1]+bs, inv, bs, fcoding[1]+bs, 0, cw);
+	galois_region_xor(fcoding[33], fcoding[1]+bs, bs);
+	coupling_region_multiply(fcoding[1]+bs, inv, bs, fcoding[1]+bs, 0, cw);
+	galois_region_xor(fcoding[34], fcoding[2]+bs, bs);
+	coupling_region_multiply(fcoding[2]+bs, inv, bs, fcoding[2]+bs, 0, cw);
+	galois_region_xor(fcoding[34], fcoding[2]+bs, bs);
+	coupling_region_multiply(fcoding[2]+bs, inv, bs, fcoding[2]+bs, 0, cw);
+	galois_region_xor(fcoding[35], fcoding[3]+bs, bs);
+	coupling_region_multiply(fcoding[3]+bs, inv, bs, fcoding[3]+bs, 0, cw);
+	galois_region_xor(fcoding[35], fcoding[3]+bs, bs);
+	coupling_region_multiply(fcoding[3]+bs, inv, bs, fcoding[3]+bs, 0, cw);
+	galois_region_xor(fcoding[36], fcoding[4]+bs, bs);
+	coupling_region_multiply(fcoding[4]+bs, inv, bs, fcoding[4]+bs, 0, cw);
+	galois_region_xor(fcoding[36], fcoding[4]+bs, bs);
+	coupling_region_multiply(fcoding[4]+bs, inv, bs, fcoding[4]+bs, 0, cw);
+	galois_region_xor(fcoding[37], fcoding[5]+bs, bs);
+	coupling_region_multiply(fcoding[5]+bs, inv, bs, fcoding[5]+bs, 0, cw);
+	galois_region_xor(fcoding[37], fcoding[5]+bs, bs);
+	coupling_region_multiply(fcoding[5]+bs, inv, bs, fcoding[5]+bs, 0, cw);
+	galois_region_xor(fcoding[38], fcoding[6]+bs, bs);
+	coupling_region_multiply(fcoding[6]+bs, inv, bs, fcoding[6]+bs, 0, cw);
+	galois_region_xor(fcoding[38], fcoding[6]+bs, bs);
+	coupling_region_multiply(fcoding[6]+bs, inv, bs, fcoding[6]+bs, 0, cw);
+	galois_region_xor(fcoding[39], fcoding[7]+bs, bs);
+	coupling_region_multiply(fcoding[7]+bs, inv, bs, fcoding[7]+bs, 0, cw);
+	galois_region_xor(fcoding[39], fcoding[7]+bs, bs);
+	coupling_region_multiply(fcoding[7]+bs, inv, bs, fcoding[7]+bs, 0, cw);
+	galois_region_xor(fcoding[40], fcoding[8]+bs, bs);
+	coupling_region_multiply(fcoding[8]+bs, inv, bs, fcoding[8]+bs, 0, cw);
+	galois_region_xor(fcoding[40], fcoding[8]+bs, bs);
+	coupling_region_multiply(fcoding[8]+bs, inv, bs, fcoding[8]+bs, 0, cw);
+	galois_region_xor(fcoding[41], fcoding[9]+bs, bs);
+	coupling_region_multiply(fcoding[9]+bs, inv, bs, fcoding[9]+bs, 0, cw);
+	galois_region_xor(fcoding[41], fcoding[9]+bs, bs);
+	coupling_region_multiply(fcoding[9]+bs, inv, bs, fcoding[9]+bs, 0, cw);
+	galois_region_xor(fcoding[42], fcoding[10]+bs, bs);
+	coupling_region_multiply(fcoding[10]+bs, inv, bs, fcoding[10]+bs, 0, cw);
+	galois_region_xor(fcoding[42], fcoding[10]+bs, bs);
+	coupling_region_multiply(fcoding[10]+bs, inv, bs, fcoding[10]+bs, 0, cw);
+	galois_region_xor(fcoding[43], fcoding[11]+bs, bs);
+	coupling_region_multiply(fcoding[11]+bs, inv, bs, fcoding[11]+bs, 0, cw);
+	galois_region_xor(fcoding[43], fcoding[11]+bs, bs);
+	coupling_region_multiply(fcoding[11]+bs, inv, bs, fcoding[11]+bs, 0, cw);
+	galois_region_xor(fcoding[44], fcoding[12]+bs, bs);
+	coupling_region_multiply(fcoding[12]+bs, inv, bs, fcoding[12]+bs, 0, cw);
+	galois_region_xor(fcoding[44], fcoding[12]+bs, bs);
+	coupling_region_multiply(fcoding[12]+bs, inv, bs, fcoding[12]+bs, 0, cw);
+	galois_region_xor(fcoding[45], fcoding[13]+bs, bs);
+	coupling_region_multiply(fcoding[13]+bs, inv, bs, fcoding[13]+bs, 0, cw);
+	galois_region_xor(fcoding[45], fcoding[13]+bs, bs);
+	coupling_region_multiply(fcoding[13]+bs, inv, bs, fcoding[13]+bs, 0, cw);
+	galois_region_xor(fcoding[46], fcoding[14]+bs, bs);
+	coupling_region_multiply(fcoding[14]+bs, inv, bs, fcoding[14]+bs, 0, cw);
+	galois_region_xor(fcoding[46], fcoding[14]+bs, bs);
+	coupling_region_multiply(fcoding[14]+bs, inv, bs, fcoding[14]+bs, 0, cw);
+	galois_region_xor(fcoding[47], fcoding[15]+bs, bs);
+	coupling_region_multiply(fcoding[15]+bs, inv, bs, fcoding[15]+bs, 0, cw);
+	galois_region_xor(fcoding[47], fcoding[15]+bs, bs);
+	coupling_region_multiply(fcoding[15]+bs, inv, bs, fcoding[15]+bs, 0, cw);
+	galois_region_xor(fcoding[48], fcoding[16]+bs, bs);
+	coupling_region_multiply(fcoding[16]+bs, inv, bs, fcoding[16]+bs, 0, cw);
+	galois_region_xor(fcoding[48], fcoding[16]+bs, bs);
+	coupling_region_multiply(fcoding[16]+bs, inv, bs, fcoding[16]+bs, 0, cw);
+	galois_region_xor(fcoding[49], fcoding[17]+bs, bs);
+	coupling_region_multiply(fcoding[17]+bs, inv, bs, fcoding[17]+bs, 0, cw);
+	galois_region_xor(fcoding[49], fcoding[17]+bs, bs);
+	coupling_region_multiply(fcoding[17]+bs, inv, bs, fcoding[17]+bs, 0, cw);
+	galois_region_xor(fcoding[50], fcoding[18]+bs, bs);
+	coupling_region_multiply(fcoding[18]+bs, inv, bs, fcoding[18]+bs, 0, cw);
+	galois_region_xor(fcoding[50], fcoding[18]+bs, bs);
+	coupling_region_multiply(fcoding[18]+bs, inv, bs, fcoding[18]+bs, 0, cw);
+	galois_region_xor(fcoding[51], fcoding[19]+bs, bs);
+	coupling_region_multiply(fcoding[19]+bs, inv, bs, fcoding[19]+bs, 0, cw);
+	galois_region_xor(fcoding[51], fcoding[19]+bs, bs);
+	coupling_region_multiply(fcoding[19]+bs, inv, bs, fcoding[19]+bs, 0, cw);
+	galois_region_xor(fcoding[52], fcoding[20]+bs, bs);
+	coupling_region_multiply(fcoding[20]+bs, inv, bs, fcoding[20]+bs, 0, cw);
+	galois_region_xor(fcoding[52], fcoding[20]+bs, bs);
+	coupling_region_multiply(fcoding[20]+bs, inv, bs, fcoding[20]+bs, 0, cw);
+	galois_region_xor(fcoding[53], fcoding[21]+bs, bs);
+	coupling_region_multiply(fcoding[21]+bs, inv, bs, fcoding[21]+bs, 0, cw);
+	galois_region_xor(fcoding[53], fcoding[21]+bs, bs);
+	coupling_region_multiply(fcoding[21]+bs, inv, bs, fcoding[21]+bs, 0, cw);
+	galois_region_xor(fcoding[54], fcoding[22]+bs, bs);
+	coupling_region_multiply(fcoding[22]+bs, inv, bs, fcoding[22]+bs, 0, cw);
+	galois_region_xor(fcoding[54], fcoding[22]+bs, bs);
+	coupling_region_multiply(fcoding[22]+bs, inv, bs, fcoding[22]+bs, 0, cw);
+	galois_region_xor(fcoding[55], fcoding[23]+bs, bs);
+	coupling_region_multiply(fcoding[23]+bs, inv, bs, fcoding[23]+bs, 0, cw);
+	galois_region_xor(fcoding[55], fcoding[23]+bs, bs);
+	coupling_region_multiply(fcoding[23]+bs, inv, bs, fcoding[23]+bs, 0, cw);
+	galois_region_xor(fcoding[56], fcoding[24]+bs, bs);
+	coupling_region_multiply(fcoding[24]+bs, inv, bs, fcoding[24]+bs, 0, cw);
+	galois_region_xor(fcoding[56], fcoding[24]+bs, bs);
+	coupling_region_multiply(fcoding[24]+bs, inv, bs, fcoding[24]+bs, 0, cw);
+	galois_region_xor(fcoding[57], fcoding[25]+bs, bs);
+	coupling_region_multiply(fcoding[25]+bs, inv, bs, fcoding[25]+bs, 0, cw);
+	galois_region_xor(fcoding[57], fcoding[25]+bs, bs);
+	coupling_region_multiply(fcoding[25]+bs, inv, bs, fcoding[25]+bs, 0, cw);
+	galois_region_xor(fcoding[58], fcoding[26]+bs, bs);
+	coupling_region_multiply(fcoding[26]+bs, inv, bs, fcoding[26]+bs, 0, cw);
+	galois_region_xor(fcoding[58], fcoding[26]+bs, bs);
+	coupling_region_multiply(fcoding[26]+bs, inv, bs, fcoding[26]+bs, 0, cw);
+	galois_region_xor(fcoding[59], fcoding[27]+bs, bs);
+	coupling_region_multiply(fcoding[27]+bs, inv, bs, fcoding[27]+bs, 0, cw);
+	galois_region_xor(fcoding[59], fcoding[27]+bs, bs);
+	coupling_region_multiply(fcoding[27]+bs, inv, bs, fcoding[27]+bs, 0, cw);
+	galois_region_xor(fcoding[60], fcoding[28]+bs, bs);
+	coupling_region_multiply(fcoding[28]+bs, inv, bs, fcoding[28]+bs, 0, cw);
+	galois_region_xor(fcoding[60], fcoding[28]+bs, bs);
+	coupling_region_multiply(fcoding[28]+bs, inv, bs, fcoding[28]+bs, 0, cw);
+	galois_region_xor(fcoding[61], fcoding[29]+bs, bs);
+	coupling_region_multiply(fcoding[29]+bs, inv, bs, fcoding[29]+bs, 0, cw);
+	galois_region_xor(fcoding[61], fcoding[29]+bs, bs);
+	coupling_region_multiply(fcoding[29]+bs, inv, bs, fcoding[29]+bs, 0, cw);
+	galois_region_xor(fcoding[62], fcoding[30]+bs, bs);
+	coupling_region_multiply(fcoding[30]+bs, inv, bs, fcoding[30]+bs, 0, cw);
+	galois_region_xor(fcoding[62], fcoding[30]+bs, bs);
+	coupling_region_multiply(fcoding[30]+bs, inv, bs, fcoding[30]+bs, 0, cw);
+	galois_region_xor(fcoding[63], fcoding[31]+bs, bs);
+	coupling_region_multiply(fcoding[31]+bs, inv, bs, fcoding[31]+bs, 0, cw);
+	galois_region_xor(fcoding[63], fcoding[31]+bs, bs);
+	coupling_region_multiply(fcoding[31]+bs, inv, bs, fcoding[31]+bs, 0, cw);
+	coupling_region_multiply(fcoding[0]+bs, 2, bs, fcoding[32], 1, cw);
+	coupling_region_multiply(fcoding[1]+bs, 2, bs, fcoding[33], 1, cw);
+	coupling_region_multiply(fcoding[2]+bs, 2, bs, fcoding[34], 1, cw);
+	coupling_region_multiply(fcoding[3]+bs, 2, bs, fcoding[35], 1, cw);
+	coupling_region_multiply(fcoding[4]+bs, 2, bs, fcoding[36], 1, cw);
+	coupling_region_multiply(fcoding[5]+bs, 2, bs, fcoding[37], 1, cw);
+	coupling_region_multiply(fcoding[6]+bs, 2, bs, fcoding[38], 1, cw);
+	coupling_region_multiply(fcoding[7]+bs, 2, bs, fcoding[39], 1, cw);
+	coupling_region_multiply(fcoding[8]+bs, 2, bs, fcoding[40], 1, cw);
+	coupling_region_multiply(fcoding[9]+bs, 2, bs, fcoding[41], 1, cw);
+	coupling_region_multiply(fcoding[10]+bs, 2, bs, fcoding[42], 1, cw);
+	coupling_region_multiply(fcoding[11]+bs, 2, bs, fcoding[43], 1, cw);
+	coupling_region_multiply(fcoding[12]+bs, 2, bs, fcoding[44], 1, cw);
+	coupling_region_multiply(fcoding[13]+bs, 2, bs, fcoding[45], 1, cw);
+	coupling_region_multiply(fcoding[14]+bs, 2, bs, fcoding[46], 1, cw);
+	coupling_region_multiply(fcoding[15]+bs, 2, bs, fcoding[47], 1, cw);
+	coupling_region_multiply(fcoding[16]+bs, 2, bs, fcoding[48], 1, cw);
+	coupling_region_multiply(fcoding[17]+bs, 2, bs, fcoding[49], 1, cw);
+	coupling_region_multiply(fcoding[18]+bs, 2, bs, fcoding[50], 1, cw);
+	coupling_region_multiply(fcoding[19]+bs, 2, bs, fcoding[51], 1, cw);
+	coupling_region_multiply(fcoding[20]+bs, 2, bs, fcoding[52], 1, cw);
+	coupling_region_multiply(fcoding[21]+bs, 2, bs, fcoding[53], 1, cw);
+	coupling_region_multiply(fcoding[22]+bs, 2, bs, fcoding[54], 1, cw);
+	coupling_region_multiply(fcoding[23]+bs, 2, bs, fcoding[55], 1, cw);
+	coupling_region_multiply(fcoding[24]+bs, 2, bs, fcoding[56], 1, cw);
+	coupling_region_multiply(fcoding[25]+bs, 2, bs, fcoding[57], 1, cw);
+	coupling_region_multiply(fcoding[26]+bs, 2, bs, fcoding[58], 1, cw);
+	coupling_region_multiply(fcoding[27]+bs, 2, bs, fcoding[59], 1, cw);
+	coupling_region_multiply(fcoding[28]+bs, 2, bs, fcoding[60], 1, cw);
+	coupling_region_multiply(fcoding[29]+bs, 2, bs, fcoding[61], 1, cw);
+	coupling_region_multiply(fcoding[30]+bs, 2, bs, fcoding[62], 1, cw);
+	coupling_region_multiply(fcoding[31]+bs, 2, bs, fcoding[63], 1, cw);
+	galois_region_xor(fcoding[96], fcoding[64]+bs, bs);
+	coupling_region_multiply(fcoding[64]+bs, inv, bs, fcoding[64]+bs, 0, cw);
+	galois_region_xor(fcoding[96], fcoding[64]+bs, bs);
+	coupling_region_multiply(fcoding[64]+bs, inv, bs, fcoding[64]+bs, 0, cw);
+	galois_region_xor(fcoding[97], fcoding[65]+bs, bs);
+	coupling_region_multiply(fcoding[65]+bs, inv, bs, fcoding[65]+bs, 0, cw);
+	galois_region_xor(fcoding[97], fcoding[65]+bs, bs);
+	coupling_region_multiply(fcoding[65]+bs, inv, bs, fcoding[65]+bs, 0, cw);
+	galois_region_xor(fcoding[98], fcoding[66]+bs, bs);
+	coupling_region_multiply(fcoding[66]+bs, inv, bs, fcoding[66]+bs, 0, cw);
+	galois_region_xor(fcoding[98], fcoding[66]+bs, bs);
+	coupling_region_multiply(fcoding[66]+bs, inv, bs, fcoding[66]+bs, 0, cw);
+	galois_region_xor(fcoding[99], fcoding[67]+bs, bs);
+	coupling_region_multiply(fcoding[67]+bs, inv, bs, fcoding[67]+bs, 0, cw);
+	galois_region_xor(fcoding[99], fcoding[67]+bs, bs);
+	coupling_region_multiply(fcoding[67]+bs, inv, bs, fcoding[67]+bs, 0, cw);
+	galois_region_xor(fcoding[100], fcoding[68]+bs, bs);
+	coupling_region_multiply(fcoding[68]+bs, inv, bs, fcoding[68]+bs, 0, cw);
+	galois_region_xor(fcoding[100], fcoding[68]+bs, bs);
+	coupling_region_multiply(fcoding[68]+bs, inv, bs, fcoding[68]+bs, 0, cw);
+	galois_region_xor(fcoding[101], fcoding[69]+bs, bs);
+	coupling_region_multiply(fcoding[69]+bs, inv, bs, fcoding[69]+bs, 0, cw);
+	galois_region_xor(fcoding[101], fcoding[69]+bs, bs);
+	coupling_region_multiply(fcoding[69]+bs, inv, bs, fcoding[69]+bs, 0, cw);
+	galois_region_xor(fcoding[102], fcoding[70]+bs, bs);
+	coupling_region_multiply(fcoding[70]+bs, inv, bs, fcoding[70]+bs, 0, cw);
+	galois_region_xor(fcoding[102], fcoding[70]+bs, bs);
+	coupling_region_multiply(fcoding[70]+bs, inv, bs, fcoding[70]+bs, 0, cw);
+	galois_region_xor(fcoding[103], fcoding[71]+bs, bs);
+	coupling_region_multiply(fcoding[71]+bs, inv, bs, fcoding[71]+bs, 0, cw);
+	galois_region_xor(fcoding[103], fcoding[71]+bs, bs);
+	coupling_region_multiply(fcoding[71]+bs, inv, bs, fcoding[71]+bs, 0, cw);
+	galois_region_xor(fcoding[104], fcoding[72]+bs, bs);
+	coupling_region_multiply(fcoding[72]+bs, inv, bs, fcoding[72]+bs, 0, cw);
+	galois_region_xor(fcoding[104], fcoding[72]+bs, bs);
+	coupling_region_multiply(fcoding[72]+bs, inv, bs, fcoding[72]+bs, 0, cw);
+	galois_region_xor(fcoding[105], fcoding[73]+bs, bs);
+	coupling_region_multiply(fcoding[73]+bs, inv, bs, fcoding[73]+bs, 0, cw);
+	galois_region_xor(fcoding[105], fcoding[73]+bs, bs);
+	coupling_region_multiply(fcoding[73]+bs, inv, bs, fcoding[73]+bs, 0, cw);
+	galois_region_xor(fcoding[106], fcoding[74]+bs, bs);
+	coupling_region_multiply(fcoding[74]+bs, inv, bs, fcoding[74]+bs, 0, cw);
+	galois_region_xor(fcoding[106], fcoding[74]+bs, bs);
+	coupling_region_multiply(fcoding[74]+bs, inv, bs, fcoding[74]+bs, 0, cw);
+	galois_region_xor(fcoding[107], fcoding[75]+bs, bs);
+	coupling_region_multiply(fcoding[75]+bs, inv, bs, fcoding[75]+bs, 0, cw);
+	galois_region_xor(fcoding[107], fcoding[75]+bs, bs);
+	coupling_region_multiply(fcoding[75]+bs, inv, bs, fcoding[75]+bs, 0, cw);
+	galois_region_xor(fcoding[108], fcoding[76]+bs, bs);
+	coupling_region_multiply(fcoding[76]+bs, inv, bs, fcoding[76]+bs, 0, cw);
+	galois_region_xor(fcoding[108], fcoding[76]+bs, bs);
+	coupling_region_multiply(fcoding[76]+bs, inv, bs, fcoding[76]+bs, 0, cw);
+	galois_region_xor(fcoding[109], fcoding[77]+bs, bs);
+	coupling_region_multiply(fcoding[77]+bs, inv, bs, fcoding[77]+bs, 0, cw);
+	galois_region_xor(fcoding[109], fcoding[77]+bs, bs);
+	coupling_region_multiply(fcoding[77]+bs, inv, bs, fcoding[77]+bs, 0, cw);
+	galois_region_xor(fcoding[110], fcoding[78]+bs, bs);
+	coupling_region_multiply(fcoding[78]+bs, inv, bs, fcoding[78]+bs, 0, cw);
+	galois_region_xor(fcoding[110], fcoding[78]+bs, bs);
+	coupling_region_multiply(fcoding[78]+bs, inv, bs, fcoding[78]+bs, 0, cw);
+	galois_region_xor(fcoding[111], fcoding[79]+bs, bs);
+	coupling_region_multiply(fcoding[79]+bs, inv, bs, fcoding[79]+bs, 0, cw);
+	galois_region_xor(fcoding[111], fcoding[79]+bs, bs);
+	coupling_region_multiply(fcoding[79]+bs, inv, bs, fcoding[79]+bs, 0, cw);
+	galois_region_xor(fcoding[112], fcoding[80]+bs, bs);
+	coupling_region_multiply(fcoding[80]+bs, inv, bs, fcoding[80]+bs, 0, cw);
+	galois_region_xor(fcoding[112], fcoding[80]+bs, bs);
+	coupling_region_multiply(fcoding[80]+bs, inv, bs, fcoding[80]+bs, 0, cw);
+	galois_region_xor(fcoding[113], fcoding[81]+bs, bs);
+	coupling_region_multiply(fcoding[81]+bs, inv, bs, fcoding[81]+bs, 0, cw);
+	galois_region_xor(fcoding[113], fcoding[81]+bs, bs);
+	coupling_region_multiply(fcoding[81]+bs, inv, bs, fcoding[81]+bs, 0, cw);
+	galois_region_xor(fcoding[114], fcoding[82]+bs, bs);
+	coupling_region_multiply(fcoding[82]+bs, inv, bs, fcoding[82]+bs, 0, cw);
+	galois_region_xor(fcoding[114], fcoding[82]+bs, bs);
+	coupling_region_multiply(fcoding[82]+bs, inv, bs, fcoding[82]+bs, 0, cw);
+	galois_region_xor(fcoding[115], fcoding[83]+bs, bs);
+	coupling_region_multiply(fcoding[83]+bs, inv, bs, fcoding[83]+bs, 0, cw);
+	galois_region_xor(fcoding[115], fcoding[83]+bs, bs);
+	coupling_region_multiply(fcoding[83]+bs, inv, bs, fcoding[83]+bs, 0, cw);
+	galois_region_xor(fcoding[116], fcoding[84]+bs, bs);
+	coupling_region_multiply(fcoding[84]+bs, inv, bs, fcoding[84]+bs, 0, cw);
+	galois_region_xor(fcoding[116], fcoding[84]+bs, bs);
+	coupling_region_multiply(fcoding[84]+bs, inv, bs, fcoding[84]+bs, 0, cw);
+	galois_region_xor(fcoding[117], fcoding[85]+bs, bs);
+	coupling_region_multiply(fcoding[85]+bs, inv, bs, fcoding[85]+bs, 0, cw);
+	galois_region_xor(fcoding[117], fcoding[85]+bs, bs);
+	coupling_region_multiply(fcoding[85]+bs, inv, bs, fcoding[85]+bs, 0, cw);
+	galois_region_xor(fcoding[118], fcoding[86]+bs, bs);
+	coupling_region_multiply(fcoding[86]+bs, inv, bs, fcoding[86]+bs, 0, cw);
+	galois_region_xor(fcoding[118], fcoding[86]+bs, bs);
+	coupling_region_multiply(fcoding[86]+bs, inv, bs, fcoding[86]+bs, 0, cw);
+	galois_region_xor(fcoding[119], fcoding[87]+bs, bs);
+	coupling_region_multiply(fcoding[87]+bs, inv, bs, fcoding[87]+bs, 0, cw);
+	galois_region_xor(fcoding[119], fcoding[87]+bs, bs);
+	coupling_region_multiply(fcoding[87]+bs, inv, bs, fcoding[87]+bs, 0, cw);
+	galois_region_xor(fcoding[120], fcoding[88]+bs, bs);
+	coupling_region_multiply(fcoding[88]+bs, inv, bs, fcoding[88]+bs, 0, cw);
+	galois_region_xor(fcoding[120], fcoding[88]+bs, bs);
+	coupling_region_multiply(fcoding[88]+bs, inv, bs, fcoding[88]+bs, 0, cw);
+	galois_region_xor(fcoding[121], fcoding[89]+bs, bs);
+	coupling_region_multiply(fcoding[89]+bs, inv, bs, fcoding[89]+bs, 0, cw);
+	galois_region_xor(fcoding[121], fcoding[89]+bs, bs);
+	coupling_region_multiply(fcoding[89]+bs, inv, bs, fcoding[89]+bs, 0, cw);
+	galois_region_xor(fcoding[122], fcoding[90]+bs, bs);
+	coupling_region_multiply(fcoding[90]+bs, inv, bs, fcoding[90]+bs, 0, cw);
+	galois_region_xor(fcoding[122], fcoding[90]+bs, bs);
+	coupling_region_multiply(fcoding[90]+bs, inv, bs, fcoding[90]+bs, 0, cw);
+	galois_region_xor(fcoding[123], fcoding[91]+bs, bs);
+	coupling_region_multiply(fcoding[91]+bs, inv, bs, fcoding[91]+bs, 0, cw);
+	galois_region_xor(fcoding[123], fcoding[91]+bs, bs);
+	coupling_region_multiply(fcoding[91]+bs, inv, bs, fcoding[91]+bs, 0, cw);
+	galois_region_xor(fcoding[124], fcoding[92]+bs, bs);
+	coupling_region_multiply(fcoding[92]+bs, inv, bs, fcoding[92]+bs, 0, cw);
+	galois_region_xor(fcoding[124], fcoding[92]+bs, bs);
+	coupling_region_multiply(fcoding[92]+bs, inv, bs, fcoding[92]+bs, 0, cw);
+	galois_region_xor(fcoding[125], fcoding[93]+bs, bs);
+	coupling_region_multiply(fcoding[93]+bs, inv, bs, fcoding[93]+bs, 0, cw);
+	galois_region_xor(fcoding[125], fcoding[93]+bs, bs);
+	coupling_region_multiply(fcoding[93]+bs, inv, bs, fcoding[93]+bs, 0, cw);
+	galois_region_xor(fcoding[126], fcoding[94]+bs, bs);
+	coupling_region_multiply(fcoding[94]+bs, inv, bs, fcoding[94]+bs, 0, cw);
+	galois_region_xor(fcoding[126], fcoding[94]+bs, bs);
+	coupling_region_multiply(fcoding[94]+bs, inv, bs, fcoding[94]+bs, 0, cw);
+	galois_region_xor(fcoding[127], fcoding[95]+bs, bs);
+	coupling_region_multiply(fcoding[95]+bs, inv, bs, fcoding[95]+bs, 0, cw);
+	galois_region_xor(fcoding[127], fcoding[95]+bs, bs);
+	coupling_region_multiply(fcoding[95]+bs, inv, bs, fcoding[95]+bs, 0, cw);
+	coupling_region_multiply(fcoding[64]+bs, 2, bs, fcoding[96], 1, cw);
+	coupling_region_multiply(fcoding[65]+bs, 2, bs, fcoding[97], 1, cw);
+	coupling_region_multiply(fcoding[66]+bs, 2, bs, fcoding[98], 1, cw);
+	coupling_region_multiply(fcoding[67]+bs, 2, bs, fcoding[99], 1, cw);
+	coupling_region_multiply(fcoding[68]+bs, 2, bs, fcoding[100], 1, cw);
+	coupling_region_multiply(fcoding[69]+bs, 2, bs, fcoding[101], 1, cw);
+	coupling_region_multiply(fcoding[70]+bs, 2, bs, fcoding[102], 1, cw);
+	coupling_region_multiply(fcoding[71]+bs, 2, bs, fcoding[103], 1, cw);
+	coupling_region_multiply(fcoding[72]+bs, 2, bs, fcoding[104], 1, cw);
+	coupling_region_multiply(fcoding[73]+bs, 2, bs, fcoding[105], 1, cw);
+	coupling_region_multiply(fcoding[74]+bs, 2, bs, fcoding[106], 1, cw);
+	coupling_region_multiply(fcoding[75]+bs, 2, bs, fcoding[107], 1, cw);
+	coupling_region_multiply(fcoding[76]+bs, 2, bs, fcoding[108], 1, cw);
+	coupling_region_multiply(fcoding[77]+bs, 2, bs, fcoding[109], 1, cw);
+	coupling_region_multiply(fcoding[78]+bs, 2, bs, fcoding[110], 1, cw);
+	coupling_region_multiply(fcoding[79]+bs, 2, bs, fcoding[111], 1, cw);
+	coupling_region_multiply(fcoding[80]+bs, 2, bs, fcoding[112], 1, cw);
+	coupling_region_multiply(fcoding[81]+bs, 2, bs, fcoding[113], 1, cw);
+	coupling_region_multiply(fcoding[82]+bs, 2, bs, fcoding[114], 1, cw);
+	coupling_region_multiply(fcoding[83]+bs, 2, bs, fcoding[115], 1, cw);
+	coupling_region_multiply(fcoding[84]+bs, 2, bs, fcoding[116], 1, cw);
+	coupling_region_multiply(fcoding[85]+bs, 2, bs, fcoding[117], 1, cw);
+	coupling_region_multiply(fcoding[86]+bs, 2, bs, fcoding[118], 1, cw);
+	coupling_region_multiply(fcoding[87]+bs, 2, bs, fcoding[119], 1, cw);
+	coupling_region_multiply(fcoding[88]+bs, 2, bs, fcoding[120], 1, cw);
+	coupling_region_multiply(fcoding[89]+bs, 2, bs, fcoding[121], 1, cw);
+	coupling_region_multiply(fcoding[90]+bs, 2, bs, fcoding[122], 1, cw);
+	coupling_region_multiply(fcoding[91]+bs, 2, bs, fcoding[123], 1, cw);
+	coupling_region_multiply(fcoding[92]+bs, 2, bs, fcoding[124], 1, cw);
+	coupling_region_multiply(fcoding[93]+bs, 2, bs, fcoding[125], 1, cw);
+	coupling_region_multiply(fcoding[94]+bs, 2, bs, fcoding[126], 1, cw);
+	coupling_region_multiply(fcoding[95]+bs, 2, bs, fcoding[127], 1, cw);
+	galois_region_xor(fcoding[64]+2*bs, fcoding[0]+3*bs, bs);
+	coupling_region_multiply(fcoding[0]+3*bs, inv, bs, fcoding[0]+3*bs, 0, cw);
+	galois_region_xor(fcoding[64]+2*bs, fcoding[0]+3*bs, bs);
+	coupling_region_multiply(fcoding[0]+3*bs, inv, bs, fcoding[0]+3*bs, 0, cw);
+	galois_region_xor(fcoding[65]+2*bs, fcoding[1]+3*bs, bs);
+	coupling_region_multiply(fcoding[1]+3*bs, inv, bs, fcoding[1]+3*bs, 0, cw);
+	galois_region_xor(fcoding[65]+2*bs, fcoding[1]+3*bs, bs);
+	coupling_region_multiply(fcoding[1]+3*bs, inv, bs, fcoding[1]+3*bs, 0, cw);
+	galois_region_xor(fcoding[66]+2*bs, fcoding[2]+3*bs, bs);
+	coupling_region_multiply(fcoding[2]+3*bs, inv, bs, fcoding[2]+3*bs, 0, cw);
+	galois_region_xor(fcoding[66]+2*bs, fcoding[2]+3*bs, bs);
+	coupling_region_multiply(fcoding[2]+3*bs, inv, bs, fcoding[2]+3*bs, 0, cw);
+	galois_region_xor(fcoding[67]+2*bs, fcoding[3]+3*bs, bs);
+	coupling_region_multiply(fcoding[3]+3*bs, inv, bs, fcoding[3]+3*bs, 0, cw);
+	galois_region_xor(fcoding[67]+2*bs, fcoding[3]+3*bs, bs);
+	coupling_region_multiply(fcoding[3]+3*bs, inv, bs, fcoding[3]+3*bs, 0, cw);
+	galois_region_xor(fcoding[68]+2*bs, fcoding[4]+3*bs, bs);
+	coupling_region_multiply(fcoding[4]+3*bs, inv, bs, fcoding[4]+3*bs, 0, cw);
+	galois_region_xor(fcoding[68]+2*bs, fcoding[4]+3*bs, bs);
+	coupling_region_multiply(fcoding[4]+3*bs, inv, bs, fcoding[4]+3*bs, 0, cw);
+	galois_region_xor(fcoding[69]+2*bs, fcoding[5]+3*bs, bs);
+	coupling_region_multiply(fcoding[5]+3*bs, inv, bs, fcoding[5]+3*bs, 0, cw);
+	galois_region_xor(fcoding[69]+2*bs, fcoding[5]+3*bs, bs);
+	coupling_region_multiply(fcoding[5]+3*bs, inv, bs, fcoding[5]+3*bs, 0, cw);
+	galois_region_xor(fcoding[70]+2*bs, fcoding[6]+3*bs, bs);
+	coupling_region_multiply(fcoding[6]+3*bs, inv, bs, fcoding[6]+3*bs, 0, cw);
+	galois_region_xor(fcoding[70]+2*bs, fcoding[6]+3*bs, bs);
+	coupling_region_multiply(fcoding[6]+3*bs, inv, bs, fcoding[6]+3*bs, 0, cw);
+	galois_region_xor(fcoding[71]+2*bs, fcoding[7]+3*bs, bs);
+	coupling_region_multiply(fcoding[7]+3*bs, inv, bs, fcoding[7]+3*bs, 0, cw);
+	galois_region_xor(fcoding[71]+2*bs, fcoding[7]+3*bs, bs);
+	coupling_region_multiply(fcoding[7]+3*bs, inv, bs, fcoding[7]+3*bs, 0, cw);
+	galois_region_xor(fcoding[72]+2*bs, fcoding[8]+3*bs, bs);
+	coupling_region_multiply(fcoding[8]+3*bs, inv, bs, fcoding[8]+3*bs, 0, cw);
+	galois_region_xor(fcoding[72]+2*bs, fcoding[8]+3*bs, bs);
+	coupling_region_multiply(fcoding[8]+3*bs, inv, bs, fcoding[8]+3*bs, 0, cw);
+	galois_region_xor(fcoding[73]+2*bs, fcoding[9]+3*bs, bs);
+	coupling_region_multiply(fcoding[9]+3*bs, inv, bs, fcoding[9]+3*bs, 0, cw);
+	galois_region_xor(fcoding[73]+2*bs, fcoding[9]+3*bs, bs);
+	coupling_region_multiply(fcoding[9]+3*bs, inv, bs, fcoding[9]+3*bs, 0, cw);
+	galois_region_xor(fcoding[74]+2*bs, fcoding[10]+3*bs, bs);
+	coupling_region_multiply(fcoding[10]+3*bs, inv, bs, fcoding[10]+3*bs, 0, cw);
+	galois_region_xor(fcoding[74]+2*bs, fcoding[10]+3*bs, bs);
+	coupling_region_multiply(fcoding[10]+3*bs, inv, bs, fcoding[10]+3*bs, 0, cw);
+	galois_region_xor(fcoding[75]+2*bs, fcoding[11]+3*bs, bs);
+	coupling_region_multiply(fcoding[11]+3*bs, inv, bs, fcoding[11]+3*bs, 0, cw);
+	galois_region_xor(fcoding[75]+2*bs, fcoding[11]+3*bs, bs);
+	coupling_region_multiply(fcoding[11]+3*bs, inv, bs, fcoding[11]+3*bs, 0, cw);
+	galois_region_xor(fcoding[76]+2*bs, fcoding[12]+3*bs, bs);
+	coupling_region_multiply(fcoding[12]+3*bs, inv, bs, fcoding[12]+3*bs, 0, cw);
+	galois_region_xor(fcoding[76]+2*bs, fcoding[12]+3*bs, bs);
+	coupling_region_multiply(fcoding[12]+3*bs, inv, bs, fcoding[12]+3*bs, 0, cw);
+	galois_region_xor(fcoding[77]+2*bs, fcoding[13]+3*bs, bs);
+	coupling_region_multiply(fcoding[13]+3*bs, inv, bs, fcoding[13]+3*bs, 0, cw);
+	galois_region_xor(fcoding[77]+2*bs, fcoding[13]+3*bs, bs);
+	coupling_region_multiply(fcoding[13]+3*bs, inv, bs, fcoding[13]+3*bs, 0, cw);
+	galois_region_xor(fcoding[78]+2*bs, fcoding[14]+3*bs, bs);
+	coupling_region_multiply(fcoding[14]+3*bs, inv, bs, fcoding[14]+3*bs, 0, cw);
+	galois_region_xor(fcoding[78]+2*bs, fcoding[14]+3*bs, bs);
+	coupling_region_multiply(fcoding[14]+3*bs, inv, bs, fcoding[14]+3*bs, 0, cw);
+	galois_region_xor(fcoding[79]+2*bs, fcoding[15]+3*bs, bs);
+	coupling_region_multiply(fcoding[15]+3*bs, inv, bs, fcoding[15]+3*bs, 0, cw);
+	galois_region_xor(fcoding[79]+2*bs, fcoding[15]+3*bs, bs);
+	coupling_region_multiply(fcoding[15]+3*bs, inv, bs, fcoding[15]+3*bs, 0, cw);
+	galois_region_xor(fcoding[80]+2*bs, fcoding[16]+3*bs, bs);
+	coupling_region_multiply(fcoding[16]+3*bs, inv, bs, fcoding[16]+3*bs, 0, cw);
+	galois_region_xor(fcoding[80]+2*bs, fcoding[16]+3*bs, bs);
+	coupling_region_multiply(fcoding[16]+3*bs, inv, bs, fcoding[16]+3*bs, 0, cw);
+	galois_region_xor(fcoding[81]+2*bs, fcoding[17]+3*bs, bs);
+	coupling_region_multiply(fcoding[17]+3*bs, inv, bs, fcoding[17]+3*bs, 0, cw);
+	galois_region_xor(fcoding[81]+2*bs, fcoding[17]+3*bs, bs);
+	coupling_region_multiply(fcoding[17]+3*bs, inv, bs, fcoding[17]+3*bs, 0, cw);
+	galois_region_xor(fcoding[82]+2*bs, fcoding[18]+3*bs, bs);
+	coupling_region_multiply(fcoding[18]+3*bs, inv, bs, fcoding[18]+3*bs, 0, cw);
+	galois_region_xor(fcoding[82]+2*bs, fcoding[18]+3*bs, bs);
+	coupling_region_multiply(fcoding[18]+3*bs, inv, bs, fcoding[18]+3*bs, 0, cw);
+	galois_region_xor(fcoding[83]+2*bs, fcoding[19]+3*bs, bs);
+	coupling_region_multiply(fcoding[19]+3*bs, inv, bs, fcoding[19]+3*bs, 0, cw);
+	galois_region_xor(fcoding[83]+2*bs, fcoding[19]+3*bs, bs);
+	coupling_region_multiply(fcoding[19]+3*bs, inv, bs, fcoding[19]+3*bs, 0, cw);
+	galois_region_xor(fcoding[84]+2*bs, fcoding[20]+3*bs, bs);
+	coupling_region_multiply(fcoding[20]+3*bs, inv, bs, fcoding[20]+3*bs, 0, cw);
+	galois_region_xor(fcoding[84]+2*bs, fcoding[20]+3*bs, bs);
+	coupling_region_multiply(fcoding[20]+3*bs, inv, bs, fcoding[20]+3*bs, 0, cw);
+	galois_region_xor(fcoding[85]+2*bs, fcoding[21]+3*bs, bs);
+	coupling_region_multiply(fcoding[21]+3*bs, inv, bs, fcoding[21]+3*bs, 0, cw);
+	galois_region_xor(fcoding[85]+2*bs, fcoding[21]+3*bs, bs);
+	coupling_region_multiply(fcoding[21]+3*bs, inv, bs, fcoding[21]+3*bs, 0, cw);
+	galois_region_xor(fcoding[86]+2*bs, fcoding[22]+3*bs, bs);
+	coupling_region_multiply(fcoding[22]+3*bs, inv, bs, fcoding[22]+3*bs, 0, cw);
+	galois_region_xor(fcoding[86]+2*bs, fcoding[22]+3*bs, bs);
+	coupling_region_multiply(fcoding[22]+3*bs, inv, bs, fcoding[22]+3*bs, 0, cw);
+	galois_region_xor(fcoding[87]+2*bs, fcoding[23]+3*bs, bs);
+	coupling_region_multiply(fcoding[23]+3*bs, inv, bs, fcoding[23]+3*bs, 0, cw);
+	galois_region_xor(fcoding[87]+2*bs, fcoding[23]+3*bs, bs);
+	coupling_region_multiply(fcoding[23]+3*bs, inv, bs, fcoding[23]+3*bs, 0, cw);
+	galois_region_xor(fcoding[88]+2*bs, fcoding[24]+3*bs, bs);
+	coupling_region_multiply(fcoding[24]+3*bs, inv, bs, fcoding[24]+3*bs, 0, cw);
+	galois_region_xor(fcoding[88]+2*bs, fcoding[24]+3*bs, bs);
+	coupling_region_multiply(fcoding[24]+3*bs, inv, bs, fcoding[24]+3*bs, 0, cw);
+	galois_region_xor(fcoding[89]+2*bs, fcoding[25]+3*bs, bs);
+	coupling_region_multiply(fcoding[25]+3*bs, inv, bs, fcoding[25]+3*bs, 0, cw);
+	galois_region_xor(fcoding[89]+2*bs, fcoding[25]+3*bs, bs);
+	coupling_region_multiply(fcoding[25]+3*bs, inv, bs, fcoding[25]+3*bs, 0, cw);
+	galois_region_xor(fcoding[90]+2*bs, fcoding[26]+3*bs, bs);
+	coupling_region_multiply(fcoding[26]+3*bs, inv, bs, fcoding[26]+3*bs, 0, cw);
+	galois_region_xor(fcoding[90]+2*bs, fcoding[26]+3*bs, bs);
+	coupling_region_multiply(fcoding[26]+3*bs, inv, bs, fcoding[26]+3*bs, 0, cw);
+	galois_region_xor(fcoding[91]+2*bs, fcoding[27]+3*bs, bs);
+	coupling_region_multiply(fcoding[27]+3*bs, inv, bs, fcoding[27]+3*bs, 0, cw);
+	galois_region_xor(fcoding[91]+2*bs, fcoding[27]+3*bs, bs);
+	coupling_region_multiply(fcoding[27]+3*bs, inv, bs, fcoding[27]+3*bs, 0, cw);
+	galois_region_xor(fcoding[92]+2*bs, fcoding[28]+3*bs, bs);
+	coupling_region_multiply(fcoding[28]+3*bs, inv, bs, fcoding[28]+3*bs, 0, cw);
+	galois_region_xor(fcoding[92]+2*bs, fcoding[28]+3*bs, bs);
+	coupling_region_multiply(fcoding[28]+3*bs, inv, bs, fcoding[28]+3*bs, 0, cw);
+	galois_region_xor(fcoding[93]+2*bs, fcoding[29]+3*bs, bs);
+	coupling_region_multiply(fcoding[29]+3*bs, inv, bs, fcoding[29]+3*bs, 0, cw);
+	galois_region_xor(fcoding[93]+2*bs, fcoding[29]+3*bs, bs);
+	coupling_region_multiply(fcoding[29]+3*bs, inv, bs, fcoding[29]+3*bs, 0, cw);
+	galois_region_xor(fcoding[94]+2*bs, fcoding[30]+3*bs, bs);
+	coupling_region_multiply(fcoding[30]+3*bs, inv, bs, fcoding[30]+3*bs, 0, cw);
+	galois_region_xor(fcoding[94]+2*bs, fcoding[30]+3*bs, bs);
+	coupling_region_multiply(fcoding[30]+3*bs, inv, bs, fcoding[30]+3*bs, 0, cw);
+	galois_region_xor(fcoding[95]+2*bs, fcoding[31]+3*bs, bs);
+	coupling_region_multiply(fcoding[31]+3*bs, inv, bs, fcoding[31]+3*bs, 0, cw);
+	galois_region_xor(fcoding[95]+2*bs, fcoding[31]+3*bs, bs);
+	coupling_region_multiply(fcoding[31]+3*bs, inv, bs, fcoding[31]+3*bs, 0, cw);
+	galois_region_xor(fcoding[96]+2*bs, fcoding[32]+3*bs, bs);
+	coupling_region_multiply(fcoding[32]+3*bs, inv, bs, fcoding[32]+3*bs, 0, cw);
+	galois_region_xor(fcoding[96]+2*bs, fcoding[32]+3*bs, bs);
+	coupling_region_multiply(fcoding[32]+3*bs, inv, bs, fcoding[32]+3*bs, 0, cw);
+	galois_region_xor(fcoding[97]+2*bs, fcoding[33]+3*bs, bs);
+	coupling_region_multiply(fcoding[33]+3*bs, inv, bs, fcoding[33]+3*bs, 0, cw);
+	galois_region_xor(fcoding[97]+2*bs, fcoding[33]+3*bs, bs);
+	coupling_region_multiply(fcoding[33]+3*bs, inv, bs, fcoding[33]+3*bs, 0, cw);
+	galois_region_xor(fcoding[98]+2*bs, fcoding[34]+3*bs, bs);
+	coupling_region_multiply(fcoding[34]+3*bs, inv, bs, fcoding[34]+3*bs, 0, cw);
+	galois_region_xor(fcoding[98]+2*bs, fcoding[34]+3*bs, bs);
+	coupling_region_multiply(fcoding[34]+3*bs, inv, bs, fcoding[34]+3*bs, 0, cw);
+	galois_region_xor(fcoding[99]+2*bs, fcoding[35]+3*bs, bs);
+	coupling_region_multiply(fcoding[35]+3*bs, inv, bs, fcoding[35]+3*bs, 0, cw);
+	galois_region_xor(fcoding[99]+2*bs, fcoding[35]+3*bs, bs);
+	coupling_region_multiply(fcoding[35]+3*bs, inv, bs, fcoding[35]+3*bs, 0, cw);
+	galois_region_xor(fcoding[100]+2*bs, fcoding[36]+3*bs, bs);
+	coupling_region_multiply(fcoding[36]+3*bs, inv, bs, fcoding[36]+3*bs, 0, cw);
+	galois_region_xor(fcoding[100]+2*bs, fcoding[36]+3*bs, bs);
+	coupling_region_multiply(fcoding[36]+3*bs, inv, bs, fcoding[36]+3*bs, 0, cw);
+	galois_region_xor(fcoding[101]+2*bs, fcoding[37]+3*bs, bs);
+	coupling_region_multiply(fcoding[37]+3*bs, inv, bs, fcoding[37]+3*bs, 0, cw);
+	galois_region_xor(fcoding[101]+2*bs, fcoding[37]+3*bs, bs);
+	coupling_region_multiply(fcoding[37]+3*bs, inv, bs, fcoding[37]+3*bs, 0, cw);
+	galois_region_xor(fcoding[102]+2*bs, fcoding[38]+3*bs, bs);
+	coupling_region_multiply(fcoding[38]+3*bs, inv, bs, fcoding[38]+3*bs, 0, cw);
+	galois_region_xor(fcoding[102]+2*bs, fcoding[38]+3*bs, bs);
+	coupling_region_multiply(fcoding[38]+3*bs, inv, bs, fcoding[38]+3*bs, 0, cw);
+	galois_region_xor(fcoding[103]+2*bs, fcoding[39]+3*bs, bs);
+	coupling_region_multiply(fcoding[39]+3*bs, inv, bs, fcoding[39]+3*bs, 0, cw);
+	galois_region_xor(fcoding[103]+2*bs, fcoding[39]+3*bs, bs);
+	coupling_region_multiply(fcoding[39]+3*bs, inv, bs, fcoding[39]+3*bs, 0, cw);
+	galois_region_xor(fcoding[104]+2*bs, fcoding[40]+3*bs, bs);
+	coupling_region_multiply(fcoding[40]+3*bs, inv, bs, fcoding[40]+3*bs, 0, cw);
+	galois_region_xor(fcoding[104]+2*bs, fcoding[40]+3*bs, bs);
+	coupling_region_multiply(fcoding[40]+3*bs, inv, bs, fcoding[40]+3*bs, 0, cw);
+	galois_region_xor(fcoding[105]+2*bs, fcoding[41]+3*bs, bs);
+	coupling_region_multiply(fcoding[41]+3*bs, inv, bs, fcoding[41]+3*bs, 0, cw);
+	galois_region_xor(fcoding[105]+2*bs, fcoding[41]+3*bs, bs);
+	coupling_region_multiply(fcoding[41]+3*bs, inv, bs, fcoding[41]+3*bs, 0, cw);
+	galois_region_xor(fcoding[106]+2*bs, fcoding[42]+3*bs, bs);
+	coupling_region_multiply(fcoding[42]+3*bs, inv, bs, fcoding[42]+3*bs, 0, cw);
+	galois_region_xor(fcoding[106]+2*bs, fcoding[42]+3*bs, bs);
+	coupling_region_multiply(fcoding[42]+3*bs, inv, bs, fcoding[42]+3*bs, 0, cw);
+	galois_region_xor(fcoding[107]+2*bs, fcoding[43]+3*bs, bs);
+	coupling_region_multiply(fcoding[43]+3*bs, inv, bs, fcoding[43]+3*bs, 0, cw);
+	galois_region_xor(fcoding[107]+2*bs, fcoding[43]+3*bs, bs);
+	coupling_region_multiply(fcoding[43]+3*bs, inv, bs, fcoding[43]+3*bs, 0, cw);
+	galois_region_xor(fcoding[108]+2*bs, fcoding[44]+3*bs, bs);
+	coupling_region_multiply(fcoding[44]+3*bs, inv, bs, fcoding[44]+3*bs, 0, cw);
+	galois_region_xor(fcoding[108]+2*bs, fcoding[44]+3*bs, bs);
+	coupling_region_multiply(fcoding[44]+3*bs, inv, bs, fcoding[44]+3*bs, 0, cw);
+	galois_region_xor(fcoding[109]+2*bs, fcoding[45]+3*bs, bs);
+	coupling_region_multiply(fcoding[45]+3*bs, inv, bs, fcoding[45]+3*bs, 0, cw);
+	galois_region_xor(fcoding[109]+2*bs, fcoding[45]+3*bs, bs);
+	coupling_region_multiply(fcoding[45]+3*bs, inv, bs, fcoding[45]+3*bs, 0, cw);
+	galois_region_xor(fcoding[110]+2*bs, fcoding[46]+3*bs, bs);
+	coupling_region_multiply(fcoding[46]+3*bs, inv, bs, fcoding[46]+3*bs, 0, cw);
+	galois_region_xor(fcoding[110]+2*bs, fcoding[46]+3*bs, bs);
+	coupling_region_multiply(fcoding[46]+3*bs, inv, bs, fcoding[46]+3*bs, 0, cw);
+	galois_region_xor(fcoding[111]+2*bs, fcoding[47]+3*bs, bs);
+	coupling_region_multiply(fcoding[47]+3*bs, inv, bs, fcoding[47]+3*bs, 0, cw);
+	galois_region_xor(fcoding[111]+2*bs, fcoding[47]+3*bs, bs);
+	coupling_region_multiply(fcoding[47]+3*bs, inv, bs, fcoding[47]+3*bs, 0, cw);
+	galois_region_xor(fcoding[112]+2*bs, fcoding[48]+3*bs, bs);
+	coupling_region_multiply(fcoding[48]+3*bs, inv, bs, fcoding[48]+3*bs, 0, cw);
+	galois_region_xor(fcoding[112]+2*bs, fcoding[48]+3*bs, bs);
+	coupling_region_multiply(fcoding[48]+3*bs, inv, bs, fcoding[48]+3*bs, 0, cw);
+	galois_region_xor(fcoding[113]+2*bs, fcoding[49]+3*bs, bs);
+	coupling_region_multiply(fcoding[49]+3*bs, inv, bs, fcoding[49]+3*bs, 0, cw);
+	galois_region_xor(fcoding[113]+2*bs, fcoding[49]+3*bs, bs);
+	coupling_region_multiply(fcoding[49]+3*bs, inv, bs, fcoding[49]+3*bs, 0, cw);
+	galois_region_xor(fcoding[114]+2*bs, fcoding[50]+3*bs, bs);
+	coupling_region_multiply(fcoding[50]+3*bs, inv, bs, fcoding[50]+3*bs, 0, cw);
+	galois_region_xor(fcoding[114]+2*bs, fcoding[50]+3*bs, bs);
+	coupling_region_multiply(fcoding[50]+3*bs, inv, bs, fcoding[50]+3*bs, 0, cw);
+	galois_region_xor(fcoding[115]+2*bs, fcoding[51]+3*bs, bs);
+	coupling_region_multiply(fcoding[51]+3*bs, inv, bs, fcoding[51]+3*bs, 0, cw);
+	galois_region_xor(fcoding[115]+2*bs, fcoding[51]+3*bs, bs);
+	coupling_region_multiply(fcoding[51]+3*bs, inv, bs, fcoding[51]+3*bs, 0, cw);
+	galois_region_xor(fcoding[116]+2*bs, fcoding[52]+3*bs, bs);
+	coupling_region_multiply(fcoding[52]+3*bs, inv, bs, fcoding[52]+3*bs, 0, cw);
+	galois_region_xor(fcoding[116]+2*bs, fcoding[52]+3*bs, bs);
+	coupling_region_multiply(fcoding[52]+3*bs, inv, bs, fcoding[52]+3*bs, 0, cw);
+	galois_region_xor(fcoding[117]+2*bs, fcoding[53]+3*bs, bs);
+	coupling_region_multiply(fcoding[53]+3*bs, inv, bs, fcoding[53]+3*bs, 0, cw);
+	galois_region_xor(fcoding[117]+2*bs, fcoding[53]+3*bs, bs);
+	coupling_region_multiply(fcoding[53]+3*bs, inv, bs, fcoding[53]+3*bs, 0, cw);
+	galois_region_xor(fcoding[118]+2*bs, fcoding[54]+3*bs, bs);
+	coupling_region_multiply(fcoding[54]+3*bs, inv, bs, fcoding[54]+3*bs, 0, cw);
+	galois_region_xor(fcoding[118]+2*bs, fcoding[54]+3*bs, bs);
+	coupling_region_multiply(fcoding[54]+3*bs, inv, bs, fcoding[54]+3*bs, 0, cw);
+	galois_region_xor(fcoding[119]+2*bs, fcoding[55]+3*bs, bs);
+	coupling_region_multiply(fcoding[55]+3*bs, inv, bs, fcoding[55]+3*bs, 0, cw);
+	galois_region_xor(fcoding[119]+2*bs, fcoding[55]+3*bs, bs);
+	coupling_region_multiply(fcoding[55]+3*bs, inv, bs, fcoding[55]+3*bs, 0, cw);
+	galois_region_xor(fcoding[120]+2*bs, fcoding[56]+3*bs, bs);
+	coupling_region_multiply(fcoding[56]+3*bs, inv, bs, fcoding[56]+3*bs, 0, cw);
+	galois_region_xor(fcoding[120]+2*bs, fcoding[56]+3*bs, bs);
+	coupling_region_multiply(fcoding[56]+3*bs, inv, bs, fcoding[56]+3*bs, 0, cw);
+	galois_region_xor(fcoding[121]+2*bs, fcoding[57]+3*bs, bs);
+	coupling_region_multiply(fcoding[57]+3*bs, inv, bs, fcoding[57]+3*bs, 0, cw);
+	galois_region_xor(fcoding[121]+2*bs, fcoding[57]+3*bs, bs);
+	coupling_region_multiply(fcoding[57]+3*bs, inv, bs, fcoding[57]+3*bs, 0, cw);
+	galois_region_xor(fcoding[122]+2*bs, fcoding[58]+3*bs, bs);
+	coupling_region_multiply(fcoding[58]+3*bs, inv, bs, fcoding[58]+3*bs, 0, cw);
+	galois_region_xor(fcoding[122]+2*bs, fcoding[58]+3*bs, bs);
+	coupling_region_multiply(fcoding[58]+3*bs, inv, bs, fcoding[58]+3*bs, 0, cw);
+	galois_region_xor(fcoding[123]+2*bs, fcoding[59]+3*bs, bs);
+	coupling_region_multiply(fcoding[59]+3*bs, inv, bs, fcoding[59]+3*bs, 0, cw);
+	galois_region_xor(fcoding[123]+2*bs, fcoding[59]+3*bs, bs);
+	coupling_region_multiply(fcoding[59]+3*bs, inv, bs, fcoding[59]+3*bs, 0, cw);
+	galois_region_xor(fcoding[124]+2*bs, fcoding[60]+3*bs, bs);
+	coupling_region_multiply(fcoding[60]+3*bs, inv, bs, fcoding[60]+3*bs, 0, cw);
+	galois_region_xor(fcoding[124]+2*bs, fcoding[60]+3*bs, bs);
+	coupling_region_multiply(fcoding[60]+3*bs, inv, bs, fcoding[60]+3*bs, 0, cw);
+	galois_region_xor(fcoding[125]+2*bs, fcoding[61]+3*bs, bs);
+	coupling_region_multiply(fcoding[61]+3*bs, inv, bs, fcoding[61]+3*bs, 0, cw);
+	galois_region_xor(fcoding[125]+2*bs, fcoding[61]+3*bs, bs);
+	coupling_region_multiply(fcoding[61]+3*bs, inv, bs, fcoding[61]+3*bs, 0, cw);
+	galois_region_xor(fcoding[126]+2*bs, fcoding[62]+3*bs, bs);
+	coupling_region_multiply(fcoding[62]+3*bs, inv, bs, fcoding[62]+3*bs, 0, cw);
+	galois_region_xor(fcoding[126]+2*bs, fcoding[62]+3*bs, bs);
+	coupling_region_multiply(fcoding[62]+3*bs, inv, bs, fcoding[62]+3*bs, 0, cw);
+	galois_region_xor(fcoding[127]+2*bs, fcoding[63]+3*bs, bs);
+	coupling_region_multiply(fcoding[63]+3*bs, inv, bs, fcoding[63]+3*bs, 0, cw);
+	galois_region_xor(fcoding[127]+2*bs, fcoding[63]+3*bs, bs);
+	coupling_region_multiply(fcoding[63]+3*bs, inv, bs, fcoding[63]+3*bs, 0, cw);
+	coupling_region_multiply(fcoding[0]+3*bs, 2, bs, fcoding[64]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[1]+3*bs, 2, bs, fcoding[65]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[2]+3*bs, 2, bs, fcoding[66]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[3]+3*bs, 2, bs, fcoding[67]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[4]+3*bs, 2, bs, fcoding[68]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[5]+3*bs, 2, bs, fcoding[69]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[6]+3*bs, 2, bs, fcoding[70]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[7]+3*bs, 2, bs, fcoding[71]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[8]+3*bs, 2, bs, fcoding[72]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[9]+3*bs, 2, bs, fcoding[73]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[10]+3*bs, 2, bs, fcoding[74]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[11]+3*bs, 2, bs, fcoding[75]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[12]+3*bs, 2, bs, fcoding[76]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[13]+3*bs, 2, bs, fcoding[77]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[14]+3*bs, 2, bs, fcoding[78]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[15]+3*bs, 2, bs, fcoding[79]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[16]+3*bs, 2, bs, fcoding[80]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[17]+3*bs, 2, bs, fcoding[81]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[18]+3*bs, 2, bs, fcoding[82]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[19]+3*bs, 2, bs, fcoding[83]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[20]+3*bs, 2, bs, fcoding[84]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[21]+3*bs, 2, bs, fcoding[85]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[22]+3*bs, 2, bs, fcoding[86]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[23]+3*bs, 2, bs, fcoding[87]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[24]+3*bs, 2, bs, fcoding[88]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[25]+3*bs, 2, bs, fcoding[89]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[26]+3*bs, 2, bs, fcoding[90]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[27]+3*bs, 2, bs, fcoding[91]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[28]+3*bs, 2, bs, fcoding[92]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[29]+3*bs, 2, bs, fcoding[93]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[30]+3*bs, 2, bs, fcoding[94]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[31]+3*bs, 2, bs, fcoding[95]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[32]+3*bs, 2, bs, fcoding[96]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[33]+3*bs, 2, bs, fcoding[97]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[34]+3*bs, 2, bs, fcoding[98]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[35]+3*bs, 2, bs, fcoding[99]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[36]+3*bs, 2, bs, fcoding[100]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[37]+3*bs, 2, bs, fcoding[101]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[38]+3*bs, 2, bs, fcoding[102]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[39]+3*bs, 2, bs, fcoding[103]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[40]+3*bs, 2, bs, fcoding[104]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[41]+3*bs, 2, bs, fcoding[105]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[42]+3*bs, 2, bs, fcoding[106]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[43]+3*bs, 2, bs, fcoding[107]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[44]+3*bs, 2, bs, fcoding[108]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[45]+3*bs, 2, bs, fcoding[109]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[46]+3*bs, 2, bs, fcoding[110]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[47]+3*bs, 2, bs, fcoding[111]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[48]+3*bs, 2, bs, fcoding[112]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[49]+3*bs, 2, bs, fcoding[113]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[50]+3*bs, 2, bs, fcoding[114]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[51]+3*bs, 2, bs, fcoding[115]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[52]+3*bs, 2, bs, fcoding[116]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[53]+3*bs, 2, bs, fcoding[117]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[54]+3*bs, 2, bs, fcoding[118]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[55]+3*bs, 2, bs, fcoding[119]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[56]+3*bs, 2, bs, fcoding[120]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[57]+3*bs, 2, bs, fcoding[121]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[58]+3*bs, 2, bs, fcoding[122]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[59]+3*bs, 2, bs, fcoding[123]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[60]+3*bs, 2, bs, fcoding[124]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[61]+3*bs, 2, bs, fcoding[125]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[62]+3*bs, 2, bs, fcoding[126]+2*bs, 1, cw);
+	coupling_region_multiply(fcoding[63]+3*bs, 2, bs, fcoding[127]+2*bs, 1, cw);
+}
+
+/* Runs the uncouple schedule of (k, m, layers); -1 if there is none */
+static int clay_uncouple_schedule(int k, int m, int layers, char **fdata, char **fcoding, long bs, int inv, int cw)
+{
+	if (k == 10 && m == 4 && layers == 128) {
+		clay_uncouple_10_4(fdata, fcoding, bs, inv, cw);
+		return 0;
+	}
+	return -1;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,36 @@
+/* *
+ * coupling.h - region multiply of the pairwise coupling, shared by the
+ * Clay and multi-layer tools and by clay-schedule.h.
+ *
+ * The coupling is done in GF(2^cw).  Region multiplies only exist for
+ * w = 8, 16 and 32, so any other word size couples in GF(2^8).
+ */
+
+#ifndef _COUPLING_H
+#define _COUPLING_H
+
+#include "galois.h"
+
+/* Word size the coupling of a code with word size w is done in */
+static inline int coupling_w(int w)
+{
+	if (w == 16 || w == 32) return w;
+	return 8;
+}
+
+/* r2 = multby*region in GF(2^cw), or r2 += that if add is set */
+static inline void coupling_region_multiply(char *region, int multby, int nbytes, char *r2, int add, int cw)
+{
+	switch (cw) {
+		case 16:
+			galois_w16_region_multiply(region, multby, nbytes, r2, add);
+			break;
+		case 32:
+			galois_w32_region_multiply(region, multby, nbytes, r2, add);
+			break;
+		default:
+			galois_w08_region_multiply(region, multby, nbytes, r2, add);
+	}
+}
+
+#endif
@@ -0,0 +1,120 @@
+/* *
+ * crc32c.h - CRC32C (Castagnoli) of stored sub-chunks.
+ *
+ * On x86-64 CPUs with SSE4.2 the crc32 instruction is used, eight bytes
+ * at a time.  Everywhere else a slice-by-8 table does the same job; both
+ * give identical results, so chunks written on one machine verify on any
+ * other.  crc32c(0, buf, len) is the CRC of buf alone, and passing the
+ * result back in as crc continues it over the next region.
+ */
+
+#ifndef _CRC32C_H
+#define _CRC32C_H
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <nmmintrin.h>
+#define CRC32C_SSE42
+#endif
+
+#define CRC32C_POLY 0x82f63b78		/* reflected Castagnoli polynomial */
+
+static uint32_t crc32c_table[8][256];
+static int crc32c_ready;
+static int crc32c_hw;			/* SSE4.2 crc32 usable */
+
+static inline void crc32c_init(void)
+{
+	uint32_t c;
+	int i, j;
+
+	for (i = 0; i < 256; i++) {
+		c = i;
+		for (j = 0; j < 8; j++) c = (c >> 1) ^ ((c & 1) ? CRC32C_POLY : 0);
+		crc32c_table[0][i] = c;
+	}
+	for (i = 0; i < 256; i++) {
+		c = crc32c_table[0][i];
+		for (j = 1; j < 8; j++) {
+			c = crc32c_table[0][c & 0xff] ^ (c >> 8);
+			crc32c_table[j][i] = c;
+		}
+	}
+#ifdef CRC32C_SSE42
+	crc32c_hw = __builtin_cpu_supports("sse4.2") ? 1 : 0;
+#else
+	crc32c_hw = 0;
+#endif
+	crc32c_ready = 1;
+}
+
+/* Table version, on the inverted crc */
+static inline uint32_t crc32c_sw(uint32_t crc, const unsigned char *p, size_t len)
+{
+	uint64_t v;
+
+	while (len > 0 && ((uintptr_t) p & 7) != 0) {
+		crc = crc32c_table[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+		len--;
+	}
+	while (len >= 8) {
+		memcpy(&v, p, 8);
+		v ^= crc;
+		crc = crc32c_table[7][v & 0xff] ^
+		      crc32c_table[6][(v >> 8) & 0xff] ^
+		      crc32c_table[5][(v >> 16) & 0xff] ^
+		      crc32c_table[4][(v >> 24) & 0xff] ^
+		      crc32c_table[3][(v >> 32) & 0xff] ^
+		      crc32c_table[2][(v >> 40) & 0xff] ^
+		      crc32c_table[1][(v >> 48) & 0xff] ^
+		      crc32c_table[0][v >> 56];
+		p += 8;
+		len -= 8;
+	}
+	while (len > 0) {
+		crc = crc32c_table[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+		len--;
+	}
+	return crc;
+}
+
+#ifdef CRC32C_SSE42
+/* crc32 instruction version, on the inverted crc */
+__attribute__((target("sse4.2")))
+static inline uint32_t crc32c_sse42(uint32_t crc, const unsigned char *p, size_t len)
+{
+	uint64_t c, v;
+
+	while (len > 0 && ((uintptr_t) p & 7) != 0) {
+		crc = _mm_crc32_u8(crc, *p++);
+		len--;
+	}
+	c = crc;
+	while (len >= 8) {
+		memcpy(&v, p, 8);
+		c = _mm_crc32_u64(c, v);
+		p += 8;
+		len -= 8;
+	}
+	crc = (uint32_t) c;
+	while (len > 0) {
+		crc = _mm_crc32_u8(crc, *p++);
+		len--;
+	}
+	return crc;
+}
+#endif
+
+static inline uint32_t crc32c(uint32_t crc, const char *buf, size_t len)
+{
+	if (!crc32c_ready) crc32c_init();
+	crc = ~crc;
+#ifdef CRC32C_SSE42
+	if (crc32c_hw) return ~crc32c_sse42(crc, (const unsigned char *) buf, len);
+#endif
+	return ~crc32c_sw(crc, (const unsigned char *) buf, len);
+}
+
+#endif
@@ -67,6 +67,7 @@ same arguments, and encoder.c does error check.
 #include <sys/time.h>
 #include <sys/stat.h>
 #include <signal.h>
+#include <fcntl.h>
 #include <unistd.h>
 #include "jerasure.h"
 #include "reed_sol.h"
@@ -74,6 +75,10 @@ same arguments, and encoder.c does error check.
 #include "cauchy.h"
 #include "liberation.h"
 #include "timing.h"
+#include "chunk-io.h"
+#include "chunk-header.h"
+#include "crc32c.h"
+#include "chunk-stage.h"
 
 #define N 10
 
@@ -85,6 +90,9 @@ char *Methods[N] = {"reed_sol_van", "reed_sol_r6_op", "cauchy_orig", "cauchy_goo
 enum Coding_Technique method;
 int readins, n;
 
+/* Time and bytes of each stage, for the report at the end */
+chunk_stage stages;
+
 /* Function prototype */
 void ctrl_bs_handler(int dummy);
 
@@ -96,20 +104,38 @@ int main (int argc, char **argv) {
 	char **coding;
 	int *erasures;
 	int *erased;
+	char *ioerr;			// ioerr[i]: the read of file i failed or came up short
 	int *matrix;
 	int *bitmatrix;
 	
 	/* Parameters */
-	int k, m, w, packetsize, buffersize;
+	int k, m, w, packetsize;
+	long buffersize;
 	int tech;
 	char *c_tech;
 	
-	int i, j;				// loop control variable, s
-	int blocksize = 0;			// size of individual files
-	int origsize;			// size of file before padding
-	int total;				// used to write data, not padding to file
+	int i;				// loop control variable
+	long blocksize = 0;			// size of individual files
+	long lastbs = 0;			// blocksize of the last read-in, short for a stream
+	long bs;				// blocksize of this read-in
+	int subchunks = 1;			// sub-chunks a block is CRC'd in
+	int j;				// sub-chunk of a block
+	long origsize;			// size of file before padding
+	long total;				// used to write data, not padding to file
 	struct stat status;		// used to find size of individual files
 	int numerased;			// number of erased files
+	int use_uring;			// read the k+m files through io_uring
+	int use_direct;			// read the k+m files with O_DIRECT
+	FILE *out;				// decoded object on stdout, or NULL
+	chunk_io cio;
+	int *cfd;			// descriptors of the k+m files
+	chunk_header chdr;		// layout from the chunk headers
+	chunk_header ihdr;		// header of each chunk, checked against chdr
+	uint64_t *choff;		// sub-chunk offset table, NULL for old objects
+	int hdr_size;			// bytes in front of the first sub-chunk
+	uint32_t **crcs;		// CRC32C table of each chunk, NULL if it has none
+	char *hdrbad;			// hdrbad[i]: file i is there but its header is not usable
+	uint64_t *hoff;
 		
 	/* Used to recreate file names */
 	char *temp;
@@ -132,17 +158,47 @@ int main (int argc, char **argv) {
 	
 	/* Start timing */
 	timing_set(&t1);
+	chunk_stage_init(&stages);
 
 	/* Error checking parameters */
-	if (argc != 2) {
-		fprintf(stderr, "usage: inputfile\n");
+	if (argc < 2) {
+		fprintf(stderr, "usage: inputfile [uring] [direct] [stdout] [perf]\n");
+		fprintf(stderr, "\nuring reads the k+m files in batches through io_uring.");
+		fprintf(stderr, "\ndirect reads the k+m files with O_DIRECT.");
+		fprintf(stderr, "\nstdout writes the decoded object to stdout instead of Coding/<name>_decoded.");
+		fprintf(stderr, "\nperf also counts cycles, instructions and cache misses of each stage, where the CPU lets it.\n");
 		exit(0);
 	}
+	use_uring = 0;
+	use_direct = 0;
+	out = NULL;
+	for (i = 2; i < argc; i++) {
+		if (strcmp(argv[i], "uring") == 0) {
+			use_uring = 1;
+		}
+		else if (strcmp(argv[i], "direct") == 0) {
+			use_direct = 1;
+		}
+		else if (strcmp(argv[i], "stdout") == 0) {
+			/* The decoded bytes get the real stdout; everything else 
+			   printed goes to stderr */
+			out = fdopen(dup(1), "wb");
+			if (out == NULL) { perror("stdout"); exit(1); }
+			dup2(2, 1);
+		}
+		else if (strcmp(argv[i], "perf") == 0) {
+			chunk_stage_perf(&stages);
+		}
+		else {
+			fprintf(stderr, "Unknown option %s\n", argv[i]);
+			exit(0);
+		}
+	}
 	curdir = (char *)malloc(sizeof(char)*1000);
 	assert(curdir == getcwd(curdir, 1000));
 	
 	/* Begin recreation of file names */
-	cs1 = (char*)malloc(sizeof(char)*strlen(argv[1]));
+	cs1 = (char*)malloc(sizeof(char)*strlen(argv[1])+1);
 	cs2 = strrchr(argv[1], '/');
 	if (cs2 != NULL) {
 		cs2++;
@@ -160,67 +216,137 @@ int main (int argc, char **argv) {
         }	
 	fname = (char *)malloc(sizeof(char*)*(100+strlen(argv[1])+20));
 
-	/* Read in parameters from metadata file */
-	sprintf(fname, "%s/Coding/%s_meta.txt", curdir, cs1);
-      
-        //for(i=0;i<10;i++){
-        //printf("%d ",cs1[i]);}
-
-	fp = fopen(fname, "rb");
-        if (fp == NULL) {
-          fprintf(stderr, "Error: no metadata file %s\n", fname);
-          exit(1);
-        }
+	/* Read in parameters from the header of any surviving chunk */
 	temp = (char *)malloc(sizeof(char)*(strlen(argv[1])+20));
-	if (fscanf(fp, "%s", temp) != 1) {
-		fprintf(stderr, "Metadata file - bad format\n");
-		exit(0);
-	}
-	
-	if (fscanf(fp, "%d", &origsize) != 1) {
-		fprintf(stderr, "Original size is not valid\n");
-		exit(0);
-	}
-	if (fscanf(fp, "%d %d %d %d %d", &k, &m, &w, &packetsize, &buffersize) != 5) {
-		fprintf(stderr, "Parameters are not correct\n");
-		exit(0);
-	}
 	c_tech = (char *)malloc(sizeof(char)*(strlen(argv[1])+20));
-	if (fscanf(fp, "%s", c_tech) != 1) {
-		fprintf(stderr, "Metadata file - bad format\n");
-		exit(0);
-	}
-	if (fscanf(fp, "%d", &tech) != 1) {
-		fprintf(stderr, "Metadata file - bad format\n");
-		exit(0);
+	sprintf(fname, "%s/Coding", curdir);
+	if (chunk_header_find(fname, cs1, extension, &chdr, &choff) == 0) {
+		if (chdr.family != Chunk_Mul) {
+			fprintf(stderr, "%s was not encoded by mul-encoder\n", argv[1]);
+			exit(0);
+		}
+		origsize = chdr.size;
+		k = chdr.k;
+		m = chdr.m;
+		w = chdr.w;
+		packetsize = chdr.packetsize;
+		buffersize = chdr.buffersize;
+		tech = chdr.tech;
+		method = tech;
+		readins = chdr.readins;
+		strcpy(c_tech, Methods[tech]);
+		hdr_size = chdr.hdr_size;
+		/* The block of a read-in is subchunks sub-chunks */
+		subchunks = chdr.subchunks;
+		blocksize = (long) subchunks*chdr.blocksize;
+		lastbs = (long) subchunks*chdr.lastbs;
 	}
-	method = tech;
-	if (fscanf(fp, "%d", &readins) != 1) {
-		fprintf(stderr, "Metadata file - bad format\n");
-		exit(0);
+	else {
+		choff = NULL;
+		hdr_size = 0;
+		/* Objects encoded before chunk headers: read in parameters from 
+		   the metadata file */
+		sprintf(fname, "%s/Coding/%s_meta.txt", curdir, cs1);
+      
+	        //for(i=0;i<10;i++){
+	        //printf("%d ",cs1[i]);}
+
+		fp = fopen(fname, "rb");
+	        if (fp == NULL) {
+	          fprintf(stderr, "Error: no chunk header and no metadata file %s\n", fname);
+	          exit(1);
+	        }
+		if (fscanf(fp, "%s", temp) != 1) {
+			fprintf(stderr, "Metadata file - bad format\n");
+			exit(0);
+		}
+	
+		if (fscanf(fp, "%ld", &origsize) != 1) {
+			fprintf(stderr, "Original size is not valid\n");
+			exit(0);
+		}
+		if (fscanf(fp, "%d %d %d %d %ld", &k, &m, &w, &packetsize, &buffersize) != 5) {
+			fprintf(stderr, "Parameters are not correct\n");
+			exit(0);
+		}
+		if (fscanf(fp, "%s", c_tech) != 1) {
+			fprintf(stderr, "Metadata file - bad format\n");
+			exit(0);
+		}
+		if (fscanf(fp, "%d", &tech) != 1) {
+			fprintf(stderr, "Metadata file - bad format\n");
+			exit(0);
+		}
+		method = tech;
+		if (fscanf(fp, "%d", &readins) != 1) {
+			fprintf(stderr, "Metadata file - bad format\n");
+			exit(0);
+		}
+		fclose(fp);	
 	}
-	fclose(fp);	
 
 	/* Allocate memory */
 	erased = (int *)malloc(sizeof(int)*(k+m));
 	for (i = 0; i < k+m; i++)
 		erased[i] = 0;
-	erasures = (int *)malloc(sizeof(int)*(k+m));
+	erasures = (int *)malloc(sizeof(int)*(k+m+1));
+	ioerr = (char *)malloc(sizeof(char)*(k+m));
+
+	sprintf(temp, "%d", k);
+	md = strlen(temp);
+
+	/* Objects without a header: a read-in is buffersize, or with whole-file
+	   chunks the size of any surviving chunk is the block size */
+	if (blocksize == 0 && buffersize != origsize) {
+		blocksize = buffersize/k;
+	}
+	for (i = 0; i < k+m && blocksize == 0; i++) {
+		if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i+1, extension);
+		else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i-k+1, extension);
+		if (stat(fname, &status) == 0) blocksize = status.st_size;
+	}
+	if (lastbs == 0) lastbs = blocksize;
 
+	/* One block per file, reused by every read-in */
 	data = (char **)malloc(sizeof(char *)*k);
 	coding = (char **)malloc(sizeof(char *)*m);
-	if (buffersize != origsize) {
-		for (i = 0; i < k; i++) {
-			data[i] = (char *)malloc(sizeof(char)*(buffersize/k));
+	for (i = 0; i < k; i++) {
+		data[i] = chunk_io_alloc(sizeof(char)*blocksize);
+	}
+	for (i = 0; i < m; i++) {
+		coding[i] = chunk_io_alloc(sizeof(char)*blocksize);
+	}
+
+	/* Each chunk carries the CRCs of its own sub-chunks.  A chunk that is
+	   there but whose header cannot be read, or is not that of this
+	   object, is erased like a missing one. */
+	crcs = (uint32_t **)malloc(sizeof(uint32_t*)*(k+m));
+	hdrbad = (char *)malloc(sizeof(char)*(k+m));
+	for (i = 0; i < k+m; i++) {
+		crcs[i] = NULL;
+		hdrbad[i] = 0;
+		if (choff == NULL) continue;
+		if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i+1, extension);
+		else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i-k+1, extension);
+		if (chunk_header_load(fname, &ihdr, &hoff, &crcs[i]) != 0) {
+			crcs[i] = NULL;
+			if (access(fname, F_OK) != 0) continue;
 		}
-		for (i = 0; i < m; i++) {
-			coding[i] = (char *)malloc(sizeof(char)*(buffersize/k));
+		else {
+			free(hoff);
+			if (chunk_header_match(&ihdr, &chdr, i) == 0) continue;
+			free(crcs[i]);
+			crcs[i] = NULL;
 		}
-		blocksize = buffersize/k;
+		fprintf(stderr, "%s: the chunk header is damaged or not that of this object, treating the chunk as erased\n", fname);
+		hdrbad[i] = 1;
 	}
 
-	sprintf(temp, "%d", k);
-	md = strlen(temp);
+	cfd = (int *)malloc(sizeof(int)*(k+m));
+	if (use_uring || use_direct) {
+		chunk_io_init(&cio, 64, use_uring);
+		cio.tagged = ioerr;
+	}
 	timing_set(&t3);
 
 	/* Create coding matrix or bitmatrix */
@@ -258,16 +384,43 @@ int main (int argc, char **argv) {
         
 	timing_set(&t4);
 	totalsec += timing_delta(&t3, &t4);
+	chunk_stage_end(&stages, Stage_Setup, 0);
 	
 	/* Begin decoding process */
 	total = 0;
 	n = 1;	
 	while (n <= readins) {
 		numerased = 0;
+		memset(ioerr, 0, k+m);
+		bs = (n == readins) ? lastbs : blocksize;
+		if (use_uring || use_direct) {
+			/* Queue the reads of all k+m files as one batch */
+			for (i = 0; i < k+m; i++) {
+				if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i+1, extension);
+				else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i-k+1, extension);
+				cfd[i] = hdrbad[i] ? -1 : chunk_io_open(fname, O_RDONLY, use_direct);
+				if (cfd[i] < 0) {
+					erased[i] = 1;
+					erasures[numerased] = i;
+					numerased++;
+					if (i < k) printf("%s failed\n", fname);
+					continue;
+				}
+				if (use_direct && blocksize%CHUNK_IO_ALIGN != 0) {
+					chunk_io_undirect(cfd[i]);
+				}
+				cio.tag = i;
+				chunk_io_pread(&cio, cfd[i], (i < k) ? data[i] : coding[i-k], bs, hdr_size+(off_t)blocksize*(n-1), -1);
+			}
+			chunk_io_wait(&cio);
+			for (i = 0; i < k+m; i++) {
+				if (cfd[i] >= 0) close(cfd[i]);
+			}
+		}
 		/* Open files, check for erasures, read in data/coding */	
-		for (i = 1; i <= k; i++) {
+		for (i = 1; i <= k && !use_uring && !use_direct; i++) {
 			sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i, extension);
-			fp = fopen(fname, "rb");
+			fp = hdrbad[i-1] ? NULL : fopen(fname, "rb");
 			if (fp == NULL) {
 				erased[i-1] = 1;
 				erasures[numerased] = i-1;
@@ -275,22 +428,14 @@ int main (int argc, char **argv) {
 				printf("%s failed\n", fname);
 			}
 			else {
-				if (buffersize == origsize) {
-					stat(fname, &status);
-					blocksize = status.st_size;
-					data[i-1] = (char *)malloc(sizeof(char)*blocksize);
-					assert(blocksize == fread(data[i-1], sizeof(char), blocksize, fp));
-				}
-				else {
-					fseek(fp, blocksize*(n-1), SEEK_SET); 
-					assert(buffersize/k == fread(data[i-1], sizeof(char), buffersize/k, fp));
-				}
+				fseek(fp, hdr_size+blocksize*(n-1), SEEK_SET); 
+				if (fread(data[i-1], sizeof(char), bs, fp) != (size_t) bs) ioerr[i-1] = 1;
 				fclose(fp);
 			}
 		}
-		for (i = 1; i <= m; i++) {
+		for (i = 1; i <= m && !use_uring && !use_direct; i++) {
 			sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i, extension);
-				fp = fopen(fname, "rb");
+				fp = hdrbad[k+i-1] ? NULL : fopen(fname, "rb");
 			if (fp == NULL) {
 				erased[k+(i-1)] = 1;
 				erasures[numerased] = k+i-1;
@@ -298,16 +443,8 @@ int main (int argc, char **argv) {
 				//printf("%s failed\n", fname);
 			}
 			else {
-				if (buffersize == origsize) {
-					stat(fname, &status);
-					blocksize = status.st_size;
-					coding[i-1] = (char *)malloc(sizeof(char)*blocksize);
-					assert(blocksize == fread(coding[i-1], sizeof(char), blocksize, fp));
-				}
-				else {
-					fseek(fp, blocksize*(n-1), SEEK_SET);
-					assert(blocksize == fread(coding[i-1], sizeof(char), blocksize, fp));
-				}	
+				fseek(fp, hdr_size+blocksize*(n-1), SEEK_SET);
+				if (fread(coding[i-1], sizeof(char), bs, fp) != (size_t) bs) ioerr[k+i-1] = 1;
 				fclose(fp);
 			}
 		}
@@ -320,33 +457,55 @@ int main (int argc, char **argv) {
                    printf("%d ",erasures[i]);
                 }*/
 
-		/* Finish allocating data/coding if needed */
-		if (n == 1) {
-			for (i = 0; i < numerased; i++) {
-				if (erasures[i] < k) {
-					data[erasures[i]] = (char *)malloc(sizeof(char)*blocksize);
-				}
-				else {
-					coding[erasures[i]-k] = (char *)malloc(sizeof(char)*blocksize);
-				}
+		/* A file that is there but cannot be read in full (truncated,
+		   or an I/O error) is an erasure for this read-in, as long as
+		   k files are left */
+		for (i = 0; i < k+m; i++) {
+			if (!ioerr[i] || erased[i]) continue;
+			if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i+1, extension);
+			else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i-k+1, extension);
+			fprintf(stderr, "%s: read-in %d cannot be read in full, treating it as erased\n", fname, n);
+			erasures[numerased] = i;
+			numerased++;
+		}
+		if (numerased > m) {
+			fprintf(stderr, "Read-in %d: %d of the %d files are missing or unreadable, at most %d may be\n", n, numerased, k+m, m);
+			exit(1);
+		}
+		chunk_stage_end(&stages, Stage_Read, (uint64_t) (k+m-numerased)*bs);
+
+		/* A block with a sub-chunk that fails the CRC in its chunk header
+		   is an erasure for this read-in only */
+		for (i = 0; i < k+m; i++) {
+			if (erased[i] || ioerr[i] || crcs[i] == NULL) continue;
+			for (j = 0; j < subchunks; j++) {
+				if (crc32c(0, ((i < k) ? data[i] : coding[i-k])+j*(bs/subchunks), bs/subchunks) != crcs[i][(long)(n-1)*subchunks+j]) break;
+			}
+			if (j < subchunks) {
+				if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, cs1, md, i+1, extension);
+				else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, cs1, md, i-k+1, extension);
+				fprintf(stderr, "%s: sub-chunk %d of read-in %d fails the CRC32C check, treating it as erased\n", fname, j, n);
+				erasures[numerased] = i;
+				numerased++;
 			}
 		}
-		
 		erasures[numerased] = -1;
+		chunk_stage_end(&stages, Stage_Crc, (uint64_t) (k+m-numerased)*bs);
 		timing_set(&t3);
 	
 		/* Choose proper decoding method */
 		if (tech == Reed_Sol_Van || tech == Reed_Sol_R6_Op) {
-			i = jerasure_matrix_decode(k, m, w, matrix, 1, erasures, data, coding, blocksize);
+			i = jerasure_matrix_decode(k, m, w, matrix, 1, erasures, data, coding, bs);
 		}
 		else if (tech == Cauchy_Orig || tech == Cauchy_Good || tech == Liberation || tech == Blaum_Roth || tech == Liber8tion) {
-			i = jerasure_schedule_decode_lazy(k, m, w, bitmatrix, erasures, data, coding, blocksize, packetsize, 1);
+			i = jerasure_schedule_decode_lazy(k, m, w, bitmatrix, erasures, data, coding, bs, packetsize, 1);
 		}
 		else {
 			fprintf(stderr, "Not a valid coding technique.\n");
 			exit(0);
 		}
 		timing_set(&t4);
+		chunk_stage_end(&stages, Stage_Mds, (uint64_t) k*bs);
 	
 		/* Exit if decoding was unsuccessful */
 		if (i == -1) {
@@ -356,35 +515,34 @@ int main (int argc, char **argv) {
 	
 		/* Create decoded file */
 		sprintf(fname, "%s/Coding/%s_decoded%s", curdir, cs1, extension);
-		if (n == 1) {
+		if (out != NULL) {
+			fp = out;
+		}
+		else if (n == 1) {
 			fp = fopen(fname, "wb");
 		}
 		else {
 			fp = fopen(fname, "ab");
 		}
 		for (i = 0; i < k; i++) {
-			if (total+blocksize <= origsize) {
-				fwrite(data[i], sizeof(char), blocksize, fp);
-				total+= blocksize;
+			if (total+bs <= origsize) {
+				fwrite(data[i], sizeof(char), bs, fp);
+				total+= bs;
 			}
-			else {
-				for (j = 0; j < blocksize; j++) {
-					if (total < origsize) {
-						fprintf(fp, "%c", data[i][j]);
-						total++;
-					}
-					else {
-						break;
-					}
-					
-				}
+			else if (total < origsize) {
+				fwrite(data[i], sizeof(char), origsize-total, fp);
+				total = origsize;
 			}
 		}
+		if (out == NULL) fclose(fp);
+		chunk_stage_end(&stages, Stage_Write, total-(long)(n-1)*k*blocksize);
+		stages.readins++;
 		n++;
-		fclose(fp);
 		totalsec += timing_delta(&t3, &t4);
 	}
 	
+	if (out != NULL) fclose(out);
+
 	/* Free allocated memory */
 	free(cs1);
 	free(extension);
@@ -393,12 +551,16 @@ int main (int argc, char **argv) {
 	free(coding);
 	free(erasures);
 	free(erased);
+	free(ioerr);
+	if (use_uring) chunk_io_exit(&cio);
+	free(cfd);
 	
 	/* Stop timing and print time */
 	timing_set(&t2);
 	tsec = timing_delta(&t1, &t2);
 	printf("Decoding (MB/sec): %0.10f\n", (((double) origsize)/1024.0/1024.0)/totalsec);
 	printf("De_Total (MB/sec): %0.10f\n\n", (((double) origsize)/1024.0/1024.0)/tsec);
+	chunk_stage_report(&stages, stdout, "mul-decoder", origsize);
 
 	return 0;
 }	
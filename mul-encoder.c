@@ -65,35 +65,81 @@ is the file name with "_k#" or "_m#" and then the extension.
 #include <stdlib.h>
 #include <errno.h>
 #include <signal.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <gf_rand.h>
 #include <unistd.h>
 #include "jerasure.h"
+#include "galois.h"
 #include "reed_sol.h"
 #include "cauchy.h"
 #include "liberation.h"
 #include "timing.h"
+#include "chunk-io.h"
+#include "chunk-header.h"
+#include "crc32c.h"
+#include "chunk-stage.h"
+#include "chunk-mem.h"
+#include "coupling.h"
 
 #define N 10
 #define M 8
 #define r 2
+
+/* With buffersize 0, objects larger than this are encoded in read-ins of
+   about this size, so memory use does not grow with the object */
+#define STREAM_BUFSIZE (64L*1024*1024)
 enum Coding_Technique {Reed_Sol_Van, Reed_Sol_R6_Op, Cauchy_Orig, Cauchy_Good, Liberation, Blaum_Roth, Liber8tion, RDP, EVENODD, No_Coding};
 
 char *Methods[N] = {"reed_sol_van", "reed_sol_r6_op", "cauchy_orig", "cauchy_good", "liberation", "blaum_roth", "liber8tion", "no_coding"};
 
 /* Global variables for signal handler */
 int readins, n;
+
+/* Time and bytes of each stage, for the report at the end */
+chunk_stage stages;
+
+/* Bytes of each class of buffer, for the report at the end */
+chunk_mem mem;
 enum Coding_Technique method;
 
 /* Function prototypes */
 int is_prime(int w);
 void ctrl_bs_handler(int dummy);
 
-int jfread(void *ptr, int size, int nmembers, FILE *stream)
+long jfread(void *ptr, int size, long nmembers, FILE *stream)
 {
   if (stream != NULL) return fread(ptr, size, nmembers, stream);
 
-  MOA_Fill_Random_Region(ptr, size);
-  return size;
+  MOA_Fill_Random_Region(ptr, size*nmembers);
+  return nmembers;
+}
+
+/* madvise() of the part of the mapped inputfile from off to off+len, 
+   whole pages only and clipped to the file */
+void map_advise(char *map, long size, long off, long len, int advice)
+{
+  long page, end;
+
+  page = sysconf(_SC_PAGESIZE);
+  end = (off+len < size) ? off+len : size;
+  off = off/page*page;
+  if (off >= end) return;
+  madvise(map+off, end-off, advice);
+}
+
+/* CRC32C of the M sub-chunks of blk, the blocksize bytes a read-in leaves
+   in chunk node; crc is the table of the current read-in.  Called as soon
+   as the MDS encode has produced the block, while it is still in cache,
+   so the checksums need no pass of their own. */
+void block_crc(uint32_t *crc, int node, char *blk, long blocksize)
+{
+  long sbs;
+  int j;
+
+  sbs = blocksize/M;
+  for (j = 0; j < M; j++) crc[(long)node*M+j] = crc32c(0, blk+j*sbs, sbs);
+  chunk_stage_end(&stages, Stage_Crc, blocksize);
 }
 
 static void print_data_and_coding(int k, int m, int w, int size,
@@ -137,18 +183,42 @@ static void print_data_and_coding(int k, int m, int w, int size,
 int main (int argc, char **argv) {
 	FILE *fp, *fp2;				// file pointers
 	char *block;				// padding file
-	int size, newsize;			// size of file and temp size 
+	long size, newsize;			// size of file and temp size 
 	struct stat status;			// finding file size
 
 	
 	enum Coding_Technique tech;		// coding technique (parameter)
 	int k, m, w, packetsize;		// parameters
-	int buffersize;					// paramter
+	int cw;					// coupling word size
+	long buffersize;				// paramter
 	int i,j,i1,j1;						// loop control variables
-	int blocksize;					// size of k+m files
-	int total;
-	int extra; 
-	int stripe_size;
+	long blocksize;					// size of k+m files
+	long total;
+	long extra; 
+	long stripe_size;
+	long unit_size;				// newsize and buffersize are multiples of this
+	int use_mmap;				// map the inputfile instead of reading it
+	char *map;				// mapped inputfile
+	char *tail;				// zero-padded copy of the layers past the end of the file
+	long tailstart = 0;			// file offset of tail[0]
+	long off;
+	int use_uring;				// write the k+m files through io_uring
+	int use_direct;				// write the k+m files with O_DIRECT
+	long unit;				// a read-in is a multiple of this
+	chunk_io cio;
+	int *cfd;				// descriptors of the k+m files
+	char *blockbuf[2];			// with cfd, block of the odd and even read-ins
+	char **codingbuf[2];			// with cfd, coding of the odd and even read-ins
+	chunk_header chdr;			// layout stored at the front of every chunk
+	uint64_t *choff;			// sub-chunk offset table
+	char *hbuf;				// packed headers of the k+m files
+	uint32_t *chcrc;			// CRC32C of every sub-chunk, read-in by read-in
+	uint32_t *rcrc;				// CRCs of the current read-in
+	uint32_t *fcrc;				// CRCs of one file
+	long crccap;				// read-ins chcrc has room for
+	int use_stdin;				// encode a stream of unknown length from stdin
+	char *tbuf;				// packed trailers of the k+m files
+	long tlen;
 	
 	/* Jerasure Arguments */
 	char **data;				
@@ -180,25 +250,32 @@ int main (int argc, char **argv) {
 	struct timing start;
 
 	/* Find buffersize */
-	int up, down;
+	long up, down;
 
 
 	signal(SIGQUIT, ctrl_bs_handler);
 
 	/* Start timing */
 	timing_set(&t1);
+	chunk_stage_init(&stages);
+	chunk_mem_init(&mem);
 	totalsec = 0.0;
 	matrix = NULL;
 	bitmatrix = NULL;
 	schedule = NULL;
 	
 	/* Error check Arguments*/
-	if (argc != 8) {
-		fprintf(stderr,  "usage: inputfile k m coding_technique w packetsize buffersize\n");
+	if (argc < 8) {
+		fprintf(stderr,  "usage: inputfile k m coding_technique w packetsize buffersize [mmap] [uring] [direct] [stdin] [perf]\n");
 		fprintf(stderr,  "\nChoose one of the following coding techniques: \nreed_sol_van, \nreed_sol_r6_op, \ncauchy_orig, \ncauchy_good, \nliberation, \nblaum_roth, \nliber8tion");
 		fprintf(stderr,  "\n\nPacketsize is ignored for the reed_sol's");
 		fprintf(stderr,  "\nBuffersize of 0 means the buffersize is chosen automatically.\n");
-		fprintf(stderr,  "\nIf you just want to test speed, use an inputfile of \"-number\" where number is the size of the fake file you want to test.\n\n");
+		fprintf(stderr,  "\nIf you just want to test speed, use an inputfile of \"-number\" where number is the size of the fake file you want to test.\n");
+		fprintf(stderr,  "\nmmap encodes straight out of a read-only mapping of the inputfile.");
+		fprintf(stderr,  "\nuring writes the k+m files in batches through io_uring, overlapped with encoding.");
+		fprintf(stderr,  "\ndirect writes the k+m files with O_DIRECT; sub-chunks are padded to %d bytes.", CHUNK_IO_ALIGN);
+		fprintf(stderr,  "\nstdin encodes a stream of unknown length from stdin; inputfile only names the chunks.");
+		fprintf(stderr,  "\nperf also counts cycles, instructions and cache misses of each stage, where the CPU lets it.\n\n");
 		exit(0);
 	}
 	/* Conversion of parameters and error checking */	
@@ -223,50 +300,57 @@ int main (int argc, char **argv) {
 			exit(0);
 		}
 	}
-	if (argc != 8) {
+	if (argc < 8) {
 		buffersize = 0;
 	}
 	else {
-		if (sscanf(argv[7], "%d", &buffersize) == 0 || buffersize < 0) {
+		if (sscanf(argv[7], "%ld", &buffersize) == 0 || buffersize < 0) {
 			fprintf(stderr, "Invalid value for buffersize\n");
 			exit(0);
 		}
 		
 	}
 
-	/* Determine proper buffersize by finding the closest valid buffersize to the input value  */
-	if (buffersize != 0) {
-		if (packetsize != 0 && buffersize%(sizeof(long)*w*k*packetsize) != 0) { 
-			up = buffersize;
-			down = buffersize;
-			while (up%(sizeof(long)*w*k*packetsize) != 0 && (down%(sizeof(long)*w*k*packetsize) != 0)) {
-				up++;
-				if (down == 0) {
-					down--;
-				}
-			}
-			if (up%(sizeof(long)*w*k*packetsize) == 0) {
-				buffersize = up;
-			}
-			else {
-				if (down != 0) {
-					buffersize = down;
-				}
-			}
+	/* Optional trailing arguments */
+	use_mmap = 0;
+	use_uring = 0;
+	use_direct = 0;
+	use_stdin = 0;
+	for (i = 8; i < argc; i++) {
+		if (strcmp(argv[i], "mmap") == 0) {
+			use_mmap = 1;
 		}
-		else if (packetsize == 0 && buffersize%(sizeof(long)*w*k) != 0) {
-			up = buffersize;
-			down = buffersize;
-			while (up%(sizeof(long)*w*k) != 0 && down%(sizeof(long)*w*k) != 0) {
-				up++;
-				down--;
-			}
-			if (up%(sizeof(long)*w*k) == 0) {
-				buffersize = up;
-			}
-			else {
-				buffersize = down;
-			}
+		else if (strcmp(argv[i], "uring") == 0) {
+			use_uring = 1;
+		}
+		else if (strcmp(argv[i], "direct") == 0) {
+			use_direct = 1;
+		}
+		else if (strcmp(argv[i], "stdin") == 0) {
+			use_stdin = 1;
+		}
+		else if (strcmp(argv[i], "perf") == 0) {
+			chunk_stage_perf(&stages);
+		}
+		else {
+			fprintf(stderr, "Unknown option %s\n", argv[i]);
+			exit(0);
+		}
+	}
+
+	/* Determine proper buffersize by finding the closest valid buffersize to the input value.
+	   A read-in is M layers of k sub-chunks, each a whole number of words
+	   (or packets). */
+	if (packetsize != 0) unit_size = sizeof(long)*w*k*packetsize*M;
+	else unit_size = sizeof(long)*w*k*M;
+	if (buffersize != 0 && buffersize%unit_size != 0) {
+		up = (buffersize/unit_size+1)*unit_size;
+		down = (buffersize/unit_size)*unit_size;
+		if (down == 0 || up-buffersize <= buffersize-down) {
+			buffersize = up;
+		}
+		else {
+			buffersize = down;
 		}
 	}
 
@@ -371,12 +455,24 @@ int main (int argc, char **argv) {
 
 	/* Set global variable method for signal handler */
 	method = tech;
+	cw = coupling_w(w);
 
 	/* Get current working directory for construction of file names */
 	curdir = (char*)malloc(sizeof(char)*1000);	
 	assert(curdir == getcwd(curdir, 1000));
 
-        if (argv[1][0] != '-') {
+        if (use_stdin) {
+		/* The length is not known until the stream ends: size is 
+		   counted up as read-ins come in, and a stream cannot be mapped */
+		fp = stdin;
+		size = 0;
+		use_mmap = 0;
+		i = mkdir("Coding", S_IRWXU);
+		if (i == -1 && errno != EEXIST) {
+			fprintf(stderr, "Unable to create Coding directory.\n");
+			exit(0);
+		}
+        } else if (argv[1][0] != '-') {
 
 		/* Open file and error check */
 		fp = fopen(argv[1], "rb");
@@ -396,34 +492,40 @@ int main (int argc, char **argv) {
 		stat(argv[1], &status);	
 		size = status.st_size;
         } else {
-        	if (sscanf(argv[1]+1, "%d", &size) != 1 || size <= 0) {
+        	if (sscanf(argv[1]+1, "%ld", &size) != 1 || size <= 0) {
                 	fprintf(stderr, "Files starting with '-' should be sizes for randomly created input\n");
 			exit(1);
 		}
         	fp = NULL;
+		use_mmap = 0;
+		use_uring = 0;
+		use_direct = 0;
 		MOA_Seed(time(0));
         }
 
 	newsize = size;
 	
 	/* Find new size by determining next closest multiple */
-	if (packetsize != 0) {
-		if (size%(k*w*packetsize*sizeof(long)) != 0) {
-			while (newsize%(k*w*packetsize*sizeof(long)) != 0) 
-				newsize++;
-		}
+	newsize = ((newsize+unit_size-1)/unit_size)*unit_size;
+
+	/* Large objects are streamed through a fixed-size buffer */
+	if (buffersize == 0 && (newsize > STREAM_BUFSIZE || use_stdin)) {
+		buffersize = (STREAM_BUFSIZE/unit_size)*unit_size;
+		if (buffersize == 0) buffersize = unit_size;
 	}
-	else {
-		if (size%(k*w*sizeof(long)) != 0) {
-			while (newsize%(k*w*sizeof(long)) != 0) 
-				newsize++;
-		}
+
+	/* With O_DIRECT every sub-chunk (blocksize) has to be a multiple of 
+	   CHUNK_IO_ALIGN as well */
+	unit = unit_size;
+	if (use_direct) {
+		if (packetsize != 0) unit = k*M*chunk_io_align_unit(w*packetsize*sizeof(long));
+		else unit = k*M*chunk_io_align_unit(w*sizeof(long));
+		newsize = ((newsize+unit-1)/unit)*unit;
+		if (buffersize != 0) buffersize = ((buffersize+unit-1)/unit)*unit;
 	}
 	
 	if (buffersize != 0) {
-		while (newsize%buffersize != 0) {
-			newsize++;
-		}
+		newsize = ((newsize+buffersize-1)/buffersize)*buffersize;
 	}
 
 
@@ -431,28 +533,66 @@ int main (int argc, char **argv) {
 	
 	stripe_size = newsize/M;
 	blocksize= stripe_size/k;
-        printf("size:%d\n", size);
-        printf("newsize:%d\n",newsize);
-	printf("stripe_size:%d\n",stripe_size);	
-	printf("blocksize:%d\n", blocksize);
-
-	/* Allow for buffersize and determine number of read-ins */
-	if (size > buffersize && buffersize != 0) {
+        printf("size:%ld\n", size);
+        printf("newsize:%ld\n",newsize);
+	printf("stripe_size:%ld\n",stripe_size);	
+	printf("blocksize:%ld\n", blocksize);
+
+	/* Allow for buffersize and determine number of read-ins.  A stream 
+	   has at least one; readins is raised as long as read-ins come back
+	   full. */
+	if (use_stdin) {
+		readins = 1;
+		block = chunk_io_alloc(sizeof(char)*buffersize);
+		chunk_mem_add(&mem, Mem_Input, sizeof(char)*buffersize);
+		blocksize = buffersize/k/M;
+	}
+	else if (size > buffersize && buffersize != 0) {
 		if (newsize%buffersize != 0) {
 			readins = newsize/buffersize;
 		}
 		else {
 			readins = newsize/buffersize;
 		}
-		block = (char *)malloc(sizeof(char)*buffersize);
-		blocksize = buffersize/k;
+		if (!use_mmap) {
+			block = chunk_io_alloc(sizeof(char)*buffersize);
+			chunk_mem_add(&mem, Mem_Input, sizeof(char)*buffersize);
+		}
+		blocksize = buffersize/k/M;
 	}
 	else {
 		readins = 1;
 		buffersize = size;
-		block = (char *)malloc(sizeof(char)*newsize);
+		if (!use_mmap) {
+			block = chunk_io_alloc(sizeof(char)*newsize);
+			chunk_mem_add(&mem, Mem_Input, sizeof(char)*newsize);
+		}
 	}
-	printf("blocksize:%d\n", blocksize);
+
+	/* Map the inputfile.  Layers that run past the end of the file are 
+	   copied once into tail and zero-padded. */
+	map = NULL;
+	tail = NULL;
+	if (use_mmap) {
+		block = NULL;
+		map = (char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+		if (map == MAP_FAILED) {
+			perror("mmap");
+			exit(1);
+		}
+		madvise(map, size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+		madvise(map, size, MADV_HUGEPAGE);
+#endif
+		tailstart = (size/(k*blocksize))*(k*blocksize);
+		/* Aligned: the data chunks of the last read-in are written 
+		   straight from it, with O_DIRECT too */
+		tail = chunk_io_alloc(sizeof(char)*(newsize-tailstart+1));
+		chunk_mem_add(&mem, Mem_Input, sizeof(char)*(newsize-tailstart+1));
+		memset(tail, 0, newsize-tailstart);
+		memcpy(tail, map+tailstart, size-tailstart);
+	}
+	printf("blocksize:%ld\n", blocksize);
 
 	/* Break inputfile name into the filename and extension */	
 	s1 = (char*)malloc(sizeof(char)*(strlen(argv[1])+20));
@@ -481,38 +621,78 @@ int main (int argc, char **argv) {
 	data = (char **)malloc(sizeof(char*)*k);
 	coding = (char **)malloc(sizeof(char*)*m);
 	for (i = 0; i < m; i++) {
-		coding[i] = (char *)malloc(sizeof(char)*blocksize);
-                if (coding[i] == NULL) { perror("malloc"); exit(1); }
+		coding[i] = chunk_io_alloc(sizeof(char)*blocksize);
+		chunk_mem_add(&mem, Mem_Coding, sizeof(char)*blocksize);
 	}
 
 
+        /* One set of layer buffers, reused by every read-in */
         fdata = (char **)malloc(sizeof(char*)*M);
-            /*for (i = 0; i < M; i++) {
-		fdata[i] = (char *)malloc(sizeof(char)*M);
-                if (fdata[i] == NULL) { perror("malloc"); exit(1); }
-	     }*/
+            for (i = 0; i < M; i++) {
+		fdata[i] = (char *)chunk_mem_alloc(&mem, Mem_Layers, sizeof(char)*k*blocksize);
+	     }
         fcoding = (char **)malloc(sizeof(char*)*M);
-            /*for (i = 0; i < M; i++) {
-		fcoding[i] = (char *)malloc(sizeof(char)*m*blocksize);
-                if (fcoding[i] == NULL) { perror("malloc"); exit(1); }
-	    }*/
+            for (i = 0; i < M; i++) {
+		fcoding[i] = (char *)chunk_mem_alloc(&mem, Mem_Layers, sizeof(char)*m*blocksize);
+	    }
 	
         ffdata = (char **)malloc(sizeof(char*)*M);
-            for (i = 0; i < M; i++) {
-		ffdata[i] = (char *)malloc(sizeof(char)*k*blocksize);
-                if (ffdata[i] == NULL) { perror("malloc"); exit(1); }
+            for (i = 0; i < M && !use_mmap; i++) {
+		ffdata[i] = (char *)chunk_mem_alloc(&mem, Mem_Uncoupled, sizeof(char)*k*blocksize);
 	     }
         ccoding = (char **)malloc(sizeof(char*)*M);
             for (i = 0; i < M; i++) {
-		ccoding[i] = (char *)malloc(sizeof(char)*m*blocksize);
-                if (ccoding[i] == NULL) { perror("malloc"); exit(1); }
+		ccoding[i] = (char *)chunk_mem_alloc(&mem, Mem_Uncoupled, sizeof(char)*m*blocksize);
 	     }
 
-        e = (char *)malloc(sizeof(char)*7);
+	/* Every chunk file starts with a header describing the whole layout.
+	   The block a read-in leaves in a chunk is stored as M sub-chunks of
+	   blocksize/M bytes, each with its own CRC32C, so that a corrupt one
+	   can be told apart. */
+	choff = (uint64_t *)chunk_mem_alloc(&mem, Mem_Meta, sizeof(uint64_t)*M);
+	chunk_header_init(&chdr, choff, Chunk_Mul, k, m, w, M, tech, packetsize, size, buffersize, blocksize/M, use_stdin ? 0 : readins);
+	if (use_stdin) chdr.flags |= CHUNK_TRAILER;
+	hbuf = chunk_io_alloc((k+m)*chdr.hdr_size);
+	chunk_mem_add(&mem, Mem_Meta, (k+m)*chdr.hdr_size);
+	for (i = 0; i < k+m; i++) {
+		chunk_header_pack(&chdr, choff, NULL, i, hbuf+i*chdr.hdr_size);
+	}
+	crccap = readins;
+	chcrc = (uint32_t *)chunk_mem_alloc(&mem, Mem_Meta, sizeof(uint32_t)*(k+m)*crccap*M);
+
+        /* uring and direct write through chunk-io.h.  The writes of one 
+           read-in are in flight while the next one is read and encoded, so
+           block and coding come in two sets, used alternately. */
+        cfd = NULL;
+        if ((use_uring || use_direct) && fp != NULL) {
+		chunk_io_init(&cio, 64, use_uring);
+		blockbuf[0] = block;
+		blockbuf[1] = NULL;
+		if (!use_mmap) {
+			blockbuf[1] = chunk_io_alloc(sizeof(char)*k*M*blocksize);
+			chunk_mem_add(&mem, Mem_Io, sizeof(char)*k*M*blocksize);
+		}
+		codingbuf[0] = coding;
+		codingbuf[1] = (char **)malloc(sizeof(char*)*m);
+		for (i = 0; i < m; i++) {
+			codingbuf[1][i] = chunk_io_alloc(sizeof(char)*blocksize);
+			chunk_mem_add(&mem, Mem_Io, sizeof(char)*blocksize);
+		}
+		cfd = (int *)malloc(sizeof(int)*(k+m));
+		for (i = 1; i <= k+m; i++) {
+			if (i <= k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, s1, md, i, extension);
+			else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, s1, md, i-k, extension);
+			cfd[i-1] = chunk_io_open(fname, O_WRONLY | O_CREAT | O_TRUNC, use_direct);
+			if (cfd[i-1] < 0) { perror(fname); exit(1); }
+			chunk_io_pwrite(&cio, cfd[i-1], hbuf+(i-1)*chdr.hdr_size, chdr.hdr_size, 0, -1);
+		}
+        }
+
+        e = (char *)chunk_mem_alloc(&mem, Mem_Scratch, sizeof(char)*7);
 	
-        extra1 = (char *)malloc(sizeof(char)*blocksize);
-	extra2 = (char *)malloc(sizeof(char)*blocksize);
-        extra3 = (char *)malloc(sizeof(char)*blocksize);
+        extra1 = (char *)chunk_mem_alloc(&mem, Mem_Scratch, sizeof(char)*blocksize);
+	extra2 = (char *)chunk_mem_alloc(&mem, Mem_Scratch, sizeof(char)*blocksize);
+        extra3 = (char *)chunk_mem_alloc(&mem, Mem_Scratch, sizeof(char)*blocksize);
 
 	/* Create coding matrix or bitmatrix and schedule */
 	timing_set(&t3);
@@ -553,30 +733,68 @@ int main (int argc, char **argv) {
 	timing_set(&start);
 	timing_set(&t4);
 	totalsec += timing_delta(&t3, &t4);
+	chunk_stage_end(&stages, Stage_Setup, 0);
 
 	
 
 	/* Read in data until finished */
 	n = 1;
 	total = 0;
+	chunk_mem_mark(&mem);
 
 	while (n <= readins) {
+		if (cfd != NULL) {
+			block = blockbuf[n%2];
+			coding = codingbuf[n%2];
+		}
 		/* Check if padding is needed, if so, add appropriate 
 		   number of zeros */
-		if (total < size && total+buffersize <= size) {
-			total += jfread(block, sizeof(char), buffersize, fp);
+		if (use_mmap) {
+			/* ffdata[j] is the uncoupled layer j, straight from the mapping.
+			   The pages of the next read-in are asked for now, so that 
+			   they are read while this one is encoded. */
+			map_advise(map, size, (long)n*buffersize, buffersize, MADV_WILLNEED);
+			for (j = 0; j < M; j++) {
+				off = (n-1)*buffersize + j*k*blocksize;
+				if (off+k*blocksize <= size) ffdata[j] = map+off;
+				else ffdata[j] = tail+(off-tailstart);
+			}
 		}
-		else if (total < size && total+buffersize > size) {
+		else if (use_stdin) {
+			/* A full read-in means there may be more; a stream that ends
+			   exactly on a read-in boundary gets no empty one */
 			extra = jfread(block, sizeof(char), buffersize, fp);
-			for (i = extra; i < buffersize; i++) {
-				block[i] = '0';
+			if (extra == 0 && n > 1) {
+				readins = n-1;
+				break;
 			}
-		}
-		else if (total == size) {
-			for (i = 0; i < buffersize; i++) {
-				block[i] = '0';
+			total += extra;
+			size = total;
+			if (extra == buffersize) readins = n+1;
+			else {
+				/* The last read-in is only as long as what is left of
+				   the stream, rounded up to unit */
+				blocksize = ((extra+unit-1)/unit)*unit/k/M;
+				if (blocksize == 0) blocksize = unit/k/M;
+				chdr.lastbs = blocksize/M;
 			}
+			memset(block+extra, 0, k*M*blocksize-extra);
+		}
+		else {
+			/* Past the end of the file the read-in is zero-padded */
+			extra = 0;
+			if (total < size) extra = jfread(block, sizeof(char), buffersize, fp);
+			total += extra;
+			memset(block+extra, 0, k*M*blocksize-extra);
 		}
+		chunk_stage_end(&stages, Stage_Read, use_mmap ? 0 : extra);
+		if (n > crccap) {
+			crccap *= 2;
+			chcrc = (uint32_t *)realloc(chcrc, sizeof(uint32_t)*(k+m)*crccap*M);
+			if (chcrc == NULL) { perror("realloc"); exit(1); }
+			chunk_mem_add(&mem, Mem_Meta, sizeof(uint32_t)*(k+m)*(crccap/2)*M);
+		}
+		rcrc = chcrc+(long)(n-1)*(k+m)*M;
 
 	        /*for(i1=0;i1<k*M;i1++){
 			printf("%d ",block[i1]);
@@ -589,15 +807,14 @@ int main (int argc, char **argv) {
 		}
                 //printf("data[0]:%p\n",data[0]);
 		timing_set(&t3);
+		chunk_stage_mark(&stages);
 
       
       //int count=0;
       /* Encode according to coding method */
       for(j=0;j<M;j++){
-            fcoding[j] = (char *)malloc(sizeof(char)*m*blocksize);
-            fdata[j] = (char *)malloc(sizeof(char)*k*blocksize); 
             for (i = 0; i < k; i++) {
-		 data[i] = block+((j*k+i)*blocksize);}
+		 data[i] = (use_mmap ? ffdata[j]+i*blocksize : block+((j*k+i)*blocksize));}
                  //printf("data[0]:%p\n",data[0]);
                  //printf("data[0][0]:%d\n",&data[0][0]);
 		switch(tech) {	
@@ -605,7 +822,6 @@ int main (int argc, char **argv) {
 				break;
 			case Reed_Sol_Van:
 				jerasure_matrix_encode(k, m, w, matrix, data, coding, blocksize);
-				printf("coding[m-1][blocksize-1]:%d\n",coding[0][blocksize-2]);
                                 //printf("coding[0]:%d\n",coding[0]);
                                 //printf("coding[1]:%d\n",coding[1]);
 				break;
@@ -631,6 +847,12 @@ int main (int argc, char **argv) {
 			case EVENODD:
 				assert(0);
 		}
+		chunk_stage_end(&stages, Stage_Mds, k*blocksize);
+		/* The last layer is the one written out */
+		if (j == M-1) {
+			for (i = 0; i < k; i++) block_crc(rcrc, i, data[i], blocksize);
+			for (i = 0; i < m; i++) block_crc(rcrc, k+i, coding[i], blocksize);
+		}
                 //printf("w:%d\n",w);
                 //printf("Encoding Complete:\n\n");
                 //print_data_and_coding(k, m, w, sizeof(long), data, coding);
@@ -653,13 +875,14 @@ int main (int argc, char **argv) {
              //}
 
              for(i=0;i<k*blocksize;i++)
-             {fdata[j][i] = *(block+j*k*blocksize+i);}   
+             {fdata[j][i] = data[0][i];}   
+             chunk_stage_end(&stages, Stage_Copy, (k+m)*blocksize);
 
       }
  
       /*transformation*/
       //k=0,1
-        for(i=0;i<M;i++){
+        for(i=0;i<M && !use_mmap;i++){
             for(j=0;j<k*blocksize;j++){
               ffdata[i][j]=fdata[i][j];
             }
@@ -669,6 +892,7 @@ int main (int argc, char **argv) {
               ccoding[i][j]=fcoding[i][j];
             }
         }
+        chunk_stage_end(&stages, Stage_Copy, (uint64_t) (use_mmap ? m : k+m)*M*blocksize);
 
         for(i=0;i<7;i++){
                e[0]=20; e[1]=18;e[2]=17;e[3]=16;e[4]=15;e[5]=13;e[6]=167;}
@@ -718,7 +942,7 @@ int main (int argc, char **argv) {
            galois_region_xor(fdata[3]+i1,fdata[2]+blocksize+i1,1);;
 	     	   }*/
         
-        /*galois_w08_region_multiply((ffdata[2]+1*blocksize),e[0],blocksize,(ffdata[2]+1*blocksize), 0);
+        /*coupling_region_multiply((ffdata[2]+1*blocksize),e[0],blocksize,(ffdata[2]+1*blocksize), 0, cw);
         for(i1=0;i1<blocksize;i1++){
            galois_region_xor(ffdata[2]+1*blocksize+i1,fdata[3]+i1, 1);}
 
@@ -746,10 +970,7 @@ int main (int argc, char **argv) {
 	     	   }
 	        }
                if(j%2==0 && i%2!=0){ 
-                   galois_w08_region_multiply((ffdata[i-1]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-1]+(j+1)*blocksize), 0);
-                   for(i1=0;i1<blocksize;i1++){
-		   galois_region_xor(ffdata[i-1]+(j+1)*blocksize+i1,fdata[i]+j*blocksize+i1, 1);
-		   }
+                   coupling_region_multiply(ffdata[i-1]+(j+1)*blocksize,e[j/2],blocksize,fdata[i]+j*blocksize, 1, cw);
                }
            }
         } 
@@ -762,10 +983,7 @@ int main (int argc, char **argv) {
 	     	   }
 	        }
               if(j%2==0 && (i/2==1 || i/2==3)){ 
-                   galois_w08_region_multiply((ffdata[i-2]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-2]+(j+1)*blocksize), 0);
-                   for(i1=0;i1<blocksize;i1++){
-		   galois_region_xor(ffdata[i-2]+(j+1)*blocksize+i1,fdata[i]+j*blocksize+i1, 1);
-		   }
+                   coupling_region_multiply(ffdata[i-2]+(j+1)*blocksize,e[j/2],blocksize,fdata[i]+j*blocksize, 1, cw);
                }
            }
         } 
@@ -779,10 +997,7 @@ int main (int argc, char **argv) {
 	     	   }
 	        }
               if(j%2==0 && i/4==1){ 
-                   galois_w08_region_multiply((ffdata[i-4]+(j+1)*blocksize),e[j/2],blocksize,(ffdata[i-4]+(j+1)*blocksize), 0);
-                   for(i1=0;i1<blocksize;i1++){
-		   galois_region_xor(ffdata[i-4]+(j+1)*blocksize+i1,fdata[i]+j*blocksize+i1, 1);
-		   }
+                   coupling_region_multiply(ffdata[i-4]+(j+1)*blocksize,e[j/2],blocksize,fdata[i]+j*blocksize, 1, cw);
                }
            }
         } 
@@ -796,13 +1011,12 @@ int main (int argc, char **argv) {
 	     	   }
 	        }
               if(j%2==0 && i/4==1){ 
-                   galois_w08_region_multiply((ccoding[i-4]+(j+1)*blocksize),e[j/2],blocksize,(ccoding[i-4]+(j+1)*blocksize), 0);
-                   for(i1=0;i1<blocksize;i1++){
-		   galois_region_xor(ccoding[i-4]+(j+1)*blocksize+i1,fcoding[i]+j*blocksize+i1, 1);
-		   }
+                   coupling_region_multiply(ccoding[i-4]+(j+1)*blocksize,e[j/2],blocksize,fcoding[i]+j*blocksize, 1, cw);
                }
            }
         } 
+        timing_set(&t4);
+        chunk_stage_end(&stages, Stage_Couple, (uint64_t) (k+m)*M*blocksize);
         
         /*printf("transformation_fdata_c4_8/c0_9\n");
         printf("%p\n ",&fdata[0][0]);
@@ -930,7 +1144,7 @@ int main (int argc, char **argv) {
                 for(j=0;j<M;j++){
                       printf("%d ",fdata[3][j]);}
                    printf("\n");
-                galois_w08_region_multiply(fdata[2]+blocksize,2,blocksize,fdata[3], 0);    
+                coupling_region_multiply(fdata[2]+blocksize,2,blocksize,fdata[3], 0, cw);    
                 printf("after mul(fdata[0]+blocksize,extra3):\n");
                 for(j=0;j<M;j++)
                    {printf("%d ",fdata[2][blocksize+j]);}
@@ -948,54 +1162,27 @@ int main (int argc, char **argv) {
             printf("%d ",fdata[0][0]);
             printf("%d ",&ffdata[0][0]);
             printf("%d ",&fdata[0][0]);*/
-//test  region_multiply/xor/w8_xor
-         char **a;
-         char **b;
-         int *c;
-         a = (char **)malloc(sizeof(char*)*2);
-         for (i = 0; i < 2; i++) {
-		a[i] = (char *)malloc(sizeof(char)*3);
-                if (a[i] == NULL) { perror("malloc"); exit(1); }
-	 }
-        b = (char **)malloc(sizeof(char*)*2);
-        for (i = 0; i < 2; i++) {
-		b[i] = (char *)malloc(sizeof(char)*3);
-                if (b[i] == NULL) { perror("malloc"); exit(1); }
-	}
-        c = (char *)malloc(sizeof(char)*3);
-
-        a[0][0]=1;a[0][1]=2;a[0][2]=3;
-        a[1][0]=1;a[1][1]=1;a[1][2]=2;
 
-        c[0]=1;c[1]=4;c[2]=3;
-        
-       //galois_region_xor(a[0],a[1],3);
-       galois_w8_region_xor(a[0],a[1],3);
-       for(i1=0;i1<2;i1++){
-            for(j=0;j<3;j++){
-            printf("%d ",a[i1][j]);
-           }
-          printf("\n");
-       }
-
-      /*for(i=0;i<3;i++){
-        galois_w08_region_multiply(a[0],c[i],3,b[0],0);
-        galois_w08_region_multiply(a[1],c[i],3,b[1],0);
-          for(i1=0;i1<2;i1++){
-            for(j=0;j<3;j++){
-            printf("%d ",b[i1][j]);
-           }
-          }
-         printf("\n");
-        }*/
 		/* Write data and encoded data to k+m files */
-		for	(i = 1; i <= k; i++) {
+		if (cfd != NULL) {
+			/* Reap the previous read-in, then queue this one as one batch */
+			chunk_io_done(&cio, "Writing the chunks");
+			for (i = 0; i < k; i++) {
+				chunk_io_pwrite(&cio, cfd[i], data[i], blocksize, chdr.hdr_size+(off_t)(n-1)*M*chdr.blocksize, -1);
+			}
+			for (i = 0; i < m; i++) {
+				chunk_io_pwrite(&cio, cfd[k+i], coding[i], blocksize, chdr.hdr_size+(off_t)(n-1)*M*chdr.blocksize, -1);
+			}
+			chunk_io_submit(&cio);
+		}
+		for	(i = 1; i <= k && cfd == NULL; i++) {
 			if (fp == NULL) {
 				bzero(data[i-1], blocksize);
  			} else {
 				sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, s1, md, i, extension);
 				if (n == 1) {
 					fp2 = fopen(fname, "wb");
+					fwrite(hbuf+(i-1)*chdr.hdr_size, sizeof(char), chdr.hdr_size, fp2);
 				}
 				else {
 					fp2 = fopen(fname, "ab");
@@ -1005,13 +1192,14 @@ int main (int argc, char **argv) {
 			}
 			
 		}
-		for	(i = 1; i <= m; i++) {
+		for	(i = 1; i <= m && cfd == NULL; i++) {
 			if (fp == NULL) {
 				bzero(data[i-1], blocksize);
  			} else {
 				sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, s1, md, i, extension);
 				if (n == 1) {
 					fp2 = fopen(fname, "wb");
+					fwrite(hbuf+(k+i-1)*chdr.hdr_size, sizeof(char), chdr.hdr_size, fp2);
 				}
 				else {
 					fp2 = fopen(fname, "ab");
@@ -1020,29 +1208,75 @@ int main (int argc, char **argv) {
 				fclose(fp2);
 			}
 		}
+		chunk_stage_end(&stages, Stage_Write, (k+m)*blocksize);
+		stages.readins++;
+		/* Only the read-in in hand and the next one stay resident */
+		if (use_mmap) map_advise(map, size, (long)(n-1)*buffersize, buffersize, MADV_DONTNEED);
 		n++;
 		/* Calculate encoding time */
 		totalsec += timing_delta(&t3, &t4);
 	}
-
-	/* Create metadata file */
-        if (fp != NULL) {
-		sprintf(fname, "%s/Coding/%s_meta.txt", curdir, s1);
-		fp2 = fopen(fname, "wb");
-		fprintf(fp2, "%s\n", argv[1]);
-		fprintf(fp2, "%d\n", size);
-		fprintf(fp2, "%d %d %d %d %d\n", k, m, w, packetsize, buffersize);
-		fprintf(fp2, "%s\n", argv[4]);
-		fprintf(fp2, "%d\n", tech);
-		fprintf(fp2, "%d\n", readins);
-		fclose(fp2);
+	chunk_mem_mark_end(&mem);
+
+	/* The CRCs are known now: rewrite the headers with them, or for a 
+	   stream append them with the size as a trailer */
+	fcrc = (uint32_t *)chunk_mem_alloc(&mem, Mem_Meta, sizeof(uint32_t)*readins*M);
+	tlen = chunk_trailer_size(&chdr, readins);
+	tbuf = (char *)chunk_mem_alloc(&mem, Mem_Meta, sizeof(char)*(k+m)*tlen);
+	for (i = 0; i < k+m; i++) {
+		chunk_crc_gather(chcrc, k+m, M, readins, i, fcrc);
+		if (use_stdin) chunk_trailer_pack(&chdr, fcrc, size, readins, tbuf+i*tlen);
+		else chunk_header_pack(&chdr, choff, fcrc, i, hbuf+i*chdr.hdr_size);
 	}
-
+	if (cfd != NULL) {
+		chunk_io_done(&cio, "Writing the chunks");
+		for (i = 0; i < k+m; i++) {
+			if (use_stdin) {
+				chunk_io_undirect(cfd[i]);
+				chunk_io_pwrite(&cio, cfd[i], tbuf+i*tlen, tlen, chdr.hdr_size+chunk_data_size(&chdr, readins), -1);
+			}
+			else chunk_io_pwrite(&cio, cfd[i], hbuf+i*chdr.hdr_size, chdr.hdr_size, 0, -1);
+		}
+		chunk_io_done(&cio, "Writing the chunk headers");
+		chunk_io_exit(&cio);
+		for (i = 0; i < k+m; i++) close(cfd[i]);
+	}
+	else if (fp != NULL) {
+		for (i = 0; i < k+m; i++) {
+			if (i < k) sprintf(fname, "%s/Coding/%s_k%0*d%s", curdir, s1, md, i+1, extension);
+			else sprintf(fname, "%s/Coding/%s_m%0*d%s", curdir, s1, md, i-k+1, extension);
+			if (use_stdin) {
+				fp2 = fopen(fname, "ab");
+				fwrite(tbuf+i*tlen, sizeof(char), tlen, fp2);
+			}
+			else {
+				fp2 = fopen(fname, "r+b");
+				fwrite(hbuf+i*chdr.hdr_size, sizeof(char), chdr.hdr_size, fp2);
+			}
+			fclose(fp2);
+		}
+	}
+	chunk_stage_end(&stages, Stage_Write, 0);
+	free(fcrc);
+	free(tbuf);
 
 	/* Free allocated memory */
 	free(s1);
 	free(fname);
+	if (cfd != NULL) {
+		block = blockbuf[0];
+		free(blockbuf[1]);
+		for (i = 0; i < m; i++) free(codingbuf[1][i]);
+		free(codingbuf[1]);
+	}
 	free(block);
+	free(choff);
+	free(hbuf);
+	free(chcrc);
+	if (use_mmap) {
+		munmap(map, size);
+		free(tail);
+	}
 	free(curdir);
 	
 	/* Calculate rate in MB/sec and print */
@@ -1050,6 +1284,8 @@ int main (int argc, char **argv) {
 	tsec = timing_delta(&t1, &t2);
 	printf("Encoding (MB/sec): %0.10f\n", (((double) size)/1024.0/1024.0)/totalsec);
 	printf("En_Total (MB/sec): %0.10f\n", (((double) size)/1024.0/1024.0)/tsec);
+	chunk_stage_report(&stages, stdout, "mul-encoder", size);
+	chunk_mem_report(&mem, stdout, "mul-encoder", (uint64_t) k*M*M*chdr.blocksize, readins);
 
 	return 0;
 }